@@ -5382,8 +5382,26 @@ namespace blaze {}
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
 //
-// So far the \b Blaze library does not (yet) automatically initialize dynamic memory according
-// to the first touch principle. Consider for instance the following vector triad example:
+// On ccNUMA architectures the operating system places each memory page in the locality domain
+// (LD) of the thread that writes to it for the first time. The \b Blaze library takes this first
+// touch principle into account whenever it initializes the elements of a DynamicVector or
+// DynamicMatrix itself: In case the BLAZE_USE_PARALLEL_INITIALIZATION switch in the configuration
+// file <em>./blaze/config/NUMA.h</em> is activated (by default it is deactivated), the homogeneous
+// initialization of large vectors and matrices is split into the same parts as a subsequent
+// parallel assignment and is executed in parallel:
+
+   \code
+   // Parallel initialization of all elements (in case the parallel initialization is activated)
+   blaze::DynamicVector<double> a( 1000000UL, 0.0 );
+   \endcode
+
+// The parallel initialization is skipped in case only a single thread is available or in case
+// the vector or matrix is created within a parallel operation. Since it only pays off on
+// systems with several NUMA nodes, it is recommended to activate the switch (for instance via
+// the \c -DBLAZE_USE_PARALLEL_INITIALIZATION=1 command line argument) only on these systems.
+
+// However, \b Blaze cannot control the initialization performed by the user. Consider for
+// instance the following vector triad example:
 
    \code
    using blaze::columnVector;
@@ -5431,6 +5449,13 @@ namespace blaze {}
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+// Alternatively, the BLAZE_USE_NUMA_INTERLEAVING switch in the configuration file
+// <em>./blaze/config/NUMA.h</em> can be activated. In this case the memory pages of all large
+// vectors and matrices are distributed round-robin across all LDs, independent of the thread
+// that touches them first. This does not achieve the same locality as a properly initialized
+// data structure, but reliably uses the memory bandwidth of all LDs. Please note that the
+// interleaving is only available on Linux systems.
+//
 //
 // \n \section openmp_limitations Limitations of the OpenMP Parallelization
 // <hr>
@@ -5621,6 +5646,13 @@ namespace blaze {}
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the C++11 thread parallelization.
 //
+// On ccNUMA architectures it is additionally possible to bind the worker threads to individual
+// CPUs by means of the BLAZE_USE_THREAD_PINNING switch in the configuration file
+// <em>./blaze/config/SMP.h</em>. In this case the i-th worker thread is bound to the i-th CPU
+// the process is allowed to run on. Thus the threads cannot be migrated away from the memory
+// they have initialized (see also \ref openmp_first_touch). The set of CPUs can be restricted
+// via the usual system tools, as for instance \c taskset or \c numactl.
+//
 //
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
@@ -6194,6 +6226,30 @@ namespace blaze {}
 // the OpenMP-based parallelization, are contained within the configuration file
 // <em>./blaze/config/Thresholds.h</em>.
 //
+// The Blaze benchmark suite provides the \c thresholds calibration tool (<tt>make thresholds</tt>
+// in the \c blazemark directory), which measures the crossover points between the Blaze and the
+// BLAS kernels and between the serial and parallel execution of the dense operations on the
+// current machine. It writes a replacement for <em>./blaze/config/Thresholds.h</em> and a tuning
+// file for the runtime thresholds. In case the \c BLAZE_USE_RUNTIME_THRESHOLDS switch in the
+// configuration file <em>./blaze/config/Tuning.h</em> is activated, the thresholds are not
+// compile time constants anymore, but are loaded from such a tuning file upon first use:
+
+   \code
+   // Loading the tuning file specified by the BLAZE_THRESHOLDS_FILE environment variable or,
+   // if not set, the file "blaze.thresholds" in the current working directory
+   blaze::DynamicVector<double> a( 100000UL ), b( 100000UL ), c;
+   c = a + b;
+
+   // Explicitly loading a tuning file and adapting a single threshold
+   blaze::loadThresholds( "epyc.thresholds" );
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 20000UL );
+   \endcode
+
+// Please note that the runtime thresholds are plain values without any synchronization. They
+// are read by every thread that evaluates an operation and therefore must be set before any
+// parallel evaluation is started (for instance at the beginning of the \c main() function).
+// In particular, neither loadThresholds() nor setThreshold() must be called while another
+// thread evaluates an operation or while an asynchronous assignment is still pending.
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
 //
@@ -42,11 +42,15 @@
 
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompactDiagonalMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DuplicatePolicy.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
@@ -55,14 +59,20 @@
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/Quaternion.h>
 #include <blaze/math/RotationMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/Solvers.h>
+#include <blaze/math/SplitCompressedMatrix.h>
+#include <blaze/math/SplitCompressedVector.h>
 #include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/math/StaticVectorBatch.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
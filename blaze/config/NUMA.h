@@ -0,0 +1,106 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/NUMA.h
+//  \brief Configuration of the NUMA-aware memory allocation and initialization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-interleaved allocation of large arrays.
+// \ingroup config
+//
+// This compilation switch enables/disables the interleaved allocation of large arrays on NUMA
+// systems. In case the switch is set to 1, the memory pages of all arrays that are at least
+// numaInterleavingThreshold bytes large (see below) are distributed round-robin across all
+// NUMA nodes the process is allowed to allocate from. This guarantees that memory-bound
+// operations on large vectors and matrices can use the memory bandwidth of all sockets,
+// independent of the thread that first touches the memory. In case the switch is set to 0,
+// the operating system places each memory page on the NUMA node of the thread that touches it
+// first (see also the BLAZE_USE_PARALLEL_INITIALIZATION switch).
+//
+// Possible settings for the NUMA interleaving switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Note that the interleaving is only available on Linux systems and is ignored on all other
+// systems and on systems with a single NUMA node.
+*/
+#define BLAZE_USE_NUMA_INTERLEAVING 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum size of an interleaved array.
+// \ingroup config
+//
+// This setting specifies the minimum size in Byte of an array to be distributed across all
+// NUMA nodes in case the BLAZE_USE_NUMA_INTERLEAVING switch is activated. Smaller arrays are
+// allocated as usual. Since interleaved arrays are allocated with page alignment, the setting
+// should be considerably larger than the page size. For instance, a threshold of 4 MiByte must
+// be specified as 4194304.
+*/
+const size_t numaInterleavingThreshold = 4194304UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel initialization of dense vectors and matrices.
+// \ingroup config
+//
+// This compilation switch enables/disables the parallel initialization of large dense vectors
+// and matrices. In case the switch is set to 1 and the shared-memory parallelization is active,
+// the homogeneous initialization of a DynamicVector or DynamicMatrix and the initialization of
+// the padding elements of a DynamicMatrix are split into the same parts as a subsequent SMP
+// assignment of the same size (see the SMP_DVECASSIGN_THRESHOLD and SMP_DMATASSIGN_THRESHOLD
+// thresholds in the configuration file <tt>./blaze/config/Thresholds.h</tt>). Since the
+// operating system places each memory page on the NUMA node of the thread that touches it
+// first, the memory of the vector or matrix is thus distributed across the NUMA nodes of all
+// participating threads. In case the switch is set to 0, all elements are initialized by the
+// calling thread. Note that the parallel initialization only pays off on NUMA systems in case
+// the vector or matrix is subsequently processed by parallel operations of the same size. On
+// systems with a single NUMA node the overhead of the parallel initialization usually exceeds
+// its benefit.
+//
+// Possible settings for the parallel initialization switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Note that in contrast to the other settings this switch can also be specified via the command
+// line (for instance via \c -DBLAZE_USE_PARALLEL_INITIALIZATION=1), which takes precedence over
+// this setting.
+*/
+#ifndef BLAZE_USE_PARALLEL_INITIALIZATION
+#define BLAZE_USE_PARALLEL_INITIALIZATION 0
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
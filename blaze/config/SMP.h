@@ -51,4 +51,48 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing task scheduler.
+// \ingroup config
+//
+// This compilation switch selects the thread pool of the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 0, all tasks are managed by a single task queue
+// protected by a mutex (see the ThreadPool class template). In case the switch is set to 1, the
+// tasks are managed by a work-stealing scheduler with lock-free per-worker deques, worker threads
+// that spin for a short while before they sleep, and a fork/join barrier in which the calling
+// thread takes part in the execution (see the WorkStealingPool class template). Due to the
+// considerably lower scheduling and wake-up latency the work-stealing scheduler especially
+// pays off for operations slightly above the SMP thresholds (see the configuration file
+// <tt>./blaze/config/Thresholds.h</tt>), which therefore can be lowered accordingly. Note
+// that the switch has no effect on the OpenMP-based parallelization.
+//
+// Possible settings for the work-stealing switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_WORK_STEALING 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the pinning of the worker threads.
+// \ingroup config
+//
+// This compilation switch enables/disables the pinning of the worker threads of the C++11 and
+// Boost thread-based parallelization. In case the switch is set to 1, the i-th worker thread
+// is bound to the i-th CPU the process is allowed to run on (see for instance \c taskset or
+// \c numactl) and therefore always works on the memory of the same NUMA node. In case the
+// switch is set to 0, the operating system is free to migrate the worker threads between
+// all available CPUs. Note that the switch only has an effect on Linux systems and has no
+// effect on the OpenMP-based parallelization, whose threads can be pinned via the
+// \c OMP_PROC_BIND and \c OMP_PLACES environment variables.
+//
+// Possible settings for the thread pinning switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_THREAD_PINNING 0
+//*************************************************************************************************
+
 } // namespace blaze
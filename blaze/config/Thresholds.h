@@ -1202,4 +1202,75 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP batch assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment to a batch of small matrices or vectors (as for
+// instance StaticMatrixBatch or StaticVectorBatch) can be executed in parallel. In case the
+// number of members of the target batch is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of batch members is below this threshold the operation
+// is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 4000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_BATCHASSIGN_THRESHOLD = 4000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP triplet assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a compressed matrix from unsorted (row, column,
+// value) triplets can be executed in parallel. In case the number of triplets is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of triplets is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 50000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_TRIPLETASSEMBLY_THRESHOLD = 50000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This threshold specifies when the rows of a level of a level-scheduled sparse triangular solve
+// can be computed in parallel. In case the number of rows of a level is larger or equal to this
+// threshold, the rows of the level are distributed among the threads. If the number of rows is
+// below this threshold the level is computed single-threaded. Additionally, triangular systems
+// with less rows than this threshold are solved completely single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 2000. In case the threshold is set to 0, all levels
+// are unconditionally computed in parallel.
+*/
+const size_t SMP_TRIANGULARSOLVE_THRESHOLD = 2000UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -0,0 +1,77 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Tuning.h
+//  \brief Configuration of the runtime thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime thresholds.
+// \ingroup config
+//
+// This compilation switch selects how the thresholds of the Blaze library (see the configuration
+// file <tt>./blaze/config/Thresholds.h</tt>) are provided. In case the switch is set to 0, all
+// thresholds are compile time constants. In case the switch is set to 1, the values given in
+// <tt>./blaze/config/Thresholds.h</tt> only serve as defaults. Upon first use the thresholds
+// are loaded from the tuning file specified by the \c BLAZE_THRESHOLDS_FILE environment variable
+// or, in case the environment variable is not set, from the file specified by the
+// BLAZE_THRESHOLDS_FILE setting below. Additionally, the thresholds can be adapted via the
+// loadThresholds() and setThreshold() functions. A tuning file for the current machine can be
+// created by the \c thresholds calibration tool of the Blaze benchmark suite. Note that the
+// runtime thresholds are not synchronized and therefore must be set before any parallel
+// evaluation is started.
+//
+// Possible settings for the runtime thresholds switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Note that in contrast to the other settings this switch can also be specified via the command
+// line (for instance via \c -DBLAZE_USE_RUNTIME_THRESHOLDS=1), which takes precedence over this
+// setting.
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default tuning file for the runtime thresholds.
+// \ingroup config
+//
+// This setting specifies the tuning file the thresholds are loaded from in case the runtime
+// thresholds are activated (see the BLAZE_USE_RUNTIME_THRESHOLDS switch) and the
+// \c BLAZE_THRESHOLDS_FILE environment variable is not set. Relative paths are interpreted
+// relative to the working directory of the program. In case the file does not exist, the
+// default thresholds are used.
+*/
+#define BLAZE_THRESHOLDS_FILE "blaze.thresholds"
+//*************************************************************************************************
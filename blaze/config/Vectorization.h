@@ -38,12 +38,12 @@
 // \ingroup config
 //
 // This compilation switch enables/disables vectorization of mathematical expressions via
-// the SSE, AVX, and/or MIC instruction sets. In case the switch is set to 1 (i.e. in case
-// vectorization is enabled), the Blaze library attempts to vectorize the linear algebra
-// operations by SSE, AVX, and/or MIC intrinsics (depending on which instruction set is
-// available on the target platform). In case the switch is set to 0 (i.e. vectorization
-// is disabled), the Blaze library chooses default, non-vectorized functionality for the
-// operations. Note that deactivating the vectorization may pose a severe performance
+// the SSE, AVX, AVX-512, and/or MIC instruction sets. In case the switch is set to 1 (i.e.
+// in case vectorization is enabled), the Blaze library attempts to vectorize the linear
+// algebra operations by SSE, AVX, AVX-512, and/or MIC intrinsics (depending on which
+// instruction set is available on the target platform). In case the switch is set to 0 (i.e.
+// vectorization is disabled), the Blaze library chooses default, non-vectorized functionality
+// for the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
 // Possible settings for the vectorization switch:
@@ -52,3 +52,42 @@
 */
 #define BLAZE_USE_VECTORIZATION 1
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of the dense kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of several performance
+// critical dense kernels. By default, the instruction set used by the Blaze library is
+// selected at compile time (i.e. depending on the compiler flags such as \c -mavx or
+// \c -mavx2). In case the switch is set to 1, the following kernels for \c float and
+// \c double operands are in addition compiled for the SSE2, AVX, AVX2/FMA, and AVX-512
+// instruction sets and the best variant for the executing CPU is selected once at program
+// startup:
+//
+//  - the large dense matrix/dense matrix multiplication kernel
+//  - the large dense matrix/dense vector and dense vector/dense matrix multiplication kernels
+//  - the dense vector inner product
+//  - the dense vector addition, subtraction, componentwise multiplication, and scaling
+//
+// This enables the distribution of a single binary (compiled for instance for SSE2) that
+// still takes advantage of the full SIMD width of the executing CPU. The runtime dispatch
+// is only available for the GNU compiler (version 5 or higher) on x86 platforms and is
+// ignored in case the vectorization is deactivated. In case the BLAS mode is active, the
+// BLAS kernels take precedence over the dispatched kernels. Note that the dispatched kernels
+// are part of the Blaze library and that changing the setting of the switch requires a
+// recompilation of the Blaze library.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// The switch can also be set via the command line (e.g. \c -DBLAZE_USE_RUNTIME_DISPATCH=1),
+// which overrides this setting. In this case the same setting has to be used for both the
+// Blaze library and the application.
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
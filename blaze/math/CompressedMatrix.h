@@ -43,6 +43,7 @@
 #include <cmath>
 #include <stdexcept>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Reordering.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/SparseMatrix.h>
 #include <blaze/system/Precision.h>
@@ -64,22 +65,23 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of CompressedMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-class Rand< CompressedMatrix<Type,SO> >
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+class Rand< CompressedMatrix<Type,SO,Index> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n ) const;
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros ) const;
+   inline const CompressedMatrix<Type,SO,Index> generate( size_t m, size_t n ) const;
+   inline const CompressedMatrix<Type,SO,Index> generate( size_t m, size_t n, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const CompressedMatrix<Type,SO,Index> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros,
+   inline const CompressedMatrix<Type,SO,Index> generate( size_t m, size_t n, size_t nonzeros,
                                                     const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
@@ -87,14 +89,14 @@ class Rand< CompressedMatrix<Type,SO> >
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( CompressedMatrix<Type,SO>& matrix ) const;
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros ) const;
+   inline void randomize( CompressedMatrix<Type,SO,Index>& matrix ) const;
+   inline void randomize( CompressedMatrix<Type,SO,Index>& matrix, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedMatrix<Type,SO,Index>& matrix, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros,
+   inline void randomize( CompressedMatrix<Type,SO,Index>& matrix, size_t nonzeros,
                           const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
@@ -111,12 +113,13 @@ class Rand< CompressedMatrix<Type,SO> >
 // \param n The number of columns of the random matrix.
 // \return The generated random matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+inline const CompressedMatrix<Type,SO,Index>
+   Rand< CompressedMatrix<Type,SO,Index> >::generate( size_t m, size_t n ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,Index> matrix( m, n );
    randomize( matrix );
 
    return matrix;
@@ -135,15 +138,16 @@ inline const CompressedMatrix<Type,SO>
 // \return The generated random matrix.
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+inline const CompressedMatrix<Type,SO,Index>
+   Rand< CompressedMatrix<Type,SO,Index> >::generate( size_t m, size_t n, size_t nonzeros ) const
 {
    if( nonzeros > m*n )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,Index> matrix( m, n );
    randomize( matrix, nonzeros );
 
    return matrix;
@@ -162,13 +166,14 @@ inline const CompressedMatrix<Type,SO>
 // \return The generated random matrix.
 // \param max The largest possible value for a matrix element.
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+template< typename Arg >    // Min/max argument type
+inline const CompressedMatrix<Type,SO,Index>
+   Rand< CompressedMatrix<Type,SO,Index> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,Index> matrix( m, n );
    randomize( matrix, min, max );
 
    return matrix;
@@ -189,17 +194,18 @@ inline const CompressedMatrix<Type,SO>
 // \return The generated random matrix.
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros,
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+template< typename Arg >    // Min/max argument type
+inline const CompressedMatrix<Type,SO,Index>
+   Rand< CompressedMatrix<Type,SO,Index> >::generate( size_t m, size_t n, size_t nonzeros,
                                                 const Arg& min, const Arg& max ) const
 {
    if( nonzeros > m*n )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,Index> matrix( m, n );
    randomize( matrix, nonzeros, min, max );
 
    return matrix;
@@ -215,9 +221,10 @@ inline const CompressedMatrix<Type,SO>
 // \param matrix The matrix to be randomized.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+inline void Rand< CompressedMatrix<Type,SO,Index> >::randomize( CompressedMatrix<Type,SO,Index>& matrix ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -246,9 +253,10 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \return void
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+inline void Rand< CompressedMatrix<Type,SO,Index> >::randomize( CompressedMatrix<Type,SO,Index>& matrix, size_t nonzeros ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -278,10 +286,11 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \param max The largest possible value for a matrix element.
 // \return void
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix,
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+template< typename Arg >    // Min/max argument type
+inline void Rand< CompressedMatrix<Type,SO,Index> >::randomize( CompressedMatrix<Type,SO,Index>& matrix,
                                                           const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
@@ -313,10 +322,11 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \return void
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix,
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the matrix
+template< typename Arg >    // Min/max argument type
+inline void Rand< CompressedMatrix<Type,SO,Index> >::randomize( CompressedMatrix<Type,SO,Index>& matrix,
                                                           size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
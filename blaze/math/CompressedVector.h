@@ -63,36 +63,37 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of CompressedVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-class Rand< CompressedVector<Type,TF> >
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+class Rand< CompressedVector<Type,TF,Index> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const CompressedVector<Type,TF> generate( size_t size ) const;
-   inline const CompressedVector<Type,TF> generate( size_t size, size_t nonzeros ) const;
+   inline const CompressedVector<Type,TF,Index> generate( size_t size ) const;
+   inline const CompressedVector<Type,TF,Index> generate( size_t size, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline const CompressedVector<Type,TF> generate( size_t size, const Arg& min, const Arg& max ) const;
+   inline const CompressedVector<Type,TF,Index> generate( size_t size, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline const CompressedVector<Type,TF> generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   inline const CompressedVector<Type,TF,Index> generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( CompressedVector<Type,TF>& vector ) const;
-   inline void randomize( CompressedVector<Type,TF>& vector, size_t nonzeros ) const;
+   inline void randomize( CompressedVector<Type,TF,Index>& vector ) const;
+   inline void randomize( CompressedVector<Type,TF,Index>& vector, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedVector<Type,TF>& vector, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedVector<Type,TF,Index>& vector, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedVector<Type,TF>& vector, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedVector<Type,TF,Index>& vector, size_t nonzeros, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -107,12 +108,13 @@ class Rand< CompressedVector<Type,TF> >
 // \param size The size of the random vector.
 // \return The generated random vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+inline const CompressedVector<Type,TF,Index>
+   Rand< CompressedVector<Type,TF,Index> >::generate( size_t size ) const
 {
-   CompressedVector<Type,TF> vector( size );
+   CompressedVector<Type,TF,Index> vector( size );
    randomize( vector );
 
    return vector;
@@ -130,15 +132,16 @@ inline const CompressedVector<Type,TF>
 // \return The generated random vector.
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, size_t nonzeros ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+inline const CompressedVector<Type,TF,Index>
+   Rand< CompressedVector<Type,TF,Index> >::generate( size_t size, size_t nonzeros ) const
 {
    if( nonzeros > size )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedVector<Type,TF> vector( size, nonzeros );
+   CompressedVector<Type,TF,Index> vector( size, nonzeros );
    randomize( vector, nonzeros );
 
    return vector;
@@ -156,13 +159,14 @@ inline const CompressedVector<Type,TF>
 // \param max The largest possible value for a vector element.
 // \return The generated random vector.
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+template< typename Arg >    // Min/max argument type
+inline const CompressedVector<Type,TF,Index>
+   Rand< CompressedVector<Type,TF,Index> >::generate( size_t size, const Arg& min, const Arg& max ) const
 {
-   CompressedVector<Type,TF> vector( size );
+   CompressedVector<Type,TF,Index> vector( size );
    randomize( vector, min, max );
 
    return vector;
@@ -182,16 +186,17 @@ inline const CompressedVector<Type,TF>
 // \return The generated random vector.
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+template< typename Arg >    // Min/max argument type
+inline const CompressedVector<Type,TF,Index>
+   Rand< CompressedVector<Type,TF,Index> >::generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    if( nonzeros > size )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedVector<Type,TF> vector( size, nonzeros );
+   CompressedVector<Type,TF,Index> vector( size, nonzeros );
    randomize( vector, nonzeros, min, max );
 
    return vector;
@@ -207,9 +212,10 @@ inline const CompressedVector<Type,TF>
 // \param vector The vector to be randomized.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+inline void Rand< CompressedVector<Type,TF,Index> >::randomize( CompressedVector<Type,TF,Index>& vector ) const
 {
    const size_t size( vector.size() );
 
@@ -237,9 +243,10 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \return void
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector, size_t nonzeros ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+inline void Rand< CompressedVector<Type,TF,Index> >::randomize( CompressedVector<Type,TF,Index>& vector, size_t nonzeros ) const
 {
    const size_t size( vector.size() );
 
@@ -268,10 +275,11 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \param max The largest possible value for a vector element.
 // \return void
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector,
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+template< typename Arg >    // Min/max argument type
+inline void Rand< CompressedVector<Type,TF,Index> >::randomize( CompressedVector<Type,TF,Index>& vector,
                                                           const Arg& min, const Arg& max ) const
 {
    const size_t size( vector.size() );
@@ -302,10 +310,11 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \return void
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector,
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the vector
+template< typename Arg >    // Min/max argument type
+inline void Rand< CompressedVector<Type,TF,Index> >::randomize( CompressedVector<Type,TF,Index>& vector,
                                                           size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t size( vector.size() );
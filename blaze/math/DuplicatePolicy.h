@@ -0,0 +1,78 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/DuplicatePolicy.h
+//  \brief Header file for the duplicate policy types
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DUPLICATEPOLICY_H_
+#define _BLAZE_MATH_DUPLICATEPOLICY_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DUPLICATE POLICY TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Treatment of duplicate elements during the assembly of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// The duplicate policy specifies how multiple (row, column, value) triplets with the same row
+// and column index are combined during the bulk assembly of a sparse matrix (see for instance
+// the triplet constructor of the CompressedMatrix class template). The \a sumDuplicates policy
+// adds up the values of all duplicates, as it is required for instance for the assembly of
+// finite element matrices from element contributions. The \a overwriteDuplicates policy keeps
+// the value of the last duplicate in the order of the given triplets:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::overwriteDuplicates;
+
+   const size_t rows   [] = { 1, 0, 1 };
+   const size_t columns[] = { 2, 0, 2 };
+   const double values [] = { 1.0, 2.0, 3.0 };
+
+   CompressedMatrix<double> A( 2, 3, 3, rows, columns, values );  // A(1,2) == 4
+   CompressedMatrix<double> B( 2, 3, 3, rows, columns, values, overwriteDuplicates );  // B(1,2) == 3
+   \endcode
+*/
+enum DuplicatePolicy {
+   sumDuplicates       = 0,  //!< The values of duplicate elements are summed up.
+   overwriteDuplicates = 1   //!< The last of the duplicate elements is stored.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
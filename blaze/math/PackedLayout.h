@@ -0,0 +1,93 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedLayout.h
+//  \brief Header file for the packed matrix layout types
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_PACKEDLAYOUT_H_
+#define _BLAZE_MATH_PACKEDLAYOUT_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED MATRIX LAYOUT TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Layout of the elements of a packed matrix.
+// \ingroup dense_matrix
+//
+// Via the packed layout it is possible to specify which triangular half of a square matrix is
+// stored in a packed matrix (see the PackedMatrix class template) and how the elements of the
+// unstored half are interpreted. Given the 3x3 lower matrix
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 0 & 0 \\
+                          2 & 3 & 0 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)\f]\n
+
+// in case of row-major order and the \a packedLower layout the elements are stored in the order
+
+                          \f[\left(\begin{array}{*{6}{c}}
+                          1 & 2 & 3 & 4 & 5 & 6. \\
+                          \end{array}\right)\f]
+
+// The \a packedLower and \a packedUpper layouts store the lower or upper part (including the
+// diagonal) of a triangular matrix, the elements of the unstored part are always 0. The
+// \a packedSymmetric layout stores the lower part of a row-major (the upper part of a
+// column-major) symmetric matrix, the elements of the unstored part mirror the stored elements.
+// The following example demonstrates the setup of packed matrices:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedLower;
+   using blaze::packedSymmetric;
+   using blaze::rowMajor;
+
+   PackedMatrix<double,packedLower,rowMajor> L( 3UL );  // Lower 3x3 matrix with 6 stored elements
+   PackedMatrix<double,packedSymmetric>      S( 3UL );  // Symmetric 3x3 matrix with 6 stored elements
+   \endcode
+*/
+enum PackedLayout {
+   packedLower     = 0,  //!< Packed storage of the lower part of a lower matrix.
+   packedUpper     = 1,  //!< Packed storage of the upper part of an upper matrix.
+   packedSymmetric = 2   //!< Packed storage of one triangular half of a symmetric matrix.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,199 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedMatrix.h
+//  \brief Header file for the complete PackedMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDMATRIX_H_
+#define _BLAZE_MATH_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for PackedMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of PackedMatrix. Only the
+// stored elements are randomized, i.e. the resulting matrix is a random lower, upper, or
+// symmetric matrix, respectively.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+class Rand< PackedMatrix<Type,PL,SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const PackedMatrix<Type,PL,SO> generate( size_t m, size_t n ) const;
+
+   template< typename Arg >
+   inline const PackedMatrix<Type,PL,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( PackedMatrix<Type,PL,SO>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( PackedMatrix<Type,PL,SO>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline const PackedMatrix<Type,PL,SO>
+   Rand< PackedMatrix<Type,PL,SO> >::generate( size_t m, size_t n ) const
+{
+   PackedMatrix<Type,PL,SO> matrix( m, n );
+   randomize( matrix );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Arg >    // Min/max argument type
+inline const PackedMatrix<Type,PL,SO>
+   Rand< PackedMatrix<Type,PL,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+{
+   PackedMatrix<Type,PL,SO> matrix( m, n );
+   randomize( matrix, min, max );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void Rand< PackedMatrix<Type,PL,SO> >::randomize( PackedMatrix<Type,PL,SO>& matrix ) const
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      Type* const v( matrix.data( i ) );
+      const size_t nonzeros( matrix.capacity( i ) );
+      for( size_t j=0UL; j<nonzeros; ++j ) {
+         v[j] = rand<Type>();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Arg >    // Min/max argument type
+inline void Rand< PackedMatrix<Type,PL,SO> >::randomize( PackedMatrix<Type,PL,SO>& matrix,
+                                                        const Arg& min, const Arg& max ) const
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      Type* const v( matrix.data( i ) );
+      const size_t nonzeros( matrix.capacity( i ) );
+      for( size_t j=0UL; j<nonzeros; ++j ) {
+         v[j] = rand<Type>( min, max );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
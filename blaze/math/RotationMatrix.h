@@ -1460,14 +1460,14 @@ struct MultTrait< DynamicVector<T1,true>, RotationMatrix<T2> >
    typedef StaticVector< typename MultTrait<T1,T2>::Type, 3UL, true >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< RotationMatrix<T1>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename I2 >
+struct MultTrait< RotationMatrix<T1>, CompressedVector<T2,false,I2> >
 {
    typedef StaticVector< typename MultTrait<T1,T2>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, RotationMatrix<T2> >
+template< typename T1, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,true,I1>, RotationMatrix<T2> >
 {
    typedef StaticVector< typename MultTrait<T1,T2>::Type, 3UL, true >  Type;
 };
@@ -1496,14 +1496,14 @@ struct MultTrait< DynamicMatrix<T1,SO>, RotationMatrix<T2> >
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< RotationMatrix<T1>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename I2 >
+struct MultTrait< RotationMatrix<T1>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, RotationMatrix<T2> >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, RotationMatrix<T2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
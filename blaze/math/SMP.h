@@ -40,11 +40,20 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/AsyncAssign.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/smp/BCSRMult.h>
+#include <blaze/math/smp/CSRMV.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/Fill.h>
 #include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SELLMV.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/SpGEMM.h>
+#include <blaze/math/smp/TriangularSolve.h>
+#include <blaze/math/smp/TripletAssembly.h>
 
 #endif
@@ -0,0 +1,265 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SlicedEllpackMatrix.h
+//  \brief Header file for the complete SlicedEllpackMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SlicedEllpackMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/smp/SELLMV.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/system/Precision.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for SlicedEllpackMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of SlicedEllpackMatrix. The
+// random matrices are generated as row-major compressed matrices and converted afterwards.
+*/
+template< typename Type >  // Data type of the matrix
+class Rand< SlicedEllpackMatrix<Type> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const SlicedEllpackMatrix<Type> generate( size_t m, size_t n ) const;
+   inline const SlicedEllpackMatrix<Type> generate( size_t m, size_t n, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline const SlicedEllpackMatrix<Type> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline const SlicedEllpackMatrix<Type> generate( size_t m, size_t n, size_t nonzeros,
+                                                    const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( SlicedEllpackMatrix<Type>& matrix ) const;
+   inline void randomize( SlicedEllpackMatrix<Type>& matrix, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline void randomize( SlicedEllpackMatrix<Type>& matrix, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline void randomize( SlicedEllpackMatrix<Type>& matrix, size_t nonzeros,
+                          const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SlicedEllpackMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline const SlicedEllpackMatrix<Type>
+   Rand< SlicedEllpackMatrix<Type> >::generate( size_t m, size_t n ) const
+{
+   return SlicedEllpackMatrix<Type>( rand< CompressedMatrix<Type,false> >( m, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SlicedEllpackMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline const SlicedEllpackMatrix<Type>
+   Rand< SlicedEllpackMatrix<Type> >::generate( size_t m, size_t n, size_t nonzeros ) const
+{
+   return SlicedEllpackMatrix<Type>( rand< CompressedMatrix<Type,false> >( m, n, nonzeros ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SlicedEllpackMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename Arg >   // Min/max argument type
+inline const SlicedEllpackMatrix<Type>
+   Rand< SlicedEllpackMatrix<Type> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+{
+   return SlicedEllpackMatrix<Type>( rand< CompressedMatrix<Type,false> >( m, n, min, max ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SlicedEllpackMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename Arg >   // Min/max argument type
+inline const SlicedEllpackMatrix<Type>
+   Rand< SlicedEllpackMatrix<Type> >::generate( size_t m, size_t n, size_t nonzeros,
+                                                const Arg& min, const Arg& max ) const
+{
+   return SlicedEllpackMatrix<Type>( rand< CompressedMatrix<Type,false> >( m, n, nonzeros, min, max ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SlicedEllpackMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void Rand< SlicedEllpackMatrix<Type> >::randomize( SlicedEllpackMatrix<Type>& matrix ) const
+{
+   matrix = rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SlicedEllpackMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline void Rand< SlicedEllpackMatrix<Type> >::randomize( SlicedEllpackMatrix<Type>& matrix, size_t nonzeros ) const
+{
+   matrix = rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), nonzeros );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SlicedEllpackMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename Arg >   // Min/max argument type
+inline void Rand< SlicedEllpackMatrix<Type> >::randomize( SlicedEllpackMatrix<Type>& matrix,
+                                                          const Arg& min, const Arg& max ) const
+{
+   matrix = rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SlicedEllpackMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename Arg >   // Min/max argument type
+inline void Rand< SlicedEllpackMatrix<Type> >::randomize( SlicedEllpackMatrix<Type>& matrix,
+                                                          size_t nonzeros, const Arg& min, const Arg& max ) const
+{
+   matrix = rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), nonzeros, min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
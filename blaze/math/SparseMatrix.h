@@ -71,8 +71,11 @@
 #include <blaze/math/expressions/TSVecSMatMultExpr.h>
 #include <blaze/math/expressions/TSVecTSMatMultExpr.h>
 #include <blaze/math/Matrix.h>
+#include <blaze/math/smp/CSRMV.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/smp/SpGEMM.h>
+#include <blaze/math/smp/TriangularSolve.h>
 #include <blaze/math/sparse/SparseMatrix.h>
 
 #endif
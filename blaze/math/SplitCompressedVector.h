@@ -0,0 +1,339 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SplitCompressedVector.h
+//  \brief Header file for the complete SplitCompressedVector implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPLITCOMPRESSEDVECTOR_H_
+#define _BLAZE_MATH_SPLITCOMPRESSEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/sparse/SplitCompressedVector.h>
+#include <blaze/math/SparseVector.h>
+#include <blaze/system/Precision.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for SplitCompressedVector.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of SplitCompressedVector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+class Rand< SplitCompressedVector<Type,TF,Index> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const SplitCompressedVector<Type,TF,Index> generate( size_t size ) const;
+   inline const SplitCompressedVector<Type,TF,Index> generate( size_t size, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline const SplitCompressedVector<Type,TF,Index> generate( size_t size, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline const SplitCompressedVector<Type,TF,Index> generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( SplitCompressedVector<Type,TF,Index>& vector ) const;
+   inline void randomize( SplitCompressedVector<Type,TF,Index>& vector, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline void randomize( SplitCompressedVector<Type,TF,Index>& vector, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline void randomize( SplitCompressedVector<Type,TF,Index>& vector, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SplitCompressedVector.
+//
+// \param size The size of the random vector.
+// \return The generated random vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+inline const SplitCompressedVector<Type,TF,Index>
+   Rand< SplitCompressedVector<Type,TF,Index> >::generate( size_t size ) const
+{
+   SplitCompressedVector<Type,TF,Index> vector( size );
+   randomize( vector );
+
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SplitCompressedVector.
+//
+// \param size The size of the random vector.
+// \param nonzeros The number of non-zero elements of the random vector.
+// \return The generated random vector.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+inline const SplitCompressedVector<Type,TF,Index>
+   Rand< SplitCompressedVector<Type,TF,Index> >::generate( size_t size, size_t nonzeros ) const
+{
+   if( nonzeros > size )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+
+   SplitCompressedVector<Type,TF,Index> vector( size, nonzeros );
+   randomize( vector, nonzeros );
+
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SplitCompressedVector.
+//
+// \param size The size of the random vector.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return The generated random vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+template< typename Arg >  // Min/max argument type
+inline const SplitCompressedVector<Type,TF,Index>
+   Rand< SplitCompressedVector<Type,TF,Index> >::generate( size_t size, const Arg& min, const Arg& max ) const
+{
+   SplitCompressedVector<Type,TF,Index> vector( size );
+   randomize( vector, min, max );
+
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SplitCompressedVector.
+//
+// \param size The size of the random vector.
+// \param nonzeros The number of non-zero elements of the random vector.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return The generated random vector.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+template< typename Arg >  // Min/max argument type
+inline const SplitCompressedVector<Type,TF,Index>
+   Rand< SplitCompressedVector<Type,TF,Index> >::generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const
+{
+   if( nonzeros > size )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+
+   SplitCompressedVector<Type,TF,Index> vector( size, nonzeros );
+   randomize( vector, nonzeros, min, max );
+
+   return vector;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SplitCompressedVector.
+//
+// \param vector The vector to be randomized.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+inline void Rand< SplitCompressedVector<Type,TF,Index> >::randomize( SplitCompressedVector<Type,TF,Index>& vector ) const
+{
+   const size_t size( vector.size() );
+
+   if( size == 0UL ) return;
+
+   const size_t nonzeros( rand<size_t>( 1UL, std::ceil( 0.5*size ) ) );
+
+   vector.reset();
+   vector.reserve( nonzeros );
+
+   while( vector.nonZeros() < nonzeros ) {
+      vector[ rand<size_t>( 0UL, size-1UL ) ] = rand<Type>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SplitCompressedVector.
+//
+// \param vector The vector to be randomized.
+// \param nonzeros The number of non-zero elements of the random vector.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+inline void Rand< SplitCompressedVector<Type,TF,Index> >::randomize( SplitCompressedVector<Type,TF,Index>& vector, size_t nonzeros ) const
+{
+   const size_t size( vector.size() );
+
+   if( nonzeros > size )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+
+   if( size == 0UL ) return;
+
+   vector.reset();
+   vector.reserve( nonzeros );
+
+   while( vector.nonZeros() < nonzeros ) {
+      vector[ rand<size_t>( 0UL, size-1UL ) ] = rand<Type>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SplitCompressedVector.
+//
+// \param vector The vector to be randomized.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+template< typename Arg >  // Min/max argument type
+inline void Rand< SplitCompressedVector<Type,TF,Index> >::randomize( SplitCompressedVector<Type,TF,Index>& vector,
+                                                                     const Arg& min, const Arg& max ) const
+{
+   const size_t size( vector.size() );
+
+   if( size == 0UL ) return;
+
+   const size_t nonzeros( rand<size_t>( 1UL, std::ceil( 0.5*size ) ) );
+
+   vector.reset();
+   vector.reserve( nonzeros );
+
+   while( vector.nonZeros() < nonzeros ) {
+      vector[ rand<size_t>( 0UL, size-1UL ) ] = rand<Type>( min, max );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SplitCompressedVector.
+//
+// \param vector The vector to be randomized.
+// \param nonzeros The number of non-zero elements of the random vector.
+// \param min The smallest possible value for a vector element.
+// \param max The largest possible value for a vector element.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type
+template< typename Arg >  // Min/max argument type
+inline void Rand< SplitCompressedVector<Type,TF,Index> >::randomize( SplitCompressedVector<Type,TF,Index>& vector,
+                                                                     size_t nonzeros, const Arg& min, const Arg& max ) const
+{
+   const size_t size( vector.size() );
+
+   if( nonzeros > size )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+
+   if( size == 0UL ) return;
+
+   vector.reset();
+   vector.reserve( nonzeros );
+
+   while( vector.nonZeros() < nonzeros ) {
+      vector[ rand<size_t>( 0UL, size-1UL ) ] = rand<Type>( min, max );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -483,16 +483,28 @@ struct AddTrait< DynamicMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
    typedef typename AddTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename I >
+struct AddTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,I> >
+{
+   typedef typename AddTrait< MT, CompressedMatrix<T,SO2,I> >::Type  Type;
+};
+
+template< typename T, bool SO1, typename I, typename MT, bool SO2, bool DF >
+struct AddTrait< CompressedMatrix<T,SO1,I>, DiagonalMatrix<MT,SO2,DF> >
+{
+   typedef typename AddTrait< CompressedMatrix<T,SO1,I>, MT >::Type  Type;
+};
+
 template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+struct AddTrait< DiagonalMatrix<MT,SO1,DF>, CompactDiagonalMatrix<T,SO2> >
 {
-   typedef typename AddTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, CompactDiagonalMatrix<T,SO2> >::Type  Type;
 };
 
 template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< CompressedMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
+struct AddTrait< CompactDiagonalMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
 {
-   typedef typename AddTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< CompactDiagonalMatrix<T,SO1>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -598,16 +610,28 @@ struct SubTrait< DynamicMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
    typedef typename SubTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename I >
+struct SubTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,I> >
+{
+   typedef typename SubTrait< MT, CompressedMatrix<T,SO2,I> >::Type  Type;
+};
+
+template< typename T, bool SO1, typename I, typename MT, bool SO2, bool DF >
+struct SubTrait< CompressedMatrix<T,SO1,I>, DiagonalMatrix<MT,SO2,DF> >
+{
+   typedef typename SubTrait< CompressedMatrix<T,SO1,I>, MT >::Type  Type;
+};
+
 template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+struct SubTrait< DiagonalMatrix<MT,SO1,DF>, CompactDiagonalMatrix<T,SO2> >
 {
-   typedef typename SubTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, CompactDiagonalMatrix<T,SO2> >::Type  Type;
 };
 
 template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< CompressedMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
+struct SubTrait< CompactDiagonalMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
 {
-   typedef typename SubTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< CompactDiagonalMatrix<T,SO1>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -727,16 +751,16 @@ struct MultTrait< DynamicVector<T,true>, DiagonalMatrix<MT,SO,DF> >
    typedef typename MultTrait< DynamicVector<T,true>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO, bool DF, typename T >
-struct MultTrait< DiagonalMatrix<MT,SO,DF>, CompressedVector<T,false> >
+template< typename MT, bool SO, bool DF, typename T, typename I >
+struct MultTrait< DiagonalMatrix<MT,SO,DF>, CompressedVector<T,false,I> >
 {
-   typedef typename MultTrait< MT, CompressedVector<T,false> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedVector<T,false,I> >::Type  Type;
 };
 
-template< typename T, typename MT, bool SO, bool DF >
-struct MultTrait< CompressedVector<T,true>, DiagonalMatrix<MT,SO,DF> >
+template< typename T, typename I, typename MT, bool SO, bool DF >
+struct MultTrait< CompressedVector<T,true,I>, DiagonalMatrix<MT,SO,DF> >
 {
-   typedef typename MultTrait< CompressedVector<T,true>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedVector<T,true,I>, MT >::Type  Type;
 };
 
 template< typename MT, bool SO1, bool DF, typename T, size_t M, size_t N, bool SO2 >
@@ -775,16 +799,28 @@ struct MultTrait< DynamicMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
    typedef typename MultTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename I >
+struct MultTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,I> >
+{
+   typedef typename MultTrait< MT, CompressedMatrix<T,SO2,I> >::Type  Type;
+};
+
+template< typename T, bool SO1, typename I, typename MT, bool SO2, bool DF >
+struct MultTrait< CompressedMatrix<T,SO1,I>, DiagonalMatrix<MT,SO2,DF> >
+{
+   typedef typename MultTrait< CompressedMatrix<T,SO1,I>, MT >::Type  Type;
+};
+
 template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< DiagonalMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+struct MultTrait< DiagonalMatrix<MT,SO1,DF>, CompactDiagonalMatrix<T,SO2> >
 {
-   typedef typename MultTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, CompactDiagonalMatrix<T,SO2> >::Type  Type;
 };
 
 template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< CompressedMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
+struct MultTrait< CompactDiagonalMatrix<T,SO1>, DiagonalMatrix<MT,SO2,DF> >
 {
-   typedef typename MultTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< CompactDiagonalMatrix<T,SO1>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
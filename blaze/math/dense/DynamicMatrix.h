@@ -51,6 +51,7 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Fill.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -484,10 +485,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
+      smpFill( v_, m_, nn_, n_, nn_, Type() );
    }
 }
 //*************************************************************************************************
@@ -500,7 +498,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel
+// initialization is activated (see the BLAZE_USE_PARALLEL_INITIALIZATION switch in the
+// configuration file <tt>./blaze/config/NUMA.h</tt>), the elements of large matrices are
+// initialized in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -511,14 +512,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   smpFill( v_, m_, nn_, 0UL, n_, init );
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
+   if( IsVectorizable<Type>::value ) {
+      smpFill( v_, m_, nn_, n_, nn_, Type() );
    }
 }
 //*************************************************************************************************
@@ -1461,9 +1458,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=0UL; i<m; ++i )
-         for( size_t j=n; j<nn; ++j )
-            v_[i*nn+j] = Type();
+      smpFill( v_, m, nn, n, nn, Type() );
    }
 
    m_  = m;
@@ -2708,10 +2703,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
-      for( size_t j=0UL; j<n_; ++j )
-         for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
-      }
+      smpFill( v_, n_, mm_, m_, mm_, Type() );
    }
 }
 /*! \endcond */
@@ -2726,7 +2718,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel
+// initialization is activated (see the BLAZE_USE_PARALLEL_INITIALIZATION switch in the
+// configuration file <tt>./blaze/config/NUMA.h</tt>), the elements of large matrices are
+// initialized in parallel.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -2736,14 +2731,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   smpFill( v_, n_, mm_, 0UL, m_, init );
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t i=m_; i<mm_; ++i )
-            v_[i+j*mm_] = Type();
-      }
+   if( IsVectorizable<Type>::value ) {
+      smpFill( v_, n_, mm_, m_, mm_, Type() );
    }
 }
 /*! \endcond */
@@ -3677,9 +3668,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t j=0UL; j<n; ++j )
-         for( size_t i=m; i<mm; ++i )
-            v_[i+j*mm] = Type();
+      smpFill( v_, n, mm, m, mm, Type() );
    }
 
    m_  = m;
@@ -5008,14 +4997,14 @@ struct MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename I2 >
+struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false,I2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename I1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true,I1>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
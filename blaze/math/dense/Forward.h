@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/PackedLayout.h>
 #include <blaze/util/Types.h>
 
 
@@ -55,8 +56,11 @@ template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, PackedLayout, bool > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
+template< typename, size_t, size_t > class StaticMatrixBatch;
 template< typename, size_t, bool > class StaticVector;
+template< typename, size_t, bool > class StaticVectorBatch;
 
 } // namespace blaze
 
@@ -0,0 +1,906 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the packed dense matrix/dense matrix multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/Kernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsTriangular.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the packed dense matrix/dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The MMMBlocking class template defines the block sizes of the packed multiplication kernel
+// for the element type \a T. The register block of the micro-kernel consists of \a mr rows
+// and \a nr columns (i.e. two intrinsic vectors). The depth \a kc of the packed panels is
+// chosen such that a packed \a kc x \a nr micro-panel fits into the first level cache. The
+// packed block of the left-hand side operand (\a mc x \a kc) occupies at most an eighth and
+// the packed block of the right-hand side operand (\a kc x \a nc) at most half of the cache
+// size specified via the blaze::cacheSize setting.
+*/
+template< typename T >  // Type of the matrix elements
+struct MMMBlocking
+{
+ private:
+   //**********************************************************************************************
+   typedef IntrinsicTrait<T>  IT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static const size_t kmax = 16384UL / ( size_t( IT::size ) * 2UL * sizeof(T) );
+   static const size_t kval = ( kmax < 64UL )?( 64UL ):( ( kmax > 512UL )?( 512UL ):( kmax ) );
+   static const size_t mmax = ( cacheSize / 8UL ) / kval / sizeof(T);
+   static const size_t nmax = ( cacheSize / 2UL ) / kval / sizeof(T);
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   static const size_t mr = 6UL;
+   static const size_t nr = size_t( IT::size ) * 2UL;
+   static const size_t kc = kval;
+   static const size_t mc = ( mmax < mr )?( mr ):( mmax - mmax % mr );
+   static const size_t nc = ( nmax < nr )?( nr ):( nmax - nmax % nr );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the runtime dispatched packed multiplication kernel.
+// \ingroup dense_matrix
+//
+// In case the runtime dispatch mode is active, the element type of the target matrix is
+// \c float or \c double, and all three matrices provide direct access to their elements,
+// the nested \a value will be set to 1, otherwise it will be 0.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+struct MMMDispatch
+{
+   //**********************************************************************************************
+   typedef typename MT1::ElementType  ET;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = BLAZE_DISPATCH_MODE &&
+                  ( IsFloat<ET>::value || IsDouble<ET>::value ) &&
+                  MT1::vectorizable && MT2::vectorizable && MT3::vectorizable &&
+                  !IsComputation<MT2>::value && !IsComputation<MT3>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the left-hand side operand of a packed multiplication.
+// \ingroup dense_matrix
+//
+// \param dst Pointer to the first element of the packing buffer.
+// \param A The left-hand side operand.
+// \param ibegin The first row of the block.
+// \param iend The end of the row range of the block.
+// \param kbegin The first column of the block.
+// \param kend The end of the column range of the block.
+// \return void
+//
+// This function copies the block \f$ [ibegin..iend) \times [kbegin..kend) \f$ of the matrix
+// \f$ A' \f$ into consecutive panels of \a mr rows, where within each panel the \a mr elements
+// of a column are stored contiguously. In case \a TF is \a true, \f$ A' \f$ is the transpose
+// of the given matrix \a A. The last panel is padded with zeros.
+*/
+template< bool TF        // Transposition flag
+        , typename ET    // Type of the packed elements
+        , typename MT >  // Type of the left-hand side operand
+void mmmPackLeft( ET* dst, const MT& A, size_t ibegin, size_t iend, size_t kbegin, size_t kend )
+{
+   const size_t mr( MMMBlocking<ET>::mr );
+   const size_t kn( kend - kbegin );
+
+   for( size_t i=ibegin; i<iend; i+=mr )
+   {
+      const size_t m( min( mr, iend-i ) );
+
+      if( IsRowMajorMatrix<MT>::value != TF ) {
+         for( size_t r=0UL; r<m; ++r ) {
+            for( size_t k=0UL; k<kn; ++k ) {
+               dst[k*mr+r] = ( TF )?( A(kbegin+k,i+r) ):( A(i+r,kbegin+k) );
+            }
+         }
+      }
+      else {
+         for( size_t k=0UL; k<kn; ++k ) {
+            for( size_t r=0UL; r<m; ++r ) {
+               dst[k*mr+r] = ( TF )?( A(kbegin+k,i+r) ):( A(i+r,kbegin+k) );
+            }
+         }
+      }
+
+      for( size_t r=m; r<mr; ++r ) {
+         for( size_t k=0UL; k<kn; ++k ) {
+            reset( dst[k*mr+r] );
+         }
+      }
+
+      dst += mr*kn;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the right-hand side operand of a packed multiplication.
+// \ingroup dense_matrix
+//
+// \param dst Pointer to the first element of the packing buffer.
+// \param B The right-hand side operand.
+// \param kbegin The first row of the block.
+// \param kend The end of the row range of the block.
+// \param jbegin The first column of the block.
+// \param jend The end of the column range of the block.
+// \return void
+//
+// This function copies the block \f$ [kbegin..kend) \times [jbegin..jend) \f$ of the matrix
+// \f$ B' \f$ into consecutive panels of \a nr columns, where within each panel the \a nr
+// elements of a row are stored contiguously. In case \a TF is \a true, \f$ B' \f$ is the
+// transpose of the given matrix \a B. The last panel is padded with zeros.
+*/
+template< bool TF        // Transposition flag
+        , typename ET    // Type of the packed elements
+        , typename MT >  // Type of the right-hand side operand
+void mmmPackRight( ET* dst, const MT& B, size_t kbegin, size_t kend, size_t jbegin, size_t jend )
+{
+   const size_t nr( MMMBlocking<ET>::nr );
+   const size_t kn( kend - kbegin );
+
+   for( size_t j=jbegin; j<jend; j+=nr )
+   {
+      const size_t n( min( nr, jend-j ) );
+
+      if( IsRowMajorMatrix<MT>::value != TF ) {
+         for( size_t k=0UL; k<kn; ++k ) {
+            for( size_t c=0UL; c<n; ++c ) {
+               dst[k*nr+c] = ( TF )?( B(j+c,kbegin+k) ):( B(kbegin+k,j+c) );
+            }
+         }
+      }
+      else {
+         for( size_t c=0UL; c<n; ++c ) {
+            for( size_t k=0UL; k<kn; ++k ) {
+               dst[k*nr+c] = ( TF )?( B(j+c,kbegin+k) ):( B(kbegin+k,j+c) );
+            }
+         }
+      }
+
+      for( size_t k=0UL; k<kn; ++k ) {
+         for( size_t c=n; c<nr; ++c ) {
+            reset( dst[k*nr+c] );
+         }
+      }
+
+      dst += nr*kn;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to a single element of the target matrix of a packed multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target matrix.
+// \param i The row index within the (possibly transposed) target matrix.
+// \param j The column index within the (possibly transposed) target matrix.
+// \return Reference to the accessed element.
+*/
+template< typename MT >  // Type of the target matrix
+BLAZE_ALWAYS_INLINE typename MT::Reference
+   mmmElement( DenseMatrix<MT,false>& C, size_t i, size_t j )
+{
+   return (~C)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to a single element of the target matrix of a packed multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target matrix.
+// \param i The row index within the (possibly transposed) target matrix.
+// \param j The column index within the (possibly transposed) target matrix.
+// \return Reference to the accessed element.
+*/
+template< typename MT >  // Type of the target matrix
+BLAZE_ALWAYS_INLINE typename MT::Reference
+   mmmElement( DenseMatrix<MT,true>& C, size_t i, size_t j )
+{
+   return (~C)(j,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of an intrinsic vector of the target matrix of a packed multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target matrix.
+// \param i The row index within the (possibly transposed) target matrix.
+// \param j The column index within the (possibly transposed) target matrix.
+// \param value The computed intrinsic vector of \f$ A*B \f$.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+*/
+template< typename MT    // Type of the target matrix
+        , bool SO        // Storage order of the target matrix
+        , typename IT >  // Type of the intrinsic vector
+BLAZE_ALWAYS_INLINE void mmmUpdate( DenseMatrix<MT,SO>& C, size_t i, size_t j, const IT& value,
+                                    const IT& alpha, const IT& beta, bool overwrite )
+{
+   const size_t row   ( ( SO )?( j ):( i ) );
+   const size_t column( ( SO )?( i ):( j ) );
+
+   if( overwrite )
+      (~C).store( row, column, alpha * value );
+   else
+      (~C).store( row, column, beta * (~C).load( row, column ) + alpha * value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro-kernel of the packed multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target matrix.
+// \param a Pointer to the packed \a mr x \a kn panel of the left-hand side operand.
+// \param b Pointer to the packed \a kn x \a nr panel of the right-hand side operand.
+// \param kn The depth of the packed panels.
+// \param i The first row of the tile within the (possibly transposed) target matrix.
+// \param j The first column of the tile within the (possibly transposed) target matrix.
+// \param m The number of valid rows of the tile.
+// \param n The number of valid columns of the tile.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the \a mr x \a nr tile \f$ C'=\alpha*A'*B'+\beta*C' \f$ from the two
+// given packed panels. In case the tile is complete it is updated directly via intrinsic
+// loads and stores, partial tiles at the border of the matrix are updated element-wise.
+*/
+template< typename MT    // Type of the target matrix
+        , bool SO        // Storage order of the target matrix
+        , typename ET >  // Type of the packed elements
+void mmmMicroKernel( DenseMatrix<MT,SO>& C, const ET* a, const ET* b, size_t kn,
+                     size_t i, size_t j, size_t m, size_t n, ET alpha, ET beta )
+{
+   typedef IntrinsicTrait<ET>  IT;
+   typedef typename IT::Type   IntrinsicType;
+   typedef MMMBlocking<ET>     Blocking;
+
+   const size_t mr( Blocking::mr );
+   const size_t nr( Blocking::nr );
+
+   IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12;
+
+   for( size_t k=0UL; k<kn; ++k ) {
+      const IntrinsicType b1( load( b          ) );
+      const IntrinsicType b2( load( b+IT::size ) );
+      const IntrinsicType a1( set( a[0] ) );
+      const IntrinsicType a2( set( a[1] ) );
+      const IntrinsicType a3( set( a[2] ) );
+      const IntrinsicType a4( set( a[3] ) );
+      const IntrinsicType a5( set( a[4] ) );
+      const IntrinsicType a6( set( a[5] ) );
+      xmm1  = fmadd( a1, b1, xmm1  );
+      xmm2  = fmadd( a1, b2, xmm2  );
+      xmm3  = fmadd( a2, b1, xmm3  );
+      xmm4  = fmadd( a2, b2, xmm4  );
+      xmm5  = fmadd( a3, b1, xmm5  );
+      xmm6  = fmadd( a3, b2, xmm6  );
+      xmm7  = fmadd( a4, b1, xmm7  );
+      xmm8  = fmadd( a4, b2, xmm8  );
+      xmm9  = fmadd( a5, b1, xmm9  );
+      xmm10 = fmadd( a5, b2, xmm10 );
+      xmm11 = fmadd( a6, b1, xmm11 );
+      xmm12 = fmadd( a6, b2, xmm12 );
+      a += mr;
+      b += nr;
+   }
+
+   const bool overwrite( isDefault( beta ) );
+
+   if( m == mr && n == nr )
+   {
+      const IntrinsicType factor1( set( alpha ) );
+      const IntrinsicType factor2( set( beta  ) );
+
+      mmmUpdate( C, i    , j         , xmm1 , factor1, factor2, overwrite );
+      mmmUpdate( C, i    , j+IT::size, xmm2 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+1UL, j         , xmm3 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+1UL, j+IT::size, xmm4 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+2UL, j         , xmm5 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+2UL, j+IT::size, xmm6 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+3UL, j         , xmm7 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+3UL, j+IT::size, xmm8 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+4UL, j         , xmm9 , factor1, factor2, overwrite );
+      mmmUpdate( C, i+4UL, j+IT::size, xmm10, factor1, factor2, overwrite );
+      mmmUpdate( C, i+5UL, j         , xmm11, factor1, factor2, overwrite );
+      mmmUpdate( C, i+5UL, j+IT::size, xmm12, factor1, factor2, overwrite );
+   }
+   else
+   {
+      AlignedArray<ET,Blocking::mr*Blocking::nr> tile;
+
+      store( tile.data()                , xmm1  );
+      store( tile.data()+IT::size       , xmm2  );
+      store( tile.data()+nr             , xmm3  );
+      store( tile.data()+nr+IT::size    , xmm4  );
+      store( tile.data()+nr*2UL         , xmm5  );
+      store( tile.data()+nr*2UL+IT::size, xmm6  );
+      store( tile.data()+nr*3UL         , xmm7  );
+      store( tile.data()+nr*3UL+IT::size, xmm8  );
+      store( tile.data()+nr*4UL         , xmm9  );
+      store( tile.data()+nr*4UL+IT::size, xmm10 );
+      store( tile.data()+nr*5UL         , xmm11 );
+      store( tile.data()+nr*5UL+IT::size, xmm12 );
+
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c ) {
+            if( overwrite )
+               mmmElement( C, i+r, j+c ) = alpha * tile[r*nr+c];
+            else
+               mmmElement( C, i+r, j+c ) = beta * mmmElement( C, i+r, j+c ) + alpha * tile[r*nr+c];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-blocked, packed dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements a GotoBLAS-style multiplication kernel for large dense matrices.
+// Blocks of \a B and \a A are packed into contiguous, aligned buffers (see MMMBlocking) and
+// the product is accumulated by a register-blocked, vectorized micro-kernel. The vectorization
+// runs along the rows of a row-major target and along the columns of a column-major target,
+// the storage order of the two operands only affects the packing. In case \a beta is zero,
+// the initial values of \a C are not accessed. Note that the function requires all three
+// matrices to have the same, vectorizable element type.
+//
+// In case one or both operands are lower or upper triangular matrices (see the IsLower and
+// IsUpper type traits), the kernel works as a TRMM kernel: blocks of the operands that are
+// known to be zero are neither packed nor multiplied and the depth of each micro-kernel call
+// is restricted to the nonzero part of the according panels. In this case \a C is scaled
+// by \a beta in advance.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+typename DisableIf< MMMDispatch<MT1,MT2,MT3> >::Type
+   mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B,
+        typename MT1::ElementType alpha, typename MT1::ElementType beta )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef MMMBlocking<ET>            Blocking;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( ( SO )?( B.columns() ):( A.rows()    ) );
+   const size_t N( ( SO )?( A.rows()    ):( B.columns() ) );
+   const size_t K( A.columns() );
+
+   if( M == 0UL || N == 0UL ) {
+      return;
+   }
+
+   if( K == 0UL ) {
+      if( isDefault( beta ) )
+         reset( ~C );
+      else
+         (~C) *= beta;
+      return;
+   }
+
+   // Triangular structure of the (possibly transposed) operands A' and B'
+   const bool lowerA( ( SO )?( bool( IsUpper<MT3>::value ) ):( bool( IsLower<MT2>::value ) ) );
+   const bool upperA( ( SO )?( bool( IsLower<MT3>::value ) ):( bool( IsUpper<MT2>::value ) ) );
+   const bool lowerB( ( SO )?( bool( IsUpper<MT2>::value ) ):( bool( IsLower<MT3>::value ) ) );
+   const bool upperB( ( SO )?( bool( IsLower<MT2>::value ) ):( bool( IsUpper<MT3>::value ) ) );
+   const bool triangular( lowerA || upperA || lowerB || upperB );
+
+   if( triangular ) {
+      if( isDefault( beta ) )
+         reset( ~C );
+      else if( !isOne( beta ) )
+         (~C) *= beta;
+   }
+
+   const size_t mc( min( size_t( Blocking::mc ), M - M % Blocking::mr + Blocking::mr ) );
+   const size_t nc( min( size_t( Blocking::nc ), N - N % Blocking::nr + Blocking::nr ) );
+   const size_t kc( min( size_t( Blocking::kc ), K ) );
+
+   UniqueArray<ET,Deallocate> apack( allocate<ET>( mc*kc ) );
+   UniqueArray<ET,Deallocate> bpack( allocate<ET>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t jend( min( jj+nc, N ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kend( min( kk+kc, K ) );
+         const size_t kn( kend - kk );
+         const ET factor( ( kk == 0UL && !triangular )?( beta ):( ET(1) ) );
+
+         if( ( lowerB && kend <= jj ) || ( upperB && kk >= jend ) ) {
+            continue;
+         }
+
+         if( SO ) mmmPackRight<true> ( bpack.get(), A, kk, kend, jj, jend );
+         else     mmmPackRight<false>( bpack.get(), B, kk, kend, jj, jend );
+
+         for( size_t ii=0UL; ii<M; ii+=mc )
+         {
+            const size_t iend( min( ii+mc, M ) );
+
+            if( ( lowerA && kk >= iend ) || ( upperA && kend <= ii ) ) {
+               continue;
+            }
+
+            if( SO ) mmmPackLeft<true> ( apack.get(), B, ii, iend, kk, kend );
+            else     mmmPackLeft<false>( apack.get(), A, ii, iend, kk, kend );
+
+            for( size_t j=jj; j<jend; j+=Blocking::nr ) {
+               const ET* const b( bpack.get() + ( j - jj ) * kn );
+               for( size_t i=ii; i<iend; i+=Blocking::mr ) {
+                  const ET* const a( apack.get() + ( i - ii ) * kn );
+
+                  if( !triangular ) {
+                     mmmMicroKernel( ~C, a, b, kn, i, j, min( size_t( Blocking::mr ), iend-i ),
+                                     min( size_t( Blocking::nr ), jend-j ), alpha, factor );
+                     continue;
+                  }
+
+                  const size_t kbegin( max( ( upperA )?( i ):( kk ), ( lowerB )?( j ):( kk ), kk ) );
+                  const size_t klast ( min( ( lowerA )?( i+Blocking::mr ):( kend ),
+                                            ( upperB )?( j+Blocking::nr ):( kend ), kend ) );
+
+                  if( kbegin >= klast ) continue;
+
+                  mmmMicroKernel( ~C, a+(kbegin-kk)*Blocking::mr, b+(kbegin-kk)*Blocking::nr,
+                                  klast-kbegin, i, j, min( size_t( Blocking::mr ), iend-i ),
+                                  min( size_t( Blocking::nr ), jend-j ), alpha, factor );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched, packed dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function relays the multiplication of \c float and \c double matrices to the packed
+// multiplication kernel for the instruction set selected at program startup (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch). In case one of the operands is a triangular matrix, the
+// product is computed in panels of 128 rows (triangular \a A) or columns (triangular \a B),
+// each of which is restricted to the nonzero part of the triangular operand.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+inline typename EnableIf< MMMDispatch<MT1,MT2,MT3> >::Type
+   mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B,
+        typename MT1::ElementType alpha, typename MT1::ElementType beta )
+{
+   typedef typename MT1::ElementType  ET;
+
+   if( !IsTriangular<MT2>::value && !IsTriangular<MT3>::value ) {
+      dispatch::gemm( ~C, A, B, alpha, beta );
+      return;
+   }
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+   const size_t block( 128UL );
+
+   const size_t ars( ( IsRowMajorMatrix<MT2>::value )?( A.spacing() ):( 1UL ) );
+   const size_t acs( ( IsRowMajorMatrix<MT2>::value )?( 1UL ):( A.spacing() ) );
+   const size_t brs( ( IsRowMajorMatrix<MT3>::value )?( B.spacing() ):( 1UL ) );
+   const size_t bcs( ( IsRowMajorMatrix<MT3>::value )?( 1UL ):( B.spacing() ) );
+   const size_t crs( ( SO )?( 1UL ):( (~C).spacing() ) );
+   const size_t ccs( ( SO )?( (~C).spacing() ):( 1UL ) );
+
+   if( IsTriangular<MT2>::value )
+   {
+      for( size_t i=0UL; i<M; i+=block )
+      {
+         const size_t m( min( block, M-i ) );
+         const size_t kbegin( ( IsUpper<MT2>::value )?( i ):( 0UL ) );
+         const size_t kend  ( ( IsLower<MT2>::value )?( i+m ):( K ) );
+
+         dispatch::gemm( m, N, kend-kbegin, alpha, A.data() + i*ars + kbegin*acs, ars, acs,
+                         B.data() + kbegin*brs, brs, bcs, beta, (~C).data() + i*crs, crs, ccs );
+      }
+   }
+   else
+   {
+      for( size_t j=0UL; j<N; j+=block )
+      {
+         const size_t n( min( block, N-j ) );
+         const size_t kbegin( ( IsLower<MT3>::value )?( j ):( 0UL ) );
+         const size_t kend  ( ( IsUpper<MT3>::value )?( j+n ):( K ) );
+
+         dispatch::gemm( M, n, kend-kbegin, alpha, A.data() + kbegin*acs, ars, acs,
+                         B.data() + kbegin*brs + j*bcs, brs, bcs, beta,
+                         (~C).data() + j*ccs, crs, ccs );
+      }
+   }
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED SYMMETRIC RANK-K UPDATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given multiplication operands form a symmetric product \f$ A*A^T \f$.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return \a true in case \a B is the transpose of \a A, \a false if not.
+//
+// This function returns \a true in case the right-hand side operand \a B refers to the same
+// elements as the left-hand side operand \a A, but in the opposite storage order (as for
+// instance in \f$ X*X^T \f$ or \f$ X^T*X \f$). In this case the product is symmetric and can
+// be computed by means of the smmm() function. Note that the function requires both operands
+// to provide direct access to their elements.
+*/
+template< typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+inline bool isSymmetricProduct( const MT2& A, const MT3& B )
+{
+   return bool( IsRowMajorMatrix<MT2>::value ) != bool( IsRowMajorMatrix<MT3>::value ) &&
+          A.rows() == B.columns() && A.columns() == B.rows() &&
+          A.data() == B.data() && A.spacing() == B.spacing();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mirroring of the lower part of the (possibly transposed) target matrix of a symmetric
+//        product to its upper part.
+// \ingroup dense_matrix
+//
+// \param C The target matrix.
+// \return void
+//
+// The elements are copied in blocks of 16x16 elements in order to limit the number of cache
+// misses caused by the strided access to the lower part.
+*/
+template< typename MT  // Type of the target matrix
+        , bool SO >    // Storage order of the target matrix
+void smmmMirror( DenseMatrix<MT,SO>& C )
+{
+   const size_t N( (~C).rows() );
+   const size_t block( 16UL );
+
+   for( size_t ii=0UL; ii<N; ii+=block ) {
+      const size_t iend( min( ii+block, N ) );
+      for( size_t jj=ii; jj<N; jj+=block ) {
+         const size_t jend( min( jj+block, N ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=max( i+1UL, jj ); j<jend; ++j ) {
+               mmmElement( C, i, j ) = mmmElement( C, j, i );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-blocked, packed symmetric rank-k update (\f$ C=\alpha*A*A^T \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand, i.e. the transpose of \a A.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function computes the symmetric product \f$ C=\alpha*A*B \f$, where \a B is the
+// transpose of \a A (see the isSymmetricProduct() function). In contrast to the mmm() function
+// only the micro-tiles on and below the diagonal of the (possibly transposed) target matrix are
+// computed, the remaining elements are mirrored afterwards. This approximately halves the number
+// of floating point operations. The initial values of \a C are not accessed. Note that the
+// function requires all three matrices to have the same, vectorizable element type.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+typename DisableIf< MMMDispatch<MT1,MT2,MT3> >::Type
+   smmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, typename MT1::ElementType alpha )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef MMMBlocking<ET>            Blocking;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( isSymmetricProduct( A, B )   , "Non-symmetric product detected" );
+
+   const size_t N( A.rows()    );
+   const size_t K( A.columns() );
+
+   if( N == 0UL ) {
+      return;
+   }
+
+   if( K == 0UL ) {
+      reset( ~C );
+      return;
+   }
+
+   const size_t mc( min( size_t( Blocking::mc ), N - N % Blocking::mr + Blocking::mr ) );
+   const size_t nc( min( size_t( Blocking::nc ), N - N % Blocking::nr + Blocking::nr ) );
+   const size_t kc( min( size_t( Blocking::kc ), K ) );
+
+   UniqueArray<ET,Deallocate> apack( allocate<ET>( mc*kc ) );
+   UniqueArray<ET,Deallocate> bpack( allocate<ET>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t jend( min( jj+nc, N ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kend( min( kk+kc, K ) );
+         const size_t kn( kend - kk );
+         const ET factor( ( kk == 0UL )?( ET(0) ):( ET(1) ) );
+
+         if( SO ) mmmPackRight<true> ( bpack.get(), A, kk, kend, jj, jend );
+         else     mmmPackRight<false>( bpack.get(), B, kk, kend, jj, jend );
+
+         for( size_t ii=jj-jj%mc; ii<N; ii+=mc )
+         {
+            const size_t iend( min( ii+mc, N ) );
+
+            if( SO ) mmmPackLeft<true> ( apack.get(), B, ii, iend, kk, kend );
+            else     mmmPackLeft<false>( apack.get(), A, ii, iend, kk, kend );
+
+            for( size_t j=jj; j<jend; j+=Blocking::nr ) {
+               const ET* const b( bpack.get() + ( j - jj ) * kn );
+               for( size_t i=ii; i<iend; i+=Blocking::mr ) {
+                  if( i+Blocking::mr <= j ) continue;
+                  const ET* const a( apack.get() + ( i - ii ) * kn );
+                  mmmMicroKernel( ~C, a, b, kn, i, j, min( size_t( Blocking::mr ), iend-i ),
+                                  min( size_t( Blocking::nr ), jend-j ), alpha, factor );
+               }
+            }
+         }
+      }
+   }
+
+   smmmMirror( ~C );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched symmetric rank-k update (\f$ C=\alpha*A*A^T \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand, i.e. the transpose of \a A.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function computes the lower part of the (possibly transposed) target matrix in panels
+// of 64 columns by means of the runtime dispatched gemm() kernel and mirrors the remaining
+// elements afterwards.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3 > // Type of the right-hand side matrix operand
+inline typename EnableIf< MMMDispatch<MT1,MT2,MT3> >::Type
+   smmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, typename MT1::ElementType alpha )
+{
+   typedef typename MT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( isSymmetricProduct( A, B )   , "Non-symmetric product detected" );
+
+   const size_t N( A.rows()    );
+   const size_t K( A.columns() );
+   const size_t block( 64UL );
+
+   const size_t ars( ( IsRowMajorMatrix<MT2>::value )?( A.spacing() ):( 1UL ) );
+   const size_t acs( ( IsRowMajorMatrix<MT2>::value )?( 1UL ):( A.spacing() ) );
+   const size_t brs( ( IsRowMajorMatrix<MT3>::value )?( B.spacing() ):( 1UL ) );
+   const size_t bcs( ( IsRowMajorMatrix<MT3>::value )?( 1UL ):( B.spacing() ) );
+   const size_t crs( ( SO )?( 1UL ):( (~C).spacing() ) );
+   const size_t ccs( ( SO )?( (~C).spacing() ):( 1UL ) );
+
+   for( size_t j=0UL; j<N; j+=block )
+   {
+      const size_t n( min( block, N-j ) );
+
+      const ET* const a( A.data() + j*ars );
+      const ET* const b( B.data() + j*bcs );
+      ET* const c( (~C).data() + j*crs + j*ccs );
+
+      if( SO ) dispatch::gemm( n, N-j, K, alpha, a, ars, acs, b, brs, bcs, ET(0), c, crs, ccs );
+      else     dispatch::gemm( N-j, n, K, alpha, a, ars, acs, b, brs, bcs, ET(0), c, crs, ccs );
+   }
+
+   smmmMirror( ~C );
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,911 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedAccessProxy.h
+//  \brief Header file for the PackedAccessProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDACCESSPROXY_H_
+#define _BLAZE_MATH_DENSE_PACKEDACCESSPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of packed dense matrices.
+// \ingroup math
+//
+// The PackedAccessProxy provides safe access to the elements of a non-const packed matrix (as
+// for instance the PackedMatrix class template), which stores only one triangular half of its
+// elements. Accesses to stored elements (including mirrored elements of a symmetric packed
+// matrix) are directly forwarded to the stored element, whereas accesses to elements of the
+// unstored, zero half of a triangular packed matrix always represent a default value. Assigning
+// a non-default value to such an element results in a \a std::invalid_argument exception:
+
+   \code
+   blaze::PackedMatrix<double,blaze::packedLower> A( 4UL );
+
+   A(2,1) = 2.0;  // Assignment to a stored lower element
+   A(1,2) = 0.0;  // Assignment of a default value to an unstored upper element; has no effect
+   A(1,2) = 1.0;  // Invalid assignment to an unstored upper element; results in an exception!
+
+   const double result = A(2,1) + A(1,2);  // Reads from unstored elements return 0
+   \endcode
+*/
+template< typename MT >  // Type of the packed matrix
+class PackedAccessProxy : public Proxy< PackedAccessProxy<MT>, typename MT::ElementType >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType  RepresentedType;  //!< Type of the represented packed matrix element.
+   typedef RepresentedType&          RawReference;     //!< Raw reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedAccessProxy( RepresentedType* value );
+            inline PackedAccessProxy( const PackedAccessProxy& pap );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+                          inline PackedAccessProxy& operator= ( const PackedAccessProxy& pap );
+   template< typename T > inline PackedAccessProxy& operator= ( const T& value );
+   template< typename T > inline PackedAccessProxy& operator+=( const T& value );
+   template< typename T > inline PackedAccessProxy& operator-=( const T& value );
+   template< typename T > inline PackedAccessProxy& operator*=( const T& value );
+   template< typename T > inline PackedAccessProxy& operator/=( const T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T > inline void check( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   RepresentedType* value_;  //!< Pointer to the stored element (\a NULL for unstored elements).
+
+   mutable RepresentedType zero_;  //!< Representation of an unstored element.
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   void* operator&() const;  //!< Address operator (private & undefined)
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedAccessProxy.
+//
+// \param value Pointer to the stored packed matrix element (\a NULL for an unstored element).
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedAccessProxy<MT>::PackedAccessProxy( RepresentedType* value )
+   : value_( value )  // Pointer to the stored packed matrix element
+   , zero_ (       )  // Representation of an unstored element
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedAccessProxy.
+//
+// \param pap Packed access proxy to be copied.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedAccessProxy<MT>::PackedAccessProxy( const PackedAccessProxy& pap )
+   : value_( pap.value_ )  // Pointer to the stored packed matrix element
+   , zero_ (            )  // Representation of an unstored element
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedAccessProxy.
+//
+// \param pap Packed access proxy to be copied.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to unstored packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator=( const PackedAccessProxy& pap )
+{
+   check( pap.get() );
+   get() = pap.get();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed packed matrix element.
+//
+// \param value The new value of the packed matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to unstored packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator=( const T& value )
+{
+   check( value );
+   get() = value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value to be added to the packed matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to unstored packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator+=( const T& value )
+{
+   check( value );
+   get() += value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the packed matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to unstored packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator-=( const T& value )
+{
+   check( value );
+   get() -= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned access proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator*=( const T& value )
+{
+   get() *= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed packed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned access proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedAccessProxy<MT>& PackedAccessProxy<MT>::operator/=( const T& value )
+{
+   get() /= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed packed matrix element.
+//
+// \return Direct/raw reference to the accessed packed matrix element.
+//
+// In case the proxy represents an unstored element, the function returns a reference to a
+// default value that is owned by the proxy.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedAccessProxy<MT>::RawReference PackedAccessProxy<MT>::get() const
+{
+   using blaze::reset;
+
+   if( value_ == NULL ) {
+      reset( zero_ );
+      return zero_;
+   }
+
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking an assignment to the accessed packed matrix element.
+//
+// \param value The value to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to unstored packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline void PackedAccessProxy<MT>::check( const T& value ) const
+{
+   using blaze::isDefault;
+
+   if( value_ == NULL && !isDefault( value ) )
+      throw std::invalid_argument( "Invalid assignment to unstored packed matrix element" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed packed matrix element.
+//
+// \return Direct/raw reference to the accessed packed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedAccessProxy<MT>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedAccessProxy operators */
+//@{
+template< typename MT1, typename MT2 >
+inline bool operator==( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator==( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator==( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator!=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator!=( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator!=( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator<( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator<( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator<( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator>( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator>( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator>( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator<=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator<=( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator<=( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator>=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator>=( const PackedAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator>=( const T& lhs, const PackedAccessProxy<MT>& rhs );
+
+template< typename MT >
+inline std::ostream& operator<<( std::ostream& os, const PackedAccessProxy<MT>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator==( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename MT, typename T >
+inline bool operator==( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename MT >
+inline bool operator==( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator!=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename MT, typename T >
+inline bool operator!=( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename MT >
+inline bool operator!=( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator<( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator<( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator<( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator>( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator>( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator>( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator<=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator<=( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator<=( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two PackedAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator>=( const PackedAccessProxy<MT1>& lhs, const PackedAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a PackedAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side PackedAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator>=( const PackedAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a PackedAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedAccessProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator>=( const T& lhs, const PackedAccessProxy<MT>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for the PackedAccessProxy class template.
+// \ingroup math
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename MT >
+inline std::ostream& operator<<( std::ostream& os, const PackedAccessProxy<MT>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedAccessProxy global functions */
+//@{
+template< typename MT >
+inline void reset( const PackedAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline void clear( const PackedAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isDefault( const PackedAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline void swap( const PackedAccessProxy<MT>& a, const PackedAccessProxy<MT>& b ) /* throw() */;
+
+template< typename MT, typename T >
+inline void swap( const PackedAccessProxy<MT>& a, T& b ) /* throw() */;
+
+template< typename T, typename MT >
+inline void swap( T& a, const PackedAccessProxy<MT>& v ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial value.
+// In case the access proxy represents a vector- or matrix-like data structure that provides a
+// reset() function, this function resets all elements of the vector/matrix to the default initial
+// values.
+*/
+template< typename MT >
+inline void reset( const PackedAccessProxy<MT>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial state.
+// In case the access proxy represents a vector- or matrix-like data structure that provides a
+// clear() function, this function clears the vector/matrix to its default initial state.
+*/
+template< typename MT >
+inline void clear( const PackedAccessProxy<MT>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isDefault( const PackedAccessProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two access proxies.
+// \ingroup math
+//
+// \param a The first access proxy to be swapped.
+// \param b The second access proxy to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename MT >
+inline void swap( const PackedAccessProxy<MT>& a, const PackedAccessProxy<MT>& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a.get(), b.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of an access proxy with another element.
+// \ingroup math
+//
+// \param a The access proxy to be swapped.
+// \param b The other element to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename MT, typename T >
+inline void swap( const PackedAccessProxy<MT>& a, T& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a.get(), b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of an access proxy with another element.
+// \ingroup math
+//
+// \param a The other element to be swapped.
+// \param b The access proxy to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename T, typename MT >
+inline void swap( T& a, const PackedAccessProxy<MT>& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a, b.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
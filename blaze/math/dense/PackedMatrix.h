@@ -0,0 +1,3371 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed triangular/symmetric NxN matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/PackedAccessProxy.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PackedLayout.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dynamic \f$ N \times N \f$ matrix in packed storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of a square lower, upper, or symmetric
+// matrix that only stores the \f$ N(N+1)/2 \f$ elements of one triangular half (including the
+// diagonal) in a single, contiguous array (comparable to the LAPACK "AP" format). In comparison
+// to a DynamicMatrix it requires only half the memory and all kernels only have to stream half
+// the data. The type of the elements, the packed layout and the storage order of the matrix can
+// be specified via the three template parameters:
+
+   \code
+   template< typename Type, PackedLayout PL, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - PL  : specifies the packed layout (blaze::packedLower, blaze::packedUpper, or
+//          blaze::packedSymmetric) of the matrix.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Depending on the storage order, the stored elements are either stored in a row-wise fashion
+// or in a column-wise fashion. Given the 3x3 lower matrix
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 0 & 0 \\
+                          2 & 3 & 0 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)\f]\n
+
+// in case of row-major order and the \a packedLower layout the elements are stored in the order
+
+                          \f[\left(\begin{array}{*{6}{c}}
+                          1 & 2 & 3 & 4 & 5 & 6. \\
+                          \end{array}\right)\f]
+
+// In case of column-major order the elements are stored in the order
+
+                          \f[\left(\begin{array}{*{6}{c}}
+                          1 & 2 & 4 & 3 & 5 & 6. \\
+                          \end{array}\right)\f]
+
+// In case of the \a packedLower and \a packedUpper layouts the elements of the unstored half
+// are always 0. The attempt to set such an element to a non-default value results in a
+// \a std::invalid_argument exception. In case of the \a packedSymmetric layout the elements of
+// the unstored half mirror the stored elements, i.e. both \c A(i,j) and \c A(j,i) refer to the
+// same stored element. Since the same triangular half is stored for both storage orders, a
+// row-major and a column-major symmetric packed matrix share the same memory layout.
+//
+// The PackedMatrix is primarily meant as compact storage for the LowerMatrix, UpperMatrix, and
+// SymmetricMatrix adaptors, which provide the according compile time information and enforce
+// their invariant on top of the packed storage:
+
+   \code
+   using blaze::LowerMatrix;
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::packedLower;
+   using blaze::packedSymmetric;
+
+   SymmetricMatrix< PackedMatrix<double,packedSymmetric> > C( 50000UL );  // 1.25e9 stored elements
+   LowerMatrix< PackedMatrix<double,packedLower> > L( 3UL );
+
+   L(2,1) = 2.0;  // Setting the stored element (2,1)
+   L(1,2) = 1.0;  // Invalid assignment to an unstored element; results in an exception!
+   \endcode
+
+// Nonetheless, a PackedMatrix can also be used on its own with all dense matrix operations of
+// the \b Blaze library. All assignments check that the assigned matrix fits into the packed
+// layout and throw a \a std::invalid_argument exception in case it does not. Note that the
+// PackedMatrix does not provide direct access to full rows/columns via data(), but only to the
+// stored part of each row/column. Therefore all kernels that require contiguous rows/columns
+// (as for instance the BLAS kernels) are not used for packed matrices. Instead, the conversion
+// from the full format and all element-wise operations between packed matrices of the same
+// layout are vectorized on the contiguous stored parts.
+*/
+template< typename Type                    // Data type of the matrix
+        , PackedLayout PL                  // Packed layout
+        , bool SO = defaultStorageOrder >  // Storage order
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,PL,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the mirroring of the unstored elements.
+   enum { symmetric = ( PL == packedSymmetric ) };
+
+   //! Compilation switch for the stored part of each row/column.
+   /*! In case \a prefix is set to 1, row/column \a k stores the elements with index \f$ [0..k] \f$,
+       in case it is set to 0, row/column \a k stores the elements with index \f$ [k..N-1] \f$. */
+   enum { prefix = symmetric || ( ( PL == packedLower ) != SO ) };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,PL,SO>   This;            //!< Type of this PackedMatrix instance.
+   typedef This                       ResultType;      //!< Result type for expression template evaluations.
+   typedef PackedMatrix<Type,PL,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+
+   //! Transpose type for expression template evaluations.
+   typedef PackedMatrix< Type
+                       , ( PL == packedLower )?( packedUpper ):
+                         ( PL == packedUpper )?( packedLower ):( packedSymmetric )
+                       , !SO >  TransposeType;
+
+   typedef Type                       ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                CompositeType;   //!< Data type for composite expression templates.
+   typedef PackedAccessProxy<This>    Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                      Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                ConstPointer;    //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,PL,SO>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**PackedIterator class definition*************************************************************
+   /*!\brief Iterator over the elements of a single row/column of the packed matrix.
+   //
+   // In contrast to the iterators of other dense matrices, the PackedIterator traverses the
+   // complete row/column, including the unstored elements. It is used both as iterator over
+   // non-constant elements (in which case it returns a PackedAccessProxy) and as iterator over
+   // constant elements.
+   */
+   template< typename MatrixType >  // Type of the packed matrix
+   class PackedIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Return type of the element access operator.
+      typedef typename If< IsConst<MatrixType>, ConstReference, Reference >::Type  RT;
+
+      //! Pointer type of the iterator.
+      typedef typename If< IsConst<MatrixType>, ConstPointer, Reference >::Type  PT;
+
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef PT                               PointerType;       //!< Pointer return type.
+      typedef RT                               ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the PackedIterator class.
+      */
+      inline PackedIterator()
+         : matrix_( NULL )  // Pointer to the packed matrix
+         , row_   ( 0UL  )  // The current row index of the iterator
+         , column_( 0UL  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the PackedIterator class.
+      //
+      // \param matrix The packed matrix.
+      // \param row Initial row index of the iterator.
+      // \param column Initial column index of the iterator.
+      */
+      inline PackedIterator( MatrixType& matrix, size_t row, size_t column )
+         : matrix_( &matrix )  // Pointer to the packed matrix
+         , row_   ( row     )  // The current row index of the iterator
+         , column_( column  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different PackedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2 >
+      inline PackedIterator( const PackedIterator<MatrixType2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the packed matrix
+         , row_   ( it.row_    )  // The current row index of the iterator
+         , column_( it.column_ )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline PackedIterator& operator+=( size_t inc ) {
+         ( SO )?( row_ += inc ):( column_ += inc );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline PackedIterator& operator-=( size_t dec ) {
+         ( SO )?( row_ -= dec ):( column_ -= dec );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline PackedIterator& operator++() {
+         ( SO )?( ++row_ ):( ++column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator++( int ) {
+         const PackedIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline PackedIterator& operator--() {
+         ( SO )?( --row_ ):( --column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator--( int ) {
+         const PackedIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)( row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator==( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ == rhs.row_ ):( lhs.column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator!=( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ != rhs.row_ ):( lhs.column_ != rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator<( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ < rhs.row_ ):( lhs.column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator>( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ > rhs.row_ ):( lhs.column_ > rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator<=( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ <= rhs.row_ ):( lhs.column_ <= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename MatrixType2 >
+      friend inline bool operator>=( const PackedIterator& lhs, const PackedIterator<MatrixType2>& rhs ) {
+         return ( SO )?( lhs.row_ >= rhs.row_ ):( lhs.column_ >= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const PackedIterator& rhs ) const {
+         return ( SO )?( row_ - rhs.row_ ):( column_ - rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) {
+         if( SO )
+            return PackedIterator( *it.matrix_, it.row_ + inc, it.column_ );
+         else
+            return PackedIterator( *it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a PackedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) {
+         if( SO )
+            return PackedIterator( *it.matrix_, it.row_ + inc, it.column_ );
+         else
+            return PackedIterator( *it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) {
+         if( SO )
+            return PackedIterator( *it.matrix_, it.row_ - dec, it.column_ );
+         else
+            return PackedIterator( *it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< Pointer to the packed matrix.
+      size_t      row_;     //!< The current row index of the iterator.
+      size_t      column_;  //!< The current column index of the iterator.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2 > friend class PackedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PackedIterator<This>        Iterator;       //!< Iterator over non-constant elements.
+   typedef PackedIterator<const This>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows/columns of a packed matrix are not
+       stored in full, the \a vectorizable flag is always set to 0. Note that the conversion
+       from the full format is nonetheless vectorized. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix();
+   explicit inline PackedMatrix( size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n, const Type& init );
+            inline PackedMatrix( const PackedMatrix& m );
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   inline Pointer        data  ( size_t i );
+   inline ConstPointer   data  ( size_t i ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& set );
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        spacing() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t i ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+                              inline void          clear();
+                                     void          resize ( size_t m, size_t n, bool preserve=true );
+                              inline void          extend ( size_t n, bool preserve=true );
+                              inline void          reserve( size_t elements );
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+                              inline void          swap( PackedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the detection of matrix types that are known to fit the packed layout.
+   /*! A matrix type is known to fit the packed layout in case it is a lower, upper, or symmetric
+       matrix, respectively, or in case its result type is a packed matrix of the same layout. */
+   template< typename MT >
+   struct IsPackable {
+      typedef typename MT::ResultType   RT;
+      typedef typename RT::ElementType  ET;
+
+      enum { value = ( PL == packedLower     && IsLower<MT>::value     ) ||
+                     ( PL == packedUpper     && IsUpper<MT>::value     ) ||
+                     ( PL == packedSymmetric && IsSymmetric<MT>::value ) ||
+                     IsSame< RT, PackedMatrix<ET,PL,false> >::value ||
+                     IsSame< RT, PackedMatrix<ET,PL,true > >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT, bool SO2 >
+   struct VectorizedAssign {
+      enum { value = IsVectorizable<Type>::value && MT::vectorizable && SO == SO2 &&
+                     IsSame<Type,typename MT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT, bool SO2 >
+   struct VectorizedAddAssign {
+      enum { value = IsVectorizable<Type>::value && MT::vectorizable && SO == SO2 &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT, bool SO2 >
+   struct VectorizedSubAssign {
+      enum { value = IsVectorizable<Type>::value && MT::vectorizable && SO == SO2 &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename Other >
+   struct VectorizedPackedAssign {
+      enum { value = IsVectorizable<Type>::value && IsSame<Type,Other>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename Other >
+   struct VectorizedPackedAddAssign {
+      enum { value = IsVectorizable<Type>::value && IsSame<Type,Other>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename Other >
+   struct VectorizedPackedSubAssign {
+      enum { value = IsVectorizable<Type>::value && IsSame<Type,Other>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 >
+   inline typename DisableIf< VectorizedAssign<MT,SO2> >::Type
+      assign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline typename EnableIf< VectorizedAssign<MT,SO2> >::Type
+      assign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename DisableIf< VectorizedPackedAssign<Other> >::Type
+      assign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< VectorizedPackedAssign<Other> >::Type
+      assign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void assign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline typename DisableIf< VectorizedAddAssign<MT,SO2> >::Type
+      addAssign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline typename EnableIf< VectorizedAddAssign<MT,SO2> >::Type
+      addAssign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename DisableIf< VectorizedPackedAddAssign<Other> >::Type
+      addAssign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< VectorizedPackedAddAssign<Other> >::Type
+      addAssign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline typename DisableIf< VectorizedSubAssign<MT,SO2> >::Type
+      subAssign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline typename EnableIf< VectorizedSubAssign<MT,SO2> >::Type
+      subAssign( const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename DisableIf< VectorizedPackedSubAssign<Other> >::Type
+      subAssign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< VectorizedPackedSubAssign<Other> >::Type
+      subAssign( const PackedMatrix<Other,PL,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t packedSize ( size_t n );
+   static inline size_t storedBegin( size_t k );
+   static inline size_t storedEnd  ( size_t k, size_t n );
+   static inline size_t offset     ( size_t k, size_t n );
+
+   inline Type*       address( size_t i, size_t j );
+   inline const Type* address( size_t i, size_t j ) const;
+
+   template< typename MT, bool SO2 >
+   static inline bool isPackable( const Matrix<MT,SO2>& m );
+
+   template< typename Other, bool SO2 >
+   static inline bool isPackable( const PackedMatrix<Other,PL,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows/columns of the matrix.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The stored matrix elements.
+                             /*!< Access to the matrix elements is gained via the function call
+                                  operator. The stored elements of each row/column are stored
+                                  contiguously, the rows/columns themselves are stored one after
+                                  another without any padding. */
+
+   static const Type zero_;  //!< Neutral element for accesses to unstored zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, PackedLayout PL, bool SO >
+const Type PackedMatrix<Type,PL,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::PackedMatrix()
+   : n_       ( 0UL  )  // The current number of rows/columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$. No element initialization is performed!
+//
+// \param n The number of rows and columns of the matrix.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::PackedMatrix( size_t n )
+   : n_       ( n                              )  // The current number of rows/columns of the matrix
+   , capacity_( packedSize( n )                )  // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ )    )  // The stored matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$. No element initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor is only responsible to allocate the required dynamic memory. No element
+// initialization is performed! In case the given number of rows and columns don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::PackedMatrix( size_t m, size_t n )
+   : n_       ( n    )  // The current number of rows/columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+{
+   if( m != n )
+      throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+   capacity_ = packedSize( n_ );
+   v_ = allocate<Type>( capacity_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all stored \f$ M \times N \f$ matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the stored matrix elements.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// All stored matrix elements are initialized with the specified value. In case of the
+// \a packedLower and \a packedUpper layouts, the unstored elements remain 0. In case the
+// given number of rows and columns don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::PackedMatrix( size_t m, size_t n, const Type& init )
+   : n_       ( n    )  // The current number of rows/columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+{
+   if( m != n )
+      throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+   capacity_ = packedSize( n_ );
+   v_ = allocate<Type>( capacity_ );
+
+   std::fill( v_, v_+capacity_, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_                        )  // The current number of rows/columns of the matrix
+   , capacity_( packedSize( n_ )            )  // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The stored matrix elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor initializes the packed matrix as a copy of the given matrix. In case the
+// given matrix is not square or does not fit into the packed layout (i.e. in case it is not
+// lower, upper, or symmetric, respectively), a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT        // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline PackedMatrix<Type,PL,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : n_       ( (~m).rows() )  // The current number of rows/columns of the matrix
+   , capacity_( 0UL         )  // The maximum capacity of the matrix
+   , v_       ( NULL        )  // The stored matrix elements
+{
+   if( !isSquare( ~m ) )
+      throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+   if( IsComputation<MT>::value && !IsPackable<MT>::value )
+   {
+      const typename MT::ResultType tmp( ~m );
+
+      if( !isPackable( tmp ) )
+         throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+      capacity_ = packedSize( n_ );
+      v_ = allocate<Type>( capacity_ );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      smpAssign( *this, tmp );
+   }
+   else
+   {
+      if( !isPackable( ~m ) )
+         throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+      capacity_ = packedSize( n_ );
+      v_ = allocate<Type>( capacity_ );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      smpAssign( *this, ~m );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// The function returns a proxy to the accessed element. In case of the \a packedLower and
+// \a packedUpper layouts, the attempt to assign a non-default value to an unstored element
+// results in a \a std::invalid_argument exception. In case of the \a packedSymmetric layout,
+// the elements (i,j) and (j,i) refer to the same stored element.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::Reference
+   PackedMatrix<Type,PL,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return Reference( address( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstReference
+   PackedMatrix<Type,PL,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   const Type* const element( address( i, j ) );
+   return ( element != NULL )?( *element ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that in
+// contrast to other dense matrices only the \f$ N(N+1)/2 \f$ stored elements are contained in
+// the array and that the rows/columns are stored without any padding.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::Pointer PackedMatrix<Type,PL,SO>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. Note that in
+// contrast to other dense matrices only the \f$ N(N+1)/2 \f$ stored elements are contained in
+// the array and that the rows/columns are stored without any padding.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstPointer PackedMatrix<Type,PL,SO>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns a pointer to the first
+// stored element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns a pointer to the first stored element of column \a i. Row/column \a i contains
+// capacity(i) stored elements.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::Pointer PackedMatrix<Type,PL,SO>::data( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns a pointer to the first
+// stored element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns a pointer to the first stored element of column \a i. Row/column \a i contains
+// capacity(i) stored elements.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstPointer PackedMatrix<Type,PL,SO>::data( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::Iterator PackedMatrix<Type,PL,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( Iterator( *this, 0UL, i ) ):( Iterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstIterator
+   PackedMatrix<Type,PL,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstIterator
+   PackedMatrix<Type,PL,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::Iterator PackedMatrix<Type,PL,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( Iterator( *this, n_, i ) ):( Iterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstIterator
+   PackedMatrix<Type,PL,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, n_, i ) ):( ConstIterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline typename PackedMatrix<Type,PL,SO>::ConstIterator
+   PackedMatrix<Type,PL,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, n_, i ) ):( ConstIterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all stored matrix elements.
+//
+// \param rhs Scalar value to be assigned to all stored matrix elements.
+// \return Reference to the assigned matrix.
+//
+// In case of the \a packedLower and \a packedUpper layouts, the unstored elements remain 0.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+packedSize( n_ ), rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, rhs.n_, false );
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not square or does not fit into the packed
+// layout (i.e. in case it is not lower, upper, or symmetric, respectively), a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( !isSquare( ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+   if( IsComputation<MT>::value && !IsPackable<MT>::value )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !isPackable( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      resize( tmp.rows(), tmp.columns(), false );
+      if( IsSparseMatrix<MT>::value )
+         reset();
+      smpAssign( *this, tmp );
+   }
+   else
+   {
+      if( !isPackable( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      if( (~rhs).canAlias( this ) ) {
+         PackedMatrix tmp( ~rhs );
+         swap( tmp );
+      }
+      else {
+         resize( (~rhs).rows(), (~rhs).columns(), false );
+         if( IsSparseMatrix<MT>::value )
+            reset();
+         smpAssign( *this, ~rhs );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. Also, in case the result of the addition does not fit into the packed layout, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( ( IsComputation<MT>::value && !IsPackable<MT>::value ) || (~rhs).canAlias( this ) )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !isPackable( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      smpAddAssign( *this, tmp );
+   }
+   else
+   {
+      if( !isPackable( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. Also, in case the result of the subtraction does not fit into the packed layout, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( ( IsComputation<MT>::value && !IsPackable<MT>::value ) || (~rhs).canAlias( this ) )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !isPackable( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      smpSubAssign( *this, tmp );
+   }
+   else
+   {
+      if( !isPackable( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown. Also, in case the result of the multiplication does not fit into the packed layout,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   PackedMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PL,SO> >::Type&
+   PackedMatrix<Type,PL,SO>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PL,SO> >::Type&
+   PackedMatrix<Type,PL,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// Since the rows/columns of a packed matrix are stored without any padding and with varying
+// length, there is no fixed spacing between two rows/columns. For compatibility with other
+// dense matrices the function returns the number of rows/columns of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::spacing() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns the number of stored
+// elements of row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of stored elements of column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+   return storedEnd( i, n_ ) - storedBegin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the packed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      const Type* const v( v_ + offset( k, n_ ) - lbegin );
+      for( size_t l=lbegin; l<lend; ++l ) {
+         if( !isDefault( v[l] ) )
+            nonzeros += ( symmetric && l != k )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      const Type* const element( ( SO )?( address( j, i ) ):( address( i, j ) ) );
+      if( element != NULL && !isDefault( *element ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t nn( packedSize( n_ ) );
+
+   for( size_t i=0UL; i<nn; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that in case of the \a packedSymmetric layout also the according column/row is reset.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      Type* const element( ( SO )?( address( j, i ) ):( address( i, j ) ) );
+      if( element != NULL )
+         clear( *element );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid resize of packed matrix.
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. In this case all new stored elements are initialized
+// to 0. In case the given number of rows and columns don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+void PackedMatrix<Type,PL,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( m != n )
+      throw std::invalid_argument( "Invalid resize of packed matrix" );
+
+   if( n == n_ ) return;
+
+   const size_t nn( packedSize( n ) );
+
+   if( preserve )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( nn );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t lbegin( storedBegin( k ) );
+         const size_t lend  ( storedEnd( k, n ) );
+         Type* const dst( v + offset( k, n ) - lbegin );
+
+         size_t l( lbegin );
+
+         if( k < min_n ) {
+            const size_t lpos( storedEnd( k, min_n ) );
+            const Type* const src( v_ + offset( k, n_ ) - lbegin );
+            for( ; l<lpos; ++l )
+               dst[l] = src[l];
+         }
+
+         for( ; l<lend; ++l )
+            dst[l] = Type();
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = nn;
+   }
+   else if( nn > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( nn );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = nn;
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a n rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Therefore
+// this function potentially changes all matrix elements. In order to preserve the old matrix
+// values, the \a preserve flag can be set to \a true. In this case all new stored elements are
+// initialized to 0.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::extend( size_t n, bool preserve )
+{
+   resize( n_+n, n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed matrix.
+// \return void
+//
+// This function increases the capacity of the packed matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      std::copy( v_, v_+packedSize( n_ ), tmp );
+
+      // Replacing the old array
+      std::swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline PackedMatrix<Type,PL,SO>& PackedMatrix<Type,PL,SO>::scale( const Other& scalar )
+{
+   const size_t nn( packedSize( n_ ) );
+
+   for( size_t i=0UL; i<nn; ++i )
+      v_[i] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void PackedMatrix<Type,PL,SO>::swap( PackedMatrix& m ) /* throw() */
+{
+   std::swap( n_, m.n_ );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of a packed \f$ N \times N \f$ matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::packedSize( size_t n )
+{
+   return ( n * ( n+1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \return The index of the first stored element.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::storedBegin( size_t k )
+{
+   return ( prefix )?( 0UL ):( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The index one past the last stored element.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::storedEnd( size_t k, size_t n )
+{
+   return ( prefix )?( k+1UL ):( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first stored element of row/column \a k in the array.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The position of the first stored element of row/column \a k.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline size_t PackedMatrix<Type,PL,SO>::offset( size_t k, size_t n )
+{
+   return ( prefix )?( ( k * ( k+1UL ) ) / 2UL )
+                    :( ( k * ( 2UL*n - k + 1UL ) ) / 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the stored element (i,j).
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Pointer to the stored element, \a NULL in case the element is not stored.
+//
+// In case of the \a packedSymmetric layout, the function returns the address of the stored
+// mirror element in case the element (i,j) itself is not stored.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline Type* PackedMatrix<Type,PL,SO>::address( size_t i, size_t j )
+{
+   const size_t k( ( SO )?( j ):( i ) );
+   const size_t l( ( SO )?( i ):( j ) );
+
+   if( l >= storedBegin( k ) && l < storedEnd( k, n_ ) )
+      return v_ + offset( k, n_ ) + l - storedBegin( k );
+   else if( symmetric )
+      return v_ + offset( l, n_ ) + k - storedBegin( l );
+   else return NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the stored element (i,j).
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Pointer to the stored element, \a NULL in case the element is not stored.
+//
+// In case of the \a packedSymmetric layout, the function returns the address of the stored
+// mirror element in case the element (i,j) itself is not stored.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline const Type* PackedMatrix<Type,PL,SO>::address( size_t i, size_t j ) const
+{
+   const size_t k( ( SO )?( j ):( i ) );
+   const size_t l( ( SO )?( i ):( j ) );
+
+   if( l >= storedBegin( k ) && l < storedEnd( k, n_ ) )
+      return v_ + offset( k, n_ ) + l - storedBegin( k );
+   else if( symmetric )
+      return v_ + offset( l, n_ ) + k - storedBegin( l );
+   else return NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix fits into the packed layout.
+//
+// \param m The matrix to be checked.
+// \return \a true in case the matrix fits into the packed layout, \a false if not.
+//
+// This function returns whether the given square matrix is a lower, upper, or symmetric matrix,
+// respectively. In case the type of the matrix already guarantees this property, the check is
+// skipped.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the matrix
+        , bool SO2 >        // Storage order of the matrix
+inline bool PackedMatrix<Type,PL,SO>::isPackable( const Matrix<MT,SO2>& m )
+{
+   if( IsPackable<MT>::value )
+      return true;
+
+   switch( PL ) {
+      case packedLower: return isLower( ~m );
+      case packedUpper: return isUpper( ~m );
+      default:          return isSymmetric( ~m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given packed matrix fits into the packed layout.
+//
+// \param m The packed matrix to be checked.
+// \return \a true.
+//
+// Packed matrices with the same packed layout always fit into the packed layout.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other    // Data type of the packed matrix
+        , bool SO2 >        // Storage order of the packed matrix
+inline bool PackedMatrix<Type,PL,SO>::isPackable( const PackedMatrix<Other,PL,SO2>& m )
+{
+   UNUSED_PARAMETER( m );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PL,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PL,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the rows/columns of a packed matrix are stored without any padding, the beginning of
+// the rows/columns is not guaranteed to conform to the alignment restrictions of the element
+// type \a Type. Therefore the function always returns \a false.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline bool PackedMatrix<Type,PL,SO>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline bool PackedMatrix<Type,PL,SO>::canSMPAssign() const
+{
+   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+      for( size_t l=lbegin; l<lend; ++l ) {
+         v[l] = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      const size_t lhead ( ( lbegin + IT::size - 1UL ) & size_t(-IT::size) );
+      const size_t lstart( ( lhead < lend )?( lhead ):( lend ) );
+      const size_t lpos  ( lstart + ( ( lend - lstart ) & size_t(-IT::size) ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+
+      size_t l( lbegin );
+
+      for( ; l<lstart; ++l ) {
+         v[l] = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+      for( ; l<lpos; l+=IT::size ) {
+         storeu( v+l, ( SO )?( (~rhs).load(l,k) ):( (~rhs).load(k,l) ) );
+      }
+      for( ; l<lend; ++l ) {
+         v[l] = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a packed matrix with the same layout.
+//
+// \param rhs The right-hand side packed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::assign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   const size_t nn( packedSize( n_ ) );
+   const Other* const src( rhs.data() );
+
+   for( size_t i=0UL; i<nn; ++i )
+      v_[i] = src[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a packed matrix with the same
+//        layout.
+//
+// \param rhs The right-hand side packed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::assign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t nn  ( packedSize( n_ ) );
+   const size_t ipos( nn & size_t(-IT::size) );
+   const Type* const src( rhs.data() );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=IT::size ) {
+      storeu( v_+i, loadu( src+i ) );
+   }
+   for( ; i<nn; ++i ) {
+      v_[i] = src[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PL,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( ( SO == SO2 )?( i ):( element->index() ) );
+         const size_t l( ( SO == SO2 )?( element->index() ):( i ) );
+         if( l >= storedBegin( k ) && l < storedEnd( k, n_ ) )
+            v_[offset( k, n_ )+l-storedBegin( k )] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+      for( size_t l=lbegin; l<lend; ++l ) {
+         v[l] += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      const size_t lhead ( ( lbegin + IT::size - 1UL ) & size_t(-IT::size) );
+      const size_t lstart( ( lhead < lend )?( lhead ):( lend ) );
+      const size_t lpos  ( lstart + ( ( lend - lstart ) & size_t(-IT::size) ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+
+      size_t l( lbegin );
+
+      for( ; l<lstart; ++l ) {
+         v[l] += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+      for( ; l<lpos; l+=IT::size ) {
+         storeu( v+l, loadu( v+l ) + ( ( SO )?( (~rhs).load(l,k) ):( (~rhs).load(k,l) ) ) );
+      }
+      for( ; l<lend; ++l ) {
+         v[l] += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a packed matrix with the same
+//        layout.
+//
+// \param rhs The right-hand side packed matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedAddAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::addAssign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   const size_t nn( packedSize( n_ ) );
+   const Other* const src( rhs.data() );
+
+   for( size_t i=0UL; i<nn; ++i )
+      v_[i] += src[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a packed matrix with
+//        the same layout.
+//
+// \param rhs The right-hand side packed matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedAddAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::addAssign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t nn  ( packedSize( n_ ) );
+   const size_t ipos( nn & size_t(-IT::size) );
+   const Type* const src( rhs.data() );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=IT::size ) {
+      storeu( v_+i, loadu( v_+i ) + loadu( src+i ) );
+   }
+   for( ; i<nn; ++i ) {
+      v_[i] += src[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PL,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( ( SO == SO2 )?( i ):( element->index() ) );
+         const size_t l( ( SO == SO2 )?( element->index() ):( i ) );
+         if( l >= storedBegin( k ) && l < storedEnd( k, n_ ) )
+            v_[offset( k, n_ )+l-storedBegin( k )] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+      for( size_t l=lbegin; l<lend; ++l ) {
+         v[l] -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT,SO2> >::Type
+   PackedMatrix<Type,PL,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t lbegin( storedBegin( k ) );
+      const size_t lend  ( storedEnd( k, n_ ) );
+      const size_t lhead ( ( lbegin + IT::size - 1UL ) & size_t(-IT::size) );
+      const size_t lstart( ( lhead < lend )?( lhead ):( lend ) );
+      const size_t lpos  ( lstart + ( ( lend - lstart ) & size_t(-IT::size) ) );
+      Type* const v( v_ + offset( k, n_ ) - lbegin );
+
+      size_t l( lbegin );
+
+      for( ; l<lstart; ++l ) {
+         v[l] -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+      for( ; l<lpos; l+=IT::size ) {
+         storeu( v+l, loadu( v+l ) - ( ( SO )?( (~rhs).load(l,k) ):( (~rhs).load(k,l) ) ) );
+      }
+      for( ; l<lend; ++l ) {
+         v[l] -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a packed matrix with the same
+//        layout.
+//
+// \param rhs The right-hand side packed matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename DisableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedSubAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::subAssign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   const size_t nn( packedSize( n_ ) );
+   const Other* const src( rhs.data() );
+
+   for( size_t i=0UL; i<nn; ++i )
+      v_[i] -= src[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a packed matrix
+//        with the same layout.
+//
+// \param rhs The right-hand side packed matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side packed matrix
+inline typename EnableIf< typename PackedMatrix<Type,PL,SO>::BLAZE_TEMPLATE VectorizedPackedSubAssign<Other> >::Type
+   PackedMatrix<Type,PL,SO>::subAssign( const PackedMatrix<Other,PL,SO>& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t nn  ( packedSize( n_ ) );
+   const size_t ipos( nn & size_t(-IT::size) );
+   const Type* const src( rhs.data() );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=IT::size ) {
+      storeu( v_+i, loadu( v_+i ) - loadu( src+i ) );
+   }
+   for( ; i<nn; ++i ) {
+      v_[i] -= src[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PL,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         const size_t k( ( SO == SO2 )?( i ):( element->index() ) );
+         const size_t l( ( SO == SO2 )?( element->index() ):( i ) );
+         if( l >= storedBegin( k ) && l < storedEnd( k, n_ ) )
+            v_[offset( k, n_ )+l-storedBegin( k )] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackedLayout PL, bool SO >
+inline void reset( PackedMatrix<Type,PL,SO>& m );
+
+template< typename Type, PackedLayout PL, bool SO >
+inline void reset( PackedMatrix<Type,PL,SO>& m, size_t i );
+
+template< typename Type, PackedLayout PL, bool SO >
+inline void clear( PackedMatrix<Type,PL,SO>& m );
+
+template< typename Type, PackedLayout PL, bool SO >
+inline bool isDefault( const PackedMatrix<Type,PL,SO>& m );
+
+template< typename Type, PackedLayout PL, bool SO >
+inline void swap( PackedMatrix<Type,PL,SO>& a, PackedMatrix<Type,PL,SO>& b ) /* throw() */;
+
+template< typename Type, PackedLayout PL, bool SO >
+inline void move( PackedMatrix<Type,PL,SO>& dst, PackedMatrix<Type,PL,SO>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void reset( PackedMatrix<Type,PL,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given packed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void reset( PackedMatrix<Type,PL,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void clear( PackedMatrix<Type,PL,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the packed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::PackedMatrix<int,blaze::packedLower> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline bool isDefault( const PackedMatrix<Type,PL,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void swap( PackedMatrix<Type,PL,SO>& a, PackedMatrix<Type,PL,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one packed matrix to another.
+// \ingroup packed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedLayout PL   // Packed layout
+        , bool SO >         // Storage order
+inline void move( PackedMatrix<Type,PL,SO>& dst, PackedMatrix<Type,PL,SO>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedLayout PL, bool SO >
+struct IsResizable< PackedMatrix<T,PL,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct AddTrait< PackedMatrix<T1,PL,SO>, PackedMatrix<T2,PL,SO> >
+{
+   typedef PackedMatrix< typename AddTrait<T1,T2>::Type, PL, SO >  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PL,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef PackedMatrix< typename AddTrait<T1,T2>::Type, PL, false >  Type;
+};
+
+template< typename T1, PackedLayout PL1, bool SO1, typename T2, PackedLayout PL2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PL1,SO1>, PackedMatrix<T2,PL2,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PL,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PL,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PL,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2, typename I2 >
+struct AddTrait< PackedMatrix<T1,PL,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, PackedLayout PL, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct SubTrait< PackedMatrix<T1,PL,SO>, PackedMatrix<T2,PL,SO> >
+{
+   typedef PackedMatrix< typename SubTrait<T1,T2>::Type, PL, SO >  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PL,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef PackedMatrix< typename SubTrait<T1,T2>::Type, PL, false >  Type;
+};
+
+template< typename T1, PackedLayout PL1, bool SO1, typename T2, PackedLayout PL2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PL1,SO1>, PackedMatrix<T2,PL2,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PL,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PL,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PL,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2, typename I2 >
+struct SubTrait< PackedMatrix<T1,PL,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, PackedLayout PL, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct MultTrait< PackedMatrix<T1,PL,SO>, T2 >
+{
+   typedef PackedMatrix< typename MultTrait<T1,T2>::Type, PL, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, PackedLayout PL, bool SO >
+struct MultTrait< T1, PackedMatrix<T2,PL,SO> >
+{
+   typedef PackedMatrix< typename MultTrait<T1,T2>::Type, PL, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, PackedLayout PL, bool SO, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,PL,SO>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, StaticVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, PackedLayout PL, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, PackedMatrix<T2,PL,SO> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,PL,SO>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, HybridVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, PackedLayout PL, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, PackedMatrix<T2,PL,SO> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct MultTrait< PackedMatrix<T1,PL,SO>, DynamicVector<T2,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, DynamicVector<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, PackedLayout PL, bool SO >
+struct MultTrait< DynamicVector<T1,true>, PackedMatrix<T2,PL,SO> >
+{
+   typedef typename MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO, typename T2, typename I2 >
+struct MultTrait< PackedMatrix<T1,PL,SO>, CompressedVector<T2,false,I2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false,I2> >::Type  Type;
+};
+
+template< typename T1, typename I1, typename T2, PackedLayout PL, bool SO >
+struct MultTrait< CompressedVector<T1,true,I1>, PackedMatrix<T2,PL,SO> >
+{
+   typedef typename MultTrait< CompressedVector<T1,true,I1>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PL,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PL,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PL,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackedLayout PL, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL, bool SO1, typename T2, bool SO2, typename I2 >
+struct MultTrait< PackedMatrix<T1,PL,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, PackedLayout PL, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, PackedMatrix<T2,PL,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackedLayout PL1, bool SO1, typename T2, PackedLayout PL2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PL1,SO1>, PackedMatrix<T2,PL2,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct DivTrait< PackedMatrix<T1,PL,SO>, T2 >
+{
+   typedef PackedMatrix< typename DivTrait<T1,T2>::Type, PL, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO, typename T2 >
+struct MathTrait< PackedMatrix<T1,PL,SO>, PackedMatrix<T2,PL,SO> >
+{
+   typedef PackedMatrix< typename MathTrait<T1,T2>::HighType, PL, SO >  HighType;
+   typedef PackedMatrix< typename MathTrait<T1,T2>::LowType , PL, SO >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO >
+struct SubmatrixTrait< PackedMatrix<T1,PL,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO >
+struct RowTrait< PackedMatrix<T1,PL,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedLayout PL, bool SO >
+struct ColumnTrait< PackedMatrix<T1,PL,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1081 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticMatrixBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup static_matrix_batch StaticMatrixBatch
+// \ingroup batch
+*/
+/*!\brief Efficient implementation of a batch of fixed-size matrices.
+// \ingroup static_matrix_batch
+//
+// The StaticMatrixBatch class template represents a resizable sequence of small, fixed-size
+// matrices of identical size. The type of the elements and the number of rows and columns of
+// the batch members can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class StaticMatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. StaticMatrixBatch can only be used with
+//          vectorizable element types.
+//  - M   : specifies the number of rows of the batch members.
+//  - N   : specifies the number of columns of the batch members.
+//
+// In contrast to a sequence of StaticMatrix instances, which fill an intrinsic vector only
+// partially (as for instance a 3x3 matrix of double precision values), StaticMatrixBatch stores
+// its members in an interleaved (struct of arrays) layout. The members are grouped into blocks
+// of \a IT::size members, where \a IT::size is the number of elements of an intrinsic vector.
+// Within a block, all \a IT::size values of the element (i,j) are stored contiguously:
+
+                     \f[\left(\begin{array}{*{5}{c}}
+                     A_0(0,0) & A_1(0,0) & \cdots & A_{W-1}(0,0) & A_0(0,1) & \cdots \\
+                     \end{array}\right)\f]
+
+// Therefore all batch operations (addition, subtraction, multiplication, transposition, scaling,
+// and the matrix/vector multiplication with a StaticVectorBatch) are executed on complete
+// intrinsic vectors, where each intrinsic lane processes a different batch member. Within the
+// performance critical loops, no horizontal operations and no partially filled intrinsic vectors
+// are required. Additionally, all batch operations are parallelized over the members of the
+// batch. The following example demonstrates the use of StaticMatrixBatch:
+
+   \code
+   using blaze::StaticMatrixBatch;
+   using blaze::StaticVectorBatch;
+
+   StaticMatrixBatch<double,3UL,3UL> A( 100000UL ), B( 100000UL ), C;
+   StaticVectorBatch<double,3UL> x( 100000UL ), y;
+
+   A(0UL,1UL,2UL) = 2.0;  // Setting the element (1,2) of the first matrix of the batch
+   B.set( 1UL, D );       // Setting the complete second matrix of the batch
+
+   C = A * B;            // Multiplication of all 100000 pairs of 3x3 matrices
+   C = trans( A ) + B;   // Addition of the transpose of all matrices in A and all matrices in B
+   y = A * x;            // Multiplication of all 100000 matrix/vector pairs
+   C *= 2.0;             // Scaling of all matrices in C
+   \endcode
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+class StaticMatrixBatch : public Batch< StaticMatrixBatch<Type,M,N> >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the batch element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrixBatch<Type,M,N>         This;            //!< Type of this StaticMatrixBatch instance.
+   typedef This                                ResultType;      //!< Result type for expression template evaluations.
+   typedef StaticMatrix<Type,M,N,rowMajor>     MemberType;      //!< Type of the batch members.
+   typedef Type                                ElementType;     //!< Type of the batch elements.
+   typedef typename IT::Type                   IntrinsicType;   //!< Intrinsic type of the batch elements.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                               Reference;       //!< Reference to a non-constant batch value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant batch value.
+   typedef Type*                               Pointer;         //!< Pointer to a non-constant batch value.
+   typedef const Type*                         ConstPointer;    //!< Pointer to a constant batch value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   /*! The \a rows and \a columns compilation flags represent the number of rows and columns
+       of the members of the batch. The \a isVector flag indicates that the batch members are
+       matrices. */
+   enum { rows = M, columns = N, isVector = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticMatrixBatch();
+   explicit inline StaticMatrixBatch( size_t n );
+   explicit inline StaticMatrixBatch( size_t n, const Type& init );
+            inline StaticMatrixBatch( const StaticMatrixBatch& b );
+   template< typename BT > inline StaticMatrixBatch( const Batch<BT>& b );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StaticMatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j );
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StaticMatrixBatch& operator=( const Type& rhs );
+   inline StaticMatrixBatch& operator=( const StaticMatrixBatch& rhs );
+
+   template< typename BT > inline StaticMatrixBatch& operator= ( const Batch<BT>& rhs );
+   template< typename BT > inline StaticMatrixBatch& operator+=( const Batch<BT>& rhs );
+   template< typename BT > inline StaticMatrixBatch& operator-=( const Batch<BT>& rhs );
+   template< typename BT > inline StaticMatrixBatch& operator*=( const Batch<BT>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, StaticMatrixBatch >::Type&
+      operator*=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t           size  () const;
+                              inline size_t           blocks() const;
+                              inline const MemberType get   ( size_t k ) const;
+   template< typename MT, bool SO > inline void       set   ( size_t k, const Matrix<MT,SO>& m );
+                              inline void             reset ();
+                              inline void             clear ();
+                              inline void             resize( size_t n, bool preserve=true );
+                              inline void             swap  ( StaticMatrixBatch& b ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t index       ( size_t k, size_t i, size_t j ) const;
+   inline void   resetMembers( size_t first, size_t last );
+   //@}
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   BLAZE_ALWAYS_INLINE void load ( size_t block, IntrinsicType* values ) const;
+   BLAZE_ALWAYS_INLINE void store( size_t block, const IntrinsicType* values );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;  //!< The current number of batch members.
+   Type* v_;   //!< The interleaved elements of the batch members.
+               /*!< Access to the element (i,j) of the k-th batch member is gained via the
+                    index (((k/IT::size)*M+i)*N+j)*IT::size+k%IT::size. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticMatrixBatch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch()
+   : n_( 0UL )   // The current number of batch members
+   , v_( NULL )  // The interleaved elements of the batch members
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of size \a n. No element initialization is performed!
+//
+// \param n The number of batch members.
+//
+// Note that this constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( size_t n )
+   : n_( n )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*M*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   resetMembers( n_, blocks()*IT::size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all elements of all batch members.
+//
+// \param n The number of batch members.
+// \param init The initial value of the batch elements.
+//
+// All elements of all \a n batch members are initialized with the given value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( size_t n, const Type& init )
+   : n_( n )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*M*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   resetMembers( n_, blocks()*IT::size );
+   *this = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StaticMatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( const StaticMatrixBatch& b )
+   : n_( b.n_ )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*M*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   std::copy( b.v_, b.v_ + blocks()*M*N*IT::size, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different batches.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename BT >  // Type of the foreign batch
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( const Batch<BT>& b )
+   : n_( (~b).size() )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*M*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   smpAssign( *this, ~b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StaticMatrixBatch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>::~StaticMatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the batch members.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline typename StaticMatrixBatch<Type,M,N>::Reference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i<M , "Invalid row access index"   );
+   BLAZE_USER_ASSERT( j<N , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the batch members.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline typename StaticMatrixBatch<Type,M,N>::ConstReference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i<M , "Invalid row access index"   );
+   BLAZE_USER_ASSERT( j<N , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// of the batch members are stored in an interleaved fashion (see the class description).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline typename StaticMatrixBatch<Type,M,N>::Pointer StaticMatrixBatch<Type,M,N>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// of the batch members are stored in an interleaved fashion (see the class description).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline typename StaticMatrixBatch<Type,M,N>::ConstPointer StaticMatrixBatch<Type,M,N>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements of all batch members.
+//
+// \param rhs Scalar value to be assigned to all batch elements.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator=( const Type& rhs )
+{
+   for( size_t k=0UL; k<n_; ++k )
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            v_[index(k,i,j)] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StaticMatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator=( const StaticMatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different batches.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+// Since the batch members are evaluated independently of each other, the given batch may
+// depend on this batch (as for instance in \c A = A * B).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename BT >  // Type of the right-hand side batch
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ ) {
+      StaticMatrixBatch tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a batch (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side batch to be added to the batch.
+// \return Reference to the batch.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// In case the current sizes of the two batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename BT >  // Type of the right-hand side batch
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator+=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   smpAddAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a batch (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side batch to be subtracted from the batch.
+// \return Reference to the batch.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// In case the current sizes of the two batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename BT >  // Type of the right-hand side batch
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator-=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   smpSubAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a batch (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side batch for the multiplication.
+// \return Reference to the batch.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This operator multiplies each batch member with the according member of the given batch.
+// In case the current sizes of the two batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename BT >  // Type of the right-hand side batch
+inline StaticMatrixBatch<Type,M,N>& StaticMatrixBatch<Type,M,N>::operator*=( const Batch<BT>& rhs )
+{
+   BLAZE_STATIC_ASSERT( size_t( BT::rows ) == N && size_t( BT::columns ) == N );
+
+   smpAssign( *this, (*this) * (~rhs) );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a batch and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the batch.
+*/
+template< typename Type     // Data type of the batch members
+        , size_t M          // Number of rows of the batch members
+        , size_t N >        // Number of columns of the batch members
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, StaticMatrixBatch<Type,M,N> >::Type&
+   StaticMatrixBatch<Type,M,N>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of batch members.
+//
+// \return The number of batch members.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline size_t StaticMatrixBatch<Type,M,N>::size() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of batch members.
+//
+// \return The number of blocks of batch members.
+//
+// Each block contains the elements of \a IT::size batch members, where \a IT::size is the
+// number of elements of an intrinsic vector. The last block may be partially filled.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline size_t StaticMatrixBatch<Type,M,N>::blocks() const
+{
+   return ( n_ + IT::size - 1UL ) / IT::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the specified batch member.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \return Copy of the k-th batch member.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline const typename StaticMatrixBatch<Type,M,N>::MemberType
+   StaticMatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+
+   MemberType member;
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         member(i,j) = v_[index(k,i,j)];
+
+   return member;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the specified batch member.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param m The new value of the batch member.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the given matrix is not a \a M x \a N matrix, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void StaticMatrixBatch<Type,M,N>::set( size_t k, const Matrix<MT,SO>& m )
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+
+   if( (~m).rows() != M || (~m).columns() != N )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         v_[index(k,i,j)] = (~m)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void StaticMatrixBatch<Type,M,N>::reset()
+{
+   using blaze::reset;
+
+   const size_t total( blocks()*M*N*IT::size );
+
+   for( size_t i=0UL; i<total; ++i )
+      reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void StaticMatrixBatch<Type,M,N>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of batch members.
+//
+// \param n The new number of batch members.
+// \param preserve \a true if the old batch members should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to the given number of members. During this operation, new
+// dynamic memory may be allocated in case the number of blocks changes. Note that in this case,
+// if \a preserve is set to \a true, the old members are copied and the new members are reset
+// to their default value. If \a preserve is set to \a false, the values of all batch members
+// are undefined after the resize operation.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void StaticMatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   if( n == n_ ) return;
+
+   const size_t oldBlocks( blocks() );
+   const size_t newBlocks( ( n + IT::size - 1UL ) / IT::size );
+
+   if( oldBlocks != newBlocks )
+   {
+      Type* v = allocate<Type>( newBlocks*M*N*IT::size );
+
+      if( preserve ) {
+         std::copy( v_, v_ + min( oldBlocks, newBlocks )*M*N*IT::size, v );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+   }
+
+   const size_t first( ( preserve )?( min( n, n_ ) ):( n ) );
+
+   n_ = n;
+
+   resetMembers( first, newBlocks*IT::size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void StaticMatrixBatch<Type,M,N>::swap( StaticMatrixBatch& b ) /* throw() */
+{
+   std::swap( n_, b.n_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the storage index of the element (i,j) of the k-th batch member.
+//
+// \param k Index of the batch member.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The index of the element within the element storage.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline size_t StaticMatrixBatch<Type,M,N>::index( size_t k, size_t i, size_t j ) const
+{
+   return ( ( ( k / IT::size )*M + i )*N + j )*IT::size + k % IT::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all elements of the batch members in the range \f$[first..last)\f$.
+//
+// \param first The index of the first batch member to be reset.
+// \param last The index one past the last batch member to be reset.
+// \return void
+//
+// This function is used to reset new batch members and the padding members of the last block.
+// The padding members are required to remain in their default state in order to guarantee
+// that they do not affect any batch operation.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void StaticMatrixBatch<Type,M,N>::resetMembers( size_t first, size_t last )
+{
+   using blaze::reset;
+
+   for( size_t k=first; k<last; ++k )
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            reset( v_[index(k,i,j)] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch is properly aligned in memory.
+//
+// \return \a true in case the batch is aligned, \a false if not.
+//
+// The elements of a StaticMatrixBatch are always properly aligned in memory.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline bool StaticMatrixBatch<Type,M,N>::isAligned() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch can be used in SMP assignments.
+//
+// \return \a true in case the batch can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the batch can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// batch members).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline bool StaticMatrixBatch<Type,M,N>::canSMPAssign() const
+{
+   return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of all elements of a block of batch members.
+//
+// \param block Index of the block of batch members.
+// \param values The target array for the \a M * \a N intrinsic values of the block.
+// \return void
+//
+// This function loads the complete given block of batch members. The intrinsic values are
+// written in row-major order to the given array, i.e. \a values[i*N+j] contains the element
+// (i,j) of all batch members of the block. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+BLAZE_ALWAYS_INLINE void
+   StaticMatrixBatch<Type,M,N>::load( size_t block, IntrinsicType* values ) const
+{
+   using blaze::load;
+
+   BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+
+   const Type* v( v_ + block*M*N*IT::size );
+
+   for( size_t k=0UL; k<M*N; ++k ) {
+      values[k] = load( v + k*IT::size );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of all elements of a block of batch members.
+//
+// \param block Index of the block of batch members.
+// \param values The \a M * \a N intrinsic values of the block to be stored.
+// \return void
+//
+// This function stores the complete given block of batch members. The intrinsic values are
+// expected in row-major order (see the load() function). This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+BLAZE_ALWAYS_INLINE void
+   StaticMatrixBatch<Type,M,N>::store( size_t block, const IntrinsicType* values )
+{
+   using blaze::store;
+
+   BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+
+   Type* v( v_ + block*M*N*IT::size );
+
+   for( size_t k=0UL; k<M*N; ++k ) {
+      store( v + k*IT::size, values[k] );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATICMATRIXBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( StaticMatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( StaticMatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup static_matrix_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void reset( StaticMatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup static_matrix_batch
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void clear( StaticMatrixBatch<Type,M,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup static_matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t M       // Number of rows of the batch members
+        , size_t N >     // Number of columns of the batch members
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1036 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticVectorBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup static_vector_batch StaticVectorBatch
+// \ingroup batch
+*/
+/*!\brief Efficient implementation of a batch of fixed-size vectors.
+// \ingroup static_vector_batch
+//
+// The StaticVectorBatch class template represents a resizable sequence of small, fixed-size
+// vectors of identical size. It is the vector counterpart of the StaticMatrixBatch class
+// template (see \ref static_matrix_batch). The type of the elements, the number of elements
+// and the transpose flag of the batch members can be specified via the three template
+// parameters:
+
+   \code
+   template< typename Type, size_t N, bool TF >
+   class StaticVectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. StaticVectorBatch can only be used with
+//          vectorizable element types.
+//  - N   : specifies the number of elements of the batch members.
+//  - TF  : specifies whether the batch members are row vectors (\a blaze::rowVector) or column
+//          vectors (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// Analogous to StaticMatrixBatch, the batch members are stored in an interleaved (struct of
+// arrays) layout, i.e. within a block of \a IT::size members all values of the i-th element
+// are stored contiguously. Within batch operations a column vector batch is treated as a batch
+// of \a N x 1 matrices and a row vector batch as a batch of 1 x \a N matrices. The following
+// example demonstrates the use of StaticVectorBatch:
+
+   \code
+   using blaze::StaticMatrixBatch;
+   using blaze::StaticVectorBatch;
+
+   StaticMatrixBatch<double,6UL,6UL> A( 100000UL );
+   StaticVectorBatch<double,6UL> x( 100000UL ), y( 100000UL ), z;
+
+   x(0UL,2UL) = 2.0;  // Setting the element 2 of the first vector of the batch
+   y.set( 1UL, v );   // Setting the complete second vector of the batch
+
+   z = A * x + y;       // Matrix/vector multiplication and addition for all batch members
+   z = trans( x ) * A;  // Vector/matrix multiplication for all batch members
+   \endcode
+*/
+template< typename Type                     // Data type of the batch members
+        , size_t N                          // Number of elements of the batch members
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class StaticVectorBatch : public Batch< StaticVectorBatch<Type,N,TF> >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the batch element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticVectorBatch<Type,N,TF>        This;            //!< Type of this StaticVectorBatch instance.
+   typedef This                                ResultType;      //!< Result type for expression template evaluations.
+   typedef StaticVector<Type,N,TF>             MemberType;      //!< Type of the batch members.
+   typedef Type                                ElementType;     //!< Type of the batch elements.
+   typedef typename IT::Type                   IntrinsicType;   //!< Intrinsic type of the batch elements.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                               Reference;       //!< Reference to a non-constant batch value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant batch value.
+   typedef Type*                               Pointer;         //!< Pointer to a non-constant batch value.
+   typedef const Type*                         ConstPointer;    //!< Pointer to a constant batch value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   /*! The \a rows and \a columns compilation flags represent the size of the members of the
+       batch: a column vector batch is treated as a batch of \a N x 1 matrices, a row vector
+       batch as a batch of 1 x \a N matrices. The \a isVector flag indicates that the batch
+       members are vectors. */
+   enum { rows    = ( TF == columnVector )?( N ):( 1UL )
+        , columns = ( TF == columnVector )?( 1UL ):( N )
+        , isVector = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticVectorBatch();
+   explicit inline StaticVectorBatch( size_t n );
+   explicit inline StaticVectorBatch( size_t n, const Type& init );
+            inline StaticVectorBatch( const StaticVectorBatch& b );
+   template< typename BT > inline StaticVectorBatch( const Batch<BT>& b );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StaticVectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i );
+   inline ConstReference operator()( size_t k, size_t i ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StaticVectorBatch& operator=( const Type& rhs );
+   inline StaticVectorBatch& operator=( const StaticVectorBatch& rhs );
+
+   template< typename BT > inline StaticVectorBatch& operator= ( const Batch<BT>& rhs );
+   template< typename BT > inline StaticVectorBatch& operator+=( const Batch<BT>& rhs );
+   template< typename BT > inline StaticVectorBatch& operator-=( const Batch<BT>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, StaticVectorBatch >::Type&
+      operator*=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t           size  () const;
+                              inline size_t           blocks() const;
+                              inline const MemberType get   ( size_t k ) const;
+   template< typename VT >    inline void             set   ( size_t k, const Vector<VT,TF>& v );
+                              inline void             reset ();
+                              inline void             clear ();
+                              inline void             resize( size_t n, bool preserve=true );
+                              inline void             swap  ( StaticVectorBatch& b ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t index       ( size_t k, size_t i ) const;
+   inline void   resetMembers( size_t first, size_t last );
+   //@}
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   BLAZE_ALWAYS_INLINE void load ( size_t block, IntrinsicType* values ) const;
+   BLAZE_ALWAYS_INLINE void store( size_t block, const IntrinsicType* values );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;  //!< The current number of batch members.
+   Type* v_;   //!< The interleaved elements of the batch members.
+               /*!< Access to the element i of the k-th batch member is gained via the
+                    index ((k/IT::size)*N+i)*IT::size+k%IT::size. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE ( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticVectorBatch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>::StaticVectorBatch()
+   : n_( 0UL )   // The current number of batch members
+   , v_( NULL )  // The interleaved elements of the batch members
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of size \a n. No element initialization is performed!
+//
+// \param n The number of batch members.
+//
+// Note that this constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>::StaticVectorBatch( size_t n )
+   : n_( n )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   resetMembers( n_, blocks()*IT::size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all elements of all batch members.
+//
+// \param n The number of batch members.
+// \param init The initial value of the batch elements.
+//
+// All elements of all \a n batch members are initialized with the given value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>::StaticVectorBatch( size_t n, const Type& init )
+   : n_( n )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   resetMembers( n_, blocks()*IT::size );
+   *this = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StaticVectorBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>::StaticVectorBatch( const StaticVectorBatch& b )
+   : n_( b.n_ )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   std::copy( b.v_, b.v_ + blocks()*N*IT::size, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different batches.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+template< typename BT >  // Type of the foreign batch
+inline StaticVectorBatch<Type,N,TF>::StaticVectorBatch( const Batch<BT>& b )
+   : n_( (~b).size() )  // The current number of batch members
+   , v_( allocate<Type>( blocks()*N*IT::size ) )  // The interleaved elements of the batch members
+{
+   smpAssign( *this, ~b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StaticVectorBatch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>::~StaticVectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the batch members.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline typename StaticVectorBatch<Type,N,TF>::Reference
+   StaticVectorBatch<Type,N,TF>::operator()( size_t k, size_t i )
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i<N , "Invalid vector access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the batch members.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline typename StaticVectorBatch<Type,N,TF>::ConstReference
+   StaticVectorBatch<Type,N,TF>::operator()( size_t k, size_t i ) const
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i<N , "Invalid vector access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// of the batch members are stored in an interleaved fashion (see the class description).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline typename StaticVectorBatch<Type,N,TF>::Pointer StaticVectorBatch<Type,N,TF>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// of the batch members are stored in an interleaved fashion (see the class description).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline typename StaticVectorBatch<Type,N,TF>::ConstPointer StaticVectorBatch<Type,N,TF>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements of all batch members.
+//
+// \param rhs Scalar value to be assigned to all batch elements.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>& StaticVectorBatch<Type,N,TF>::operator=( const Type& rhs )
+{
+   for( size_t k=0UL; k<n_; ++k )
+      for( size_t i=0UL; i<N; ++i )
+         v_[index(k,i)] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StaticVectorBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline StaticVectorBatch<Type,N,TF>& StaticVectorBatch<Type,N,TF>::operator=( const StaticVectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different batches.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+// Since the batch members are evaluated independently of each other, the given batch may
+// depend on this batch (as for instance in \c A = A * B).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+template< typename BT >  // Type of the right-hand side batch
+inline StaticVectorBatch<Type,N,TF>& StaticVectorBatch<Type,N,TF>::operator=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ ) {
+      StaticVectorBatch tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a batch (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side batch to be added to the batch.
+// \return Reference to the batch.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// In case the current sizes of the two batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+template< typename BT >  // Type of the right-hand side batch
+inline StaticVectorBatch<Type,N,TF>& StaticVectorBatch<Type,N,TF>::operator+=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   smpAddAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a batch (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side batch to be subtracted from the batch.
+// \return Reference to the batch.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// In case the current sizes of the two batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+template< typename BT >  // Type of the right-hand side batch
+inline StaticVectorBatch<Type,N,TF>& StaticVectorBatch<Type,N,TF>::operator-=( const Batch<BT>& rhs )
+{
+   if( (~rhs).size() != n_ )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   smpSubAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a batch and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the batch.
+*/
+template< typename Type     // Data type of the batch members
+        , size_t N          // Number of elements of the batch members
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, StaticVectorBatch<Type,N,TF> >::Type&
+   StaticVectorBatch<Type,N,TF>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of batch members.
+//
+// \return The number of batch members.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline size_t StaticVectorBatch<Type,N,TF>::size() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of batch members.
+//
+// \return The number of blocks of batch members.
+//
+// Each block contains the elements of \a IT::size batch members, where \a IT::size is the
+// number of elements of an intrinsic vector. The last block may be partially filled.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline size_t StaticVectorBatch<Type,N,TF>::blocks() const
+{
+   return ( n_ + IT::size - 1UL ) / IT::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the specified batch member.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \return Copy of the k-th batch member.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline const typename StaticVectorBatch<Type,N,TF>::MemberType
+   StaticVectorBatch<Type,N,TF>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+
+   MemberType member;
+
+   for( size_t i=0UL; i<N; ++i )
+      member[i] = v_[index(k,i)];
+
+   return member;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the specified batch member.
+//
+// \param k Index of the batch member in the range \f$[0..size-1]\f$.
+// \param v The new value of the batch member.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the size of the given vector is not \a N, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the vector
+inline void StaticVectorBatch<Type,N,TF>::set( size_t k, const Vector<VT,TF>& v )
+{
+   BLAZE_USER_ASSERT( k<n_, "Invalid batch access index" );
+
+   if( (~v).size() != N )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   for( size_t i=0UL; i<N; ++i )
+      v_[index(k,i)] = (~v)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void StaticVectorBatch<Type,N,TF>::reset()
+{
+   using blaze::reset;
+
+   const size_t total( blocks()*N*IT::size );
+
+   for( size_t i=0UL; i<total; ++i )
+      reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void StaticVectorBatch<Type,N,TF>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of batch members.
+//
+// \param n The new number of batch members.
+// \param preserve \a true if the old batch members should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to the given number of members. During this operation, new
+// dynamic memory may be allocated in case the number of blocks changes. Note that in this case,
+// if \a preserve is set to \a true, the old members are copied and the new members are reset
+// to their default value. If \a preserve is set to \a false, the values of all batch members
+// are undefined after the resize operation.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void StaticVectorBatch<Type,N,TF>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   if( n == n_ ) return;
+
+   const size_t oldBlocks( blocks() );
+   const size_t newBlocks( ( n + IT::size - 1UL ) / IT::size );
+
+   if( oldBlocks != newBlocks )
+   {
+      Type* v = allocate<Type>( newBlocks*N*IT::size );
+
+      if( preserve ) {
+         std::copy( v_, v_ + min( oldBlocks, newBlocks )*N*IT::size, v );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+   }
+
+   const size_t first( ( preserve )?( min( n, n_ ) ):( n ) );
+
+   n_ = n;
+
+   resetMembers( first, newBlocks*IT::size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void StaticVectorBatch<Type,N,TF>::swap( StaticVectorBatch& b ) /* throw() */
+{
+   std::swap( n_, b.n_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the storage index of the element i of the k-th batch member.
+//
+// \param k Index of the batch member.
+// \param i The index of the element.
+// \return The index of the element within the element storage.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline size_t StaticVectorBatch<Type,N,TF>::index( size_t k, size_t i ) const
+{
+   return ( ( k / IT::size )*N + i )*IT::size + k % IT::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all elements of the batch members in the range \f$[first..last)\f$.
+//
+// \param first The index of the first batch member to be reset.
+// \param last The index one past the last batch member to be reset.
+// \return void
+//
+// This function is used to reset new batch members and the padding members of the last block.
+// The padding members are required to remain in their default state in order to guarantee
+// that they do not affect any batch operation.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void StaticVectorBatch<Type,N,TF>::resetMembers( size_t first, size_t last )
+{
+   using blaze::reset;
+
+   for( size_t k=first; k<last; ++k )
+      for( size_t i=0UL; i<N; ++i )
+         reset( v_[index(k,i)] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch is properly aligned in memory.
+//
+// \return \a true in case the batch is aligned, \a false if not.
+//
+// The elements of a StaticVectorBatch are always properly aligned in memory.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline bool StaticVectorBatch<Type,N,TF>::isAligned() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the batch can be used in SMP assignments.
+//
+// \return \a true in case the batch can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the batch can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// batch members).
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline bool StaticVectorBatch<Type,N,TF>::canSMPAssign() const
+{
+   return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of all elements of a block of batch members.
+//
+// \param block Index of the block of batch members.
+// \param values The target array for the \a N intrinsic values of the block.
+// \return void
+//
+// This function loads the complete given block of batch members, i.e. \a values[i] contains
+// the element i of all batch members of the block. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE void
+   StaticVectorBatch<Type,N,TF>::load( size_t block, IntrinsicType* values ) const
+{
+   using blaze::load;
+
+   BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+
+   const Type* v( v_ + block*N*IT::size );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      values[k] = load( v + k*IT::size );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of all elements of a block of batch members.
+//
+// \param block Index of the block of batch members.
+// \param values The \a N intrinsic values of the block to be stored.
+// \return void
+//
+// This function stores the complete given block of batch members (see the load() function). This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE void
+   StaticVectorBatch<Type,N,TF>::store( size_t block, const IntrinsicType* values )
+{
+   using blaze::store;
+
+   BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+
+   Type* v( v_ + block*N*IT::size );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      store( v + k*IT::size, values[k] );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATICVECTORBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticVectorBatch operators */
+//@{
+template< typename Type, size_t N, bool TF >
+inline void reset( StaticVectorBatch<Type,N,TF>& b );
+
+template< typename Type, size_t N, bool TF >
+inline void clear( StaticVectorBatch<Type,N,TF>& b );
+
+template< typename Type, size_t N, bool TF >
+inline void swap( StaticVectorBatch<Type,N,TF>& a, StaticVectorBatch<Type,N,TF>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup static_vector_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void reset( StaticVectorBatch<Type,N,TF>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup static_vector_batch
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void clear( StaticVectorBatch<Type,N,TF>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup static_vector_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the batch members
+        , size_t N       // Number of elements of the batch members
+        , bool TF >      // Transpose flag
+inline void swap( StaticVectorBatch<Type,N,TF>& a, StaticVectorBatch<Type,N,TF>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,92 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/InstructionSet.h
+//  \brief Header file for the instruction sets of the runtime dispatched kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instruction sets of the runtime dispatched kernels.
+// \ingroup math
+//
+// In case the runtime dispatch mode is active (see the BLAZE_USE_RUNTIME_DISPATCH switch),
+// the dispatched kernels of the Blaze library are compiled for each of the following
+// instruction sets. The variant for the most powerful instruction set supported by the
+// executing CPU is selected once at program startup.
+*/
+enum InstructionSet
+{
+   sse2InstructionSet   = 0,  //!< SSE2 kernels.
+   avxInstructionSet    = 1,  //!< AVX kernels.
+   avx2InstructionSet   = 2,  //!< AVX2 kernels with fused multiply-add operations.
+   avx512InstructionSet = 3   //!< AVX-512 kernels.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+#if BLAZE_DISPATCH_MODE
+InstructionSet instructionSet();
+#endif
+//@}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Header file for the runtime dispatched dense kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELS_H_
+#define _BLAZE_MATH_DISPATCH_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime dispatched kernels
+//
+// The following kernels are part of the Blaze library and are compiled for several instruction
+// sets (see the InstructionSet enumeration). Each call is relayed to the variant selected at
+// program startup. The matrix operands are specified by a pointer to their first element and
+// the distance between two consecutive rows (\a rs) and columns (\a cs). All vector operands
+// are required to be contiguous.
+*/
+//@{
+#if BLAZE_DISPATCH_MODE
+void gemm( size_t m, size_t n, size_t k, float alpha,
+           const float* A, size_t ars, size_t acs, const float* B, size_t brs, size_t bcs,
+           float beta, float* C, size_t crs, size_t ccs );
+
+void gemm( size_t m, size_t n, size_t k, double alpha,
+           const double* A, size_t ars, size_t acs, const double* B, size_t brs, size_t bcs,
+           double beta, double* C, size_t crs, size_t ccs );
+
+void gemv( size_t m, size_t n, float alpha, const float* A, size_t ars, size_t acs,
+           const float* x, float beta, float* y );
+
+void gemv( size_t m, size_t n, double alpha, const double* A, size_t ars, size_t acs,
+           const double* x, double beta, double* y );
+
+float  dot( size_t n, const float*  x, const float*  y );
+double dot( size_t n, const double* x, const double* y );
+
+void add( size_t n, const float*  x, const float*  y, float*  z );
+void add( size_t n, const double* x, const double* y, double* z );
+
+void sub( size_t n, const float*  x, const float*  y, float*  z );
+void sub( size_t n, const double* x, const double* y, double* z );
+
+void mult( size_t n, const float*  x, const float*  y, float*  z );
+void mult( size_t n, const double* x, const double* y, double* z );
+
+void scale( size_t n, float  s, const float*  x, float*  z );
+void scale( size_t n, double s, const double* x, double* z );
+#endif
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX/DENSE VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dense matrix/dense vector kernels */
+//@{
+#if BLAZE_DISPATCH_MODE
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+BLAZE_ALWAYS_INLINE void gemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                               const DenseMatrix<MT3,SO3>& B, typename MT1::ElementType alpha,
+                               typename MT1::ElementType beta );
+
+template< typename VT1, typename MT1, bool SO, typename VT2 >
+BLAZE_ALWAYS_INLINE void gemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                               const DenseVector<VT2,false>& x, typename VT1::ElementType alpha,
+                               typename VT1::ElementType beta );
+
+template< typename VT1, typename VT2, typename MT1, bool SO >
+BLAZE_ALWAYS_INLINE void gemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                               const DenseMatrix<MT1,SO>& A, typename VT1::ElementType alpha,
+                               typename VT1::ElementType beta );
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*!\brief Runtime dispatched dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function performs the dense matrix/dense matrix multiplication by means of the runtime
+// dispatched gemm() kernel. Note that the function only works for matrices with \c float or
+// \c double element type and requires direct access to the elements of all three matrices.
+// In case \a beta is zero, the initial values of \a C are not accessed.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , bool SO1      // Storage order of the left-hand side target matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , bool SO2      // Storage order of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , bool SO3 >    // Storage order of the right-hand side matrix operand
+BLAZE_ALWAYS_INLINE void gemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                               const DenseMatrix<MT3,SO3>& B, typename MT1::ElementType alpha,
+                               typename MT1::ElementType beta )
+{
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   gemm( (~C).rows(), (~C).columns(), (~A).columns(), alpha,
+         (~A).data(), ( SO2 )?( 1UL ):( (~A).spacing() ), ( SO2 )?( (~A).spacing() ):( 1UL ),
+         (~B).data(), ( SO3 )?( 1UL ):( (~B).spacing() ), ( SO3 )?( (~B).spacing() ):( 1UL ),
+         beta,
+         (~C).data(), ( SO1 )?( 1UL ):( (~C).spacing() ), ( SO1 )?( (~C).spacing() ):( 1UL ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*!\brief Runtime dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// This function performs the dense matrix/dense vector multiplication by means of the runtime
+// dispatched gemv() kernel. Note that the function only works for vectors and matrices with
+// \c float or \c double element type and requires direct access to their elements. In case
+// \a beta is zero, the initial values of \a y are not accessed.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT1    // Type of the left-hand side matrix operand
+        , bool SO         // Storage order of the left-hand side matrix operand
+        , typename VT2 >  // Type of the right-hand side vector operand
+BLAZE_ALWAYS_INLINE void gemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                               const DenseVector<VT2,false>& x, typename VT1::ElementType alpha,
+                               typename VT1::ElementType beta )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~A).rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~A).columns(), "Invalid vector size" );
+
+   gemv( (~A).rows(), (~A).columns(), alpha,
+         (~A).data(), ( SO )?( 1UL ):( (~A).spacing() ), ( SO )?( (~A).spacing() ):( 1UL ),
+         (~x).data(), beta, (~y).data() );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*!\brief Runtime dispatched transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T=\alpha*\vec{x}^T*A+\beta*\vec{y}^T \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \param beta The scaling factor for \f$ \vec{y}^T \f$.
+// \return void
+//
+// This function performs the transpose dense vector/dense matrix multiplication by means of
+// the runtime dispatched gemv() kernel. Note that the function only works for vectors and
+// matrices with \c float or \c double element type and requires direct access to their
+// elements. In case \a beta is zero, the initial values of \a y are not accessed.
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename VT2  // Type of the left-hand side vector operand
+        , typename MT1  // Type of the right-hand side matrix operand
+        , bool SO >     // Storage order of the right-hand side matrix operand
+BLAZE_ALWAYS_INLINE void gemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                               const DenseMatrix<MT1,SO>& A, typename VT1::ElementType alpha,
+                               typename VT1::ElementType beta )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~A).columns(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~A).rows()   , "Invalid vector size" );
+
+   gemv( (~A).columns(), (~A).rows(), alpha,
+         (~A).data(), ( SO )?( (~A).spacing() ):( 1UL ), ( SO )?( 1UL ):( (~A).spacing() ),
+         (~x).data(), beta, (~y).data() );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,295 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/Batch.h
+//  \brief Header file for the Batch base class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BATCH_H_
+#define _BLAZE_MATH_EXPRESSIONS_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup batch Batches
+// \ingroup math
+*/
+/*!\brief Base class for batches of small matrices and vectors.
+// \ingroup batch
+//
+// The Batch class is a base class for all batch classes and batch expression templates within
+// the Blaze library. A batch represents a sequence of small matrices or vectors of identical
+// compile time size. The elements of the batch members are stored in an interleaved (struct of
+// arrays) layout: the members are grouped into blocks of as many members as fit into a single
+// intrinsic vector, and within a block the same element of all members is stored contiguously.
+// Therefore all intrinsic lanes are used independent of the size of the batch members.\n
+// The Batch class provides an abstraction from the actual type of the batch, but enables a
+// conversion back to this type via the 'Curiously Recurring Template Pattern' (CRTP). All
+// derived classes are required to provide the following interface:
+
+   \code
+   size_t size() const;    // Number of batch members
+   size_t blocks() const;  // Number of blocks of batch members
+   void load( size_t block, IntrinsicType* values ) const;  // Evaluation of a complete block
+   \endcode
+
+// The load() function evaluates all \a rows * \a columns elements of the given block and writes
+// them to the given array in row-major order. Assignable batches additionally provide the
+// according store() function.
+*/
+template< typename BT >  // Type of the batch
+struct Batch
+{
+   //**Type definitions****************************************************************************
+   typedef BT  BatchType;  //!< Type of the batch.
+   //**********************************************************************************************
+
+   //**Non-const conversion operator***************************************************************
+   /*!\brief Conversion operator for non-constant batches.
+   //
+   // \return Reference of the actual type of the batch.
+   */
+   BLAZE_ALWAYS_INLINE BatchType& operator~() {
+      return *static_cast<BatchType*>( this );
+   }
+   //**********************************************************************************************
+
+   //**Const conversion operator*******************************************************************
+   /*!\brief Conversion operator for constant batches.
+   //
+   // \return Constant reference of the actual type of the batch.
+   */
+   BLAZE_ALWAYS_INLINE const BatchType& operator~() const {
+      return *static_cast<const BatchType*>( this );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch global functions */
+//@{
+template< typename BT >
+BLAZE_ALWAYS_INLINE size_t size( const Batch<BT>& batch );
+
+template< typename BT1, typename BT2 >
+inline void assign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+
+template< typename BT1, typename BT2 >
+inline void addAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+
+template< typename BT1, typename BT2 >
+inline void subAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of members of the batch.
+// \ingroup batch
+//
+// \param batch The given batch.
+// \return The number of members of the batch.
+*/
+template< typename BT >  // Type of the batch
+BLAZE_ALWAYS_INLINE size_t size( const Batch<BT>& batch )
+{
+   return (~batch).size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a batch to a batch.
+// \ingroup batch
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be assigned.
+// \return void
+//
+// This function implements the default assignment of a batch to a batch. The right-hand side
+// batch is evaluated block by block. Since each block is completely evaluated before it is
+// written to the target, the assignment is safe even if the target is part of the right-hand
+// side expression.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void assign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT( size_t( BT1::rows ) == size_t( BT2::rows ) );
+   BLAZE_STATIC_ASSERT( size_t( BT1::columns ) == size_t( BT2::columns ) );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   typedef typename BT1::IntrinsicType  IntrinsicType;
+
+   const size_t blocks( (~lhs).blocks() );
+
+   IntrinsicType values[BT1::rows*BT1::columns];
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      (~rhs).load( b, values );
+      (~lhs).store( b, values );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a batch to a batch.
+// \ingroup batch
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be added.
+// \return void
+//
+// This function implements the default addition assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void addAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT( size_t( BT1::rows ) == size_t( BT2::rows ) );
+   BLAZE_STATIC_ASSERT( size_t( BT1::columns ) == size_t( BT2::columns ) );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   typedef typename BT1::IntrinsicType  IntrinsicType;
+
+   const size_t blocks( (~lhs).blocks() );
+
+   IntrinsicType values[BT1::rows*BT1::columns];
+   IntrinsicType tmp   [BT1::rows*BT1::columns];
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      (~lhs).load( b, values );
+      (~rhs).load( b, tmp );
+      for( size_t k=0UL; k<BT1::rows*BT1::columns; ++k ) {
+         values[k] = values[k] + tmp[k];
+      }
+      (~lhs).store( b, values );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a batch to a batch.
+// \ingroup batch
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be subtracted.
+// \return void
+//
+// This function implements the default subtraction assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void subAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT( size_t( BT1::rows ) == size_t( BT2::rows ) );
+   BLAZE_STATIC_ASSERT( size_t( BT1::columns ) == size_t( BT2::columns ) );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   typedef typename BT1::IntrinsicType  IntrinsicType;
+
+   const size_t blocks( (~lhs).blocks() );
+
+   IntrinsicType values[BT1::rows*BT1::columns];
+   IntrinsicType tmp   [BT1::rows*BT1::columns];
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      (~lhs).load( b, values );
+      (~rhs).load( b, tmp );
+      for( size_t k=0UL; k<BT1::rows*BT1::columns; ++k ) {
+         values[k] = values[k] - tmp[k];
+      }
+      (~lhs).store( b, values );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
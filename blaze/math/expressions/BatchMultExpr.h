@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BatchMultExpr.h
+//  \brief Header file for the batch multiplication expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BATCHMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BATCHMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/traits/BatchTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for batch multiplications.
+// \ingroup batch
+//
+// The BatchMultExpr class represents the compile time expression for the member-wise product
+// of two batches of small matrices or vectors. Depending on the sizes of the batch members, the
+// expression represents a batch of matrix/matrix multiplications, matrix/vector multiplications,
+// vector/matrix multiplications, or outer and inner products.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+class BatchMultExpr : public Batch< BatchMultExpr<BT1,BT2> >
+                    , private MultExpr
+                    , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename BT1::ElementType  ET1;  //!< Element type of the left-hand side batch expression.
+   typedef typename BT2::ElementType  ET2;  //!< Element type of the right-hand side batch expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of columns of the left-hand side and number of rows of the right-hand side members.
+   enum { inner = BT1::columns };
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   /*! The resulting batch members are vectors in case at least one of the operands is a batch of
+       vectors and either the number of rows or the number of columns of the result is 1. */
+   enum { rows     = BT1::rows
+        , columns  = BT2::columns
+        , isVector = ( BT1::isVector || BT2::isVector ) && ( rows == 1 || columns == 1 ) };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BatchMultExpr<BT1,BT2>                                        This;           //!< Type of this BatchMultExpr instance.
+   typedef typename BatchTrait<ET1,rows,columns,isVector>::Type          ResultType;     //!< Result type for expression template evaluations.
+   typedef ET1                                                           ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type                    IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const BatchMultExpr&                                          CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side batch expression.
+   typedef typename SelectType< IsExpression<BT1>::value, const BT1, const BT1& >::Type  LeftOperand;
+
+   //! Composite type of the right-hand side batch expression.
+   typedef typename SelectType< IsExpression<BT2>::value, const BT2, const BT2& >::Type  RightOperand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchMultExpr class.
+   //
+   // \param lhs The left-hand side operand of the multiplication expression.
+   // \param rhs The right-hand side operand of the multiplication expression.
+   */
+   explicit inline BatchMultExpr( const BT1& lhs, const BT2& rhs )
+      : lhs_( lhs )  // Left-hand side batch of the multiplication expression
+      , rhs_( rhs )  // Right-hand side batch of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.size() == rhs.size(), "Invalid batch sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Evaluation of all elements of a block of batch members.
+   //
+   // \param block Index of the block of batch members.
+   // \param values The target array for the \a rows * \a columns intrinsic values of the block.
+   // \return void
+   //
+   // This function computes the products of all members of the given block. Since each intrinsic
+   // lane holds a different batch member, the products are computed without any horizontal
+   // operation.
+   */
+   BLAZE_ALWAYS_INLINE void load( size_t block, IntrinsicType* values ) const {
+      IntrinsicType a[rows*inner];
+      IntrinsicType b[inner*columns];
+      lhs_.load( block, a );
+      rhs_.load( block, b );
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            IntrinsicType xmm( a[i*inner] * b[j] );
+            for( size_t k=1UL; k<inner; ++k ) {
+               xmm = xmm + a[i*inner+k] * b[k*columns+j];
+            }
+            values[i*columns+j] = xmm;
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current number of batch members.
+   //
+   // \return The number of batch members.
+   */
+   inline size_t size() const {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the current number of blocks of batch members.
+   //
+   // \return The number of blocks of batch members.
+   */
+   inline size_t blocks() const {
+      return lhs_.blocks();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side batch operand.
+   //
+   // \return The left-hand side batch operand.
+   */
+   inline LeftOperand leftOperand() const {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side batch operand.
+   //
+   // \return The right-hand side batch operand.
+   */
+   inline RightOperand rightOperand() const {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side batch of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side batch of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET1, ET2 );
+   BLAZE_STATIC_ASSERT( size_t( BT1::columns ) == size_t( BT2::rows ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the member-wise multiplication of two batches
+//        (\f$ A=B*C \f$).
+// \ingroup batch
+//
+// \param lhs The left-hand side batch for the batch multiplication.
+// \param rhs The right-hand side batch for the batch multiplication.
+// \return The member-wise product of the two batches.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This operator represents the member-wise multiplication of two batches of matrices or
+// vectors:
+
+   \code
+   blaze::StaticMatrixBatch<double,3UL,3UL> A, B, C;
+   blaze::StaticVectorBatch<double,3UL,blaze::columnVector> x, y;
+   // ... Resizing and initialization
+   C = A * B;
+   y = A * x;
+   \endcode
+
+// The operator returns an expression representing a batch of the same size as the two given
+// batches. The number of columns of the left-hand side batch members has to match the number
+// of rows of the right-hand side batch members and both batches must have the same element
+// type. In case the current numbers of batch members don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename T1    // Type of the left-hand side batch
+        , typename T2 >  // Type of the right-hand side batch
+inline const BatchMultExpr<T1,T2>
+   operator*( const Batch<T1>& lhs, const Batch<T2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   return BatchMultExpr<T1,T2>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
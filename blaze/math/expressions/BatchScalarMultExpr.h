@@ -0,0 +1,267 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BatchScalarMultExpr.h
+//  \brief Header file for the batch/scalar multiplication expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BATCHSCALARMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BATCHSCALARMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/traits/BatchTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHSCALARMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for batch-scalar multiplications.
+// \ingroup batch
+//
+// The BatchScalarMultExpr class represents the compile time expression for the multiplication
+// of all members of a batch with a scalar value.
+*/
+template< typename BT    // Type of the left-hand side batch
+        , typename ST >  // Type of the right-hand side scalar value
+class BatchScalarMultExpr : public Batch< BatchScalarMultExpr<BT,ST> >
+                          , private MultExpr
+                          , private Computation
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   enum { rows     = BT::rows
+        , columns  = BT::columns
+        , isVector = BT::isVector };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BatchScalarMultExpr<BT,ST>                                    This;           //!< Type of this BatchScalarMultExpr instance.
+   typedef typename BT::ElementType                                      ElementType;    //!< Resulting element type.
+   typedef typename BatchTrait<ElementType,rows,columns,isVector>::Type  ResultType;     //!< Result type for expression template evaluations.
+   typedef typename IntrinsicTrait<ElementType>::Type                    IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const BatchScalarMultExpr&                                    CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side batch expression.
+   typedef typename SelectType< IsExpression<BT>::value, const BT, const BT& >::Type  LeftOperand;
+
+   //! Composite type of the right-hand side scalar value.
+   typedef ST  RightOperand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchScalarMultExpr class.
+   //
+   // \param batch The left-hand side batch of the multiplication expression.
+   // \param scalar The right-hand side scalar of the multiplication expression.
+   */
+   explicit inline BatchScalarMultExpr( const BT& batch, ST scalar )
+      : batch_ ( batch  )  // Left-hand side batch of the multiplication expression
+      , scalar_( scalar )  // Right-hand side scalar of the multiplication expression
+   {}
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Evaluation of all elements of a block of batch members.
+   //
+   // \param block Index of the block of batch members.
+   // \param values The target array for the \a rows * \a columns intrinsic values of the block.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void load( size_t block, IntrinsicType* values ) const {
+      const IntrinsicType factor( set( ElementType( scalar_ ) ) );
+      batch_.load( block, values );
+      for( size_t k=0UL; k<rows*columns; ++k ) {
+         values[k] = values[k] * factor;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current number of batch members.
+   //
+   // \return The number of batch members.
+   */
+   inline size_t size() const {
+      return batch_.size();
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the current number of blocks of batch members.
+   //
+   // \return The number of blocks of batch members.
+   */
+   inline size_t blocks() const {
+      return batch_.blocks();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side batch operand.
+   //
+   // \return The left-hand side batch operand.
+   */
+   inline LeftOperand leftOperand() const {
+      return batch_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side scalar operand.
+   //
+   // \return The right-hand side scalar operand.
+   */
+   inline RightOperand rightOperand() const {
+      return scalar_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  batch_;   //!< Left-hand side batch of the multiplication expression.
+   RightOperand scalar_;  //!< Right-hand side scalar of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ST );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a batch and a scalar value
+//        (\f$ A=B*s \f$).
+// \ingroup batch
+//
+// \param batch The left-hand side batch for the multiplication.
+// \param scalar The right-hand side scalar value for the multiplication.
+// \return The scaled batch.
+//
+// This operator represents the multiplication of all members of a batch with a scalar value:
+
+   \code
+   blaze::StaticMatrixBatch<double,3UL,3UL> A, B;
+   // ... Resizing and initialization
+   B = A * 1.25;
+   \endcode
+
+// The scalar value is converted to the element type of the batch.
+*/
+template< typename T1    // Type of the left-hand side batch
+        , typename T2 >  // Type of the right-hand side scalar
+inline const typename EnableIf< IsNumeric<T2>, BatchScalarMultExpr<T1,T2> >::Type
+   operator*( const Batch<T1>& batch, T2 scalar )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return BatchScalarMultExpr<T1,T2>( ~batch, scalar );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a scalar value and a batch
+//        (\f$ A=s*B \f$).
+// \ingroup batch
+//
+// \param scalar The left-hand side scalar value for the multiplication.
+// \param batch The right-hand side batch for the multiplication.
+// \return The scaled batch.
+//
+// This operator represents the multiplication of all members of a batch with a scalar value:
+
+   \code
+   blaze::StaticMatrixBatch<double,3UL,3UL> A, B;
+   // ... Resizing and initialization
+   B = 1.25 * A;
+   \endcode
+
+// The scalar value is converted to the element type of the batch.
+*/
+template< typename T1    // Type of the left-hand side scalar
+        , typename T2 >  // Type of the right-hand side batch
+inline const typename EnableIf< IsNumeric<T1>, BatchScalarMultExpr<T2,T1> >::Type
+   operator*( T1 scalar, const Batch<T2>& batch )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return BatchScalarMultExpr<T2,T1>( ~batch, scalar );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
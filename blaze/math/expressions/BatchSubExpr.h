@@ -0,0 +1,254 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BatchSubExpr.h
+//  \brief Header file for the batch subtraction expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BATCHSUBEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BATCHSUBEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/SubExpr.h>
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/traits/BatchTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHSUBEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for batch subtractions.
+// \ingroup batch
+//
+// The BatchSubExpr class represents the compile time expression for the member-wise subtraction
+// of two batches of small matrices or vectors.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+class BatchSubExpr : public Batch< BatchSubExpr<BT1,BT2> >
+                   , private SubExpr
+                   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename BT1::ElementType  ET1;  //!< Element type of the left-hand side batch expression.
+   typedef typename BT2::ElementType  ET2;  //!< Element type of the right-hand side batch expression.
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   enum { rows     = BT1::rows
+        , columns  = BT1::columns
+        , isVector = BT1::isVector && BT2::isVector };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BatchSubExpr<BT1,BT2>                                         This;           //!< Type of this BatchSubExpr instance.
+   typedef typename BatchTrait<ET1,rows,columns,isVector>::Type          ResultType;     //!< Result type for expression template evaluations.
+   typedef ET1                                                           ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type                    IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const BatchSubExpr&                                           CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side batch expression.
+   typedef typename SelectType< IsExpression<BT1>::value, const BT1, const BT1& >::Type  LeftOperand;
+
+   //! Composite type of the right-hand side batch expression.
+   typedef typename SelectType< IsExpression<BT2>::value, const BT2, const BT2& >::Type  RightOperand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchSubExpr class.
+   //
+   // \param lhs The left-hand side operand of the subtraction expression.
+   // \param rhs The right-hand side operand of the subtraction expression.
+   */
+   explicit inline BatchSubExpr( const BT1& lhs, const BT2& rhs )
+      : lhs_( lhs )  // Left-hand side batch of the subtraction expression
+      , rhs_( rhs )  // Right-hand side batch of the subtraction expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.size() == rhs.size(), "Invalid batch sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Evaluation of all elements of a block of batch members.
+   //
+   // \param block Index of the block of batch members.
+   // \param values The target array for the \a rows * \a columns intrinsic values of the block.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void load( size_t block, IntrinsicType* values ) const {
+      IntrinsicType tmp[rows*columns];
+      lhs_.load( block, values );
+      rhs_.load( block, tmp );
+      for( size_t k=0UL; k<rows*columns; ++k ) {
+         values[k] = values[k] - tmp[k];
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current number of batch members.
+   //
+   // \return The number of batch members.
+   */
+   inline size_t size() const {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the current number of blocks of batch members.
+   //
+   // \return The number of blocks of batch members.
+   */
+   inline size_t blocks() const {
+      return lhs_.blocks();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side batch operand.
+   //
+   // \return The left-hand side batch operand.
+   */
+   inline LeftOperand leftOperand() const {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side batch operand.
+   //
+   // \return The right-hand side batch operand.
+   */
+   inline RightOperand rightOperand() const {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side batch of the subtraction expression.
+   RightOperand rhs_;  //!< Right-hand side batch of the subtraction expression.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET1, ET2 );
+   BLAZE_STATIC_ASSERT( size_t( BT1::rows ) == size_t( BT2::rows ) );
+   BLAZE_STATIC_ASSERT( size_t( BT1::columns ) == size_t( BT2::columns ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subtraction operator for the member-wise subtraction of two batches (\f$ A=B-C \f$).
+// \ingroup batch
+//
+// \param lhs The left-hand side batch for the batch subtraction.
+// \param rhs The right-hand side batch for the batch subtraction.
+// \return The member-wise difference of the two batches.
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This operator represents the member-wise subtraction of two batches of matrices or vectors:
+
+   \code
+   blaze::StaticMatrixBatch<double,3UL,3UL> A, B, C;
+   // ... Resizing and initialization
+   C = A - B;
+   \endcode
+
+// The operator returns an expression representing a batch of the same size as the two given
+// batches. The members of both batches have to be of the same size and the same element type.
+// In case the current numbers of batch members don't match, a \a std::invalid_argument is
+// thrown.
+*/
+template< typename T1    // Type of the left-hand side batch
+        , typename T2 >  // Type of the right-hand side batch
+inline const BatchSubExpr<T1,T2>
+   operator-( const Batch<T1>& lhs, const Batch<T2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   return BatchSubExpr<T1,T2>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,208 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BatchTransExpr.h
+//  \brief Header file for the batch transpose expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BATCHTRANSEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BATCHTRANSEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/TransExpr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/traits/BatchTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHTRANSEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the transposition of batches.
+// \ingroup batch
+//
+// The BatchTransExpr class represents the compile time expression for the member-wise
+// transposition of a batch of small matrices or vectors.
+*/
+template< typename BT >  // Type of the batch
+class BatchTransExpr : public Batch< BatchTransExpr<BT> >
+                     , private TransExpr
+                     , private Computation
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   enum { rows     = BT::columns
+        , columns  = BT::rows
+        , isVector = BT::isVector };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BatchTransExpr<BT>                                            This;           //!< Type of this BatchTransExpr instance.
+   typedef typename BT::ElementType                                      ElementType;    //!< Resulting element type.
+   typedef typename BatchTrait<ElementType,rows,columns,isVector>::Type  ResultType;     //!< Result type for expression template evaluations.
+   typedef typename IntrinsicTrait<ElementType>::Type                    IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const BatchTransExpr&                                         CompositeType;  //!< Data type for composite expression templates.
+
+   //! Composite data type of the batch expression.
+   typedef typename SelectType< IsExpression<BT>::value, const BT, const BT& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchTransExpr class.
+   //
+   // \param batch The batch operand of the transposition expression.
+   */
+   explicit inline BatchTransExpr( const BT& batch )
+      : batch_( batch )  // Batch of the transposition expression
+   {}
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Evaluation of all elements of a block of batch members.
+   //
+   // \param block Index of the block of batch members.
+   // \param values The target array for the \a rows * \a columns intrinsic values of the block.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void load( size_t block, IntrinsicType* values ) const {
+      IntrinsicType tmp[rows*columns];
+      batch_.load( block, tmp );
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            values[i*columns+j] = tmp[j*rows+i];
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current number of batch members.
+   //
+   // \return The number of batch members.
+   */
+   inline size_t size() const {
+      return batch_.size();
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the current number of blocks of batch members.
+   //
+   // \return The number of blocks of batch members.
+   */
+   inline size_t blocks() const {
+      return batch_.blocks();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the batch operand.
+   //
+   // \return The batch operand.
+   */
+   inline Operand operand() const {
+      return batch_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( size() > SMP_BATCHASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand batch_;  //!< Batch of the transposition expression.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Calculation of the member-wise transpose of the given batch.
+// \ingroup batch
+//
+// \param batch The batch to be transposed.
+// \return The batch of transposed members.
+//
+// This function returns an expression representing the member-wise transpose of the given
+// batch. The transpose of a batch of column vectors is a batch of row vectors and vice versa:
+
+   \code
+   blaze::StaticMatrixBatch<double,2UL,3UL> A;
+   blaze::StaticMatrixBatch<double,3UL,2UL> B;
+   // ... Resizing and initialization
+   B = trans( A );
+   \endcode
+*/
+template< typename BT >  // Type of the batch
+inline const BatchTransExpr<BT> trans( const Batch<BT>& batch )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return BatchTransExpr<BT>( ~batch );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatDMatMultChain.h
+//  \brief Header file for the reordering of dense matrix multiplication chains
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATDMATMULTCHAIN_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATDMATMULTCHAIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS IsDenseMatMatMultChainLink
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the DMatDMatMultChain class template.
+// \ingroup math
+//
+// This helper struct evaluates to 1 in case the given type \a MT is a matrix/matrix
+// multiplication expression with two dense matrix operands, i.e. in case it can form one
+// link of a reorderable dense matrix multiplication chain. Otherwise it evaluates to 0.
+*/
+template< typename MT                                // Type of the matrix operand
+        , bool = IsMatMatMultExpr<MT>::value >  // Compile time flag for multiplication expressions
+struct IsDenseMatMatMultChainLink
+{
+   enum { value = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsDenseMatMatMultChainLink helper for matrix/matrix
+//        multiplication expressions.
+// \ingroup math
+*/
+template< typename MT >  // Type of the matrix multiplication expression
+struct IsDenseMatMatMultChainLink<MT,true>
+{
+   enum { value = IsDenseMatrix< typename RemoveReference<typename MT::LeftOperand>::Type >::value &&
+                  IsDenseMatrix< typename RemoveReference<typename MT::RightOperand>::Type >::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DMatDMatMultChain
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime reordering of dense matrix multiplication chains.
+// \ingroup math
+//
+// The DMatDMatMultChain class template implements the runtime reordering of a chain of three
+// dense matrices. By default, the expression templates of the Blaze library evaluate the
+// multiplication of three matrices in the order given by the expression (i.e. \f$ (A*B)*C \f$
+// is evaluated left to right and \f$ A*(B*C) \f$ is evaluated right to left). Depending on the
+// dimensions of the three matrices however, the second order may require considerably fewer
+// arithmetic operations. Assuming \f$ A \f$ is a \f$ m \times k \f$ matrix, \f$ B \f$ is a
+// \f$ k \times n \f$ matrix, and \f$ C \f$ is a \f$ n \times p \f$ matrix, the cost of the
+// two possible orders is
+
+      \f[ cost((A*B)*C) = m \cdot k \cdot n + m \cdot n \cdot p, \f]
+      \f[ cost(A*(B*C)) = k \cdot n \cdot p + m \cdot k \cdot p. \f]
+
+// In case the given expression \f$ MT1*MT2 \f$ represents such a chain (i.e. in case exactly one
+// of the two operands is itself a dense matrix multiplication), the functions of this class
+// template reassociate the chain if the alternative order is strictly cheaper and perform the
+// according assignment. In case the chain is reordered, the functions return \a true, otherwise
+// they return \a false and the original evaluation has to take place. Note that since the
+// alternative order is only selected if it is strictly cheaper, a reordered chain is never
+// reordered back. For all other expressions the functions always return \a false.
+*/
+template< typename MT1                                             // Type of the left-hand side dense matrix
+        , typename MT2                                             // Type of the right-hand side dense matrix
+        , bool = IsDenseMatMatMultChainLink<MT1>::value &&
+                 !IsMatMatMultExpr<MT2>::value
+        , bool = IsDenseMatMatMultChainLink<MT2>::value &&
+                 !IsMatMatMultExpr<MT1>::value >
+struct DMatDMatMultChain
+{
+   //**Reordered assignment functions**************************************************************
+   template< typename MT, bool SO >
+   static inline bool reorderedAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedAddAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSubAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAddAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPSubAssign( DenseMatrix<MT,SO>&, const MT1&, const MT2& ) { return false; }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DMatDMatMultChain class template for \f$ (A*B)*C \f$ chains.
+// \ingroup math
+*/
+template< typename MT1    // Type of the left-hand side matrix multiplication expression
+        , typename MT2 >  // Type of the right-hand side dense matrix
+struct DMatDMatMultChain<MT1,MT2,true,false>
+{
+   //**Reordering check****************************************************************************
+   /*!\brief Returns whether the evaluation as \f$ A*(B*C) \f$ is cheaper.
+   //
+   // \param lhs The left-hand side matrix multiplication \f$ A*B \f$.
+   // \param rhs The right-hand side dense matrix \f$ C \f$.
+   // \return \a true in case the reordered chain is strictly cheaper, \a false if not.
+   */
+   static inline bool isBeneficial( const MT1& lhs, const MT2& rhs )
+   {
+      const size_t m( lhs.rows() );
+      const size_t k( lhs.leftOperand().columns() );
+      const size_t n( lhs.columns() );
+      const size_t p( rhs.columns() );
+
+      return ( k*n*p + m*k*p ) < ( m*k*n + m*n*p );
+   }
+   //**********************************************************************************************
+
+   //**Reordered assignment functions**************************************************************
+   template< typename MT, bool SO >
+   static inline bool reorderedAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      assign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedAddAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      addAssign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSubAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      subAssign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpAssign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAddAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpAddAssign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPSubAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpSubAssign( ~lhs, A.leftOperand() * ( A.rightOperand() * B ) );
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DMatDMatMultChain class template for \f$ A*(B*C) \f$ chains.
+// \ingroup math
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side matrix multiplication expression
+struct DMatDMatMultChain<MT1,MT2,false,true>
+{
+   //**Reordering check****************************************************************************
+   /*!\brief Returns whether the evaluation as \f$ (A*B)*C \f$ is cheaper.
+   //
+   // \param lhs The left-hand side dense matrix \f$ A \f$.
+   // \param rhs The right-hand side matrix multiplication \f$ B*C \f$.
+   // \return \a true in case the reordered chain is strictly cheaper, \a false if not.
+   */
+   static inline bool isBeneficial( const MT1& lhs, const MT2& rhs )
+   {
+      const size_t m( lhs.rows() );
+      const size_t k( lhs.columns() );
+      const size_t n( rhs.leftOperand().columns() );
+      const size_t p( rhs.columns() );
+
+      return ( m*k*n + m*n*p ) < ( k*n*p + m*k*p );
+   }
+   //**********************************************************************************************
+
+   //**Reordered assignment functions**************************************************************
+   template< typename MT, bool SO >
+   static inline bool reorderedAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      assign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedAddAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      addAssign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSubAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      subAssign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpAssign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPAddAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpAddAssign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+
+   template< typename MT, bool SO >
+   static inline bool reorderedSMPSubAssign( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+   {
+      if( !isBeneficial( A, B ) ) return false;
+      smpSubAssign( ~lhs, ( A * B.leftOperand() ) * B.rightOperand() );
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
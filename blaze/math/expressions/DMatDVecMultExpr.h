@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -216,14 +218,35 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, no BLAS kernel is available, and the runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. Triangular matrices are
+       handled by the default kernels, which skip the known zero elements. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T2>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -562,14 +585,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -592,10 +615,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -614,9 +637,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -634,8 +657,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -651,7 +674,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 );
@@ -965,6 +988,34 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense matrix-dense vector multiplication (\f$
+   //        \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication for single and double
+   // precision operands based on the runtime dispatched kernel for the instruction set selected at
+   // program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1209,14 +1260,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1239,10 +1290,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1261,9 +1312,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1281,8 +1332,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1298,7 +1349,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 );
@@ -1612,6 +1663,34 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a matrix-vector multiplication (\f$
+   //        \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the matrix-vector multiplication for single and double precision
+   // operands based on the runtime dispatched kernel for the instruction set selected at program
+   // startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1832,14 +1911,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1862,10 +1941,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1884,9 +1963,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1904,8 +1983,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1921,7 +2000,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 );
@@ -2235,6 +2314,34 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a matrix-vector multiplication (\f$
+   //        \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the matrix-vector multiplication for single and double precision
+   // operands based on the runtime dispatched kernel for the instruction set selected at program
+   // startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -2680,14 +2787,34 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, the scalar value is not a complex data type, no BLAS kernel is available,
+       and the runtime dispatched kernel can be used, the nested \a value will be set to 1,
+       otherwise it will be 0. Triangular matrices are handled by the default kernels. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T2>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value &&
+                     !IsComplex<T4>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3, typename T4 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3,T4>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    //**********************************************************************************************
 
@@ -3006,14 +3133,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3036,10 +3163,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3058,9 +3185,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3078,8 +3205,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3095,7 +3222,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 ) * scalar;
@@ -3427,6 +3554,34 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled dense matrix-dense vector multiplication (\f$
+   //        \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, scalar, ElementType(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based assignment of a scaled dense matrix-dense vector multiplication for
@@ -3671,14 +3826,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3701,10 +3856,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3723,9 +3878,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3743,8 +3898,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3760,7 +3915,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 ) * scalar;
@@ -4073,6 +4228,34 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based addition assignment of a scaled dense matrix-dense vector multiplication
@@ -4295,14 +4478,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4325,10 +4508,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4347,9 +4530,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4367,8 +4550,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4384,7 +4567,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 ) * scalar;
@@ -4697,6 +4880,34 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, -scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based subtraction assignment of a scaled dense matrix-dense vector multiplication
@@ -45,8 +45,10 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatDMatMultChain.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
@@ -145,15 +147,34 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    enum { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The CanExploitSymmetry struct is a helper struct for the selection of the optimal
+       evaluation strategy. In case the target matrix is row-major and the right-hand side
+       matrix operand is symmetric or in case the target matrix is column-major and the
+       left-hand side matrix operand is symmetric, \a value is set to 1 and an optimized
+       evaluation strategy is selected. Otherwise \a value is set to 0 and the default
+       strategy is chosen. */
+   template< typename T1, typename T2, typename T3 >
+   struct CanExploitSymmetry {
+      enum { value = ( IsRowMajorMatrix<T1>::value && IsSymmetric<T3>::value ) ||
+                     ( IsColumnMajorMatrix<T1>::value && IsSymmetric<T2>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The IsEvaluationRequired struct is a helper struct for the selection of the parallel
        evaluation strategy. In case either of the two matrix operands requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation and no symmetry can be exploited, the nested \value will be set to 1,
+       otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct IsEvaluationRequired {
-      enum { value = ( evaluateLeft || evaluateRight ) };
+      enum { value = ( evaluateLeft || evaluateRight ) &&
+                     !CanExploitSymmetry<T1,T2,T3>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -451,7 +472,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void assign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -466,6 +488,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -625,14 +651,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -659,10 +685,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -681,8 +707,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -704,10 +730,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -726,8 +752,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -742,7 +768,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -801,14 +827,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -831,10 +857,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -862,10 +888,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -884,8 +910,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -907,8 +933,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -923,7 +949,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -971,7 +997,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    //
    // This function implements the vectorized default assignment of a dense matrix-transpose dense
    // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on a cache-blocked, packed matrix multiplication (see the mmm()
+   // function).
+   //
+   // In case \a B is the transpose of \a A (as for instance in \f$ X*X^T \f$), only one half
+   // of the symmetric result is computed and mirrored (see the smmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -979,8 +1009,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( isSymmetricProduct( A, B ) )
+         smmm( C, A, B, ElementType(1) );
+      else
+         mmm( C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -998,7 +1030,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    //
    // This function implements the vectorized default assignment of a dense matrix-transpose dense
    // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on a cache-blocked, packed matrix multiplication (see the mmm()
+   // function).
+   //
+   // In case \a B is the transpose of \a A (as for instance in \f$ X*X^T \f$), only one half
+   // of the symmetric result is computed and mirrored (see the smmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1006,8 +1042,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( isSymmetricProduct( A, B ) )
+         smmm( C, A, B, ElementType(1) );
+      else
+         mmm( C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1208,7 +1246,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    template< typename MT  // Type of the target sparse matrix
            , bool SO >    // Storage order of the target sparse matrix
-   friend inline void assign( SparseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( SparseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -1230,6 +1269,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Restructuring assignment to matrices*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring assignment of a dense matrix-transpose dense matrix multiplication to a
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring assignment of a dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         assign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         assign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a dense matrix-transpose dense matrix multiplication to a
@@ -1245,7 +1320,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void addAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      addAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -1256,6 +1332,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedAddAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1416,14 +1496,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1450,10 +1530,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1472,8 +1552,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1494,10 +1574,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1516,8 +1596,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1532,7 +1612,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1591,14 +1671,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1621,10 +1701,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1652,10 +1732,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1674,8 +1754,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1697,8 +1777,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1713,7 +1793,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1760,8 +1840,9 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \return void
    //
    // This function implements the vectorized default addition assignment of a dense matrix-
-   // transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on a cache-blocked, packed matrix multiplication
+   // (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1769,8 +1850,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1787,8 +1867,9 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \return void
    //
    // This function implements the vectorized default addition assignment of a dense matrix-
-   // transpose dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on a cache-blocked, packed matrix multiplication
+   // (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1796,8 +1877,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1991,6 +2071,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 #endif
    //**********************************************************************************************
 
+   //**Restructuring addition assignment to matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring addition assignment of a dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring addition assignment of a dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      addAssign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         addAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         addAssign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -2010,7 +2126,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void subAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      subAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -2021,6 +2138,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedSubAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2181,14 +2302,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2215,10 +2336,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2237,8 +2358,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2260,10 +2381,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2282,8 +2403,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2298,7 +2419,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2357,14 +2478,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2387,10 +2508,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2418,10 +2539,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2440,8 +2561,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2462,8 +2583,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2478,7 +2599,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2524,9 +2645,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default subtraction assignment of a dense matrix-transpose
-   // dense matrix multiplication expression to a row-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the default subtraction assignment of a dense matrix-transpose dense
+   // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
+   // large matrices and is based on a cache-blocked, packed matrix multiplication (see the mmm()
+   // function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2534,8 +2656,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2551,9 +2672,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default subtraction assignment of a dense matrix-transpose
-   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the default subtraction assignment of a dense matrix-transpose dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices and is based on a cache-blocked, packed matrix multiplication (see the mmm()
+   // function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2561,8 +2683,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2756,6 +2877,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 #endif
    //**********************************************************************************************
 
+   //**Restructuring subtraction assignment to matrices*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring subtraction assignment of a dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring subtraction assignment of a dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      subAssign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         subAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         subAssign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -2801,6 +2958,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedSMPAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2856,6 +3017,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Restructuring SMP assignment to matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring SMP assignment of a dense matrix-transpose dense matrix multiplication to
+   //        a matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP assignment of a dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpAssign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         smpAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         smpAssign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a dense matrix-transpose dense matrix multiplication
@@ -2886,6 +3083,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedSMPAddAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2901,6 +3102,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Restructuring SMP addition assignment to matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring SMP addition assignment of a dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP addition assignment of a dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpAddAssign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         smpAddAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         smpAddAssign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -2935,6 +3172,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( DMatDMatMultChain<MT1,MT2>::reorderedSMPSubAssign( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2950,6 +3191,42 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Restructuring SMP subtraction assignment to matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Restructuring SMP subtraction assignment of a dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP subtraction assignment of a
+   // dense matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpSubAssign( Matrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( SO )
+         smpSubAssign( ~lhs, trans( rhs.lhs_ ) * rhs.rhs_ );
+      else
+         smpSubAssign( ~lhs, rhs.lhs_ * trans( rhs.rhs_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -3021,14 +3298,31 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    enum { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The CanExploitSymmetry struct is a helper struct for the selection of the optimal
+       evaluation strategy. In case the target matrix is row-major and the right-hand side
+       matrix operand is symmetric or in case the target matrix is column-major and the
+       left-hand side matrix operand is symmetric, \a value is set to 1 and an optimized
+       evaluation strategy is selected. Otherwise \a value is set to 0 and the default
+       strategy is chosen. */
+   template< typename T1, typename T2, typename T3 >
+   struct CanExploitSymmetry {
+      enum { value = ( IsRowMajorMatrix<T1>::value && IsSymmetric<T3>::value ) ||
+                     ( IsColumnMajorMatrix<T1>::value && IsSymmetric<T2>::value ) };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The IsEvaluationRequired struct is a helper struct for the selection of the parallel
        evaluation strategy. In case either of the two matrix operands requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation and no symmetry can be exploited, the nested \value will be set to 1,
+       otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct IsEvaluationRequired {
-      enum { value = ( evaluateLeft || evaluateRight ) };
+      enum { value = ( evaluateLeft || evaluateRight ) &&
+                     !CanExploitSymmetry<T1,T2,T3>::value };
    };
    //**********************************************************************************************
 
@@ -3294,7 +3588,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void assign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -3472,14 +3767,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3506,10 +3801,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3528,8 +3823,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3551,10 +3846,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3573,8 +3868,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3589,7 +3884,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3648,14 +3943,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3678,10 +3973,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3709,10 +4004,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3731,8 +4026,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3754,8 +4049,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3770,7 +4065,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3815,9 +4110,13 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled dense matrix-
-   // transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled dense matrix-transpose
+   // dense matrix multiplication expression to a row-major dense matrix. This kernel is optimized
+   // for large matrices and is based on a cache-blocked, packed matrix multiplication (see the
+   // mmm() function).
+   //
+   // In case \a B is the transpose of \a A (as for instance in \f$ X*X^T \f$), only one half
+   // of the symmetric result is computed and mirrored (see the smmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3826,8 +4125,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( isSymmetricProduct( A, B ) )
+         smmm( C, A, B, scalar );
+      else
+         mmm( C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -3842,9 +4143,13 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled dense matrix-
-   // transpose dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled dense matrix-transpose
+   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on a cache-blocked, packed matrix multiplication
+   // (see the mmm() function).
+   //
+   // In case \a B is the transpose of \a A (as for instance in \f$ X*X^T \f$), only one half
+   // of the symmetric result is computed and mirrored (see the smmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3853,8 +4158,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( isSymmetricProduct( A, B ) )
+         smmm( C, A, B, scalar );
+      else
+         mmm( C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -4053,7 +4360,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    */
    template< typename MT  // Type of the target sparse matrix
            , bool SO >    // Storage order of the target sparse matrix
-   friend inline void assign( SparseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( SparseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -4074,6 +4382,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Restructuring assignment to matrices*********************************************************
+   /*!\brief Restructuring assignment of a scaled dense matrix-transpose dense matrix multiplication
+   //        to a matrix (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring assignment of a scaled dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      assign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         assign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         assign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*!\brief Addition assignment of a scaled dense matrix-transpose dense matrix multiplication
    //        to a dense matrix (\f$ C+=s*A*B \f$).
@@ -4088,7 +4433,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void addAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      addAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -4240,14 +4586,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4274,10 +4620,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4296,8 +4642,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4319,10 +4665,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4341,8 +4687,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4357,7 +4703,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4416,14 +4762,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4446,10 +4792,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4477,10 +4823,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4499,8 +4845,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4522,8 +4868,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4538,7 +4884,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4583,9 +4929,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default addition assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a row-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on a cache-blocked, packed matrix multiplication
+   // (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4594,8 +4941,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -4610,9 +4956,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default addition assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on a cache-blocked, packed matrix multiplication
+   // (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4621,8 +4968,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -4815,6 +5161,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Restructuring addition assignment to matrices************************************************
+   /*!\brief Restructuring addition assignment of a scaled dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring addition assignment of a scaled
+   // dense matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      addAssign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         addAssign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         addAssign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -4833,7 +5216,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline void subAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      subAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -4985,14 +5369,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5019,10 +5403,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5041,8 +5425,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5064,10 +5448,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5086,8 +5470,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5102,7 +5486,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5162,14 +5546,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5192,10 +5576,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5223,10 +5607,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5245,8 +5629,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5268,8 +5652,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5284,7 +5668,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5331,7 +5715,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function implements the vectorized default subtraction assignment of a scaled dense
    // matrix-transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on a cache-blocked, packed matrix
+   // multiplication (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5340,8 +5725,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( C, A, B, -scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5357,8 +5741,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \return void
    //
    // This function implements the vectorized default subtraction assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix. This
+   // kernel is optimized for large matrices and is based on a cache-blocked, packed matrix
+   // multiplication (see the mmm() function).
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5367,8 +5752,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( C, A, B, -scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5561,6 +5945,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Restructuring subtraction assignment to matrices*********************************************
+   /*!\brief Restructuring subtraction assignment of a scaled dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring subtraction assignment of a scaled
+   // dense matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      subAssign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         subAssign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         subAssign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -5662,6 +6083,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Restructuring SMP assignment to matrices*****************************************************
+   /*!\brief Restructuring SMP assignment of a scaled dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP assignment of a scaled dense
+   // matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpAssign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         smpAssign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         smpAssign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*!\brief SMP addition assignment of a scaled dense matrix-transpose dense matrix multiplication
    //        to a dense matrix (\f$ C+=s*A*B \f$).
@@ -5708,6 +6166,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Restructuring SMP addition assignment to matrices********************************************
+   /*!\brief Restructuring SMP addition assignment of a scaled dense matrix-transpose dense matrix
+   //        multiplication to a matrix (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP addition assignment of a scaled
+   // dense matrix-transpose dense matrix multiplication expression to a matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in case
+   // the symmetry of either of the two matrix operands can be exploited for a more cache-friendly
+   // storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpAddAssign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         smpAddAssign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         smpAddAssign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -5758,6 +6253,43 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Restructuring SMP subtraction assignment to matrices*****************************************
+   /*!\brief Restructuring SMP subtraction assignment of a scaled dense matrix-transpose dense
+   //        matrix multiplication to a matrix (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the symmetry-based restructuring SMP subtraction assignment of a
+   // scaled dense matrix-transpose dense matrix multiplication expression to a matrix. Due to the
+   // explicit application of the SFINAE principle this function can only be selected by the
+   // compiler in case the symmetry of either of the two matrix operands can be exploited for a more
+   // cache-friendly storage order.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   friend inline typename EnableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      smpSubAssign( Matrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typename MMM::LeftOperand  left ( rhs.matrix_.leftOperand()  );
+      typename MMM::RightOperand right( rhs.matrix_.rightOperand() );
+
+      if( SO )
+         smpSubAssign( ~lhs, trans( left ) * right * rhs.scalar_ );
+      else
+         smpSubAssign( ~lhs, left * trans( right ) * rhs.scalar_ );
+   }
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
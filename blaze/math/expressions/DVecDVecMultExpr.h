@@ -44,6 +44,7 @@
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/VecVecMultExpr.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -60,6 +61,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/EnableIf.h>
@@ -67,6 +69,8 @@
 #include <blaze/util/mpl/Max.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsSame.h>
 
 
@@ -151,6 +155,26 @@ class DVecDVecMultExpr : public DenseVector< DVecDVecMultExpr<VT1,VT2,TF>, TF >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatch strategy*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseDispatchAssign struct is a helper struct for the selection of the runtime dispatched
+       evaluation strategy. In case the runtime dispatch mode is active, the target vector and both
+       dense vector operands provide direct access to their single or double precision elements
+       and the target vector is not a fixed-size vector, \a value is set to 1 and the multiplication is
+       computed by the kernel for the instruction set detected at program startup. Otherwise
+       \a value is set to 0 and the default strategy is chosen. */
+   template< typename VT >
+   struct UseDispatchAssign {
+      enum { value = BLAZE_DISPATCH_MODE && !useAssign && Size<VT>::value == 0UL &&
+                     VT::vectorizable && VT1::vectorizable && VT2::vectorizable &&
+                     !IsComputation<VT1>::value && !IsComputation<VT2>::value &&
+                     ( IsFloat<ET1>::value || IsDouble<ET1>::value ) &&
+                     IsSame<ET1,ET2>::value && IsSame<typename VT::ElementType,ET1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DVecDVecMultExpr<VT1,VT2,TF>                This;           //!< Type of this DVecDVecMultExpr instance.
@@ -612,6 +636,36 @@ class DVecDVecMultExpr : public DenseVector< DVecDVecMultExpr<VT1,VT2,TF>, TF >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense vector-dense vector multiplication to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense vector-dense vector multiplication expression
+   // to a dense vector by means of the kernel for the instruction set detected at program startup.
+   // Due to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the runtime dispatch mode is active and all involved vectors provide
+   // direct access to their single or double precision elements.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline typename EnableIf< UseDispatchAssign<VT> >::Type
+      assign( DenseVector<VT,TF>& lhs, const DVecDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      dispatch::mult( (~lhs).size(), rhs.lhs_.data(), rhs.rhs_.data(), (~lhs).data() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense vector-dense vector multiplication to a sparse vector.
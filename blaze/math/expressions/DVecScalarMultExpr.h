@@ -43,6 +43,7 @@
 #include <iterator>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -73,6 +74,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/FloatingPoint.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -83,6 +85,8 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
@@ -165,6 +169,25 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatch strategy*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseDispatchAssign struct is a helper struct for the selection of the runtime dispatched
+       evaluation strategy. In case the runtime dispatch mode is active, the target vector and the
+       dense vector operand provide direct access to their single or double precision elements,
+       the scalar is of the same type and the target vector is not a fixed-size vector, \a value
+       is set to 1 and the scaling is computed by the kernel for the instruction set detected at
+       program startup. Otherwise \a value is set to 0 and the default strategy is chosen. */
+   template< typename VT2 >
+   struct UseDispatchAssign {
+      enum { value = BLAZE_DISPATCH_MODE && !useAssign && Size<VT2>::value == 0UL &&
+                     VT2::vectorizable && VT::vectorizable && !IsComputation<VT>::value &&
+                     ( IsFloat<ET>::value || IsDouble<ET>::value ) &&
+                     IsSame<ET,ST>::value && IsSame<typename VT2::ElementType,ET>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DVecScalarMultExpr<VT,ST,TF>                This;           //!< Type of this DVecScalarMultExpr instance.
@@ -607,6 +630,36 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense vector-scalar multiplication to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense vector-scalar multiplication expression
+   // to a dense vector by means of the kernel for the instruction set detected at program startup.
+   // Due to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the runtime dispatch mode is active and both vectors provide direct
+   // access to their single or double precision elements.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseDispatchAssign<VT2> >::Type
+      assign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      dispatch::scale( (~lhs).size(), rhs.scalar_, rhs.vector_.data(), (~lhs).data() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense vector-scalar multiplication to a sparse vector.
@@ -53,13 +53,19 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/BCSRMult.h>
+#include <blaze/math/sparse/CSRMV.h>
+#include <blaze/math/sparse/SELLMV.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -147,6 +153,48 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is stored in the sliced ELLPACK format and neither operand
+       requires an intermediate evaluation, the nested \value will be set to 1 and the
+       multiplication is evaluated chunk-wise, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseChunkKernel {
+      enum { value = !useAssign && IsSlicedEllpack<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is stored in the block compressed row format and neither operand
+       requires an intermediate evaluation, the nested \value will be set to 1 and the
+       multiplication is evaluated block row by block row, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseBlockKernel {
+      enum { value = !useAssign && IsBlockCompressed<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is neither stored in the sliced ELLPACK nor in the block
+       compressed row format, neither operand requires an intermediate evaluation, and the
+       target vector can be used in SMP assignments, the nested \value will be set to 1 and
+       the rows of the matrix are distributed among the threads based on their number of
+       non-zero elements, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseBalancedKernel {
+      enum { value = !useAssign && !IsSlicedEllpack<MT>::value && !IsBlockCompressed<MT>::value &&
+                     MT::smpAssignable && VT::smpAssignable && IsSMPAssignable<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDVecMultExpr<MT,VT>             This;           //!< Type of this SMatDVecMultExpr instance.
@@ -203,69 +251,26 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
 
-      typedef typename RemoveReference<MCT>::Type::ConstIterator  ConstIterator;
-
-      ElementType tmp = ElementType();
-
       // Early exit
       if( mat_.columns() == 0UL )
-         return tmp;
+         return ElementType();
 
       // Fast computation in case the left-hand side sparse matrix directly provides iterators
       if( !RequiresEvaluation<MT>::value )
       {
          MCT A( mat_ );  // Evaluation of the left-hand side sparse matrix operand
 
-         const ConstIterator end( A.end(index) );
-         ConstIterator element( A.begin(index) );
-
-         // Early exit in case row 'index' is empty
-         if( element == end )
-            return tmp;
-
-         // Calculating element 'index' for numeric data types
-         if( IsNumeric<ElementType>::value )
-         {
-            const size_t ipos( A.nonZeros(index) & size_t(-2) );
-            ElementType tmp2 = ElementType();
-
-            for( size_t i=0UL; i<ipos; i+=2UL )
-            {
-               const ElementType value1( element->value() );
-               const size_t      index1( element->index() );
-               ++element;
-               const ElementType value2( element->value() );
-               const size_t      index2( element->index() );
-               ++element;
-
-               tmp  += value1 * vec_[index1];
-               tmp2 += value2 * vec_[index2];
-            }
-            if( element!=end ) {
-               tmp += element->value() * vec_[element->index()];
-            }
-
-            tmp += tmp2;
-         }
-
-         // Calculating element 'index' for non-numeric data types
-         else {
-            tmp = element->value() * vec_[element->index()];
-            ++element;
-            for( ; element!=end; ++element )
-               tmp += element->value() * vec_[element->index()];
-         }
+         return csrmvRow<ElementType>( A, vec_, index );
       }
 
       // Default computation in case the left-hand side sparse matrix doesn't provide iterators
       else {
-         tmp = mat_(index,0UL) * vec_[0UL];
+         ElementType tmp( mat_(index,0UL) * vec_[0UL] );
          for( size_t k=1UL; k<mat_.columns(); ++k ) {
             tmp += mat_(index,k) * vec_[k];
          }
+         return tmp;
       }
-
-      return tmp;
    }
    //**********************************************************************************************
 
@@ -521,6 +526,217 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (sliced ELLPACK)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sliced ELLPACK matrix-
+   // dense vector multiplication expression to a dense vector. The product is computed chunk by
+   // chunk via the vectorized SELL-C-sigma kernel. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      sellmvAssign( ~lhs, A, x, 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (sliced ELLPACK)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sliced ELLPACK
+   // matrix-dense vector multiplication expression to a dense vector. The product is computed
+   // chunk by chunk via the vectorized SELL-C-sigma kernel. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the left-hand
+   // side matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      sellmvAddAssign( ~lhs, A, x, 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (sliced ELLPACK)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sliced ELLPACK
+   // matrix-dense vector multiplication expression to a dense vector. The product is computed
+   // chunk by chunk via the vectorized SELL-C-sigma kernel. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the left-hand
+   // side matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      sellmvSubAssign( ~lhs, A, x, 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (block compressed)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block compressed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The product is computed block
+   // row by block row, vectorized within the blocks. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a BlockCompressedMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      bcsrmvAssign( ~lhs, A, x, 0UL, A.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (block compressed)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block compressed matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The product is computed block
+   // row by block row, vectorized within the blocks. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a BlockCompressedMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      bcsrmvAddAssign( ~lhs, A, x, 0UL, A.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (block compressed)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block compressed matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a block
+   // compressed matrix-dense vector multiplication expression to a dense vector. The product is
+   // computed block row by block row, vectorized within the blocks. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // left-hand side matrix operand is a BlockCompressedMatrix and neither operand requires an
+   // evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      bcsrmvSubAssign( ~lhs, A, x, 0UL, A.blockRows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Multiplication assignment to dense vectors**************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Multiplication assignment of a sparse matrix-dense vector multiplication to a dense
@@ -727,6 +943,339 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors (sliced ELLPACK)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sliced ELLPACK matrix-
+   // dense vector multiplication expression to a dense vector. The chunks of the matrix are
+   // distributed among the available threads. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpSellmvAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (sliced ELLPACK)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sliced
+   // ELLPACK matrix-dense vector multiplication expression to a dense vector. The chunks of the
+   // matrix are distributed among the available threads. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the left-hand
+   // side matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpSellmvAddAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (sliced ELLPACK)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sliced
+   // ELLPACK matrix-dense vector multiplication expression to a dense vector. The chunks of the
+   // matrix are distributed among the available threads. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the left-hand
+   // side matrix operand is a SlicedEllpackMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpSellmvSubAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (block compressed)*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block compressed matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The block rows of the matrix
+   // are distributed among the available threads such that all threads process approximately the
+   // same number of blocks. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case the left-hand side matrix operand is a
+   // BlockCompressedMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpBcsrmvAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (block compressed)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a block compressed matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a block
+   // compressed matrix-dense vector multiplication expression to a dense vector. The block rows of
+   // the matrix are distributed among the available threads such that all threads process
+   // approximately the same number of blocks. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a BlockCompressedMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpBcsrmvAddAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (block compressed)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a block compressed matrix-dense vector multiplication to
+   //        a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a block
+   // compressed matrix-dense vector multiplication expression to a dense vector. The block rows of
+   // the matrix are distributed among the available threads such that all threads process
+   // approximately the same number of blocks. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a BlockCompressedMatrix and neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpBcsrmvSubAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (balanced)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector. The rows of the matrix are distributed
+   // among the available threads such that all threads process approximately the same number
+   // of non-zero elements. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case neither operand requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBalancedKernel<VT1> >::Type
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpCsrmvAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (balanced)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector. The rows of the matrix
+   // are distributed among the available threads such that all threads process approximately
+   // the same number of non-zero elements. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case neither operand
+   // requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBalancedKernel<VT1> >::Type
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpCsrmvAddAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (balanced)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector. The rows of the matrix
+   // are distributed among the available threads such that all threads process approximately
+   // the same number of non-zero elements. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case neither operand
+   // requires an evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBalancedKernel<VT1> >::Type
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size(), "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( A.columns() == x.size()     , "Invalid vector size" );
+
+      smpCsrmvSubAssign( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP multiplication assignment to dense vectors**********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP multiplication assignment of a sparse matrix-dense vector multiplication to a
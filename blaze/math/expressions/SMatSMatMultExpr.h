@@ -56,6 +56,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -68,10 +70,12 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsCompressedMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -166,6 +170,20 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPEvaluation struct is a helper struct for the selection of the evaluation strategy
+       of the matrix operands in SMP assignments. In case the given operand is a matrix
+       multiplication that requires an intermediate evaluation, the nested \value will be set to
+       1 and the operand is evaluated via an SMP assignment. Otherwise it will be 0. */
+   template< typename T >
+   struct UseSMPEvaluation {
+      enum { value = RequiresEvaluation<T>::value && IsMatMatMultExpr<T>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatSMatMultExpr<MT1,MT2>           This;           //!< Type of this SMatSMatMultExpr instance.
@@ -449,7 +467,8 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // matrix multiplication expression to a row-major sparse matrix.
    */
    template< typename MT >  // Type of the target sparse matrix
-   friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+   friend inline typename DisableIf< IsCompressedMatrix<MT> >::Type
+      assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -558,6 +577,45 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to row-major compressed matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a row-major compressed
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side compressed matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major compressed matrix. The product is computed
+   // in two phases: The symbolic phase determines the exact number of non-zero elements of each
+   // row, the numeric phase writes all rows directly into the exactly pre-sized target matrix.
+   // Each row is accumulated via a sort-based, a hash-based, or a dense accumulator, depending
+   // on its number of scalar products.
+   */
+   template< typename MT >  // Type of the target compressed matrix
+   friend inline typename EnableIf< IsCompressedMatrix<MT> >::Type
+      assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      spgemmAssign( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to column-major sparse matrices**************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a column-major sparse
@@ -887,6 +945,86 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP evaluation of matrix operands***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP evaluation of a matrix multiplication operand.
+   // \ingroup sparse_matrix
+   //
+   // \param operand The matrix multiplication operand to be evaluated.
+   // \return The evaluated operand.
+   //
+   // This function evaluates the given matrix multiplication operand via an SMP assignment.
+   // Thus nested products (as for instance the Galerkin product \f$ R*A*P \f$) are evaluated
+   // in parallel.
+   */
+   template< typename MT >  // Type of the sparse matrix operand
+   static inline const typename EnableIf< UseSMPEvaluation<MT>, typename MT::ResultType >::Type
+      smpEvaluate( const MT& operand )
+   {
+      typename MT::ResultType tmp;
+      tmp = operand;
+      return tmp;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP evaluation of matrix operands***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Pass-through of all operands that are not matrix multiplications.
+   // \ingroup sparse_matrix
+   //
+   // \param operand The sparse matrix operand.
+   // \return Reference to the given operand.
+   //
+   // Operands requiring an intermediate evaluation are evaluated by the subsequent construction
+   // of the according composite type.
+   */
+   template< typename MT >  // Type of the sparse matrix operand
+   static inline typename DisableIf< UseSMPEvaluation<MT>, const MT& >::Type
+      smpEvaluate( const MT& operand )
+   {
+      return operand;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to row-major compressed matrices*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major
+   //        compressed matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side compressed matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major compressed matrix. Both the symbolic and the
+   // numeric phase of the multiplication are parallelized across rows, which are distributed
+   // according to their number of scalar products.
+   */
+   template< typename MT >  // Type of the target compressed matrix
+   friend inline typename EnableIf< IsCompressedMatrix<MT> >::Type
+      smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( SMatSMatMultExpr::smpEvaluate( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( SMatSMatMultExpr::smpEvaluate( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      smpSpgemmAssign( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP assignment to column-major matrices***************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP assignment of a sparse matrix-sparse matrix multiplication to a
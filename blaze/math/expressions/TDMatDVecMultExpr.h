@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -216,14 +218,35 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, no BLAS kernel is available, and the runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. Triangular matrices are
+       handled by the default kernels, which skip the known zero elements. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T2>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -595,14 +618,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -625,10 +648,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -647,9 +670,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -667,8 +690,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -684,7 +707,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -765,14 +788,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -791,10 +814,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -809,9 +832,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -825,8 +848,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -838,7 +861,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -940,6 +963,34 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose dense matrix-dense vector multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1210,14 +1261,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1243,10 +1294,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1267,9 +1318,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1288,8 +1339,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1305,7 +1356,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1384,14 +1435,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1410,10 +1461,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1428,9 +1479,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1444,8 +1495,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -1457,7 +1508,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1561,6 +1612,34 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a transpose matrix-vector multiplication (\f$
+   //        \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose matrix-vector multiplication for single and double
+   // precision operands based on the runtime dispatched kernel for the instruction set selected at
+   // program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1808,14 +1887,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 - A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 - A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 - A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 - A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fnmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fnmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fnmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fnmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1841,10 +1920,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1865,9 +1944,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1886,8 +1965,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i         ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size,j) * x1;
+            xmm1 = fnmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1903,7 +1982,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 - A.load(i,j) * set( x[j] );
+            xmm1 = fnmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1983,14 +2062,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2009,10 +2088,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2027,9 +2106,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2043,8 +2122,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1 );
@@ -2056,7 +2135,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1 );
@@ -2160,6 +2239,34 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a transpose matrix-vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose matrix-vector multiplication for single and double
+   // precision operands based on the runtime dispatched kernel for the instruction set selected at
+   // program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      dispatch::gemv( y, A, x, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -2606,14 +2713,34 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, the scalar value is not a complex data type, no BLAS kernel is available,
+       and the runtime dispatched kernel can be used, the nested \a value will be set to 1,
+       otherwise it will be 0. Triangular matrices are handled by the default kernels. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T2>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value &&
+                     !IsComplex<T4>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3, typename T4 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3,T4>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    //**********************************************************************************************
 
@@ -2969,14 +3096,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1*factor );
@@ -2999,10 +3126,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3021,9 +3148,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3041,8 +3168,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1*factor );
@@ -3059,7 +3186,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i,j) * x1;
+            xmm1 = fmadd( A.load(i,j), x1, xmm1 );
          }
 
          y.store( i, xmm1*factor );
@@ -3142,14 +3269,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3168,10 +3295,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3186,9 +3313,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3202,8 +3329,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3215,7 +3342,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -3316,6 +3443,34 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense matrix-dense vector multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, scalar, ElementType(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based assignment of a scaled transpose dense matrix-dense vector multiplication
@@ -3563,14 +3718,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3593,10 +3748,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3615,9 +3770,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3635,8 +3790,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3652,7 +3807,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) + xmm1*factor );
@@ -3734,14 +3889,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3760,10 +3915,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3778,9 +3933,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3794,8 +3949,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3807,7 +3962,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -3910,6 +4065,34 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense matrix-dense vector multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based addition assignment of a scaled transpose dense matrix-dense vector
@@ -4135,14 +4318,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4165,10 +4348,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4187,9 +4370,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4207,8 +4390,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4223,7 +4406,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) - xmm1*factor );
@@ -4305,14 +4488,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4331,10 +4514,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4349,9 +4532,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4365,8 +4548,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4378,7 +4561,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1*factor );
@@ -4481,6 +4664,34 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled transpose dense matrix-dense
+   //        vector multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense matrix-dense vector multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,MT1,VT2,ST2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      dispatch::gemv( y, A, x, -scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based subtraction assignment of a scaled transpose dense matrix-dense vector
@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -73,6 +74,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -217,14 +219,35 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, no BLAS kernel is available, and the runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. Triangular matrices are
+       handled by the default kernels, which skip the known zero elements. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T3>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -596,14 +619,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -626,10 +649,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -648,9 +671,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -668,8 +691,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -685,7 +708,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -766,14 +789,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -792,10 +815,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -810,9 +833,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -826,8 +849,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -839,7 +862,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -941,6 +964,34 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a transpose dense vector-dense matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function performs the transpose dense vector-dense matrix multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1211,14 +1262,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1244,10 +1295,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1268,9 +1319,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1289,8 +1340,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1306,7 +1357,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1385,14 +1436,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1411,10 +1462,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1429,9 +1480,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1445,8 +1496,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -1458,7 +1509,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1562,6 +1613,34 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function performs the transpose dense vector-dense matrix multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1809,14 +1888,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 - x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 - x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 - x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 - x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fnmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fnmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fnmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fnmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1842,10 +1921,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1866,9 +1945,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1887,8 +1966,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j         );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size);
+            xmm1 = fnmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1904,7 +1983,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 - set( x[i] ) * A.load(i,j);
+            xmm1 = fnmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1984,14 +2063,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2010,10 +2089,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2028,9 +2107,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2044,8 +2123,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1 );
@@ -2057,7 +2136,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1 );
@@ -2161,6 +2240,34 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function performs the transpose dense vector-dense matrix multiplication for single and
+   // double precision operands based on the runtime dispatched kernel for the instruction set
+   // selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -2606,14 +2713,34 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, the scalar value is not a complex data type, no BLAS kernel is available,
+       and the runtime dispatched kernel can be used, the nested \a value will be set to 1,
+       otherwise it will be 0. Triangular matrices are handled by the default kernels. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T3>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value &&
+                     !IsComplex<T4>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3, typename T4 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3,T4>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    //**********************************************************************************************
 
@@ -2969,14 +3096,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1*factor );
@@ -2999,10 +3126,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3021,9 +3148,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3041,8 +3168,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1*factor );
@@ -3058,7 +3185,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1*factor );
@@ -3141,14 +3268,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3167,10 +3294,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3185,9 +3312,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3201,8 +3328,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3214,7 +3341,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -3314,6 +3441,34 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-dense matrix multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, scalar, ElementType(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based assignment of a scaled transpose dense vector-dense matrix multiplication
@@ -3561,14 +3716,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3591,10 +3746,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3613,9 +3768,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3633,8 +3788,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3650,7 +3805,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) + xmm1*factor );
@@ -3732,14 +3887,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3758,10 +3913,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3776,9 +3931,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3792,8 +3947,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3805,7 +3960,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -3908,6 +4063,34 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-dense matrix multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based addition assignment of a scaled transpose dense vector-dense matrix
@@ -4133,14 +4316,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4163,10 +4346,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4185,9 +4368,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4205,8 +4388,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4222,7 +4405,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) - xmm1*factor );
@@ -4304,14 +4487,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4330,10 +4513,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4348,9 +4531,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4364,8 +4547,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4377,7 +4560,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1*factor );
@@ -4480,6 +4663,34 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled transpose dense vector-dense
+   //        matrix multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-dense matrix multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, -scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based subtraction assignment of a scaled transpose dense vector-dense matrix
@@ -41,13 +41,20 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -89,6 +96,36 @@ struct TDVecDVecMultExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched dense vector/dense vector scalar
+//        multiplication.
+// \ingroup dense_vector
+*/
+template< typename T1    // Type of the left-hand side dense vector
+        , typename T2 >  // Type of the right-hand side dense vector
+struct TDVecDVecMultExprDispatchHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side dense vector expression.
+   typedef typename RemoveReference< typename T1::CompositeType >::Type  CT1;
+
+   //! Composite type of the right-hand side dense vector expression.
+   typedef typename RemoveReference< typename T2::CompositeType >::Type  CT2;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = BLAZE_DISPATCH_MODE &&
+                  TDVecDVecMultExprHelper<T1,T2>::value &&
+                  ( IsFloat< typename CT1::ElementType >::value ||
+                    IsDouble< typename CT1::ElementType >::value ) &&
+                  !IsComputation<CT1>::value && !IsComputation<CT2>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -185,8 +222,9 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
-inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
-                          const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
+inline typename EnableIf< And< TDVecDVecMultExprHelper<T1,T2>
+                              , Not< TDVecDVecMultExprDispatchHelper<T1,T2> > >
+                         , const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
    operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
@@ -212,10 +250,10 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    const size_t end( N - N % (IT::size*4UL) );
 
    for( size_t i=0UL; i<end; i+=IT::size*4UL ) {
-      xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
-      xmm2 = xmm2 + ( left.load(i+IT::size    ) * right.load(i+IT::size    ) );
-      xmm3 = xmm3 + ( left.load(i+IT::size*2UL) * right.load(i+IT::size*2UL) );
-      xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
+      xmm1 = fmadd( left.load(i             ), right.load(i             ), xmm1 );
+      xmm2 = fmadd( left.load(i+IT::size    ), right.load(i+IT::size    ), xmm2 );
+      xmm3 = fmadd( left.load(i+IT::size*2UL), right.load(i+IT::size*2UL), xmm3 );
+      xmm4 = fmadd( left.load(i+IT::size*3UL), right.load(i+IT::size*3UL), xmm4 );
    }
 
    MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
@@ -227,6 +265,45 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*!\brief Runtime dispatched multiplication operator for the scalar product (inner product) of
+//        two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This operator computes the scalar product of two \c float or \c double dense vectors by
+// means of the kernel for the instruction set selected at program startup (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch). In case the current sizes of the two given vectors
+// don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1    // Type of the left-hand side dense vector
+        , typename T2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< TDVecDVecMultExprDispatchHelper<T1,T2>,
+                          const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
+   operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   typedef typename T1::CompositeType  Lhs;
+   typedef typename T2::CompositeType  Rhs;
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+
+   return dispatch::dot( left.size(), left.data(), right.data() );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
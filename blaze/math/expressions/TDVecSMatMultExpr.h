@@ -52,6 +52,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/TVecMatMultExpr.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
@@ -60,6 +61,7 @@
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasSplitStorage.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
@@ -68,6 +70,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/DisableIf.h>
@@ -76,6 +79,9 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -131,6 +137,25 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target vector provides direct access to its elements, the sparse matrix
+       stores its values and indices in separate arrays, and both element types are the same
+       single or double precision type, the nested \value will be set to 1, otherwise it will
+       be 0. */
+   template< typename T1, typename T2 >
+   struct UseVectorizedKernel {
+      enum { value = BLAZE_AVX512F_MODE &&
+                     T1::vectorizable && IsSame<T1,typename T1::ResultType>::value &&
+                     HasSplitStorage<T2>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     ( IsFloat<typename T1::ElementType>::value ||
+                       IsDouble<typename T1::ElementType>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDVecSMatMultExpr<VT,MT>            This;           //!< Type of this TDVecSMatMultExpr instance.
@@ -330,7 +355,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -351,6 +377,57 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized assignment to dense vectors******************************************************
+#if BLAZE_AVX512F_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a transpose dense vector-sparse matrix
+   //        multiplication (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized serial assignment kernel for the transpose
+   // dense vector-sparse matrix multiplication with a sparse matrix with split value/index
+   // storage. The affected elements of the target vector are gathered, updated, and scattered
+   // back based on the contiguous index array of each row.
+   // Note that the target vector is expected to be reset before the kernel is called.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT1::IndexType      IndexType;
+
+      ElementType* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const size_t       nonzeros( A.nonZeros(i) );
+         const ElementType* values  ( A.begin(i).values() );
+         const IndexType*   indices ( A.begin(i).indices() );
+
+         const IntrinsicType xmm1( set( x[i] ) );
+         size_t j( 0UL );
+
+         for( ; (j+IT::size) <= nonzeros; j+=IT::size ) {
+            scatter( data, indices+j, fmadd( xmm1, loadu( values+j ), gather( data, indices+j ) ) );
+         }
+         for( ; j<nonzeros; ++j ) {
+            data[indices[j]] += x[i] * values[j];
+         }
+      }
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -433,7 +510,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -450,6 +528,56 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized addition assignment to dense vectors*********************************************
+#if BLAZE_AVX512F_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a transpose dense vector-sparse matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized serial addition assignment kernel for the transpose
+   // dense vector-sparse matrix multiplication with a sparse matrix with split value/index
+   // storage. The affected elements of the target vector are gathered, updated, and scattered
+   // back based on the contiguous index array of each row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT1::IndexType      IndexType;
+
+      ElementType* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const size_t       nonzeros( A.nonZeros(i) );
+         const ElementType* values  ( A.begin(i).values() );
+         const IndexType*   indices ( A.begin(i).indices() );
+
+         const IntrinsicType xmm1( set( x[i] ) );
+         size_t j( 0UL );
+
+         for( ; (j+IT::size) <= nonzeros; j+=IT::size ) {
+            scatter( data, indices+j, fmadd( xmm1, loadu( values+j ), gather( data, indices+j ) ) );
+         }
+         for( ; j<nonzeros; ++j ) {
+            data[indices[j]] += x[i] * values[j];
+         }
+      }
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -508,7 +636,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -525,6 +654,56 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized subtraction assignment to dense vectors******************************************
+#if BLAZE_AVX512F_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a transpose dense vector-sparse matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized serial subtraction assignment kernel for the transpose
+   // dense vector-sparse matrix multiplication with a sparse matrix with split value/index
+   // storage. The affected elements of the target vector are gathered, updated, and scattered
+   // back based on the contiguous index array of each row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedKernel<VT1,MT1> >::Type
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT1::IndexType      IndexType;
+
+      ElementType* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const size_t       nonzeros( A.nonZeros(i) );
+         const ElementType* values  ( A.begin(i).values() );
+         const IndexType*   indices ( A.begin(i).indices() );
+
+         const IntrinsicType xmm1( set( x[i] ) );
+         size_t j( 0UL );
+
+         for( ; (j+IT::size) <= nonzeros; j+=IT::size ) {
+            scatter( data, indices+j, fnmadd( xmm1, loadu( values+j ), gather( data, indices+j ) ) );
+         }
+         for( ; j<nonzeros; ++j ) {
+            data[indices[j]] -= x[i] * values[j];
+         }
+      }
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -71,6 +72,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -211,14 +213,35 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, no BLAS kernel is available, and the runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. Triangular matrices are
+       handled by the default kernels, which skip the known zero elements. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T3>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -557,14 +580,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -587,10 +610,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -609,9 +632,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -629,8 +652,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -646,7 +669,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + x.load(i) * A.load(i,j);
+            xmm1 = fmadd( x.load(i), A.load(i,j), xmm1 );
          }
 
          y[j] = sum( xmm1 );
@@ -960,6 +983,34 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a transpose dense vector-transpose dense matrix
+   //        multiplication (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side transpose dense vector operand.
+   // \param A The right-hand side column-major dense matrix operand.
+   // \return void
+   //
+   // This function performs the transpose dense vector-transpose dense matrix multiplication for
+   // single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1205,14 +1256,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1235,10 +1286,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1257,9 +1308,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1277,8 +1328,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1294,7 +1345,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 );
@@ -1609,6 +1660,34 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a vector-matrix multiplication (\f$
+   //        \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side transpose dense vector operand.
+   // \param A The right-hand side column-major dense matrix operand.
+   // \return void
+   //
+   // This function performs the vector-matrix multiplication for single and double precision
+   // operands based on the runtime dispatched kernel for the instruction set selected at program
+   // startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -1830,14 +1909,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1860,10 +1939,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1882,9 +1961,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1902,8 +1981,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1919,7 +1998,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 );
@@ -2234,6 +2313,34 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a vector-matrix multiplication (\f$
+   //        \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side transpose dense vector operand.
+   // \param A The right-hand side column-major dense matrix operand.
+   // \return void
+   //
+   // This function performs the vector-matrix multiplication for single and double precision
+   // operands based on the runtime dispatched kernel for the instruction set selected at program
+   // startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1> >::Type
+      selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      dispatch::gemv( y, x, A, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*! \cond BLAZE_INTERNAL */
@@ -2675,14 +2782,34 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case no optimized BLAS kernel can be used, the nested \a value will be set to 1,
-       otherwise it will be 0. */
+   /*! In case the data type of the two involved vectors and the matrix is either \a float or
+       \a double, the scalar value is not a complex data type, no BLAS kernel is available,
+       and the runtime dispatched kernel can be used, the nested \a value will be set to 1,
+       otherwise it will be 0. Triangular matrices are handled by the default kernels. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      typedef typename T1::ElementType  Type;
+      enum { value = BLAZE_DISPATCH_MODE && !BLAZE_BLAS_MODE &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsTriangular<T3>::value &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<typename T2::ElementType,Type>::value &&
+                     IsSame<typename T3::ElementType,Type>::value &&
+                     !IsComplex<T4>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither an optimized BLAS kernel nor a runtime dispatched kernel can be used,
+       the nested \a value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3, typename T4 >
    struct UseDefaultKernel {
-      enum { value = !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
-                                           !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
-                                           !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) };
+      enum { value = !UseDispatchKernel<T1,T2,T3,T4>::value &&
+                     ( !BLAZE_BLAS_MODE || ( !UseSinglePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseDoublePrecisionKernel<T1,T2,T3,T4>::value &&
+                                             !UseSinglePrecisionComplexKernel<T1,T2,T3>::value &&
+                                             !UseDoublePrecisionComplexKernel<T1,T2,T3>::value ) ) };
    };
    //**********************************************************************************************
 
@@ -3002,14 +3129,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3032,10 +3159,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3054,9 +3181,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3074,8 +3201,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3091,7 +3218,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] = sum( xmm1 ) * scalar;
@@ -3423,6 +3550,34 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors***********************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled transpose dense vector-transpose dense matrix
+   //        multiplication (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-transpose dense matrix multiplication
+   // for single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, scalar, ElementType(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (single precision complex)***************************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based assignment of a scaled transpose dense vector-transpose dense matrix
@@ -3672,14 +3827,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3702,10 +3857,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3724,9 +3879,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3744,8 +3899,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3761,7 +3916,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 ) * scalar;
@@ -4076,6 +4231,34 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors**************************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled transpose dense vector-transose
+   //        dense matrix multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-transose dense matrix multiplication
+   // for single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (single precision complex)******************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based addition assignment of a scaled transpose dense vector-transose dense matrix
@@ -4302,14 +4485,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4332,10 +4515,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4354,9 +4537,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4374,8 +4557,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4391,7 +4574,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 ) * scalar;
@@ -4706,6 +4889,34 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors***********************************
+#if BLAZE_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled transpose dense vector-transpose
+   //        dense matrix multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense vector-transpose dense matrix multiplication
+   // for single and double precision operands based on the runtime dispatched kernel for the
+   // instruction set selected at program startup.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UseDispatchKernel<VT1,VT2,MT1,ST2> >::Type
+      selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      dispatch::gemv( y, x, A, -scalar, ElementType(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (single precision complex)***************
 #if BLAZE_BLAS_MODE
    /*!\brief BLAS-based subtraction assignment of a scaled transpose dense vector-transpose
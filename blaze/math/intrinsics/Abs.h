@@ -61,7 +61,12 @@ namespace blaze {
 // \param a The vector of 8-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
+{
+   return _mm512_abs_epi8( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
 {
    return _mm256_abs_epi8( a.value );
@@ -83,7 +88,12 @@ BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
 // \param a The vector of 16-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
+{
+   return _mm512_abs_epi16( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
 {
    return _mm256_abs_epi16( a.value );
@@ -105,7 +115,12 @@ BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
 // \param a The vector of 32-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
+{
+   return _mm512_abs_epi32( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
 {
    return _mm256_abs_epi32( a.value );
@@ -118,6 +133,23 @@ BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
 #endif
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\fn sse_int64_t abs( sse_int64_t )
+// \brief Absolute value of a vector of 64-bit integral values.
+// \ingroup intrinsics
+//
+// \param a The vector of 64-bit integral values.
+// \return The absolute values.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_int64_t abs( const sse_int64_t& a )
+{
+   return _mm512_abs_epi64( a.value );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -60,7 +60,14 @@ namespace blaze {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+struct sse_int8_t {
+   BLAZE_ALWAYS_INLINE sse_int8_t() : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE sse_int8_t( __m512i v ) : value( v ) {}
+   BLAZE_ALWAYS_INLINE int8_t operator[]( size_t i ) const { return reinterpret_cast<const int8_t*>( &value )[i]; }
+   __m512i value;  // Contains 64 8-bit integral data values
+};
+#elif BLAZE_AVX2_MODE
 struct sse_int8_t {
    BLAZE_ALWAYS_INLINE sse_int8_t() : value( _mm256_setzero_si256() ) {}
    BLAZE_ALWAYS_INLINE sse_int8_t( __m256i v ) : value( v ) {}
@@ -92,7 +99,14 @@ struct sse_int8_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+struct sse_int16_t {
+   BLAZE_ALWAYS_INLINE sse_int16_t() : value( _mm512_setzero_si512() ) {}
+   BLAZE_ALWAYS_INLINE sse_int16_t( __m512i v ) : value( v ) {}
+   BLAZE_ALWAYS_INLINE int16_t operator[]( size_t i ) const { return reinterpret_cast<const int16_t*>( &value )[i]; }
+   __m512i value;  // Contains 32 16-bit integral data values
+};
+#elif BLAZE_AVX2_MODE
 struct sse_int16_t {
    BLAZE_ALWAYS_INLINE sse_int16_t() : value( _mm256_setzero_si256() ) {}
    BLAZE_ALWAYS_INLINE sse_int16_t( __m256i v ) : value( v ) {}
@@ -124,7 +138,7 @@ struct sse_int16_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_int32_t {
    BLAZE_ALWAYS_INLINE sse_int32_t() : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE sse_int32_t( __m512i v ) : value( v ) {}
@@ -163,7 +177,7 @@ struct sse_int32_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_int64_t {
    BLAZE_ALWAYS_INLINE sse_int64_t() : value( _mm512_setzero_epi32() ) {}
    BLAZE_ALWAYS_INLINE sse_int64_t( __m512i v ) : value( v ) {}
@@ -202,7 +216,7 @@ struct sse_int64_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_float_t {
    BLAZE_ALWAYS_INLINE sse_float_t() : value( _mm512_setzero_ps() ) {}
    BLAZE_ALWAYS_INLINE sse_float_t( __m512 v ) : value( v ) {}
@@ -241,7 +255,7 @@ struct sse_float_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_double_t {
    BLAZE_ALWAYS_INLINE sse_double_t() : value( _mm512_setzero_pd() ) {}
    BLAZE_ALWAYS_INLINE sse_double_t( __m512d v ) : value( v ) {}
@@ -280,7 +294,7 @@ struct sse_double_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_cfloat_t {
    BLAZE_ALWAYS_INLINE sse_cfloat_t() : value( _mm512_setzero_ps() ) {}
    BLAZE_ALWAYS_INLINE sse_cfloat_t( __m512 v ) : value( v ) {}
@@ -319,7 +333,7 @@ struct sse_cfloat_t {
 // \ingroup intrinsics
 */
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 struct sse_cdouble_t {
    BLAZE_ALWAYS_INLINE sse_cdouble_t() : value( _mm512_setzero_pd() ) {}
    BLAZE_ALWAYS_INLINE sse_cdouble_t( __m512d v ) : value( v ) {}
@@ -98,7 +98,7 @@ BLAZE_ALWAYS_INLINE sse_int64_t operator/( const sse_int64_t& a, const sse_int64
 // \param b The right-hand side operand.
 // \return The result of the division.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_float_t operator/( const sse_float_t& a, const sse_float_t& b )
 {
    return _mm512_div_ps( a.value, b.value );
@@ -126,7 +126,7 @@ BLAZE_ALWAYS_INLINE sse_float_t operator/( const sse_float_t& a, const sse_float
 // \param b The right-hand side operand.
 // \return The result of the division.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_double_t operator/( const sse_double_t& a, const sse_double_t& b )
 {
    return _mm512_div_pd( a.value, b.value );
@@ -0,0 +1,196 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FMA.h
+//  \brief Header file for the intrinsic fused multiply-add functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FMA_H_
+#define _BLAZE_MATH_INTRINSICS_FMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC FUSED MULTIPLY-ADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of two intrinsic vectors and addition of a third intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition.
+// \return The result of the operation \f$ a*b+c \f$.
+//
+// This function is the fallback for all intrinsic data types without native fused multiply-add
+// support. It performs the multiplication and addition via two separate intrinsic operations.
+*/
+template< typename T >  // Type of the intrinsic operands
+BLAZE_ALWAYS_INLINE T fmadd( const T& a, const T& b, const T& c )
+{
+   return a * b + c;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two intrinsic vectors and subtraction from a third intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the subtraction.
+// \return The result of the operation \f$ c-a*b \f$.
+//
+// This function is the fallback for all intrinsic data types without native fused multiply-add
+// support. It performs the multiplication and subtraction via two separate intrinsic operations.
+*/
+template< typename T >  // Type of the intrinsic operands
+BLAZE_ALWAYS_INLINE T fnmadd( const T& a, const T& b, const T& c )
+{
+   return c - a * b;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fmadd( sse_float_t, sse_float_t, sse_float_t )
+// \brief Fused multiply-add of vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition.
+// \return The result of the operation \f$ a*b+c \f$.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmadd_ps( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fmadd( sse_double_t, sse_double_t, sse_double_t )
+// \brief Fused multiply-add of vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the addition.
+// \return The result of the operation \f$ a*b+c \f$.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmadd_pd( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fnmadd( sse_float_t, sse_float_t, sse_float_t )
+// \brief Fused negative multiply-add of vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the subtraction.
+// \return The result of the operation \f$ c-a*b \f$.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fnmadd_ps( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fnmadd( sse_double_t, sse_double_t, sse_double_t )
+// \brief Fused negative multiply-add of vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The operand of the subtraction.
+// \return The result of the operation \f$ c-a*b \f$.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fnmadd_pd( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,299 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather and scatter functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t gather( const float*, const size_t* )
+// \brief Gathers a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the gathered values.
+// \param indices Pointer to the first of the offsets of the gathered values.
+// \return The gathered vector of single precision floating point values.
+//
+// This function loads the values at the positions \a address[indices[0]], \a address[indices[1]],
+// ... into a single intrinsic vector. The function is only available in case AVX2 or AVX-512 is
+// enabled. The given offsets are not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const size_t* indices )
+{
+   const __m256 v1( _mm512_i64gather_ps( _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castps_pd( _mm512_castps256_ps512( v1 ) ),
+                                                _mm256_castps_pd( v2 ), 1 ) );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const size_t* indices )
+{
+   const __m256i i1( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ) );
+   const __m256i i2( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ) );
+   const __m128 v1( _mm256_i64gather_ps( address, i1, 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, i2, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t gather( const float*, const uint32_t* )
+// \brief Gathers a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the gathered values.
+// \param indices Pointer to the first of the 32-bit offsets of the gathered values.
+// \return The gathered vector of single precision floating point values.
+//
+// This function loads the values at the positions \a address[indices[0]], \a address[indices[1]],
+// ... into a single intrinsic vector. The 32-bit offsets are zero-extended to 64 bits in order to
+// support the complete range of unsigned offsets. The function is only available in case AVX2 or
+// AVX-512 is enabled. The given offsets are not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const uint32_t* indices )
+{
+   const __m512i i( _mm512_loadu_si512( indices ) );
+   const __m256 v1( _mm512_i64gather_ps( _mm512_cvtepu32_epi64( _mm512_castsi512_si256( i ) ), address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( _mm512_cvtepu32_epi64( _mm512_extracti64x4_epi64( i, 1 ) ), address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castps_pd( _mm512_castps256_ps512( v1 ) ),
+                                                _mm256_castps_pd( v2 ), 1 ) );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const uint32_t* indices )
+{
+   const __m256i i1( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices     ) ) ) );
+   const __m256i i2( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices+4UL ) ) ) );
+   const __m128 v1( _mm256_i64gather_ps( address, i1, 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, i2, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t gather( const double*, const size_t* )
+// \brief Gathers a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the gathered values.
+// \param indices Pointer to the first of the offsets of the gathered values.
+// \return The gathered vector of double precision floating point values.
+//
+// This function loads the values at the positions \a address[indices[0]], \a address[indices[1]],
+// ... into a single intrinsic vector. The function is only available in case AVX2 or AVX-512 is
+// enabled. The given offsets are not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const size_t* indices )
+{
+   return _mm512_i64gather_pd( _mm512_loadu_si512( indices ), address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const size_t* indices )
+{
+   const __m256i i1( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm256_i64gather_pd( address, i1, 8 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t gather( const double*, const uint32_t* )
+// \brief Gathers a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the gathered values.
+// \param indices Pointer to the first of the 32-bit offsets of the gathered values.
+// \return The gathered vector of double precision floating point values.
+//
+// This function loads the values at the positions \a address[indices[0]], \a address[indices[1]],
+// ... into a single intrinsic vector. The 32-bit offsets are zero-extended to 64 bits in order to
+// support the complete range of unsigned offsets. The function is only available in case AVX2 or
+// AVX-512 is enabled. The given offsets are not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* indices )
+{
+   const __m256i i( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm512_i64gather_pd( _mm512_cvtepu32_epi64( i ), address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* indices )
+{
+   const __m128i i( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   return _mm256_i64gather_pd( address, _mm256_cvtepu32_epi64( i ), 8 );
+}
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC SCATTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn void scatter( float*, const size_t*, const sse_float_t& )
+// \brief Scatters a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the scattered values.
+// \param indices Pointer to the first of the offsets of the scattered values.
+// \param value The vector of single precision floating point values to be scattered.
+// \return void
+//
+// This function stores the elements of the given intrinsic vector to the positions
+// \a address[indices[0]], \a address[indices[1]], ... In case several offsets are equal,
+// the element with the highest position within the vector is stored. The function is only
+// available in case AVX-512 is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void scatter( float* address, const size_t* indices, const sse_float_t& value )
+{
+   const __m256 v1( _mm512_castps512_ps256( value.value ) );
+   const __m256 v2( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( value.value ), 1 ) ) );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices     ), v1, 4 );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices+8UL ), v2, 4 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void scatter( float*, const uint32_t*, const sse_float_t& )
+// \brief Scatters a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the scattered values.
+// \param indices Pointer to the first of the 32-bit offsets of the scattered values.
+// \param value The vector of single precision floating point values to be scattered.
+// \return void
+//
+// This function stores the elements of the given intrinsic vector to the positions
+// \a address[indices[0]], \a address[indices[1]], ... In case several offsets are equal,
+// the element with the highest position within the vector is stored. The 32-bit offsets are
+// zero-extended to 64 bits. The function is only available in case AVX-512 is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void scatter( float* address, const uint32_t* indices, const sse_float_t& value )
+{
+   const __m512i i( _mm512_loadu_si512( indices ) );
+   const __m256 v1( _mm512_castps512_ps256( value.value ) );
+   const __m256 v2( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( value.value ), 1 ) ) );
+   _mm512_i64scatter_ps( address, _mm512_cvtepu32_epi64( _mm512_castsi512_si256( i ) ), v1, 4 );
+   _mm512_i64scatter_ps( address, _mm512_cvtepu32_epi64( _mm512_extracti64x4_epi64( i, 1 ) ), v2, 4 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void scatter( double*, const size_t*, const sse_double_t& )
+// \brief Scatters a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the scattered values.
+// \param indices Pointer to the first of the offsets of the scattered values.
+// \param value The vector of double precision floating point values to be scattered.
+// \return void
+//
+// This function stores the elements of the given intrinsic vector to the positions
+// \a address[indices[0]], \a address[indices[1]], ... In case several offsets are equal,
+// the element with the highest position within the vector is stored. The function is only
+// available in case AVX-512 is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void scatter( double* address, const size_t* indices, const sse_double_t& value )
+{
+   _mm512_i64scatter_pd( address, _mm512_loadu_si512( indices ), value.value, 8 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void scatter( double*, const uint32_t*, const sse_double_t& )
+// \brief Scatters a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the scattered values.
+// \param indices Pointer to the first of the 32-bit offsets of the scattered values.
+// \param value The vector of double precision floating point values to be scattered.
+// \return void
+//
+// This function stores the elements of the given intrinsic vector to the positions
+// \a address[indices[0]], \a address[indices[1]], ... In case several offsets are equal,
+// the element with the highest position within the vector is stored. The 32-bit offsets are
+// zero-extended to 64 bits. The function is only available in case AVX-512 is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void scatter( double* address, const uint32_t* indices, const sse_double_t& value )
+{
+   const __m256i i( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   _mm512_i64scatter_pd( address, _mm512_cvtepu32_epi64( i ), value.value, 8 );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
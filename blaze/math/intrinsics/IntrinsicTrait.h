@@ -76,7 +76,19 @@ struct IntrinsicTraitHelper;
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 1-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<1UL>
+{
+   typedef sse_int8_t  Type;
+   enum { size           = 64,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 0,
+          division       = 0,
+          absoluteValue  = 1 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<1UL>
 {
@@ -110,7 +122,19 @@ struct IntrinsicTraitHelper<1UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 2-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<2UL>
+{
+   typedef sse_int16_t  Type;
+   enum { size           = 32,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<2UL>
 {
@@ -144,7 +168,19 @@ struct IntrinsicTraitHelper<2UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 4-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<4UL>
+{
+   typedef sse_int32_t  Type;
+   enum { size           = 16,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1 };
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitHelper<4UL>
 {
@@ -190,7 +226,19 @@ struct IntrinsicTraitHelper<4UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 8-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<8UL>
+{
+   typedef sse_int64_t  Type;
+   enum { size           = 8,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = BLAZE_AVX512DQ_MODE,
+          division       = 0,
+          absoluteValue  = 1 };
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitHelper<8UL>
 {
@@ -515,7 +563,20 @@ struct IntrinsicTraitBase<unsigned long>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'float'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase<float>
+{
+   typedef sse_float_t  Type;
+   enum { size           = ( 64UL / sizeof(float) ),
+          alignment      = AlignmentOf<float>::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 1,
+          absoluteValue  = 0 };
+};
+#elif BLAZE_MIC_MODE
 struct IntrinsicTraitBase<float>
 {
    typedef sse_float_t  Type;
@@ -563,7 +624,20 @@ struct IntrinsicTraitBase<float>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'double'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase<double>
+{
+   typedef sse_double_t  Type;
+   enum { size           = ( 64UL / sizeof(double) ),
+          alignment      = AlignmentOf<double>::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 1,
+          absoluteValue  = 0 };
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase<double>
 {
@@ -612,7 +686,22 @@ struct IntrinsicTraitBase<double>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'complex<float>'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<float> >
+{
+   typedef sse_cfloat_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<float>) ),
+          alignment      = AlignmentOf< complex<float> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase< complex<float> >
 {
@@ -667,7 +756,22 @@ struct IntrinsicTraitBase< complex<float> >
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'complex<double>'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<double> >
+{
+   typedef sse_cdouble_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<double>) ),
+          alignment      = AlignmentOf< complex<double> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase< complex<double> >
 {
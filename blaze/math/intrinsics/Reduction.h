@@ -62,7 +62,16 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   const __m256i b = _mm256_add_epi16( _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 1 )
+                                     , _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 0 ) );
+   const __m256i c = _mm256_hadd_epi16( b, b );
+   const __m256i d = _mm256_hadd_epi16( c, c );
+   const __m256i e = _mm256_hadd_epi16( d, d );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const sse_int16_t b( _mm256_hadd_epi16( a.value, a.value ) );
    const sse_int16_t c( _mm256_hadd_epi16( b.value, b.value ) );
    const sse_int16_t d( _mm256_hadd_epi16( c.value, c.value ) );
@@ -92,7 +101,15 @@ BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 */
 BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b = _mm256_add_epi32( _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 1 )
+                                     , _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 0 ) );
+   const __m256i c = _mm256_hadd_epi32( b, b );
+   const __m256i d = _mm256_hadd_epi32( c, c );
+   const __m128i e = _mm_add_epi32( _mm256_extracti128_si256( d, 1 )
+                                  , _mm256_castsi256_si128( d ) );
+   return _mm_cvtsi128_si32( e );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
    const sse_int32_t b( _mm256_hadd_epi32( a.value, a.value ) );
@@ -122,7 +139,13 @@ BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 */
 BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b = _mm256_add_epi64( _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 1 )
+                                     , _mm512_mask_extracti64x4_epi64( _mm256_setzero_si256(), 0xFF, a.value, 0 ) );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return _mm_cvtsi128_si64( _mm_add_epi64( c, _mm_unpackhi_epi64( c, c ) ) );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
@@ -144,7 +167,16 @@ BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 */
 BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m512d a2 = _mm512_castps_pd( a.value );
+   const __m256 b = _mm256_add_ps( _mm256_castpd_ps( _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0xFF, a2, 1 ) )
+                                 , _mm256_castpd_ps( _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0xFF, a2, 0 ) ) );
+   const __m256 c = _mm256_hadd_ps( b, b );
+   const __m256 d = _mm256_hadd_ps( c, c );
+   const __m128 e = _mm_add_ps( _mm256_extractf128_ps( d, 1 )
+                              , _mm256_castps256_ps128( d ) );
+   return _mm_cvtss_f32( e );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
 #elif BLAZE_AVX_MODE
    const sse_float_t b( _mm256_hadd_ps( a.value, a.value ) );
@@ -174,7 +206,14 @@ BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 */
 BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256d b = _mm256_add_pd( _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0xFF, a.value, 1 )
+                                  , _mm512_mask_extractf64x4_pd( _mm256_setzero_pd(), 0xFF, a.value, 0 ) );
+   const __m256d c = _mm256_hadd_pd( b, b );
+   const __m128d d = _mm_add_pd( _mm256_extractf128_pd( c, 1 )
+                               , _mm256_castpd256_pd128( c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
 #elif BLAZE_AVX_MODE
    const sse_double_t b( _mm256_hadd_pd( a.value, a.value ) );
@@ -202,7 +241,7 @@ BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -224,7 +263,7 @@ BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<double> sum( const sse_cdouble_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
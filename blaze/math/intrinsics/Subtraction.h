@@ -62,7 +62,12 @@ namespace blaze {
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int8_t operator-( const sse_int8_t& a, const sse_int8_t& b )
+{
+   return _mm512_sub_epi8( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int8_t operator-( const sse_int8_t& a, const sse_int8_t& b )
 {
    return _mm256_sub_epi8( a.value, b.value );
@@ -85,7 +90,12 @@ BLAZE_ALWAYS_INLINE sse_int8_t operator-( const sse_int8_t& a, const sse_int8_t&
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t operator-( const sse_int16_t& a, const sse_int16_t& b )
+{
+   return _mm512_sub_epi16( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t operator-( const sse_int16_t& a, const sse_int16_t& b )
 {
    return _mm256_sub_epi16( a.value, b.value );
@@ -108,8 +118,8 @@ BLAZE_ALWAYS_INLINE sse_int16_t operator-( const sse_int16_t& a, const sse_int16
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_MIC_MODE
-BLAZE_ALWAYS_INLINE sse_int64_t operator-( const sse_int32_t& a, const sse_int32_t& b )
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t operator-( const sse_int32_t& a, const sse_int32_t& b )
 {
    return _mm512_sub_epi32( a.value, b.value );
 }
@@ -136,7 +146,12 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator-( const sse_int32_t& a, const sse_int32
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_int64_t operator-( const sse_int64_t& a, const sse_int64_t& b )
+{
+   return _mm512_sub_epi64( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int64_t operator-( const sse_int64_t& a, const sse_int64_t& b )
 {
    return _mm256_sub_epi64( a.value, b.value );
@@ -159,7 +174,7 @@ BLAZE_ALWAYS_INLINE sse_int64_t operator-( const sse_int64_t& a, const sse_int64
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_float_t operator-( const sse_float_t& a, const sse_float_t& b )
 {
    return _mm512_sub_ps( a.value, b.value );
@@ -187,7 +202,7 @@ BLAZE_ALWAYS_INLINE sse_float_t operator-( const sse_float_t& a, const sse_float
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_double_t operator-( const sse_double_t& a, const sse_double_t& b )
 {
    return _mm512_sub_pd( a.value, b.value );
@@ -215,7 +230,7 @@ BLAZE_ALWAYS_INLINE sse_double_t operator-( const sse_double_t& a, const sse_dou
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_cfloat_t operator-( const sse_cfloat_t& a, const sse_cfloat_t& b )
 {
    return _mm512_sub_ps( a.value, b.value );
@@ -243,7 +258,7 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t operator-( const sse_cfloat_t& a, const sse_cfl
 // \param b The right-hand side operand.
 // \return The result of the subtraction.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_cdouble_t operator-( const sse_cdouble_t& a, const sse_cdouble_t& b )
 {
    return _mm512_sub_pd( a.value, b.value );
@@ -65,6 +65,10 @@ namespace blaze {
 */
 struct BoxLCP
 {
+   //**Type definitions****************************************************************************
+   typedef CMatMxN  MatrixType;  //!< Type of the system matrix.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
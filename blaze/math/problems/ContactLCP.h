@@ -41,7 +41,7 @@
 //*************************************************************************************************
 
 #include <cmath>
-#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Infinity.h>
@@ -65,6 +65,10 @@ namespace blaze {
 */
 struct ContactLCP
 {
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<real,3>  MatrixType;  //!< Type of the system matrix.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -80,10 +84,10 @@ struct ContactLCP
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   CMatMxN A_;    //!< The system matrix \f$ A \f$.
-   VecN    b_;    //!< The right-hand side vector \f$ b \f$.
-   VecN    x_;    //!< The vector of unknowns \f$ x \f$.
-   VecN    cof_;  //!< The corresponding coefficients of friction.
+   MatrixType A_;    //!< The system matrix \f$ A \f$.
+   VecN       b_;    //!< The right-hand side vector \f$ b \f$.
+   VecN       x_;    //!< The vector of unknowns \f$ x \f$.
+   VecN       cof_;  //!< The corresponding coefficients of friction.
    //@}
    //**********************************************************************************************
 };
@@ -67,6 +67,10 @@ namespace blaze {
 struct LCP
 {
  public:
+   //**Type definitions****************************************************************************
+   typedef CMatMxN  MatrixType;  //!< Type of the system matrix.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -71,6 +71,10 @@ namespace blaze {
 */
 struct ModifiedBoxLCP
 {
+   //**Type definitions****************************************************************************
+   typedef CMatMxN  MatrixType;  //!< Type of the system matrix.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
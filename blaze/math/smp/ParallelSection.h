@@ -41,8 +41,14 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/system/SMP.h>
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/Suffix.h>
 
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
 
 namespace blaze {
 
@@ -58,7 +64,8 @@ namespace blaze {
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
 // It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// that serves as a utility for debugging the shared-memory parallelization. The activity flag
+// is thread-local, which enables several threads to concurrently execute parallel sections.
 */
 template< typename T >
 class ParallelSection
@@ -89,10 +96,11 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the parallel section.
+                                           /*!< In case a parallel section is active (i.e. the
+                                                code currently executed by the calling thread
+                                                is inside a parallel section), the flag is set
+                                                to \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +124,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -208,10 +216,18 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// Since the activity flag of a parallel section is thread-local, in case of the OpenMP-based
+// parallelization the function additionally treats the threads of an active OpenMP team as
+// being part of the parallel section that has been started by the master thread of the team.
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelSection<int>::active_ || omp_in_parallel();
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
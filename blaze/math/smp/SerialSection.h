@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -58,7 +59,8 @@ namespace blaze {
 //
 // The SerialSection class is an auxiliary helper class for the \a BLAZE_SERIAL_SECTION macro.
 // It provides the functionality to detect whether a serial section is active, i.e. if the
-// currently executed code is inside a serial section.
+// currently executed code is inside a serial section. The activity flag is thread-local, i.e.
+// a serial section started by one thread does not affect operations executed by other threads.
 */
 template< typename T >
 class SerialSection
@@ -89,10 +91,11 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the serial section.
+                                           /*!< In case a serial section is active (i.e. the
+                                                code currently executed by the calling thread
+                                                is inside a serial section), the flag is set
+                                                to \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +119,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
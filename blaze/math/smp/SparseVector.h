@@ -40,6 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/SparseVector.h>
+#else
 #include <blaze/math/smp/default/SparseVector.h>
+#endif
 
 #endif
@@ -0,0 +1,394 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Workload.h
+//  \brief Header file for the workload-aware partitioning of SMP assignments
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_WORKLOAD_H_
+#define _BLAZE_MATH_SMP_WORKLOAD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatScalarMultExpr.h>
+#include <blaze/math/typetraits/IsMatVecMultExpr.h>
+#include <blaze/math/typetraits/IsTVecMatMultExpr.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsVecScalarMultExpr.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  WORKLOAD PROFILES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Distribution of the computational work along the rows, columns, or elements of an
+//        expression.
+// \ingroup smp
+*/
+enum Workload {
+   uniformWorkload    = 0,  //!< All rows/columns/elements require the same amount of work.
+   increasingWorkload = 1,  //!< The amount of work grows linearly with the index.
+   decreasingWorkload = 2   //!< The amount of work shrinks linearly with the index.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the evaluation of the workload profile of a single
+//        triangular operand.
+// \ingroup smp
+//
+// The nested \a value is set to \a increasingWorkload in case the given type is a lower (but
+// not an upper) matrix, to \a decreasingWorkload in case it is an upper (but not a lower)
+// matrix, and to \a uniformWorkload otherwise. In case the \a TF flag is set to \a true,
+// the roles of lower and upper matrices are exchanged.
+*/
+template< typename T  // Type of the operand
+        , bool TF >   // Transposition flag
+struct TriangularWorkload
+{
+ private:
+   //**********************************************************************************************
+   typedef typename RemoveReference<T>::Type  MT;
+
+   enum { lower = IsLower<MT>::value && !IsUpper<MT>::value
+        , upper = IsUpper<MT>::value && !IsLower<MT>::value };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { value = ( ( TF )?( upper ):( lower ) )?( increasingWorkload )
+                :( ( ( TF )?( lower ):( upper ) )?( decreasingWorkload )
+                                                 :( uniformWorkload ) ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Workload profile along the rows of a dense matrix expression.
+// \ingroup smp
+//
+// In a matrix/matrix multiplication the amount of work per row of the result is proportional
+// to the number of nonzero elements in the according row of the left-hand side operand. Thus
+// the rows of a product with a lower left-hand side operand get increasingly expensive, the
+// rows of a product with an upper left-hand side operand get decreasingly expensive. For all
+// other expressions the workload is considered to be uniform.
+*/
+template< typename MT >  // Type of the matrix expression
+struct RowWorkload
+{
+ private:
+   //**********************************************************************************************
+   template< typename T >
+   struct Product { enum { value = TriangularWorkload<typename T::LeftOperand,false>::value }; };
+
+   template< typename T >
+   struct Scaled { enum { value = RowWorkload< typename RemoveReference<typename T::LeftOperand>::Type >::value }; };
+
+   template< typename T >
+   struct Uniform { enum { value = uniformWorkload }; };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { value = If< IsMatMatMultExpr<MT>
+                    , Product<MT>
+                    , typename If< IsMatScalarMultExpr<MT>, Scaled<MT>, Uniform<MT> >::Type
+                    >::Type::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Workload profile along the columns of a dense matrix expression.
+// \ingroup smp
+//
+// In a matrix/matrix multiplication the amount of work per column of the result is proportional
+// to the number of nonzero elements in the according column of the right-hand side operand.
+// Thus the columns of a product with an upper right-hand side operand get increasingly
+// expensive, the columns of a product with a lower right-hand side operand get decreasingly
+// expensive. For all other expressions the workload is considered to be uniform.
+*/
+template< typename MT >  // Type of the matrix expression
+struct ColumnWorkload
+{
+ private:
+   //**********************************************************************************************
+   template< typename T >
+   struct Product { enum { value = TriangularWorkload<typename T::RightOperand,true>::value }; };
+
+   template< typename T >
+   struct Scaled { enum { value = ColumnWorkload< typename RemoveReference<typename T::LeftOperand>::Type >::value }; };
+
+   template< typename T >
+   struct Uniform { enum { value = uniformWorkload }; };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { value = If< IsMatMatMultExpr<MT>
+                    , Product<MT>
+                    , typename If< IsMatScalarMultExpr<MT>, Scaled<MT>, Uniform<MT> >::Type
+                    >::Type::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Workload profile along the elements of a dense vector expression.
+// \ingroup smp
+//
+// The elements of a matrix/vector multiplication with a lower matrix get increasingly expensive,
+// the elements of a multiplication with an upper matrix get decreasingly expensive. For vector/
+// matrix multiplications the roles of lower and upper matrices are exchanged. For all other
+// expressions the workload is considered to be uniform.
+*/
+template< typename VT >  // Type of the vector expression
+struct ElementWorkload
+{
+ private:
+   //**********************************************************************************************
+   template< typename T >
+   struct MatVecProduct { enum { value = TriangularWorkload<typename T::LeftOperand,false>::value }; };
+
+   template< typename T >
+   struct VecMatProduct { enum { value = TriangularWorkload<typename T::RightOperand,true>::value }; };
+
+   template< typename T >
+   struct Scaled { enum { value = ElementWorkload< typename RemoveReference<typename T::LeftOperand>::Type >::value }; };
+
+   template< typename T >
+   struct Uniform { enum { value = uniformWorkload }; };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum { value = If< IsMatVecMultExpr<VT>
+                    , MatVecProduct<VT>
+                    , typename If< IsTVecMatMultExpr<VT>
+                                 , VecMatProduct<VT>
+                                 , typename If< IsVecScalarMultExpr<VT>, Scaled<VT>, Uniform<VT> >::Type
+                                 >::Type
+                    >::Type::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the first index of a part of an SMP assignment.
+// \ingroup smp
+//
+// \param n The total number of rows, columns, or elements.
+// \param parts The number of parts (i.e. the number of threads).
+// \param index The index of the part \f$[0..parts]\f$.
+// \return The first row, column, or element of the specified part.
+//
+// This function splits the range \f$[0..n)\f$ into \a parts consecutive parts. For a uniform
+// workload all parts have the same size. For an increasing or decreasing workload (as for
+// instance for the multiplication with a triangular matrix) the boundaries are chosen such that
+// all parts require the same amount of work, i.e. the part boundaries are placed according to
+// the square root of the fraction of the total work. The first index of each part is rounded
+// up to a multiple of \a alignment. Calling the function with \a index equal to \a parts
+// returns \a n.
+*/
+inline size_t smpPartition( size_t n, size_t parts, size_t index, size_t alignment, Workload workload )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL    , "Invalid number of parts" );
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL, "Invalid alignment"       );
+
+   if( index >= parts )
+      return n;
+
+   if( workload == uniformWorkload )
+   {
+      const size_t addon     ( ( ( n % parts ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare( n / parts + addon );
+      const size_t rest      ( equalShare % alignment );
+      const size_t share     ( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
+
+      return min( index*share, n );
+   }
+
+   const double ratio( ( workload == increasingWorkload )
+                       ?( std::sqrt( double( index ) / double( parts ) ) )
+                       :( 1.0 - std::sqrt( double( parts - index ) / double( parts ) ) ) );
+
+   const size_t begin( static_cast<size_t>( ratio * double( n ) ) );
+   const size_t rest ( begin % alignment );
+
+   return min( ( rest )?( begin - rest + alignment ):( begin ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the boundaries of the parts of an SMP assignment of a sparse matrix.
+// \ingroup smp
+//
+// \param sm The sparse matrix whose rows (or columns) are distributed.
+// \param parts The number of parts (i.e. the number of threads).
+// \param bounds The resulting \a parts+1 boundaries of the parts.
+// \return void
+//
+// This function splits the rows of a row-major (or the columns of a column-major) sparse matrix
+// into \a parts consecutive ranges such that all ranges hold approximately the same number of
+// non-zero elements. Each row (or column) is additionally charged with one unit of work to
+// account for its constant overhead. The first index of part \a i is stored in \a bounds[i],
+// \a bounds[parts] is set to the total number of rows (or columns). In case the sparse matrix
+// cannot estimate its non-zero elements, the rows (or columns) are distributed evenly.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void smpPartition( const SparseMatrix<MT,SO>& sm, size_t parts, std::vector<size_t>& bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+
+   const size_t n( ( SO )?( (~sm).columns() ):( (~sm).rows() ) );
+
+   size_t total( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      total += (~sm).nonZeros( i );
+   }
+
+   bounds.resize( parts+1UL );
+   bounds[0UL] = 0UL;
+
+   size_t part( 1UL );
+   size_t work( 0UL );
+
+   for( size_t i=0UL; i<n && part<parts; ++i ) {
+      work += (~sm).nonZeros( i ) + 1UL;
+      while( part < parts && work*parts >= total*part ) {
+         bounds[part] = i+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the boundaries of the parts of an SMP operation with individual work per index.
+// \ingroup smp
+//
+// \param work The amount of work for each index.
+// \param parts The number of parts (i.e. the number of threads).
+// \param bounds The resulting \a parts+1 boundaries of the parts.
+// \return void
+//
+// This function splits the indices \f$ [0..N) \f$ (with \a N being the size of \a work) into
+// \a parts consecutive ranges such that all ranges hold approximately the same amount of work.
+// Each index is additionally charged with one unit of work to account for its constant overhead.
+// The first index of part \a i is stored in \a bounds[i], \a bounds[parts] is set to \a N.
+*/
+inline void smpPartition( const std::vector<size_t>& work, size_t parts,
+                          std::vector<size_t>& bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+
+   const size_t n( work.size() );
+
+   size_t total( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      total += work[i];
+   }
+
+   bounds.resize( parts+1UL );
+   bounds[0UL] = 0UL;
+
+   size_t part( 1UL );
+   size_t sum ( 0UL );
+
+   for( size_t i=0UL; i<n && part<parts; ++i ) {
+      sum += work[i] + 1UL;
+      while( part < parts && sum*parts >= total*part ) {
+         bounds[part] = i+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,151 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Batch.h
+//  \brief Header file with the default implementation of the batch SMP functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_BATCH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch SMP functions */
+//@{
+template< typename BT1, typename BT2 >
+inline void smpAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+
+template< typename BT1, typename BT2 >
+inline void smpAddAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+
+template< typename BT1, typename BT2 >
+inline void smpSubAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be assigned.
+// \return void
+//
+// This function implements the default SMP assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+   assign( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP addition assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be added.
+// \return void
+//
+// This function implements the default SMP addition assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpAddAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+   addAssign( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP subtraction assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be subtracted.
+// \return void
+//
+// This function implements the default SMP subtraction assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpSubAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+   subAssign( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/CSRMV.h
+//  \brief Header file with the default implementation of the CSR/CSC matrix/vector SMP functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_CSRMV_H_
+#define _BLAZE_MATH_SMP_DEFAULT_CSRMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/sparse/CSRMV.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CSR/CSC matrix/vector SMP functions */
+//@{
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCscmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCscmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+
+template< typename VT1, typename MT, typename VT2 >
+inline void smpCscmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP assignment of a row-major sparse matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP assignment of a row-major sparse matrix/dense vector
+// multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   csrmvAssign( ~lhs, A, x, 0UL, A.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP addition assignment of a row-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP addition assignment of a row-major sparse matrix/dense
+// vector multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   csrmvAddAssign( ~lhs, A, x, 0UL, A.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP subtraction assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP subtraction assignment of a row-major sparse
+// matrix/dense vector multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   csrmvSubAssign( ~lhs, A, x, 0UL, A.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP assignment of a column-major sparse matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP assignment of a column-major sparse matrix/dense vector
+// multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   cscmvAssign( ~lhs, A, x, 0UL, A.columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP addition assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP addition assignment of a column-major sparse
+// matrix/dense vector multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   cscmvAddAssign( ~lhs, A, x, 0UL, A.columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP subtraction assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default SMP subtraction assignment of a column-major sparse
+// matrix/dense vector multiplication to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+   cscmvSubAssign( ~lhs, A, x, 0UL, A.columns() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
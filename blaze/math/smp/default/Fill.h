@@ -0,0 +1,131 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Fill.h
+//  \brief Header file with the default implementation of the SMP fill functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_FILL_H_
+#define _BLAZE_MATH_SMP_DEFAULT_FILL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fill SMP functions */
+//@{
+template< typename Type >
+inline void smpFill( Type* array, size_t size, const Type& value );
+
+template< typename Type >
+inline void smpFill( Type* array, size_t m, size_t spacing, size_t first, size_t last, const Type& value );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP fill of an array.
+// \ingroup smp
+//
+// \param array The array to be filled.
+// \param size The number of elements of the array.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function implements the default SMP fill of an array, which assigns the given value to
+// all elements of the array.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices.
+*/
+template< typename Type >  // Data type of the array elements
+inline void smpFill( Type* array, size_t size, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<size; ++i )
+      array[i] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP fill of a two-dimensional array.
+// \ingroup smp
+//
+// \param array The two-dimensional array to be filled.
+// \param m The number of rows (row-major) or columns (column-major) of the array.
+// \param spacing The number of elements between the beginning of two rows/columns.
+// \param first The index of the first element to be filled in each row/column.
+// \param last The index one past the last element to be filled in each row/column.
+// \param value The value to be assigned to the elements.
+// \return void
+//
+// This function implements the default SMP fill of a two-dimensional array, which assigns the
+// given value to the elements in the range \f$ [first..last) \f$ of all \a m rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices.
+*/
+template< typename Type >  // Data type of the array elements
+inline void smpFill( Type* array, size_t m, size_t spacing, size_t first, size_t last, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= spacing, "Invalid element range detected" );
+
+   if( first == last )
+      return;
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=first; j<last; ++j )
+         array[i*spacing+j] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
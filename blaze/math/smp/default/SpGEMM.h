@@ -0,0 +1,156 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/SpGEMM.h
+//  \brief Header file with the default implementation of the SpGEMM SMP functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_SPGEMM_H_
+#define _BLAZE_MATH_SMP_DEFAULT_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/sparse/SpGEMMPlan.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse matrix/sparse matrix multiplication SMP functions */
+//@{
+template< typename Type, typename Index, typename MT1, typename MT2 >
+inline void smpSpgemmAssign( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B );
+
+template< typename Type, typename T1, typename T2 >
+void multiply( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+               const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP assignment of a sparse matrix/sparse matrix
+//        multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function implements the default SMP assignment of a sparse matrix/sparse matrix
+// multiplication to a row-major compressed matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the target sparse matrix
+        , typename Index  // Index type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void smpSpgemmAssign( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == B.columns(), "Invalid number of columns" );
+
+   spgemmAssign( lhs, A, B );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAN-BASED MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication based on a precomputed
+//        plan (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The resulting row-major sparse matrix.
+// \param plan The precomputed structure of the multiplication.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrices do not match the plan.
+//
+// This function computes the product \f$ A*B \f$ based on the given SpGEMMPlan. In case \a C
+// doesn't contain the sparsity pattern of the plan yet, it is laid out first. Afterwards only
+// the values of the non-zero elements of \a C are overwritten. This default implementation
+// computes all rows serially.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void multiply( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+               const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !plan.isCompatible( A, B ) )
+      throw std::invalid_argument( "Matrices do not match the SpGEMM plan" );
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      CompressedMatrix<Type,false> tmp;
+      multiply( tmp, plan, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   plan.layout( C );
+   plan.assign( C, A, B, 0UL, plan.rows() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,107 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/TriangularSolve.h
+//  \brief Header file for the default sparse triangular solve SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SMP_DEFAULT_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/TriangularSolve.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular solve SMP functions */
+//@{
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, const LevelSchedule& schedule,
+            DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a sparse triangular system based on a precomputed level schedule.
+// \ingroup sparse_matrix
+//
+// \param A The analyzed square sparse matrix.
+// \param schedule The level-set analysis of the triangular part of \a A.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix does not match the level schedule.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves \f$ A*x=b \f$ with the triangular part of \a A that has been analyzed by
+// the given LevelSchedule. \a x and \a b may be the same vector. This default implementation
+// solves the system serially by forward or back substitution.
+*/
+template< typename MT   // Type of the sparse matrix
+        , bool SO       // Storage order of the sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, const LevelSchedule& schedule,
+            DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !schedule.isCompatible( ~A ) )
+      throw std::invalid_argument( "Matrix does not match the level schedule" );
+
+   if( schedule.isLower() )
+      forwardSubstitution( ~A, ~x, ~b );
+   else
+      backSubstitution( ~A, ~x, ~b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,105 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/TripletAssembly.h
+//  \brief Header file with the default implementation of the triplet assembly SMP functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_TRIPLETASSEMBLY_H_
+#define _BLAZE_MATH_SMP_DEFAULT_TRIPLETASSEMBLY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/DuplicatePolicy.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/TripletAssembly.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Triplet assembly SMP functions */
+//@{
+template< typename Type, bool SO, typename Index, typename IT1, typename IT2, typename IT3 >
+inline void smpAssembleTriplets( CompressedMatrix<Type,SO,Index>& matrix, size_t triplets,
+                                 IT1 major, IT2 minor, IT3 values, DuplicatePolicy policy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP bulk assembly of a compressed matrix from unsorted
+//        triplets.
+// \ingroup smp
+//
+// \param matrix The target compressed matrix.
+// \param triplets The total number of triplets.
+// \param major The major indices of the triplets (row indices in case of a row-major matrix).
+// \param minor The minor indices of the triplets (column indices in case of a row-major matrix).
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function implements the default SMP bulk assembly of a compressed matrix, i.e. the
+// triplets are sorted and assembled serially.\n
+// This function must \b NOT be called explicitly! It is used internally by the triplet
+// constructor and the assemble() function of the CompressedMatrix class template. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the target matrix
+        , bool SO         // Storage order of the target matrix
+        , typename Index  // Index type of the target matrix
+        , typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline void smpAssembleTriplets( CompressedMatrix<Type,SO,Index>& matrix, size_t triplets,
+                                 IT1 major, IT2 minor, IT3 values, DuplicatePolicy policy )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   assembleTriplets( matrix, triplets, major, minor, values, policy );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,646 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/BCSRMult.h
+//  \brief Header file for the OpenMP-based block compressed SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_BCSRMULT_H_
+#define _BLAZE_MATH_SMP_OPENMP_BCSRMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/BCSRMult.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a block compressed matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a block
+// compressed matrix/dense vector multiplication. The block rows of the matrix are distributed among
+// the threads such that each thread processes approximately the same number of non-zero blocks and
+// updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmvAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a block compressed matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of a block compressed matrix/dense vector
+// multiplication. In case the target vector is too small for a parallel execution, the
+// multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpBcsrmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a block compressed matrix/dense
+//        vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// block compressed matrix/dense vector multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmvAddAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a block compressed
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP addition assignment of a block compressed
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvAddAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpBcsrmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a block compressed matrix/dense
+//        vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// block compressed matrix/dense vector multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmvSubAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a block compressed
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP subtraction assignment of a block compressed
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvSubAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpBcsrmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a block compressed matrix/dense matrix
+//        multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a block
+// compressed matrix/dense matrix multiplication. The block rows of the matrix are distributed among
+// the threads such that each thread processes approximately the same number of non-zero blocks and
+// updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmmAssign( ~lhs, A, B, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a block compressed matrix/dense
+//        matrix multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of a block compressed matrix/dense matrix
+// multiplication. In case the target matrix is too small for a parallel execution, the
+// multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, B )
+         smpBcsrmmAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a block compressed matrix/dense
+//        matrix multiplication (\f$ C+=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// block compressed matrix/dense matrix multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmAddAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmmAddAssign( ~lhs, A, B, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a block compressed
+//        matrix/dense matrix multiplication (\f$ C+=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the OpenMP-based SMP addition assignment of a block compressed
+// matrix/dense matrix multiplication. In case the target matrix is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmAddAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmAddAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, B )
+         smpBcsrmmAddAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a block compressed matrix/dense
+//        matrix multiplication (\f$ C-=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// block compressed matrix/dense matrix multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmSubAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int threads( omp_get_num_threads() );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      bcsrmmSubAssign( ~lhs, A, B, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a block compressed
+//        matrix/dense matrix multiplication (\f$ C-=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the OpenMP-based SMP subtraction assignment of a block compressed
+// matrix/dense matrix multiplication. In case the target matrix is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmSubAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmSubAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, B )
+         smpBcsrmmSubAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,716 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/CSRMV.h
+//  \brief Header file for the OpenMP-based CSR/CSC matrix/vector SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_CSRMV_H_
+#define _BLAZE_MATH_SMP_OPENMP_CSRMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <vector>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/CSRMV.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a row-major sparse matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a row-major
+// sparse matrix/dense vector multiplication. The rows of the matrix are split into ranges holding
+// approximately the same number of non-zero elements, which are distributed among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                             const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      csrmvAssign( ~lhs, A, x, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a row-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment of a row-major sparse matrix/dense
+// vector multiplication. In case the target vector is small or a serial section is active, the
+// product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+#pragma omp parallel shared( lhs, A, x, bounds )
+         smpCsrmvAssign_backend( ~lhs, A, x, bounds );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a row-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// row-major sparse matrix/dense vector multiplication. The rows of the matrix are split into ranges
+// holding approximately the same number of non-zero elements, which are distributed among the
+// threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                                const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      csrmvAddAssign( ~lhs, A, x, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP addition assignment of a row-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvAddAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+#pragma omp parallel shared( lhs, A, x, bounds )
+         smpCsrmvAddAssign_backend( ~lhs, A, x, bounds );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a row-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// row-major sparse matrix/dense vector multiplication. The rows of the matrix are split into ranges
+// holding approximately the same number of non-zero elements, which are distributed among the
+// threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                                const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      csrmvSubAssign( ~lhs, A, x, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment of a row-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvSubAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+#pragma omp parallel shared( lhs, A, x, bounds )
+         smpCsrmvSubAssign_backend( ~lhs, A, x, bounds );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a column-major sparse matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the column ranges.
+// \param partials The partial products of the column ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a column-major
+// sparse matrix/dense vector multiplication. The columns of the matrix are split into ranges
+// holding approximately the same number of non-zero elements. Each range is multiplied into a
+// separate partial product, which are combined afterwards by distributing the elements of the
+// target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename VT3 > // Type of the partial dense vectors
+void smpCscmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                             const std::vector<size_t>& bounds, std::vector<VT3>& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    parts( static_cast<int>( partials.size() ) );
+   const size_t n    ( (~lhs).size() );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<parts; ++i ) {
+      cscmvAssign( partials[i], A, x, bounds[i], bounds[i+1] );
+   }
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t first( smpPartition( n, parts, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, parts, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      cscmvReduceAssign( ~lhs, partials, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a column-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment of a column-major sparse matrix/dense
+// vector multiplication. In case the target vector is small or a serial section is active, the
+// product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+         std::vector<PartialType> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i ) {
+            partials[i].resize( (~lhs).size(), false );
+         }
+
+#pragma omp parallel shared( lhs, A, x, bounds, partials )
+         smpCscmvAssign_backend( ~lhs, A, x, bounds, partials );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a column-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the column ranges.
+// \param partials The partial products of the column ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// column-major sparse matrix/dense vector multiplication. The columns of the matrix are split into
+// ranges holding approximately the same number of non-zero elements. Each range is multiplied into
+// a separate partial product, which are combined afterwards by distributing the elements of the
+// target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename VT3 > // Type of the partial dense vectors
+void smpCscmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                                const std::vector<size_t>& bounds, std::vector<VT3>& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    parts( static_cast<int>( partials.size() ) );
+   const size_t n    ( (~lhs).size() );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<parts; ++i ) {
+      cscmvAssign( partials[i], A, x, bounds[i], bounds[i+1] );
+   }
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t first( smpPartition( n, parts, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, parts, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      cscmvReduceAddAssign( ~lhs, partials, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP addition assignment of a column-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvAddAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+         std::vector<PartialType> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i ) {
+            partials[i].resize( (~lhs).size(), false );
+         }
+
+#pragma omp parallel shared( lhs, A, x, bounds, partials )
+         smpCscmvAddAssign_backend( ~lhs, A, x, bounds, partials );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \param bounds The boundaries of the column ranges.
+// \param partials The partial products of the column ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// column-major sparse matrix/dense vector multiplication. The columns of the matrix are split into
+// ranges holding approximately the same number of non-zero elements. Each range is multiplied into
+// a separate partial product, which are combined afterwards by distributing the elements of the
+// target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename VT3 > // Type of the partial dense vectors
+void smpCscmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x,
+                                const std::vector<size_t>& bounds, std::vector<VT3>& partials )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    parts( static_cast<int>( partials.size() ) );
+   const size_t n    ( (~lhs).size() );
+
+#pragma omp for schedule(dynamic,1)
+   for( int i=0; i<parts; ++i ) {
+      cscmvAssign( partials[i], A, x, bounds[i], bounds[i+1] );
+   }
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      const size_t first( smpPartition( n, parts, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, parts, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      cscmvReduceSubAssign( ~lhs, partials, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment of a column-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvSubAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+
+         std::vector<size_t> bounds;
+         smpPartition( A, omp_get_max_threads(), bounds );
+
+         std::vector<PartialType> partials( bounds.size() - 1UL );
+         for( size_t i=0UL; i<partials.size(); ++i ) {
+            partials[i].resize( (~lhs).size(), false );
+         }
+
+#pragma omp parallel shared( lhs, A, x, bounds, partials )
+         smpCscmvSubAssign_backend( ~lhs, A, x, bounds, partials );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
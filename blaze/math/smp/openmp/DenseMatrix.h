@@ -42,6 +42,7 @@
 
 #include <omp.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/Forward.h>
 #include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -49,6 +50,7 @@
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -109,22 +111,19 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( RowWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( smpPartition( (~lhs).rows(), threads, i, alignment, workload ) );
+      const size_t m  ( smpPartition( (~lhs).rows(), threads, i+1UL, alignment, workload ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -182,22 +181,19 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ColumnWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( smpPartition( (~lhs).columns(), threads, i, alignment, workload ) );
+      const size_t n     ( smpPartition( (~lhs).columns(), threads, i+1UL, alignment, workload ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -320,6 +316,130 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a dense matrix to a packed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// dense matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side dense matrix
+        , bool SO2 >       // Storage order of the right-hand side dense matrix
+void smpAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         assign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         assign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix to a packed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a
+// sparse matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side sparse matrix
+        , bool SO2 >       // Storage order of the right-hand side sparse matrix
+void smpAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         assign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         assign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the OpenMP-based SMP assignment to a dense matrix.
@@ -452,22 +572,19 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( RowWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( smpPartition( (~lhs).rows(), threads, i, alignment, workload ) );
+      const size_t m  ( smpPartition( (~lhs).rows(), threads, i+1UL, alignment, workload ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -526,22 +643,19 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ColumnWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( smpPartition( (~lhs).columns(), threads, i, alignment, workload ) );
+      const size_t n     ( smpPartition( (~lhs).columns(), threads, i+1UL, alignment, workload ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -666,6 +780,175 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a dense matrix to a packed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// dense matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns. In case of a symmetric packed matrix the diagonal blocks
+// of all threads are updated via a temporary copy in order to avoid that the mirrored elements
+// are added twice.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side dense matrix
+        , bool SO2 >       // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      if( PL == packedSymmetric )
+      {
+         if( begin > 0UL ) {
+            if( SO1 == rowMajor ) {
+               UnalignedTarget target( submatrix<unaligned>( lhs, begin, 0UL, end-begin, begin ) );
+               addAssign( target, submatrix<unaligned>( ~rhs, begin, 0UL, end-begin, begin ) );
+            }
+            else {
+               UnalignedTarget target( submatrix<unaligned>( lhs, 0UL, begin, begin, end-begin ) );
+               addAssign( target, submatrix<unaligned>( ~rhs, 0UL, begin, begin, end-begin ) );
+            }
+         }
+
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, begin, end-begin, end-begin ) );
+         DynamicMatrix<Type,SO1> diagonal( end-begin, end-begin );
+         assign( diagonal, target );
+         assign( target, diagonal + submatrix<unaligned>( ~rhs, begin, begin, end-begin, end-begin ) );
+         continue;
+      }
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a sparse matrix to a packed
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// sparse matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns. In case of a symmetric packed matrix the diagonal blocks
+// of all threads are updated via a temporary copy in order to avoid that the mirrored elements
+// are added twice.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side sparse matrix
+        , bool SO2 >       // Storage order of the right-hand side sparse matrix
+void smpAddAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      if( PL == packedSymmetric )
+      {
+         if( begin > 0UL ) {
+            if( SO1 == rowMajor ) {
+               UnalignedTarget target( submatrix<unaligned>( lhs, begin, 0UL, end-begin, begin ) );
+               addAssign( target, submatrix<unaligned>( ~rhs, begin, 0UL, end-begin, begin ) );
+            }
+            else {
+               UnalignedTarget target( submatrix<unaligned>( lhs, 0UL, begin, begin, end-begin ) );
+               addAssign( target, submatrix<unaligned>( ~rhs, 0UL, begin, begin, end-begin ) );
+            }
+         }
+
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, begin, end-begin, end-begin ) );
+         DynamicMatrix<Type,SO1> diagonal( end-begin, end-begin );
+         assign( diagonal, target );
+         assign( target, diagonal + submatrix<unaligned>( ~rhs, begin, begin, end-begin, end-begin ) );
+         continue;
+      }
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the OpenMP-based SMP addition assignment to a dense matrix.
@@ -798,22 +1081,19 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( RowWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( smpPartition( (~lhs).rows(), threads, i, alignment, workload ) );
+      const size_t m  ( smpPartition( (~lhs).rows(), threads, i+1UL, alignment, workload ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -872,22 +1152,19 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ColumnWorkload<MT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( smpPartition( (~lhs).columns(), threads, i, alignment, workload ) );
+      const size_t n     ( smpPartition( (~lhs).columns(), threads, i+1UL, alignment, workload ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -1012,6 +1289,176 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a dense matrix to a packed
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// dense matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns. In case of a symmetric packed matrix the diagonal blocks
+// of all threads are updated via a temporary copy in order to avoid that the mirrored elements
+// are subtracted twice.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side dense matrix
+        , bool SO2 >       // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      if( PL == packedSymmetric )
+      {
+         if( begin > 0UL ) {
+            if( SO1 == rowMajor ) {
+               UnalignedTarget target( submatrix<unaligned>( lhs, begin, 0UL, end-begin, begin ) );
+               subAssign( target, submatrix<unaligned>( ~rhs, begin, 0UL, end-begin, begin ) );
+            }
+            else {
+               UnalignedTarget target( submatrix<unaligned>( lhs, 0UL, begin, begin, end-begin ) );
+               subAssign( target, submatrix<unaligned>( ~rhs, 0UL, begin, begin, end-begin ) );
+            }
+         }
+
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, begin, end-begin, end-begin ) );
+         DynamicMatrix<Type,SO1> diagonal( end-begin, end-begin );
+         assign( diagonal, target );
+         assign( target, diagonal - submatrix<unaligned>( ~rhs, begin, begin, end-begin, end-begin ) );
+         continue;
+      }
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sparse matrix to a packed
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// sparse matrix to a packed matrix. The rows/columns of the packed matrix are distributed such
+// that all threads have to process the same number of stored elements. Each thread exclusively
+// writes to the stored elements of its own rows/columns. In case of a symmetric packed matrix the diagonal blocks
+// of all threads are updated via a temporary copy in order to avoid that the mirrored elements
+// are subtracted twice.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type    // Data type of the left-hand side packed matrix
+        , PackedLayout PL  // Packed layout of the left-hand side packed matrix
+        , bool SO1         // Storage order of the left-hand side packed matrix
+        , typename MT2     // Type of the right-hand side sparse matrix
+        , bool SO2 >       // Storage order of the right-hand side sparse matrix
+void smpSubAssign_backend( PackedMatrix<Type,PL,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename SubmatrixExprTrait<PackedMatrix<Type,PL,SO1>,unaligned>::Type  UnalignedTarget;
+
+   const bool     prefix  ( PL == packedSymmetric || ( PL == packedLower ) != SO1 );
+   const int      threads ( omp_get_num_threads() );
+   const size_t   n       ( lhs.rows() );
+   const Workload workload( ( prefix )?( increasingWorkload ):( decreasingWorkload ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( n, threads, i    , 1UL, workload ) );
+      const size_t end  ( smpPartition( n, threads, i+1UL, 1UL, workload ) );
+
+      if( begin == end )
+         continue;
+
+      if( PL == packedSymmetric )
+      {
+         if( begin > 0UL ) {
+            if( SO1 == rowMajor ) {
+               UnalignedTarget target( submatrix<unaligned>( lhs, begin, 0UL, end-begin, begin ) );
+               subAssign( target, submatrix<unaligned>( ~rhs, begin, 0UL, end-begin, begin ) );
+            }
+            else {
+               UnalignedTarget target( submatrix<unaligned>( lhs, 0UL, begin, begin, end-begin ) );
+               subAssign( target, submatrix<unaligned>( ~rhs, 0UL, begin, begin, end-begin ) );
+            }
+         }
+
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, begin, end-begin, end-begin ) );
+         DynamicMatrix<Type,SO1> diagonal( end-begin, end-begin );
+         assign( diagonal, target );
+         assign( target, diagonal - submatrix<unaligned>( ~rhs, begin, begin, end-begin, end-begin ) );
+         continue;
+      }
+
+      const size_t first( ( prefix )?( 0UL ):( begin ) );
+      const size_t last ( ( prefix )?( end ):( n ) );
+
+      if( SO1 == rowMajor ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs, begin, first, end-begin, last-first ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, begin, first, end-begin, last-first ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs, first, begin, last-first, end-begin ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, first, begin, last-first, end-begin ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the OpenMP-based SMP subtracction assignment to a dense matrix.
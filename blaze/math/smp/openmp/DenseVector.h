@@ -49,6 +49,7 @@
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
 #include <blaze/math/SparseSubvector.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -109,22 +110,19 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          assign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -328,22 +326,19 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          addAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -547,22 +542,19 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          subAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -767,22 +759,19 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int      threads  ( omp_get_num_threads() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          multAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -0,0 +1,201 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Fill.h
+//  \brief Header file for the OpenMP-based SMP fill functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_FILL_H_
+#define _BLAZE_MATH_SMP_OPENMP_FILL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP fill of a two-dimensional array.
+// \ingroup smp
+//
+// \param array The two-dimensional array to be filled.
+// \param m The number of rows (row-major) or columns (column-major) of the array.
+// \param spacing The number of elements between the beginning of two rows/columns.
+// \param first The index of the first element to be filled in each row/column.
+// \param last The index one past the last element to be filled in each row/column.
+// \param value The value to be assigned to the elements.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP fill of a two-dimensional
+// array. The rows/columns are split into the same parts as in the SMP assignment of a dense
+// vector or matrix of the same size and the i-th part is filled by the i-th thread. Therefore
+// the memory pages of each part are placed on the NUMA node of the according thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices.
+*/
+template< typename Type >  // Data type of the array elements
+void smpFill_backend( Type* array, size_t m, size_t spacing, size_t first, size_t last, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<Type>  IT;
+
+   const int    threads  ( omp_get_num_threads() );
+   const size_t alignment( IsVectorizable<Type>::value ? static_cast<size_t>( IT::size ) : 1UL );
+
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t begin( smpPartition( m, threads, i, alignment, uniformWorkload ) );
+      const size_t end  ( smpPartition( m, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == 0UL && last == spacing ) {
+         for( size_t k=begin*spacing; k<end*spacing; ++k )
+            array[k] = value;
+      }
+      else {
+         for( size_t k=begin; k<end; ++k )
+            for( size_t j=first; j<last; ++j )
+               array[k*spacing+j] = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP fill of an array.
+// \ingroup smp
+//
+// \param array The array to be filled.
+// \param size The number of elements of the array.
+// \param value The value to be assigned to all elements.
+// \return void
+//
+// This function assigns the given value to all elements of the array. In case the size of the
+// array exceeds the SMP_DVECASSIGN_THRESHOLD, the elements are assigned in parallel, following
+// the partitioning of the SMP assignment of dense vectors.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices.
+*/
+template< typename Type >  // Data type of the array elements
+inline void smpFill( Type* array, size_t size, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || size <= SMP_DVECASSIGN_THRESHOLD ) {
+      for( size_t i=0UL; i<size; ++i )
+         array[i] = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( array, size, value )
+      smpFill_backend( array, size, 1UL, 0UL, 1UL, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP fill of a two-dimensional array.
+// \ingroup smp
+//
+// \param array The two-dimensional array to be filled.
+// \param m The number of rows (row-major) or columns (column-major) of the array.
+// \param spacing The number of elements between the beginning of two rows/columns.
+// \param first The index of the first element to be filled in each row/column.
+// \param last The index one past the last element to be filled in each row/column.
+// \param value The value to be assigned to the elements.
+// \return void
+//
+// This function assigns the given value to the elements in the range \f$ [first..last) \f$ of
+// all \a m rows/columns. In case the number of rows/columns exceeds the SMP_DMATASSIGN_THRESHOLD,
+// the rows/columns are filled in parallel, following the partitioning of the SMP assignment of
+// dense matrices.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices.
+*/
+template< typename Type >  // Data type of the array elements
+inline void smpFill( Type* array, size_t m, size_t spacing, size_t first, size_t last, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= spacing, "Invalid element range detected" );
+
+   if( first == last )
+      return;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || m <= SMP_DMATASSIGN_THRESHOLD ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=first; j<last; ++j )
+            array[i*spacing+j] = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( array, m, spacing, first, last, value )
+      smpFill_backend( array, m, spacing, first, last, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SELLMV.h
+//  \brief Header file for the OpenMP-based sliced ELLPACK SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SELLMV_H_
+#define _BLAZE_MATH_SMP_OPENMP_SELLMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/SELLMV.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sliced ELLPACK matrix/dense vector
+//        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a sliced
+// ELLPACK matrix/dense vector multiplication. The chunks of the matrix are distributed
+// uniformly among the threads in multiples of complete sorting windows, such that each thread
+// updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    threads  ( omp_get_num_threads() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      sellmvAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP assignment of a sliced ELLPACK matrix/dense vector
+// multiplication. In case the target vector is too small for a parallel execution, the
+// multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpSellmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition assignment of a
+// sliced ELLPACK matrix/dense vector multiplication. The chunks of the matrix are distributed
+// uniformly among the threads in multiples of complete sorting windows, such that each thread
+// updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    threads  ( omp_get_num_threads() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      sellmvAddAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP addition assignment of a sliced ELLPACK matrix/dense
+// vector multiplication. In case the target vector is too small for a parallel execution, the
+// multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvAddAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpSellmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a sliced ELLPACK matrix/dense
+//        vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction assignment of a
+// sliced ELLPACK matrix/dense vector multiplication. The chunks of the matrix are distributed
+// uniformly among the threads in multiples of complete sorting windows, such that each thread
+// updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int    threads  ( omp_get_num_threads() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      sellmvSubAssign( ~lhs, A, x, first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP subtraction assignment of a sliced ELLPACK
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvSubAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+#pragma omp parallel shared( lhs, A, x )
+         smpSellmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
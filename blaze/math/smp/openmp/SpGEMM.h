@@ -0,0 +1,338 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SpGEMM.h
+//  \brief Header file for the OpenMP-based SpGEMM SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPGEMM_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/sparse/SpGEMMPlan.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the symbolic phase of the OpenMP-based SMP assignment of a sparse
+//        matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param flops The number of scalar products per row.
+// \param nonzeros The resulting number of non-zero elements per row.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the symbolic phase of the OpenMP-based SMP
+// assignment of a sparse matrix/sparse matrix multiplication. The row ranges are distributed
+// among the threads, which determine the number of non-zero elements of their rows.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2 > // Type of the right-hand side sparse matrix
+void smpSpgemmSymbolic_backend( const MT1& A, const MT2& B, const std::vector<size_t>& flops,
+                                std::vector<size_t>& nonzeros, const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      spgemmSymbolic( A, B, flops, nonzeros, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the numeric phase of the OpenMP-based SMP assignment of a sparse
+//        matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param lhs The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param flops The number of scalar products per row.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the numeric phase of the OpenMP-based SMP
+// assignment of a sparse matrix/sparse matrix multiplication. The row ranges are distributed
+// among the threads, which write their rows directly into the pre-sized target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the target sparse matrix
+        , typename Index  // Index type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void smpSpgemmNumeric_backend( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B,
+                               const std::vector<size_t>& flops, const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      spgemmNumeric( lhs, A, B, flops, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment of a sparse matrix/sparse matrix
+//        multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment of a sparse matrix/sparse matrix
+// multiplication. The rows are split into ranges with approximately the same number of scalar
+// products. In a first parallel phase the exact number of non-zero elements of each row is
+// determined, which is used to lay out the rows of the target matrix. In a second parallel
+// phase all rows are computed and written directly into their final position. In case the
+// target matrix is small or a serial section is active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the target sparse matrix
+        , typename Index  // Index type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void smpSpgemmAssign( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == B.columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || A.rows() <= SMP_SMATSMATMULT_THRESHOLD ) {
+         spgemmAssign( lhs, A, B );
+      }
+      else {
+         std::vector<size_t> flops;
+         spgemmFlops( A, B, flops );
+
+         std::vector<size_t> bounds;
+         smpPartition( flops, omp_get_max_threads(), bounds );
+
+         std::vector<size_t> nonzeros( A.rows() );
+
+#pragma omp parallel shared( A, B, flops, nonzeros, bounds )
+         smpSpgemmSymbolic_backend( A, B, flops, nonzeros, bounds );
+
+         lhs.reset();
+         lhs.reserve( nonzeros );
+
+#pragma omp parallel shared( lhs, A, B, flops, bounds )
+         smpSpgemmNumeric_backend( lhs, A, B, flops, bounds );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAN-BASED MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based numeric phase of a sparse matrix/sparse matrix
+//        multiplication based on a precomputed plan.
+// \ingroup smp
+//
+// \param C The resulting row-major sparse matrix.
+// \param plan The precomputed structure of the multiplication.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param bounds The boundaries of the row ranges.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based numeric phase of a plan-based
+// sparse matrix/sparse matrix multiplication. The row ranges are distributed among the threads,
+// which write the values of their rows into the laid out resulting matrix.\n
+// This function must \b NOT be called explicitly! It is used internally by the multiply()
+// function. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void smpSpgemmPlan_backend( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+                            const CompressedMatrix<T1,false>& A,
+                            const CompressedMatrix<T2,false>& B, const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int parts( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<parts; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      plan.assign( C, A, B, bounds[i], bounds[i+1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication based on a precomputed
+//        plan (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The resulting row-major sparse matrix.
+// \param plan The precomputed structure of the multiplication.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrices do not match the plan.
+//
+// This function computes the product \f$ A*B \f$ based on the given SpGEMMPlan. In case \a C
+// doesn't contain the sparsity pattern of the plan yet, it is laid out first. Afterwards only
+// the values of the non-zero elements of \a C are overwritten. The rows are split into ranges
+// with approximately the same number of scalar products, which are computed in parallel by
+// the OpenMP threads. In case the resulting matrix is small or a serial section is active,
+// the rows are computed serially.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void multiply( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+               const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !plan.isCompatible( A, B ) )
+      throw std::invalid_argument( "Matrices do not match the SpGEMM plan" );
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      CompressedMatrix<Type,false> tmp;
+      multiply( tmp, plan, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   plan.layout( C );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || plan.rows() <= SMP_SMATSMATMULT_THRESHOLD ) {
+         plan.assign( C, A, B, 0UL, plan.rows() );
+      }
+      else {
+         std::vector<size_t> products( plan.rows() );
+         for( size_t i=0UL; i<plan.rows(); ++i ) {
+            products[i] = plan.products(i);
+         }
+
+         std::vector<size_t> bounds;
+         smpPartition( products, omp_get_max_threads(), bounds );
+
+#pragma omp parallel shared( C, plan, A, B, bounds )
+         smpSpgemmPlan_backend( C, plan, A, B, bounds );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/TriangularSolve.h
+//  \brief Header file for the OpenMP-based sparse triangular solve SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SMP_OPENMP_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/TriangularSolve.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based solution of a row-major sparse triangular system.
+// \ingroup smp
+//
+// \param A The analyzed row-major sparse matrix.
+// \param schedule The level-set analysis of the triangular part of \a A.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based level-scheduled triangular
+// solve. It is executed by all threads of the enclosing parallel region. The levels are
+// processed one after another, separated by the implicit barriers of the work-sharing
+// constructs. The rows of each level with at least \a SMP_TRIANGULARSOLVE_THRESHOLD rows are
+// distributed among the threads, all smaller levels are computed by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally by the solve() function.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void smpTriangularSolve_backend( const MT& A, const LevelSchedule& schedule,
+                                 VT1& x, const VT2& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef LevelSchedule::ConstIterator  ConstIterator;
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      const ConstIterator first( schedule.begin(l) );
+      const int rows( static_cast<int>( schedule.rows(l) ) );
+
+      if( static_cast<size_t>( rows ) < SMP_TRIANGULARSOLVE_THRESHOLD )
+      {
+#pragma omp single
+         schedule.substitute( A, x, b, first, schedule.end(l) );
+      }
+      else
+      {
+#pragma omp for schedule(static)
+         for( int row=0; row<rows; ++row ) {
+            schedule.substitute( A, x, b, first+row, first+row+1 );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a sparse triangular system based on a precomputed level schedule.
+// \ingroup sparse_matrix
+//
+// \param A The analyzed square sparse matrix.
+// \param schedule The level-set analysis of the triangular part of \a A.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix does not match the level schedule.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves \f$ A*x=b \f$ with the triangular part of \a A that has been analyzed by
+// the given LevelSchedule. \a x and \a b may be the same vector. In case of a row-major matrix
+// the rows of sufficiently large levels are computed in parallel by OpenMP. In case the matrix
+// is small, the matrix is column-major, or a serial section is active, the system is solved
+// serially by forward or back substitution.
+*/
+template< typename MT   // Type of the sparse matrix
+        , bool SO       // Storage order of the sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, const LevelSchedule& schedule,
+            DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !schedule.isCompatible( ~A ) )
+      throw std::invalid_argument( "Matrix does not match the level schedule" );
+
+   if( (~x).size() != schedule.rows() || (~b).size() != schedule.rows() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( SO || isSerialSectionActive() || schedule.rows() < SMP_TRIANGULARSOLVE_THRESHOLD ) {
+         if( schedule.isLower() )
+            forwardSubstitution( ~A, ~x, ~b );
+         else
+            backSubstitution( ~A, ~x, ~b );
+      }
+      else {
+         typename MT::CompositeType tmp( ~A );
+         VT1& y( ~x );
+         const VT2& c( ~b );
+#pragma omp parallel shared( tmp, schedule, y, c )
+         smpTriangularSolve_backend( tmp, schedule, y, c );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,204 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/TripletAssembly.h
+//  \brief Header file for the OpenMP-based triplet assembly SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_TRIPLETASSEMBLY_H_
+#define _BLAZE_MATH_SMP_OPENMP_TRIPLETASSEMBLY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DuplicatePolicy.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/TripletAssembly.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TRIPLET ASSEMBLY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of a phase of the OpenMP-based bulk assembly of a compressed matrix.
+// \ingroup smp
+//
+// \param assembler The triplet assembler.
+// \param matrix The target matrix.
+// \param phase The phase to be executed.
+// \param bounds The boundaries of the ranges of parts (or rows/columns).
+// \return void
+//
+// This function executes the given phase of the assembly by distributing the ranges among the
+// threads of the enclosing OpenMP parallel region.\n
+// This function must \b NOT be called explicitly! It is used internally by the triplet
+// constructor and the assemble() function of the CompressedMatrix class template. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename TA    // Type of the triplet assembler
+        , typename MT >  // Type of the target matrix
+void smpAssembleTriplets_backend( TA& assembler, MT& matrix, typename TA::Phase phase,
+                                  const std::vector<size_t>& bounds )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const int ranges( static_cast<int>( bounds.size() - 1UL ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+   for( int i=0; i<ranges; ++i )
+   {
+      if( bounds[i] == bounds[i+1] )
+         continue;
+
+      assembler.run( phase, bounds[i], bounds[i+1], matrix );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP bulk assembly of a compressed matrix from
+//        unsorted triplets.
+// \ingroup smp
+//
+// \param matrix The target compressed matrix.
+// \param triplets The total number of triplets.
+// \param major The major indices of the triplets (row indices in case of a row-major matrix).
+// \param minor The minor indices of the triplets (column indices in case of a row-major matrix).
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function implements the OpenMP-based SMP bulk assembly of a compressed matrix. The
+// input is split into contiguous parts, which are counted and scattered in parallel during
+// both counting sort passes. Afterwards the rows/columns are split into ranges with
+// approximately the same number of triplets, which are combined and appended in parallel.
+// In case the number of triplets is small or a serial section is active, the matrix is
+// assembled serially.\n
+// This function must \b NOT be called explicitly! It is used internally by the triplet
+// constructor and the assemble() function of the CompressedMatrix class template. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the target matrix
+        , bool SO         // Storage order of the target matrix
+        , typename Index  // Index type of the target matrix
+        , typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void smpAssembleTriplets( CompressedMatrix<Type,SO,Index>& matrix, size_t triplets,
+                          IT1 major, IT2 minor, IT3 values, DuplicatePolicy policy )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef TripletAssembler<IT1,IT2,IT3>  Assembler;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || triplets < SMP_TRIPLETASSEMBLY_THRESHOLD ) {
+         assembleTriplets( matrix, triplets, major, minor, values, policy );
+      }
+      else {
+         const size_t threads  ( omp_get_max_threads() );
+         const size_t majorSize( ( SO )?( matrix.columns() ):( matrix.rows() ) );
+         const size_t minorSize( ( SO )?( matrix.rows() ):( matrix.columns() ) );
+         const size_t parts    ( tripletParts( threads, triplets, majorSize, minorSize ) );
+
+         Assembler assembler( major, minor, values, triplets, majorSize, minorSize, parts, policy );
+
+         std::vector<size_t> bounds( parts+1UL );
+         for( size_t p=0UL; p<=parts; ++p ) {
+            bounds[p] = p;
+         }
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::countMinor, bounds );
+
+         if( !assembler.minorOffsets() )
+            throw std::invalid_argument( "Invalid triplet index" );
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::scatterMinor, bounds );
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::countMajor, bounds );
+
+         assembler.majorOffsets();
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::scatterMajor, bounds );
+
+         std::vector<size_t> work( majorSize );
+         for( size_t i=0UL; i<majorSize; ++i ) {
+            work[i] = assembler.triplets(i);
+         }
+
+         smpPartition( work, threads, bounds );
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::countNonZeros, bounds );
+
+         matrix.reset();
+         matrix.reserve( assembler.nonZeros() );
+
+#pragma omp parallel shared( assembler, matrix, bounds )
+         smpAssembleTriplets_backend( assembler, matrix, Assembler::appendElements, bounds );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,755 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncAssign.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous assignment implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/threadpool/Task.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCSTATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Shared completion state of an asynchronous assignment.
+// \ingroup smp
+//
+// The AsyncState class represents the completion state that is shared between an asynchronous
+// assignment and all Future objects referring to it. Next to the completion flag it stores the
+// exception thrown during the assignment (if any) and the tasks that have to be scheduled as
+// soon as the assignment has been completed.
+*/
+class AsyncState : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::Mutex      Mutex;      //!< Type of the mutex.
+   typedef TheThreadBackend::Lock       Lock;       //!< Type of a locking object.
+   typedef TheThreadBackend::Condition  Condition;  //!< Type of the condition variable.
+   typedef std::vector<threadpool::Task>  Tasks;   //!< Type of the continuation container.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor of the AsyncState class.
+   */
+   explicit inline AsyncState()
+      : ready_        ( false )  // Completion flag
+      , error_        ()         // The exception thrown during the assignment
+      , continuations_()         // Tasks to be scheduled after the completion
+      , mutex_        ()         // Synchronization mutex
+      , completed_    ()         // Wait condition for the completion
+   {}
+   //**********************************************************************************************
+
+   //**IsReady function****************************************************************************
+   /*!\brief Returns whether the asynchronous assignment has been completed.
+   //
+   // \return \a true in case the assignment has been completed, \a false if not.
+   */
+   inline bool isReady() const {
+      Lock lock( mutex_ );
+      return ready_;
+   }
+   //**********************************************************************************************
+
+   //**Wait function*******************************************************************************
+   /*!\brief Waiting for the completion of the asynchronous assignment.
+   //
+   // \return The exception thrown during the assignment (or an empty exception pointer).
+   */
+   inline boost::exception_ptr wait() const {
+      Lock lock( mutex_ );
+      while( !ready_ ) {
+         completed_.wait( lock );
+      }
+      return error_;
+   }
+   //**********************************************************************************************
+
+   //**Then function*******************************************************************************
+   /*!\brief Schedules the given task after the completion of the asynchronous assignment.
+   //
+   // \param task The task to be scheduled.
+   // \return void
+   */
+   inline void then( threadpool::Task task ) {
+      {
+         Lock lock( mutex_ );
+         if( !ready_ ) {
+            continuations_.push_back( task );
+            return;
+         }
+      }
+      TheThreadBackend::scheduleDetached( task );
+   }
+   //**********************************************************************************************
+
+   //**Complete function***************************************************************************
+   /*!\brief Marks the asynchronous assignment as completed.
+   //
+   // \param error The exception thrown during the assignment (or an empty exception pointer).
+   // \return void
+   //
+   // This function wakes up all threads waiting for the assignment and schedules all tasks
+   // depending on the assignment.
+   */
+   inline void complete( const boost::exception_ptr& error ) {
+      Tasks continuations;
+      {
+         Lock lock( mutex_ );
+         error_ = error;
+         ready_ = true;
+         continuations.swap( continuations_ );
+         completed_.notify_all();
+      }
+      for( Tasks::iterator task=continuations.begin(); task!=continuations.end(); ++task ) {
+         TheThreadBackend::scheduleDetached( *task );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   bool ready_;                   //!< Completion flag.
+   boost::exception_ptr error_;   //!< The exception thrown during the assignment.
+   Tasks continuations_;          //!< Tasks to be scheduled after the completion.
+   mutable Mutex mutex_;          //!< Synchronization mutex.
+   mutable Condition completed_;  //!< Wait condition for the completion.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUTURE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for the result of an asynchronous assignment.
+// \ingroup smp
+//
+// A Future is returned by the asynchronous assignment functions (asyncAssign(), asyncAddAssign(),
+// and asyncSubAssign()). It can be used to query whether the assignment has been completed and
+// to wait for its completion:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D, E;
+   // ... Resizing and initialization
+
+   blaze::Future f1 = asyncAssign( C, A * B );  // Computing C = A * B asynchronously
+   blaze::Future f2 = asyncAssign( D, A + B );  // Computing D = A + B asynchronously
+
+   // ... Unrelated work of the calling thread
+
+   f1.wait();  // Waiting for C to be ready
+   f2.wait();  // Waiting for D to be ready
+   \endcode
+
+// In case the assignment has failed with an exception, wait() rethrows this exception. Future
+// objects are cheap to copy; all copies refer to the same assignment. A default constructed
+// Future refers to no assignment and is always ready.
+*/
+class Future
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline Future();
+   explicit inline Future( const boost::shared_ptr<AsyncState>& state );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait   () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Continuation functions**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline boost::exception_ptr error() const;
+   inline void then( threadpool::Task task ) const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::shared_ptr<AsyncState> state_;  //!< The shared state of the asynchronous assignment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor of the Future class.
+//
+// The default constructed Future refers to no assignment and is always ready.
+*/
+inline Future::Future()
+   : state_()  // The shared state of the asynchronous assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a Future referring to the given asynchronous assignment.
+//
+// \param state The shared state of the asynchronous assignment.
+*/
+inline Future::Future( const boost::shared_ptr<AsyncState>& state )
+   : state_( state )  // The shared state of the asynchronous assignment
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the asynchronous assignment has been completed.
+//
+// \return \a true in case the assignment has been completed, \a false if not.
+//
+// In case the function returns \a true, the target of the assignment can safely be accessed.
+*/
+inline bool Future::isReady() const
+{
+   return !state_ || state_->isReady();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the asynchronous assignment.
+//
+// \return void
+//
+// This function blocks until the asynchronous assignment has been completed. In case the
+// assignment has failed with an exception, the exception is rethrown.
+*/
+inline void Future::wait() const
+{
+   if( !state_ ) return;
+
+   const boost::exception_ptr error( state_->wait() );
+
+   if( error )
+      boost::rethrow_exception( error );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the exception thrown during the completed asynchronous assignment.
+//
+// \return The exception thrown during the assignment (or an empty exception pointer).
+//
+// This function must only be called after the assignment has been completed.
+*/
+inline boost::exception_ptr Future::error() const
+{
+   return ( state_ )?( state_->wait() ):( boost::exception_ptr() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schedules the given task after the completion of the asynchronous assignment.
+//
+// \param task The task to be scheduled.
+// \return void
+*/
+inline void Future::then( threadpool::Task task ) const
+{
+   if( state_ )
+      state_->then( task );
+   else
+      TheThreadBackend::scheduleDetached( task );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the asynchronous execution of a (compound) assignment.
+// \ingroup smp
+//
+// The AsyncAssigner executes the given assignment kernel on a thread of the thread backend.
+// The assignment is performed via the regular assignment operators of the target and therefore
+// is itself parallelized via the thread backend (unless it has been started within a serial
+// section). In case the dependency of the assignment has failed, the assignment is skipped and
+// the exception of the dependency is forwarded.
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+class AsyncAssigner
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Storage type of the source operand.
+   /*! Expressions are stored by value, vectors and matrices by reference. */
+   typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type
+      Operand;
+
+   //! Type of the assignment kernel.
+   typedef void (*Kernel)( Target&, const Source& );
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target operand of the assignment.
+   // \param source The source operand of the assignment.
+   // \param kernel The assignment kernel.
+   // \param dependency The assignment that has to be completed before the assignment.
+   // \param state The shared state of the assignment.
+   // \param serial \a true in case the assignment has to be performed serially, \a false if not.
+   */
+   explicit inline AsyncAssigner( Target& target, const Source& source, Kernel kernel,
+                                  const Future& dependency,
+                                  const boost::shared_ptr<AsyncState>& state, bool serial )
+      : target_    ( target     )  // The target operand
+      , source_    ( source     )  // The source operand
+      , kernel_    ( kernel     )  // The assignment kernel
+      , dependency_( dependency )  // The preceding assignment
+      , state_     ( state      )  // The shared state of the assignment
+      , serial_    ( serial     )  // Serial execution flag
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment and completes the shared state.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      boost::exception_ptr error( dependency_.error() );
+
+      if( !error ) {
+         try {
+            if( serial_ ) {
+               BLAZE_SERIAL_SECTION { kernel_( target_, source_ ); }
+            }
+            else {
+               kernel_( target_, source_ );
+            }
+         }
+         catch( ... ) {
+            error = boost::current_exception();
+         }
+      }
+
+      state_->complete( error );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Target& target_;                       //!< The target operand.
+   Operand source_;                       //!< The source operand.
+   Kernel kernel_;                        //!< The assignment kernel.
+   Future dependency_;                    //!< The preceding assignment.
+   boost::shared_ptr<AsyncState> state_;  //!< The shared state of the assignment.
+   bool serial_;                          //!< Serial execution flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of an asynchronous assignment.
+// \ingroup smp
+//
+// \param target The target operand.
+// \param source The source operand.
+// \return void
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+void asyncAssignKernel( Target& target, const Source& source )
+{
+   target = source;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of an asynchronous addition assignment.
+// \ingroup smp
+//
+// \param target The target operand.
+// \param source The source operand.
+// \return void
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+void asyncAddAssignKernel( Target& target, const Source& source )
+{
+   target += source;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of an asynchronous subtraction assignment.
+// \ingroup smp
+//
+// \param target The target operand.
+// \param source The source operand.
+// \return void
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+void asyncSubAssignKernel( Target& target, const Source& source )
+{
+   target -= source;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schedules an asynchronous assignment on the thread backend.
+// \ingroup smp
+//
+// \param target The target operand.
+// \param source The source operand.
+// \param kernel The assignment kernel.
+// \param dependency The assignment that has to be completed before the assignment.
+// \return The handle for the asynchronous assignment.
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+Future asyncSchedule( Target& target, const Source& source,
+                      void (*kernel)( Target&, const Source& ), const Future& dependency )
+{
+   const boost::shared_ptr<AsyncState> state( new AsyncState() );
+
+   dependency.then( AsyncAssigner<Target,Source>( target, source, kernel, dependency,
+                                                  state, isSerialSectionActive() ) );
+
+   return Future( state );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline Future asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                           const Future& dependency = Future() );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                           const Future& dependency = Future() );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline Future asyncAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                              const Future& dependency = Future() );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                              const Future& dependency = Future() );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline Future asyncSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                              const Future& dependency = Future() );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                              const Future& dependency = Future() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the assignment \a lhs = \a rhs on a thread of the thread backend and
+// immediately returns a Future for the assignment. The assignment itself is executed in parallel
+// via the thread backend, exactly as a synchronous assignment. The assignment is started after
+// the given \a dependency has been completed; in case the dependency has failed, the assignment
+// is skipped and the returned Future fails with the same exception:
+
+   \code
+   blaze::DynamicVector<double> a, b, c, d;
+   // ... Resizing and initialization
+
+   blaze::Future f1 = asyncAssign( c, a + b );      // Computing c = a + b
+   blaze::Future f2 = asyncAssign( d, c * 2.0, f1 );  // Computing d = 2c after c is ready
+   f2.wait();
+   \endcode
+
+// The following rules apply until the assignment has been completed (i.e. until the wait()
+// function of the Future has returned or the isReady() function has returned \a true):
+//
+//  - The target vector \a lhs must neither be read nor written by any other thread or operation.
+//  - The vectors and matrices referenced by \a rhs must not be modified or destroyed. Note that
+//    \a rhs itself is copied, but the operands of an expression are stored by reference.
+//
+// After completion, all results of the assignment are visible to the thread that observed the
+// completion.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline Future asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                           const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncAssignKernel<VT1,VT2>, dependency );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the assignment \a lhs = \a rhs on a thread of the thread backend and
+// immediately returns a Future for the assignment. The assignment itself is executed in parallel
+// via the thread backend, exactly as a synchronous assignment. The assignment is started after
+// the given \a dependency has been completed; in case the dependency has failed, the assignment
+// is skipped and the returned Future fails with the same exception:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+
+   blaze::Future f1 = asyncAssign( C, A * B );      // Computing C = A * B
+   blaze::Future f2 = asyncAssign( D, C * A, f1 );  // Computing D = C * A after C is ready
+   f2.wait();
+   \endcode
+
+// The following rules apply until the assignment has been completed (i.e. until the wait()
+// function of the Future has returned or the isReady() function has returned \a true):
+//
+//  - The target matrix \a lhs must neither be read nor written by any other thread or operation.
+//  - The vectors and matrices referenced by \a rhs must not be modified or destroyed. Note that
+//    \a rhs itself is copied, but the operands of an expression are stored by reference.
+//
+// After completion, all results of the assignment are visible to the thread that observed the
+// completion.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                           const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncAssignKernel<MT1,MT2>, dependency );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous addition assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be added.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the addition assignment \a lhs += \a rhs asynchronously. For details
+// see the asyncAssign() function for vectors.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline Future asyncAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                              const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncAddAssignKernel<VT1,VT2>, dependency );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous addition assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be added.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the addition assignment \a lhs += \a rhs asynchronously. For details
+// see the asyncAssign() function for matrices.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                              const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncAddAssignKernel<MT1,MT2>, dependency );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous subtraction assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the subtraction assignment \a lhs -= \a rhs asynchronously. For
+// details see the asyncAssign() function for vectors.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline Future asyncSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                              const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncSubAssignKernel<VT1,VT2>, dependency );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous subtraction assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \param dependency The assignment that has to be completed before the assignment is started.
+// \return The handle for the asynchronous assignment.
+//
+// This function performs the subtraction assignment \a lhs -= \a rhs asynchronously. For
+// details see the asyncAssign() function for matrices.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                              const Future& dependency )
+{
+   return asyncSchedule( ~lhs, ~rhs, &asyncSubAssignKernel<MT1,MT2>, dependency );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,726 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/BCSRMult.h
+//  \brief Header file for the C++11/Boost thread-based block compressed SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_BCSRMULT_H_
+#define _BLAZE_MATH_SMP_THREADS_BCSRMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/BCSRMult.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BCSRTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded computation of a range of block rows of a block compressed
+//        matrix/dense vector or matrix/dense matrix multiplication.
+// \ingroup smp
+*/
+template< typename T1   // Type of the dense target
+        , typename MT   // Type of the block compressed matrix
+        , typename T2 > // Type of the right-hand side dense operand
+struct BCSRTask
+{
+   //**Type definitions****************************************************************************
+   //! Type of the multiplication kernel.
+   typedef void (*Kernel)( T1&, const MT&, const T2&, size_t, size_t );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BCSRTask class template.
+   //
+   // \param kernel The multiplication kernel to be executed.
+   // \param lhs The dense target.
+   // \param A The left-hand side block compressed matrix.
+   // \param rhs The right-hand side dense operand.
+   // \param first The index of the first block row to be computed.
+   // \param last The index one past the last block row to be computed.
+   */
+   explicit inline BCSRTask( Kernel kernel, T1& lhs, const MT& A, const T2& rhs,
+                             size_t first, size_t last )
+      : kernel_( kernel )  // The multiplication kernel
+      , lhs_   ( &lhs )    // The dense target
+      , A_     ( &A )      // The left-hand side block compressed matrix
+      , rhs_   ( &rhs )    // The right-hand side dense operand
+      , first_ ( first )   // The index of the first block row
+      , last_  ( last )    // The index one past the last block row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of block rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      kernel_( *lhs_, *A_, *rhs_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel    kernel_;  //!< The multiplication kernel.
+   T1*       lhs_;     //!< The dense target.
+   const MT* A_;       //!< The left-hand side block compressed matrix.
+   const T2* rhs_;     //!< The right-hand side dense operand.
+   size_t    first_;   //!< The index of the first block row.
+   size_t    last_;    //!< The index one past the last block row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a block compressed matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// block compressed matrix/dense vector multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmvAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a block compressed
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of a block compressed
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a block compressed
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a block compressed matrix/dense vector multiplication. The block rows of the matrix
+// are distributed among the threads such that each thread processes approximately the same number
+// of non-zero blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmvAddAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a block
+//        compressed matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP addition assignment of a block compressed
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvAddAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a block compressed
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a block compressed matrix/dense vector multiplication. The block rows of the matrix
+// are distributed among the threads such that each thread processes approximately the same number
+// of non-zero blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpBcsrmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmvSubAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a block
+//        compressed matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP subtraction assignment of a block
+// compressed matrix/dense vector multiplication. In case the target vector is too small for a
+// parallel execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpBcsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         bcsrmvSubAssign( ~lhs, A, x, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a block compressed matrix/dense
+//        matrix multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// block compressed matrix/dense matrix multiplication. The block rows of the matrix are distributed
+// among the threads such that each thread processes approximately the same number of non-zero
+// blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<MT1,MT,MT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmmAssign<MT1,MT,MT2>, ~lhs, A, B, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a block compressed
+//        matrix/dense matrix multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of a block compressed
+// matrix/dense matrix multiplication. In case the target matrix is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmmAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a block compressed
+//        matrix/dense matrix multiplication (\f$ C+=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a block compressed matrix/dense matrix multiplication. The block rows of the matrix
+// are distributed among the threads such that each thread processes approximately the same number
+// of non-zero blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmAddAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<MT1,MT,MT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmmAddAssign<MT1,MT,MT2>, ~lhs, A, B, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a block
+//        compressed matrix/dense matrix multiplication (\f$ C+=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP addition assignment of a block compressed
+// matrix/dense matrix multiplication. In case the target matrix is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmAddAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmAddAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmmAddAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a block compressed
+//        matrix/dense matrix multiplication (\f$ C-=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a block compressed matrix/dense matrix multiplication. The block rows of the matrix
+// are distributed among the threads such that each thread processes approximately the same number
+// of non-zero blocks and updates a contiguous range of rows of the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+void smpBcsrmmSubAssign_backend( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef BCSRTask<MT1,MT,MT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( bcsrPartition( A, threads, i     ) );
+      const size_t last ( bcsrPartition( A, threads, i+1UL ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &bcsrmmSubAssign<MT1,MT,MT2>, ~lhs, A, B, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a block
+//        compressed matrix/dense matrix multiplication (\f$ C-=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP subtraction assignment of a block
+// compressed matrix/dense matrix multiplication. In case the target matrix is too small for a
+// parallel execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT    // Type of the block compressed matrix
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void smpBcsrmmSubAssign( DenseMatrix<MT1,false>& lhs, const MT& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows() == A.rows(), "Invalid matrix sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).rows() <= SMP_SMATDMATMULT_THRESHOLD ) {
+         bcsrmmSubAssign( ~lhs, A, B, 0UL, A.blockRows() );
+      }
+      else {
+         smpBcsrmmSubAssign_backend( ~lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Batch.h
+//  \brief Header file for the C++11/Boost thread-based batch SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_BATCH_H_
+#define _BLAZE_MATH_SMP_THREADS_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/views/SubBatch.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a batch
+// to a batch. The batch members are distributed uniformly among the threads in multiples of
+// complete blocks of interleaved members.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+void smpAssign_backend( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename BT1::ElementType>  IT;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( smpPartition( n, threads, i, IT::size, uniformWorkload ) );
+      const size_t size ( smpPartition( n, threads, i+1UL, IT::size, uniformWorkload ) - index );
+
+      if( size == 0UL )
+         continue;
+
+      SubBatch<BT1> target( subbatch( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAssign( target, subbatch( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be assigned.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition assignment of a batch
+// to a batch. The batch members are distributed uniformly among the threads in multiples of
+// complete blocks of interleaved members.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+void smpAddAssign_backend( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename BT1::ElementType>  IT;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( smpPartition( n, threads, i, IT::size, uniformWorkload ) );
+      const size_t size ( smpPartition( n, threads, i+1UL, IT::size, uniformWorkload ) - index );
+
+      if( size == 0UL )
+         continue;
+
+      SubBatch<BT1> target( subbatch( ~lhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( target, subbatch( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be added.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP addition assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpAddAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         addAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAddAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction assignment of a batch
+// to a batch. The batch members are distributed uniformly among the threads in multiples of
+// complete blocks of interleaved members.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+void smpSubAssign_backend( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename BT1::ElementType>  IT;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( smpPartition( n, threads, i, IT::size, uniformWorkload ) );
+      const size_t size ( smpPartition( n, threads, i+1UL, IT::size, uniformWorkload ) - index );
+
+      if( size == 0UL )
+         continue;
+
+      SubBatch<BT1> target( subbatch( ~lhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( target, subbatch( ~rhs, index, size ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a batch to a batch.
+// \ingroup smp
+//
+// \param lhs The target left-hand side batch.
+// \param rhs The right-hand side batch to be subtracted.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP subtraction assignment of a batch to a batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename BT1    // Type of the left-hand side batch
+        , typename BT2 >  // Type of the right-hand side batch
+inline void smpSubAssign( Batch<BT1>& lhs, const Batch<BT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid batch sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpSubAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
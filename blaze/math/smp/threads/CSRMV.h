@@ -0,0 +1,840 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/CSRMV.h
+//  \brief Header file for the C++11/Boost thread-based CSR/CSC matrix/vector SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_CSRMV_H_
+#define _BLAZE_MATH_SMP_THREADS_CSRMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/CSRMV.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS CSRMVTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded computation of a range of rows or columns of a sparse
+//        matrix/dense vector multiplication.
+// \ingroup smp
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+struct CSRMVTask
+{
+   //**Type definitions****************************************************************************
+   //! Type of the multiplication kernel.
+   typedef void (*Kernel)( VT1&, const MT&, const VT2&, size_t, size_t );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CSRMVTask class template.
+   //
+   // \param kernel The multiplication kernel to be executed.
+   // \param y The target dense vector.
+   // \param A The left-hand side sparse matrix.
+   // \param x The right-hand side dense vector.
+   // \param first The index of the first row/column to be computed.
+   // \param last The index one past the last row/column to be computed.
+   */
+   explicit inline CSRMVTask( Kernel kernel, VT1& y, const MT& A, const VT2& x,
+                              size_t first, size_t last )
+      : kernel_( kernel )  // The multiplication kernel
+      , y_     ( &y )      // The target dense vector
+      , A_     ( &A )      // The left-hand side sparse matrix
+      , x_     ( &x )      // The right-hand side dense vector
+      , first_ ( first )   // The index of the first row/column
+      , last_  ( last )    // The index one past the last row/column
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of rows/columns.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      kernel_( *y_, *A_, *x_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel     kernel_;  //!< The multiplication kernel.
+   VT1*       y_;       //!< The target dense vector.
+   const MT*  A_;       //!< The left-hand side sparse matrix.
+   const VT2* x_;       //!< The right-hand side dense vector.
+   size_t     first_;   //!< The index of the first row/column.
+   size_t     last_;    //!< The index one past the last row/column.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS CSCMVREDUCETASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded combination of the partial products of a column-major sparse
+//        matrix/dense vector multiplication.
+// \ingroup smp
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2 > // Type of the partial dense vectors
+struct CSCMVReduceTask
+{
+   //**Type definitions****************************************************************************
+   //! Type of the reduction kernel.
+   typedef void (*Kernel)( VT1&, const std::vector<VT2>&, size_t, size_t );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CSCMVReduceTask class template.
+   //
+   // \param kernel The reduction kernel to be executed.
+   // \param y The target dense vector.
+   // \param partials The partial products to be combined.
+   // \param first The index of the first element to be computed.
+   // \param last The index one past the last element to be computed.
+   */
+   explicit inline CSCMVReduceTask( Kernel kernel, VT1& y, const std::vector<VT2>& partials,
+                                    size_t first, size_t last )
+      : kernel_  ( kernel )     // The reduction kernel
+      , y_       ( &y )         // The target dense vector
+      , partials_( &partials )  // The partial products
+      , first_   ( first )      // The index of the first element
+      , last_    ( last )       // The index one past the last element
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of elements.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      kernel_( *y_, *partials_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel                   kernel_;    //!< The reduction kernel.
+   VT1*                     y_;         //!< The target dense vector.
+   const std::vector<VT2>*  partials_;  //!< The partial products.
+   size_t                   first_;     //!< The index of the first element.
+   size_t                   last_;      //!< The index one past the last element.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major sparse matrix/dense
+//        vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// row-major sparse matrix/dense vector multiplication. The rows of the matrix are split into ranges
+// holding approximately the same number of non-zero elements, such that all threads perform
+// approximately the same amount of work.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CSRMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( &csrmvAssign<VT1,MT,VT2>, ~lhs, A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment of a row-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         smpCsrmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a row-major sparse matrix/dense vector multiplication. The rows of the matrix are
+// split into ranges holding approximately the same number of non-zero elements, such that all
+// threads perform approximately the same amount of work.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CSRMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( &csrmvAddAssign<VT1,MT,VT2>, ~lhs, A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a row-major
+//        sparse matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment of a row-major
+// sparse matrix/dense vector multiplication. In case the target vector is small or a serial section
+// is active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvAddAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         smpCsrmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT (CSR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a row-major sparse matrix/dense vector multiplication. The rows of the matrix are
+// split into ranges holding approximately the same number of non-zero elements, such that all
+// threads perform approximately the same amount of work.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCsrmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CSRMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( &csrmvSubAssign<VT1,MT,VT2>, ~lhs, A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a row-major
+//        sparse matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment of a row-major
+// sparse matrix/dense vector multiplication. In case the target vector is small or a serial section
+// is active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCsrmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         csrmvSubAssign( ~lhs, A, x, 0UL, A.rows() );
+      }
+      else {
+         smpCsrmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// column-major sparse matrix/dense vector multiplication. The columns of the matrix are split into
+// ranges holding approximately the same number of non-zero elements. Each range is multiplied into
+// a separate partial product, which are combined afterwards by distributing the elements of the
+// target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCscmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+   typedef CSRMVTask<PartialType,MT,VT2>                   PartialTask;
+   typedef CSCMVReduceTask<VT1,PartialType>                ReduceTask;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   std::vector<PartialType> partials( threads );
+
+   for( size_t i=0UL; i<threads; ++i ) {
+      partials[i].resize( n, false );
+      TheThreadBackend::schedule( PartialTask( &cscmvAssign<PartialType,MT,VT2>, partials[i], A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( n, threads, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, threads, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( ReduceTask( &cscmvReduceAssign<VT1,PartialType>, ~lhs, partials, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment of a column-major sparse
+// matrix/dense vector multiplication. In case the target vector is small or a serial section is
+// active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         smpCscmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major sparse
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a column-major sparse matrix/dense vector multiplication. The columns of the matrix
+// are split into ranges holding approximately the same number of non-zero elements. Each range is
+// multiplied into a separate partial product, which are combined afterwards by distributing the
+// elements of the target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCscmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+   typedef CSRMVTask<PartialType,MT,VT2>                   PartialTask;
+   typedef CSCMVReduceTask<VT1,PartialType>                ReduceTask;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   std::vector<PartialType> partials( threads );
+
+   for( size_t i=0UL; i<threads; ++i ) {
+      partials[i].resize( n, false );
+      TheThreadBackend::schedule( PartialTask( &cscmvAssign<PartialType,MT,VT2>, partials[i], A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( n, threads, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, threads, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( ReduceTask( &cscmvReduceAddAssign<VT1,PartialType>, ~lhs, partials, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a column-major
+//        sparse matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment of a column-major
+// sparse matrix/dense vector multiplication. In case the target vector is small or a serial section
+// is active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvAddAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         smpCscmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT (CSC)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
+//        sparse matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a column-major sparse matrix/dense vector multiplication. The columns of the matrix
+// are split into ranges holding approximately the same number of non-zero elements. Each range is
+// multiplied into a separate partial product, which are combined afterwards by distributing the
+// elements of the target vector evenly among the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpCscmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef DynamicVector<typename VT1::ElementType,false>  PartialType;
+   typedef CSRMVTask<PartialType,MT,VT2>                   PartialTask;
+   typedef CSCMVReduceTask<VT1,PartialType>                ReduceTask;
+
+   const size_t threads( TheThreadBackend::size() );
+   const size_t n      ( (~lhs).size() );
+
+   std::vector<size_t> bounds;
+   smpPartition( A, threads, bounds );
+
+   std::vector<PartialType> partials( threads );
+
+   for( size_t i=0UL; i<threads; ++i ) {
+      partials[i].resize( n, false );
+      TheThreadBackend::schedule( PartialTask( &cscmvAssign<PartialType,MT,VT2>, partials[i], A, x, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( n, threads, i    , 1UL, uniformWorkload ) );
+      const size_t last ( smpPartition( n, threads, i+1UL, 1UL, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( ReduceTask( &cscmvReduceSubAssign<VT1,PartialType>, ~lhs, partials, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a
+//        column-major sparse matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment of a
+// column-major sparse matrix/dense vector multiplication. In case the target vector is small or a
+// serial section is active, the product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpCscmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_TSMATDVECMULT_THRESHOLD ) {
+         cscmvSubAssign( ~lhs, A, x, 0UL, A.columns() );
+      }
+      else {
+         smpCscmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,6 +48,7 @@
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/Workload.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubvector.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
@@ -109,21 +110,18 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t   threads  ( TheThreadBackend::size() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -331,21 +329,18 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t   threads  ( TheThreadBackend::size() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -554,21 +549,18 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t   threads  ( TheThreadBackend::size() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -778,21 +770,18 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t   threads  ( TheThreadBackend::size() );
+   const size_t   alignment( vectorizable ? static_cast<size_t>( IT::size ) : 1UL );
+   const Workload workload ( static_cast<Workload>( ElementWorkload<VT2>::value ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( smpPartition( (~lhs).size(), threads, i, alignment, workload ) );
+      const size_t size ( smpPartition( (~lhs).size(), threads, i+1UL, alignment, workload ) - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
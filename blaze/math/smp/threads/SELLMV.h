@@ -0,0 +1,432 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SELLMV.h
+//  \brief Header file for the C++11/Boost thread-based sliced ELLPACK SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SELLMV_H_
+#define _BLAZE_MATH_SMP_THREADS_SELLMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/SELLMV.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SELLMVTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded computation of a range of chunks of a sliced ELLPACK
+//        matrix/dense vector multiplication.
+// \ingroup smp
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+struct SELLMVTask
+{
+   //**Type definitions****************************************************************************
+   //! Type of the multiplication kernel.
+   typedef void (*Kernel)( VT1&, const MT&, const VT2&, size_t, size_t );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SELLMVTask class template.
+   //
+   // \param kernel The multiplication kernel to be executed.
+   // \param y The target dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix.
+   // \param x The right-hand side dense vector.
+   // \param first The index of the first chunk to be computed.
+   // \param last The index one past the last chunk to be computed.
+   */
+   explicit inline SELLMVTask( Kernel kernel, VT1& y, const MT& A, const VT2& x,
+                               size_t first, size_t last )
+      : kernel_( kernel )  // The multiplication kernel
+      , y_     ( &y )      // The target dense vector
+      , A_     ( &A )      // The left-hand side sliced ELLPACK matrix
+      , x_     ( &x )      // The right-hand side dense vector
+      , first_ ( first )   // The index of the first chunk
+      , last_  ( last )    // The index one past the last chunk
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of chunks.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      kernel_( *y_, *A_, *x_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel     kernel_;  //!< The multiplication kernel.
+   VT1*       y_;       //!< The target dense vector.
+   const MT*  A_;       //!< The left-hand side sliced ELLPACK matrix.
+   const VT2* x_;       //!< The right-hand side dense vector.
+   size_t     first_;   //!< The index of the first chunk.
+   size_t     last_;    //!< The index one past the last chunk.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// a sliced ELLPACK matrix/dense vector multiplication. The chunks of the matrix are distributed
+// uniformly among the threads in multiples of complete sorting windows, such that each thread
+// updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SELLMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads  ( TheThreadBackend::size() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &sellmvAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP assignment of a sliced ELLPACK
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+         smpSellmvAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a sliced ELLPACK matrix/dense vector multiplication. The chunks of the matrix are
+// distributed uniformly among the threads in multiples of complete sorting windows, such that each
+// thread updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvAddAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SELLMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads  ( TheThreadBackend::size() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &sellmvAddAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP addition assignment of a sliced ELLPACK
+// matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvAddAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvAddAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+         smpSellmvAddAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a sliced ELLPACK
+//        matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a sliced ELLPACK matrix/dense vector multiplication. The chunks of the matrix are
+// distributed uniformly among the threads in multiples of complete sorting windows, such that each
+// thread updates a contiguous block of the target vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void smpSellmvSubAssign_backend( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SELLMVTask<VT1,MT,VT2>  Task;
+
+   const size_t threads  ( TheThreadBackend::size() );
+   const size_t chunks   ( A.chunks() );
+   const size_t alignment( A.sigma() / MT::chunkSize );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t first( smpPartition( chunks, threads, i    , alignment, uniformWorkload ) );
+      const size_t last ( smpPartition( chunks, threads, i+1UL, alignment, uniformWorkload ) );
+
+      if( first == last )
+         continue;
+
+      TheThreadBackend::schedule( Task( &sellmvSubAssign<VT1,MT,VT2>, ~lhs, A, x, first, last ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment of a sliced
+//        ELLPACK matrix/dense vector multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP subtraction assignment of a sliced
+// ELLPACK matrix/dense vector multiplication. In case the target vector is too small for a parallel
+// execution, the multiplication is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void smpSellmvSubAssign( DenseVector<VT1,false>& lhs, const MT& A, const VT2& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == A.rows(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~lhs).size() <= SMP_SMATDVECMULT_THRESHOLD ) {
+         sellmvSubAssign( ~lhs, A, x, 0UL, A.chunks() );
+      }
+      else {
+         smpSellmvSubAssign_backend( ~lhs, A, x );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,488 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SpGEMM.h
+//  \brief Header file for the C++11/Boost thread-based SpGEMM SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPGEMM_H_
+#define _BLAZE_MATH_SMP_THREADS_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SpGEMM.h>
+#include <blaze/math/sparse/SpGEMMPlan.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPGEMMSYMBOLICTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded symbolic phase of a sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+*/
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2 > // Type of the right-hand side sparse matrix
+struct SpGEMMSymbolicTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMSymbolicTask class template.
+   //
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param flops The number of scalar products per row.
+   // \param nonzeros The resulting number of non-zero elements per row.
+   // \param first The index of the first row to be computed.
+   // \param last The index one past the last row to be computed.
+   */
+   explicit inline SpGEMMSymbolicTask( const MT1& A, const MT2& B, const std::vector<size_t>& flops,
+                                       std::vector<size_t>& nonzeros, size_t first, size_t last )
+      : A_       ( &A )         // The left-hand side sparse matrix
+      , B_       ( &B )         // The right-hand side sparse matrix
+      , flops_   ( &flops )     // The number of scalar products per row
+      , nonzeros_( &nonzeros )  // The number of non-zero elements per row
+      , first_   ( first )      // The index of the first row
+      , last_    ( last )       // The index one past the last row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the number of non-zero elements of the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      spgemmSymbolic( *A_, *B_, *flops_, *nonzeros_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT1*                  A_;         //!< The left-hand side sparse matrix.
+   const MT2*                  B_;         //!< The right-hand side sparse matrix.
+   const std::vector<size_t>*  flops_;     //!< The number of scalar products per row.
+   std::vector<size_t>*        nonzeros_;  //!< The number of non-zero elements per row.
+   size_t                      first_;     //!< The index of the first row.
+   size_t                      last_;      //!< The index one past the last row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPGEMMNUMERICTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded numeric phase of a sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+*/
+template< typename MT3   // Type of the target sparse matrix
+        , typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2 > // Type of the right-hand side sparse matrix
+struct SpGEMMNumericTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMNumericTask class template.
+   //
+   // \param C The target sparse matrix.
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param flops The number of scalar products per row.
+   // \param first The index of the first row to be computed.
+   // \param last The index one past the last row to be computed.
+   */
+   explicit inline SpGEMMNumericTask( MT3& C, const MT1& A, const MT2& B,
+                                      const std::vector<size_t>& flops, size_t first, size_t last )
+      : C_    ( &C )      // The target sparse matrix
+      , A_    ( &A )      // The left-hand side sparse matrix
+      , B_    ( &B )      // The right-hand side sparse matrix
+      , flops_( &flops )  // The number of scalar products per row
+      , first_( first )   // The index of the first row
+      , last_ ( last )    // The index one past the last row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      spgemmNumeric( *C_, *A_, *B_, *flops_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT3*                        C_;      //!< The target sparse matrix.
+   const MT1*                  A_;      //!< The left-hand side sparse matrix.
+   const MT2*                  B_;      //!< The right-hand side sparse matrix.
+   const std::vector<size_t>*  flops_;  //!< The number of scalar products per row.
+   size_t                      first_;  //!< The index of the first row.
+   size_t                      last_;   //!< The index one past the last row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPGEMMPLANTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded numeric phase of a plan-based sparse matrix/sparse matrix
+//        multiplication.
+// \ingroup smp
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+struct SpGEMMPlanTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMPlanTask class template.
+   //
+   // \param C The resulting sparse matrix.
+   // \param plan The precomputed structure of the multiplication.
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param first The index of the first row to be computed.
+   // \param last The index one past the last row to be computed.
+   */
+   explicit inline SpGEMMPlanTask( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+                                   const CompressedMatrix<T1,false>& A,
+                                   const CompressedMatrix<T2,false>& B, size_t first, size_t last )
+      : C_    ( &C )     // The resulting sparse matrix
+      , plan_ ( &plan )  // The precomputed structure of the multiplication
+      , A_    ( &A )     // The left-hand side sparse matrix
+      , B_    ( &B )     // The right-hand side sparse matrix
+      , first_( first )  // The index of the first row
+      , last_ ( last )   // The index one past the last row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      plan_->assign( *C_, *A_, *B_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   CompressedMatrix<Type,false>*      C_;      //!< The resulting sparse matrix.
+   const SpGEMMPlan*                  plan_;   //!< The structure of the multiplication.
+   const CompressedMatrix<T1,false>*  A_;      //!< The left-hand side sparse matrix.
+   const CompressedMatrix<T2,false>*  B_;      //!< The right-hand side sparse matrix.
+   size_t                             first_;  //!< The index of the first row.
+   size_t                             last_;   //!< The index one past the last row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse matrix
+//        multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// a sparse matrix/sparse matrix multiplication. The rows are split into ranges with approximately
+// the same number of scalar products. In a first parallel phase the exact number of non-zero
+// elements of each row is determined, which is used to lay out the rows of the target matrix.
+// In a second parallel phase all rows are computed and written directly into their final
+// position.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the target sparse matrix
+        , typename Index  // Index type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void smpSpgemmAssign_backend( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SpGEMMSymbolicTask<MT1,MT2>                                   SymbolicTask;
+   typedef SpGEMMNumericTask<CompressedMatrix<Type,false,Index>,MT1,MT2>  NumericTask;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> flops;
+   spgemmFlops( A, B, flops );
+
+   std::vector<size_t> bounds;
+   smpPartition( flops, threads, bounds );
+
+   std::vector<size_t> nonzeros( A.rows() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( SymbolicTask( A, B, flops, nonzeros, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   lhs.reset();
+   lhs.reserve( nonzeros );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( NumericTask( lhs, A, B, flops, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse
+//        matrix multiplication (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse
+// matrix multiplication. In case the target matrix is small or a serial section is active, the
+// product is computed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the target sparse matrix
+        , typename Index  // Index type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void smpSpgemmAssign( CompressedMatrix<Type,false,Index>& lhs, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == B.columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || A.rows() <= SMP_SMATSMATMULT_THRESHOLD ) {
+         spgemmAssign( lhs, A, B );
+      }
+      else {
+         smpSpgemmAssign_backend( lhs, A, B );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAN-BASED MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based numeric phase of a sparse matrix/sparse matrix
+//        multiplication based on a precomputed plan.
+// \ingroup smp
+//
+// \param C The resulting row-major sparse matrix.
+// \param plan The precomputed structure of the multiplication.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based numeric phase
+// of a plan-based sparse matrix/sparse matrix multiplication. The rows are split into ranges
+// with approximately the same number of scalar products, whose values are written by the
+// threads into the laid out resulting matrix.\n
+// This function must \b NOT be called explicitly! It is used internally by the multiply()
+// function. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void smpSpgemmPlan_backend( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+                            const CompressedMatrix<T1,false>& A,
+                            const CompressedMatrix<T2,false>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef SpGEMMPlanTask<Type,T1,T2>  Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> products( plan.rows() );
+   for( size_t i=0UL; i<plan.rows(); ++i ) {
+      products[i] = plan.products(i);
+   }
+
+   std::vector<size_t> bounds;
+   smpPartition( products, threads, bounds );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( C, plan, A, B, bounds[i], bounds[i+1UL] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication based on a precomputed
+//        plan (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The resulting row-major sparse matrix.
+// \param plan The precomputed structure of the multiplication.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrices do not match the plan.
+//
+// This function computes the product \f$ A*B \f$ based on the given SpGEMMPlan. In case \a C
+// doesn't contain the sparsity pattern of the plan yet, it is laid out first. Afterwards only
+// the values of the non-zero elements of \a C are overwritten. The rows are computed in parallel
+// by the C++11/Boost threads. In case the resulting matrix is small or a serial section is
+// active, the rows are computed serially.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void multiply( CompressedMatrix<Type,false>& C, const SpGEMMPlan& plan,
+               const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !plan.isCompatible( A, B ) )
+      throw std::invalid_argument( "Matrices do not match the SpGEMM plan" );
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      CompressedMatrix<Type,false> tmp;
+      multiply( tmp, plan, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   plan.layout( C );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || plan.rows() <= SMP_SMATSMATMULT_THRESHOLD ) {
+         plan.assign( C, A, B, 0UL, plan.rows() );
+      }
+      else {
+         smpSpgemmPlan_backend( C, plan, A, B );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
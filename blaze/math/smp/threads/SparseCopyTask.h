@@ -0,0 +1,121 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseCopyTask.h
+//  \brief Header file for the SparseCopyTask class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSECOPYTASK_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSECOPYTASK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPARSECOPYTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded copy of an evaluated part into a compressed matrix.
+// \ingroup smp
+//
+// The SparseCopyTask appends the rows (for row-major matrices) or columns (for column-major
+// matrices) of an evaluated part (see the SparsePartTask class template) to the corresponding
+// rows/columns of the target compressed matrix, starting at the given offset. The capacities
+// of all rows/columns of the target must have been set in advance (see the reserve() function
+// of the CompressedMatrix class template). Since only the rows/columns of the part are modified,
+// the parts can be copied concurrently.
+*/
+template< typename MT    // Type of the target compressed matrix
+        , typename PT >  // Type of the compressed part
+struct SparseCopyTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename PT::ConstIterator  ConstIterator;  //!< Iterator over the elements of the part.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseCopyTask class template.
+   //
+   // \param target The target compressed matrix.
+   // \param part The evaluated part to be copied.
+   // \param offset The index of the first row/column of the part within the target.
+   */
+   explicit inline SparseCopyTask( MT& target, const PT& part, size_t offset )
+      : target_( &target )  // The target compressed matrix
+      , part_  ( &part   )  // The evaluated part
+      , offset_( offset  )  // The index of the first row/column
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Copies the part into the target matrix.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      const size_t n( IsRowMajorMatrix<PT>::value ? part_->rows() : part_->columns() );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         const ConstIterator end( part_->end(k) );
+         for( ConstIterator element=part_->begin(k); element!=end; ++element ) {
+            if( IsRowMajorMatrix<MT>::value )
+               target_->append( offset_+k, element->index(), element->value() );
+            else
+               target_->append( element->index(), offset_+k, element->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT*       target_;  //!< The target compressed matrix.
+   const PT* part_;    //!< The evaluated part.
+   size_t    offset_;  //!< The index of the first row/column of the part.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,953 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h
+//  \brief Header file for the C++11/Boost thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/SparseCopyTask.h>
+#include <blaze/math/smp/threads/SparseMergeTask.h>
+#include <blaze/math/smp/threads/SparsePartTask.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/Workload.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the boundaries of the parts of an SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param rhs The right-hand side row-major sparse matrix.
+// \param parts The number of parts (i.e. the number of threads).
+// \param bounds The resulting \a parts+1 boundaries of the parts.
+// \return void
+//
+// This function splits the rows (for \a SO equal to \a rowMajor) or the columns (for \a SO
+// equal to \a columnMajor) of the right-hand side operand into \a parts consecutive ranges.
+// In case the storage order of the sparse right-hand side operand matches \a SO the ranges
+// hold approximately the same number of non-zero elements.
+*/
+template< bool SO        // Partitioned storage order
+        , typename MT >  // Type of the right-hand side sparse matrix
+inline typename EnableIfTrue< !SO >::Type
+   smpSparsePartition( const SparseMatrix<MT,rowMajor>& rhs, size_t parts, std::vector<size_t>& bounds )
+{
+   smpPartition( ~rhs, parts, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the boundaries of the parts of an SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param rhs The right-hand side column-major sparse matrix.
+// \param parts The number of parts (i.e. the number of threads).
+// \param bounds The resulting \a parts+1 boundaries of the parts.
+// \return void
+//
+// This function splits the rows (for \a SO equal to \a rowMajor) or the columns (for \a SO
+// equal to \a columnMajor) of the right-hand side operand into \a parts consecutive ranges.
+// In case the storage order of the sparse right-hand side operand matches \a SO the ranges
+// hold approximately the same number of non-zero elements.
+*/
+template< bool SO        // Partitioned storage order
+        , typename MT >  // Type of the right-hand side sparse matrix
+inline typename EnableIfTrue< SO >::Type
+   smpSparsePartition( const SparseMatrix<MT,columnMajor>& rhs, size_t parts, std::vector<size_t>& bounds )
+{
+   smpPartition( ~rhs, parts, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the boundaries of the parts of an SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param rhs The right-hand side matrix.
+// \param parts The number of parts (i.e. the number of threads).
+// \param bounds The resulting \a parts+1 boundaries of the parts.
+// \return void
+//
+// This function splits the rows (for \a SO equal to \a rowMajor) or the columns (for \a SO
+// equal to \a columnMajor) of the right-hand side operand into \a parts consecutive ranges of
+// (almost) equal size.
+*/
+template< bool SO        // Partitioned storage order
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void smpSparsePartition( const Matrix<MT,SO2>& rhs, size_t parts, std::vector<size_t>& bounds )
+{
+   const size_t n( ( SO )?( (~rhs).columns() ):( (~rhs).rows() ) );
+
+   bounds.resize( parts+1UL );
+
+   for( size_t i=0UL; i<=parts; ++i ) {
+      bounds[i] = smpPartition( n, parts, i, 1UL, uniformWorkload );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP evaluation of the parts of a matrix into
+//        row-major compressed matrices.
+// \ingroup smp
+//
+// \param parts The resulting row-major compressed parts.
+// \param bounds The resulting boundaries of the parts.
+// \param rhs The right-hand side matrix to be evaluated.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP evaluation
+// of the parts of a matrix into row-major compressed matrices. The rows of the right-hand side
+// operand are distributed among the threads (balanced by the number of non-zero elements in
+// case \a rhs is a row-major sparse matrix) and each thread evaluates its rows into a separate
+// compressed matrix. Part \a i holds the rows \f$ [bounds[i]..bounds[i+1]) \f$.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed parts
+        , typename Index  // Index type of the compressed parts
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO >       // Storage order of the right-hand side matrix
+void smpEvaluateParts_backend( std::vector< CompressedMatrix<Type,rowMajor,Index> >& parts,
+                               std::vector<size_t>& bounds, const Matrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,rowMajor,Index>                PartType;
+   typedef typename SubmatrixExprTrait<const MT,unaligned>::Type  Source;
+   typedef SparsePartTask<PartType,Source>                      Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   smpSparsePartition<rowMajor>( ~rhs, threads, bounds );
+
+   parts.resize( threads );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t row( bounds[i] );
+      const size_t m  ( bounds[i+1UL] - row );
+
+      if( m == 0UL )
+         continue;
+
+      TheThreadBackend::schedule( Task( parts[i], submatrix<unaligned>( ~rhs, row, 0UL, m, (~rhs).columns() ) ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP evaluation of the parts of a matrix into
+//        column-major compressed matrices.
+// \ingroup smp
+//
+// \param parts The resulting column-major compressed parts.
+// \param bounds The resulting boundaries of the parts.
+// \param rhs The right-hand side matrix to be evaluated.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP evaluation
+// of the parts of a matrix into column-major compressed matrices. The columns of the right-hand
+// side operand are distributed among the threads (balanced by the number of non-zero elements
+// in case \a rhs is a column-major sparse matrix) and each thread evaluates its columns into a
+// separate compressed matrix. Part \a i holds the columns \f$ [bounds[i]..bounds[i+1]) \f$.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed parts
+        , typename Index  // Index type of the compressed parts
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO >       // Storage order of the right-hand side matrix
+void smpEvaluateParts_backend( std::vector< CompressedMatrix<Type,columnMajor,Index> >& parts,
+                               std::vector<size_t>& bounds, const Matrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,columnMajor,Index>             PartType;
+   typedef typename SubmatrixExprTrait<const MT,unaligned>::Type  Source;
+   typedef SparsePartTask<PartType,Source>                      Task;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   smpSparsePartition<columnMajor>( ~rhs, threads, bounds );
+
+   parts.resize( threads );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1UL] - column );
+
+      if( n == 0UL )
+         continue;
+
+      TheThreadBackend::schedule( Task( parts[i], submatrix<unaligned>( ~rhs, 0UL, column, (~rhs).rows(), n ) ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP evaluation of a matrix into a compressed
+//        matrix.
+// \ingroup smp
+//
+// \param result The target compressed matrix.
+// \param rhs The right-hand side matrix to be evaluated.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP evaluation
+// of a matrix into a compressed matrix. The parts of the right-hand side operand are evaluated
+// in parallel by means of the smpEvaluateParts_backend() functions. Afterwards the capacities
+// of all rows/columns of the (empty) \a result matrix are set at once from the numbers of
+// non-zero elements of the parts and each thread copies its part into its rows/columns.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed matrix
+        , bool SO1        // Storage order of the compressed matrix
+        , typename Index  // Index type of the compressed matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void smpEvaluate_backend( CompressedMatrix<Type,SO1,Index>& result, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( result.rows()     == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( result.columns()  == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( result.nonZeros() == 0UL             , "Invalid non-zero elements" );
+
+   typedef CompressedMatrix<Type,SO1,Index>        ResultType;
+   typedef SparseCopyTask<ResultType,ResultType>  Task;
+
+   std::vector<ResultType> parts;
+   std::vector<size_t> bounds;
+   smpEvaluateParts_backend( parts, bounds, ~rhs );
+
+   std::vector<size_t> nonzeros( bounds.back() );
+
+   for( size_t i=0UL; i<parts.size(); ++i ) {
+      for( size_t k=bounds[i]; k<bounds[i+1UL]; ++k ) {
+         nonzeros[k] = parts[i].nonZeros( k-bounds[i] );
+      }
+   }
+
+   result.reserve( nonzeros );
+
+   for( size_t i=0UL; i<parts.size(); ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( result, parts[i], bounds[i] ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition/subtraction of a matrix to/from
+//        a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be added/subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition (or
+// in case \a SUB is \a true the subtraction) of a matrix to/from a compressed matrix. The parts
+// of the right-hand side operand are evaluated in parallel by means of the
+// smpEvaluateParts_backend() functions. Afterwards the capacities of all rows/columns of the
+// result are set at once and each thread merges its part with the according rows/columns of
+// the target matrix. Finally the result is swapped into \a lhs.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< bool SUB        // Subtraction flag
+        , typename Type   // Data type of the compressed matrix
+        , bool SO1        // Storage order of the compressed matrix
+        , typename Index  // Index type of the compressed matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void smpMerge_backend( CompressedMatrix<Type,SO1,Index>& lhs, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef CompressedMatrix<Type,SO1,Index>              ResultType;
+   typedef SparseMergeTask<ResultType,ResultType,SUB>  Task;
+
+   std::vector<ResultType> parts;
+   std::vector<size_t> bounds;
+   smpEvaluateParts_backend( parts, bounds, ~rhs );
+
+   std::vector<size_t> nonzeros( bounds.back() );
+
+   for( size_t i=0UL; i<parts.size(); ++i ) {
+      for( size_t k=bounds[i]; k<bounds[i+1UL]; ++k ) {
+         nonzeros[k] = lhs.nonZeros(k) + parts[i].nonZeros( k-bounds[i] );
+      }
+   }
+
+   ResultType result( lhs.rows(), lhs.columns() );
+   result.reserve( nonzeros );
+
+   for( size_t i=0UL; i<parts.size(); ++i )
+   {
+      if( bounds[i] == bounds[i+1UL] )
+         continue;
+
+      TheThreadBackend::schedule( Task( result, lhs, parts[i], bounds[i] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   lhs.swap( result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a matrix to a sparse matrix. The right-hand side operand is evaluated in parallel by
+// means of the smpEvaluate_backend() function and the result is assigned to the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   CompressedMatrix<typename MT1::ElementType,SO1> tmp( (~rhs).rows(), (~rhs).columns() );
+   smpEvaluate_backend( tmp, ~rhs );
+
+   reset( ~lhs );
+   (~lhs).reserve( tmp.nonZeros() );
+   assign( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a
+//        compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a matrix to a compressed matrix. The right-hand side operand is evaluated in parallel
+// directly into the target by means of the smpEvaluate_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed matrix
+        , bool SO1        // Storage order of the compressed matrix
+        , typename Index  // Index type of the compressed matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void smpAssign_backend( CompressedMatrix<Type,SO1,Index>& lhs, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   lhs.reset();
+   smpEvaluate_backend( lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case either of the two operands is not SMP-assignable or the
+// target matrix is not resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , Or< Not< IsResizable<MT1> >
+                                 , Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the target matrix is resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , IsResizable<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a matrix to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a matrix to a sparse matrix. The right-hand side operand is evaluated in
+// parallel by means of the smpEvaluate_backend() function and the result is added to the
+// target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAddAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   CompressedMatrix<typename MT1::ElementType,SO1> tmp( (~rhs).rows(), (~rhs).columns() );
+   smpEvaluate_backend( tmp, ~rhs );
+
+   addAssign( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a matrix to a
+//        compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP addition
+// assignment of a matrix to a compressed matrix. The right-hand side operand is evaluated in
+// parallel and each thread adds its part to the according rows/columns of the target by means
+// of the smpMerge_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed matrix
+        , bool SO1        // Storage order of the compressed matrix
+        , typename Index  // Index type of the compressed matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void smpAddAssign_backend( CompressedMatrix<Type,SO1,Index>& lhs, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   smpMerge_backend<false>( lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP addition assignment to a
+// sparse matrix. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case either of the two operands is not SMP-assignable or
+// the target matrix is not resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , Or< Not< IsResizable<MT1> >
+                                 , Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the target matrix is
+// resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , IsResizable<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         addAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpAddAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a matrix to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a matrix to a sparse matrix. The right-hand side operand is evaluated in
+// parallel by means of the smpEvaluate_backend() function and the result is subtracted from
+// the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpSubAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   CompressedMatrix<typename MT1::ElementType,SO1> tmp( (~rhs).rows(), (~rhs).columns() );
+   smpEvaluate_backend( tmp, ~rhs );
+
+   subAssign( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a matrix to a
+//        compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
+// assignment of a matrix to a compressed matrix. The right-hand side operand is evaluated in
+// parallel and each thread subtracts its part from the according rows/columns of the target
+// by means of the smpMerge_backend() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the compressed matrix
+        , bool SO1        // Storage order of the compressed matrix
+        , typename Index  // Index type of the compressed matrix
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void smpSubAssign_backend( CompressedMatrix<Type,SO1,Index>& lhs, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   smpMerge_backend<true>( lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP subtraction assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP subtraction assignment to
+// a sparse matrix. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case either of the two operands is not SMP-assignable or
+// the target matrix is not resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , Or< Not< IsResizable<MT1> >
+                                 , Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the target matrix is
+// resizable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , IsResizable<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+         smpSubAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,170 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMergeTask.h
+//  \brief Header file for the SparseMergeTask class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMERGETASK_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMERGETASK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPARSEMERGETASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded merge of an evaluated part with a compressed matrix.
+// \ingroup smp
+//
+// The SparseMergeTask computes the sum (or in case \a SUB is \a true the difference) of the
+// rows/columns of the given compressed matrix and the rows/columns of an evaluated part (see
+// the SparsePartTask class template) and appends the result to the corresponding rows/columns
+// of the target compressed matrix, starting at the given offset. The capacities of all
+// rows/columns of the target must have been set in advance (see the reserve() function of
+// the CompressedMatrix class template). Since only the rows/columns of the part are modified,
+// the parts can be merged concurrently.
+*/
+template< typename MT   // Type of the compressed matrices
+        , typename PT   // Type of the compressed part
+        , bool SUB >    // Subtraction flag
+struct SparseMergeTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT::ConstIterator  LeftIterator;   //!< Iterator over the elements of the matrix.
+   typedef typename PT::ConstIterator  RightIterator;  //!< Iterator over the elements of the part.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseMergeTask class template.
+   //
+   // \param target The target compressed matrix.
+   // \param lhs The left-hand side compressed matrix.
+   // \param part The evaluated part to be added/subtracted.
+   // \param offset The index of the first row/column of the part within the target.
+   */
+   explicit inline SparseMergeTask( MT& target, const MT& lhs, const PT& part, size_t offset )
+      : target_( &target )  // The target compressed matrix
+      , lhs_   ( &lhs    )  // The left-hand side compressed matrix
+      , part_  ( &part   )  // The evaluated part
+      , offset_( offset  )  // The index of the first row/column
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Merges the part with the according rows/columns of the left-hand side matrix.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      const size_t n( IsRowMajorMatrix<PT>::value ? part_->rows() : part_->columns() );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t i( offset_+k );
+
+         const LeftIterator  lend( lhs_->end(i) );
+         const RightIterator rend( part_->end(k) );
+
+         LeftIterator  l( lhs_->begin(i) );
+         RightIterator r( part_->begin(k) );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               append( i, l->index(), l->value() );
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               append( i, r->index(), SUB ? -r->value() : r->value() );
+               ++r;
+            }
+            else {
+               append( i, l->index(), SUB ? l->value() - r->value() : l->value() + r->value() );
+               ++l;
+               ++r;
+            }
+         }
+
+         for( ; l!=lend; ++l ) {
+            append( i, l->index(), l->value() );
+         }
+
+         for( ; r!=rend; ++r ) {
+            append( i, r->index(), SUB ? -r->value() : r->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Append function*****************************************************************************
+   /*!\brief Appends an element to the given row/column of the target matrix.
+   //
+   // \param i The index of the row/column of the target matrix.
+   // \param index The index of the element within the row/column.
+   // \param value The value of the element.
+   // \return void
+   */
+   template< typename Type >  // Data type of the element
+   inline void append( size_t i, size_t index, const Type& value ) {
+      if( IsRowMajorMatrix<MT>::value )
+         target_->append( i, index, value );
+      else
+         target_->append( index, i, value );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT*       target_;  //!< The target compressed matrix.
+   const MT* lhs_;     //!< The left-hand side compressed matrix.
+   const PT* part_;    //!< The evaluated part.
+   size_t    offset_;  //!< The index of the first row/column of the part.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,96 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparsePartTask.h
+//  \brief Header file for the SparsePartTask class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEPARTTASK_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEPARTTASK_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPARSEPARTTASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded evaluation of a part of a sparse matrix or sparse vector assignment.
+// \ingroup smp
+//
+// The SparsePartTask evaluates a range of rows/columns (or elements) of the right-hand side
+// operand of a sparse assignment into a separate compressed matrix (or vector). Since the
+// non-zero elements of a sparse matrix are stored contiguously, the threads cannot write into
+// a shared target. Instead, each part is evaluated independently and the parts are combined
+// afterwards.
+*/
+template< typename PT    // Type of the compressed part
+        , typename ST >  // Type of the source operand
+struct SparsePartTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparsePartTask class template.
+   //
+   // \param part The compressed matrix/vector receiving the evaluated part.
+   // \param source The part of the source operand to be evaluated.
+   */
+   explicit inline SparsePartTask( PT& part, const ST& source )
+      : part_  ( &part )   // The compressed part
+      , source_( source )  // The source operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluates the part.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      PT tmp( source_ );
+      part_->swap( tmp );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   PT*      part_;    //!< The compressed part.
+   const ST source_;  //!< The source operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
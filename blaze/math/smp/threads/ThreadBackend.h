@@ -41,23 +41,32 @@
 //*************************************************************************************************
 
 #if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
 #  include <condition_variable>
 #  include <mutex>
 #  include <thread>
 #elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/atomic.hpp>
 #  include <boost/thread/condition.hpp>
 #  include <boost/thread/mutex.hpp>
 #  include <boost/thread/thread.hpp>
 #endif
 
 #include <cstdlib>
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
 
 
 namespace blaze {
@@ -75,23 +84,40 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. Depending on the
+// BLAZE_USE_WORK_STEALING switch, the tasks are executed by a ThreadPool or a WorkStealingPool.\n
+// The backend system can be used concurrently by several threads. All tasks scheduled by a
+// particular thread are collected in a thread-specific task group, and the wait() function
+// only waits for the tasks of the calling thread. For every task, the thread pool receives a
+// small ticket referring to the task group, so the tasks of all threads are distributed via
+// the same (work-stealing) queues of the pool in the order of their submission. While waiting,
+// the calling thread itself executes the not yet started tasks of its own group. In case a
+// task fails with an exception, the remaining tasks of the group are still completed and the
+// exception is rethrown by the wait() function.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
-template< typename TT    // Type of the encapsulated thread
-        , typename MT    // Type of the synchronization mutex
-        , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
 class ThreadBackend
 {
  public:
+   //**Type definitions****************************************************************************
+   typedef MT  Mutex;      //!< Type of the mutex.
+   typedef LT  Lock;       //!< Type of a locking object.
+   typedef CT  Condition;  //!< Type of the condition variable.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size        ();
+   static inline void   resize      ( size_t n, bool block=false );
+   static inline void   wait        ();
+   static inline bool   isTaskActive();
    //@}
    //**********************************************************************************************
 
@@ -109,10 +135,70 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Task >
+   static inline void schedule( Task task );
+
+   template< typename Task >
+   static inline void scheduleDetached( Task task );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+#if BLAZE_USE_WORK_STEALING
+   typedef WorkStealingPool<TT,MT,LT,CT,AT>  Pool;  //!< Type of the thread pool.
+#else
+   typedef ThreadPool<TT,MT,LT,CT>           Pool;  //!< Type of the thread pool.
+#endif
+
+   typedef threadpool::TaskGroup<MT,LT,CT,AT>  TaskGroup;   //!< Type of a task group.
+   typedef boost::shared_ptr<TaskGroup>        GroupPtr;    //!< Shared pointer to a task group.
+   typedef std::vector<GroupPtr>               TaskGroups;  //!< Type of the task group container.
+   typedef std::vector<TaskGroup*>             IdleGroups;  //!< Type of the idle group container.
+   //**********************************************************************************************
+
+   //**Private class GroupTask*********************************************************************
+   /*!\brief Auxiliary functor for the execution of the tasks of a task group by the thread pool.
+   //
+   // For every task pushed into a task group a GroupTask is scheduled in the thread pool, which
+   // executes the next not yet started task of the group. In case all tasks of the group have
+   // already been started (for instance since the waiting thread executed them itself), the
+   // GroupTask returns immediately. Since such a GroupTask might still be pending after the
+   // backend system has been destroyed, it shares the ownership of the task group. While the
+   // task is executed, the executing thread is marked as busy (see the isTaskActive() function).
+   */
+   struct GroupTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the GroupTask class.
+      //
+      // \param group The task group to be served.
+      */
+      explicit inline GroupTask( const GroupPtr& group )
+         : group_( group )  // The task group to be served
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the next not yet started task of the task group.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         const bool active( active_ );
+         active_ = true;
+         group_->execute();
+         active_ = active;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      GroupPtr group_;  //!< The task group to be served.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Private class Assigner**********************************************************************
    /*!\brief Auxiliary functor for the threaded execution of a plain assignment.
    */
@@ -284,15 +370,32 @@ class ThreadBackend
    //@}
    //**********************************************************************************************
 
+   //**Task group functions************************************************************************
+   /*!\name Task group functions */
+   //@{
+   static inline TaskGroup* acquireGroup();
+   static inline void       releaseGroup( TaskGroup* group );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads. */
+
+   static Mutex      mutex_;   //!< Synchronization mutex for the management of the task groups.
+   static TaskGroups groups_;  //!< All task groups created by the backend system.
+   static IdleGroups idle_;    //!< The task groups currently not used by any thread.
+
+   static BLAZE_THREAD_LOCAL TaskGroup* group_;  //!< The task group of the calling thread.
+                                                /*!< The task group is assigned to a thread
+                                                     by the first scheduled task and released
+                                                     by the next call to the wait() function. */
+
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the execution of a group task.
    //@}
    //**********************************************************************************************
 };
@@ -310,8 +413,25 @@ class ThreadBackend
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+typename ThreadBackend<TT,MT,LT,CT,AT>::Pool
+   ThreadBackend<TT,MT,LT,CT,AT>::threadpool_( initPool() );
+
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+typename ThreadBackend<TT,MT,LT,CT,AT>::Mutex ThreadBackend<TT,MT,LT,CT,AT>::mutex_;
+
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+typename ThreadBackend<TT,MT,LT,CT,AT>::TaskGroups ThreadBackend<TT,MT,LT,CT,AT>::groups_;
+
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+typename ThreadBackend<TT,MT,LT,CT,AT>::IdleGroups ThreadBackend<TT,MT,LT,CT,AT>::idle_;
+
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+BLAZE_THREAD_LOCAL typename ThreadBackend<TT,MT,LT,CT,AT>::TaskGroup*
+   ThreadBackend<TT,MT,LT,CT,AT>::group_( 0 );
+
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+BLAZE_THREAD_LOCAL bool ThreadBackend<TT,MT,LT,CT,AT>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -330,11 +450,12 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 //
 // \return The total number of threads of the thread backend system.
 */
-template< typename TT    // Type of the encapsulated thread
-        , typename MT    // Type of the synchronization mutex
-        , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline size_t ThreadBackend<TT,MT,LT,CT>::size()
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline size_t ThreadBackend<TT,MT,LT,CT,AT>::size()
 {
    return threadpool_.size();
 }
@@ -358,11 +479,12 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // thrown. Via the \a block flag it is possible to block the function until the desired
 // number of threads is available.
 */
-template< typename TT    // Type of the encapsulated thread
-        , typename MT    // Type of the synchronization mutex
-        , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline void ThreadBackend<TT,MT,LT,CT,AT>::resize( size_t n, bool block )
 {
    return threadpool_.resize( n, block );
 }
@@ -372,19 +494,66 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Waiting for all scheduled tasks to be completed.
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks that have been scheduled by the calling thread have
+// been completed. Tasks scheduled by other threads are not waited for. While waiting, the
+// calling thread executes all not yet started tasks of its own task group. In case any of
+// the tasks of the calling thread has failed with an exception, the first of these exceptions
+// is rethrown after all tasks have been completed.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline void ThreadBackend<TT,MT,LT,CT,AT>::wait()
+{
+   TaskGroup* const group( group_ );
+
+   if( group == NULL )
+      return;
+
+   // Detaching the task group from the calling thread (tasks scheduled by the tasks executed
+   // during the wait belong to a new task group)
+   group_ = NULL;
+
+   // Executing the not yet started tasks of the own task group
+   while( group->execute() ) {}
+
+   // Waiting for the tasks of the own task group executed by other threads
+   const boost::exception_ptr error( group->wait() );
+
+   releaseGroup( group );
+
+   if( error )
+      boost::rethrow_exception( error );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread currently executes a task of the backend system.
+//
+// \return \a true in case the calling thread executes a task, \a false if not.
+//
+// This function returns \a true in case it is called from a worker thread of the thread pool
+// while the worker thread executes a task scheduled via the schedule() function (i.e. a part
+// of a parallel operation). Tasks scheduled via the scheduleDetached() function are not
+// considered.
 */
-template< typename TT    // Type of the encapsulated thread
-        , typename MT    // Type of the synchronization mutex
-        , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline void ThreadBackend<TT,MT,LT,CT>::wait()
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline bool ThreadBackend<TT,MT,LT,CT,AT>::isTaskActive()
 {
-   threadpool_.wait();
+   return active_;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -408,16 +577,17 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //
 // This function schedules a plain assignment of the two given operands for execution.
 */
-template< typename TT        // Type of the encapsulated thread
-        , typename MT        // Type of the synchronization mutex
-        , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
-template< typename Target    // Type of the target operand
-        , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   schedule( Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -433,16 +603,17 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const So
 //
 // This function schedules an addition assignment of the two given operands for execution.
 */
-template< typename TT        // Type of the encapsulated thread
-        , typename MT        // Type of the synchronization mutex
-        , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
-template< typename Target    // Type of the target operand
-        , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   schedule( AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -458,16 +629,17 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const
 //
 // This function schedules a subtraction assignment of the two given operands for execution.
 */
-template< typename TT        // Type of the encapsulated thread
-        , typename MT        // Type of the synchronization mutex
-        , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
-template< typename Target    // Type of the target operand
-        , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   schedule( SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -483,16 +655,74 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const
 //
 // This function schedules a multiplication assignment of the two given operands for execution.
 */
-template< typename TT        // Type of the encapsulated thread
-        , typename MT        // Type of the synchronization mutex
-        , typename LT        // Type of the mutex lock
-        , typename CT >      // Type of the condition variable
-template< typename Target    // Type of the target operand
-        , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void
+   ThreadBackend<TT,MT,LT,CT,AT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   schedule( MultAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an arbitrary task for execution.
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task (i.e. a function or functor without arguments) for
+// execution. It can be used by kernels that partition their work themselves instead of
+// assigning subvectors or submatrices. The task is added to the task group of the calling
+// thread and the thread pool is notified about the new task.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Task >                  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT,AT>::schedule( Task task )
+{
+   if( group_ == NULL )
+      group_ = acquireGroup();
+
+   group_->push( task );
+   threadpool_.schedule( GroupTask( group_->shared_from_this() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an arbitrary task for execution independent of the calling thread.
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task (i.e. a function or functor without arguments) for
+// execution by the thread pool. In contrast to the schedule() function, the task is not added
+// to the task group of the calling thread and is therefore not waited for by the wait()
+// function. The task itself is allowed to schedule further tasks and to wait for them.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Task >                  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT,AT>::scheduleDetached( Task task )
+{
+   threadpool_.schedule( task );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -520,11 +750,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 #  pragma warning(push)
 #  pragma warning(disable:4996)
 #endif
-template< typename TT    // Type of the encapsulated thread
-        , typename MT    // Type of the synchronization mutex
-        , typename LT    // Type of the mutex lock
-        , typename CT >  // Type of the condition variable
-inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline size_t ThreadBackend<TT,MT,LT,CT,AT>::initPool()
 {
    const char* env = std::getenv( "BLAZE_NUM_THREADS" );
 
@@ -541,6 +772,73 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 
 
 
+//=================================================================================================
+//
+//  TASK GROUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Acquires an idle task group for the calling thread.
+//
+// \return Pointer to the acquired task group.
+//
+// This function returns a currently unused task group. In case there is no idle task group
+// available, a new task group is created.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline typename ThreadBackend<TT,MT,LT,CT,AT>::TaskGroup*
+   ThreadBackend<TT,MT,LT,CT,AT>::acquireGroup()
+{
+   Lock lock( mutex_ );
+
+   if( idle_.empty() ) {
+      groups_.push_back( GroupPtr( new TaskGroup() ) );
+      idle_.reserve( groups_.size() );
+      return groups_.back().get();
+   }
+
+   TaskGroup* const group( idle_.back() );
+   idle_.pop_back();
+   return group;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Releases the given completed task group.
+//
+// \param group The task group to be released.
+// \return void
+//
+// This function returns the given task group to the set of idle task groups. The task group
+// must not contain any pending tasks.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline void ThreadBackend<TT,MT,LT,CT,AT>::releaseGroup( TaskGroup* group )
+{
+   BLAZE_INTERNAL_ASSERT( group->isDone(), "Pending tasks detected" );
+
+   Lock lock( mutex_ );
+   idle_.push_back( group );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  TYPE DEFINITIONS
@@ -561,12 +859,14 @@ typedef ThreadBackend< std::thread
                      , std::mutex
                      , std::unique_lock< std::mutex >
                      , std::condition_variable
+                     , std::atomic
                      >  TheThreadBackend;
 #elif BLAZE_BOOST_THREADS_PARALLEL_MODE
 typedef ThreadBackend< boost::thread
                      , boost::mutex
                      , boost::unique_lock< boost::mutex >
                      , boost::condition_variable
+                     , boost::atomic
                      >  TheThreadBackend;
 #endif
 /*! \endcond */
@@ -0,0 +1,242 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/TriangularSolve.h
+//  \brief Header file for the C++11/Boost thread-based sparse triangular solve SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SMP_THREADS_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/TriangularSolve.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TRIANGULARSOLVETASK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the threaded computation of a part of a level of a sparse triangular system.
+// \ingroup smp
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+struct TriangularSolveTask
+{
+   //**Type definitions****************************************************************************
+   typedef LevelSchedule::ConstIterator  ConstIterator;  //!< Iterator over the rows of a level.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TriangularSolveTask class template.
+   //
+   // \param A The analyzed row-major sparse matrix.
+   // \param schedule The level-set analysis of the triangular part of \a A.
+   // \param x The solution vector.
+   // \param b The right-hand side vector.
+   // \param first Iterator to the first row to be computed.
+   // \param last Iterator just past the last row to be computed.
+   */
+   explicit inline TriangularSolveTask( const MT& A, const LevelSchedule& schedule, VT1& x,
+                                        const VT2& b, ConstIterator first, ConstIterator last )
+      : A_       ( &A )         // The analyzed row-major sparse matrix
+      , schedule_( &schedule )  // The level-set analysis of the matrix
+      , x_       ( &x )         // The solution vector
+      , b_       ( &b )         // The right-hand side vector
+      , first_   ( first )      // Iterator to the first row
+      , last_    ( last )       // Iterator just past the last row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the range of rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      schedule_->substitute( *A_, *x_, *b_, first_, last_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT*            A_;         //!< The analyzed row-major sparse matrix.
+   const LevelSchedule* schedule_;  //!< The level-set analysis of the matrix.
+   VT1*                 x_;         //!< The solution vector.
+   const VT2*           b_;         //!< The right-hand side vector.
+   ConstIterator        first_;     //!< Iterator to the first row.
+   ConstIterator        last_;      //!< Iterator just past the last row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based solution of a row-major sparse triangular system.
+// \ingroup smp
+//
+// \param A The analyzed row-major sparse matrix.
+// \param schedule The level-set analysis of the triangular part of \a A.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based level-scheduled
+// triangular solve. The levels are processed one after another. The rows of each level with at
+// least \a SMP_TRIANGULARSOLVE_THRESHOLD rows are split into equally sized ranges, which are
+// computed concurrently by the threads. All smaller levels are computed by the calling thread
+// to avoid the synchronization overhead.\n
+// This function must \b NOT be called explicitly! It is used internally by the solve() function.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void smpTriangularSolve_backend( const MT& A, const LevelSchedule& schedule,
+                                 VT1& x, const VT2& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef TriangularSolveTask<MT,VT1,VT2>  Task;
+   typedef LevelSchedule::ConstIterator     ConstIterator;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      const ConstIterator first( schedule.begin(l) );
+      const size_t rows( schedule.rows(l) );
+
+      if( rows < SMP_TRIANGULARSOLVE_THRESHOLD ) {
+         schedule.substitute( A, x, b, first, schedule.end(l) );
+         continue;
+      }
+
+      const size_t rowsPerThread( ( rows + threads - 1UL ) / threads );
+
+      for( size_t row=0UL; row<rows; row+=rowsPerThread ) {
+         const size_t last( ( row + rowsPerThread < rows )?( row + rowsPerThread ):( rows ) );
+         TheThreadBackend::schedule( Task( A, schedule, x, b, first+row, first+last ) );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a sparse triangular system based on a precomputed level schedule.
+// \ingroup sparse_matrix
+//
+// \param A The analyzed square sparse matrix.
+// \param schedule The level-set analysis of the triangular part of \a A.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix does not match the level schedule.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves \f$ A*x=b \f$ with the triangular part of \a A that has been analyzed by
+// the given LevelSchedule. \a x and \a b may be the same vector. In case of a row-major matrix
+// the rows of sufficiently large levels are computed in parallel by the C++11/Boost threads.
+// In case the matrix is small, the matrix is column-major, or a serial section is active, the
+// system is solved serially by forward or back substitution.
+*/
+template< typename MT   // Type of the sparse matrix
+        , bool SO       // Storage order of the sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, const LevelSchedule& schedule,
+            DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !schedule.isCompatible( ~A ) )
+      throw std::invalid_argument( "Matrix does not match the level schedule" );
+
+   if( (~x).size() != schedule.rows() || (~b).size() != schedule.rows() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( SO || isSerialSectionActive() || schedule.rows() < SMP_TRIANGULARSOLVE_THRESHOLD ) {
+         if( schedule.isLower() )
+            forwardSubstitution( ~A, ~x, ~b );
+         else
+            backSubstitution( ~A, ~x, ~b );
+      }
+      else {
+         typename MT::CompositeType tmp( ~A );
+         smpTriangularSolve_backend( tmp, schedule, ~x, ~b );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -121,8 +121,8 @@ template< typename CP >  // Type of the complementarity problem
 bool CPG::solve( CP& cp )
 {
    const size_t n( cp.size() );
-   const CMatMxN& A( cp.A_ );
-   const VecN&    b( cp.b_ );
+   const typename CP::MatrixType& A( cp.A_ );
+   const VecN& b( cp.b_ );
 
    bool converged( false );
    VecN& x( cp.x_ );
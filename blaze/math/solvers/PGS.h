@@ -127,7 +127,7 @@ template< typename CP >  // Type of the complementarity problem
 bool PGS::solve( CP& cp )
 {
    const size_t n( cp.size() );
-   const CMatMxN& A( cp.A_ );
+   const typename CP::MatrixType& A( cp.A_ );
    bool converged( false );
 
    // Allocating the helper data
@@ -187,8 +187,8 @@ inline real PGS::sweep( CP& cp ) const
    real maxResidual( 0 ), xold( 0 );
    const size_t n( cp.size() );
 
-   const CMatMxN& A( cp.A_ );
-   const VecN&    b( cp.b_ );
+   const typename CP::MatrixType& A( cp.A_ );
+   const VecN& b( cp.b_ );
    VecN& x( cp.x_ );
 
    for( size_t i=0; i<n; ++i )
@@ -219,33 +219,60 @@ inline real PGS::sweep( CP& cp ) const
 template<>
 inline real PGS::sweep( ContactLCP& cp ) const
 {
+   typedef ContactLCP::MatrixType::BlockType  BlockType;
+
    const size_t N( cp.size() / 3 );
-   real rmax( 0 ), residual, flimit, aux;
+   real rmax( 0 ), flimit, aux, delta;
+   real residual[3];
    size_t j;
 
-   const CMatMxN& A( cp.A_ );
-   const VecN&  b( cp.b_ );
+   const ContactLCP::MatrixType& A( cp.A_ );
+   const VecN& b( cp.b_ );
    VecN& x( cp.x_ );
 
    for( size_t i=0; i<N; ++i )
    {
+      const size_t     nonzeros( A.nonZeroBlocks( i ) );
+      const BlockType* blocks  ( A.blocks( i ) );
+      const size_t*    indices ( A.blockIndices( i ) );
+      const BlockType* diagonal( A.findBlock( i, i ) );
+
+      BLAZE_INTERNAL_ASSERT( diagonal != NULL, "Missing diagonal block in the LCP matrix" );
+
+      // Computing the residual of all three unknowns of the contact at once
       j = i * 3;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( 0, x[j] + diagonal_[j] * residual );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
+      residual[0] = -b[j];
+      residual[1] = -b[j+1];
+      residual[2] = -b[j+2];
+
+      for( size_t k=0; k<nonzeros; ++k ) {
+         const size_t jj( indices[k] * 3 );
+         for( size_t c=0; c<3; ++c ) {
+            residual[0] -= blocks[k](0,c) * x[jj+c];
+            residual[1] -= blocks[k](1,c) * x[jj+c];
+            residual[2] -= blocks[k](2,c) * x[jj+c];
+         }
+      }
+
+      // Updating the normal unknown and correcting the remaining residuals via the diagonal block
+      aux = max( 0, x[j] + diagonal_[j] * residual[0] );
+      delta = aux - x[j];
+      rmax = max( rmax, std::fabs( delta ) );
       x[j] = aux;
+      residual[1] -= (*diagonal)(1,0) * delta;
+      residual[2] -= (*diagonal)(2,0) * delta;
 
       flimit = cp.cof_[i] * x[j];
 
       ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
+      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual[1] ) );
+      delta = aux - x[j];
+      rmax = max( rmax, std::fabs( delta ) );
       x[j] = aux;
+      residual[2] -= (*diagonal)(2,1) * delta;
 
       ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
+      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual[2] ) );
       rmax = max( rmax, std::fabs( x[j] - aux ) );
       x[j] = aux;
    }
@@ -0,0 +1,766 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BCSRMult.h
+//  \brief Header file for the block compressed sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_BCSRMULT_H_
+#define _BLAZE_MATH_SPARSE_BCSRMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the vectorized block compressed matrix/dense vector multiplication kernel.
+// \ingroup sparse_matrix
+//
+// In case the element types of the matrix, the vector, and the result are the same vectorizable
+// data type, the nested \a value will be set to 1, otherwise it will be 0.
+*/
+template< typename MT    // Type of the block compressed matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+struct BCSRMVVectorized
+{
+   //**********************************************************************************************
+   enum { value = IsBlockCompressed<MT>::value &&
+                  IsSame<typename MT::ElementType,typename VT::ElementType>::value &&
+                  IsSame<typename MT::ElementType,ET>::value &&
+                  IsVectorizable<ET>::value &&
+                  IntrinsicTrait<ET>::addition &&
+                  IntrinsicTrait<ET>::multiplication };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the vectorized block compressed matrix/dense matrix multiplication kernel.
+// \ingroup sparse_matrix
+//
+// In case the target and the right-hand side dense matrix are vectorizable row-major matrices
+// and all element types are the same data type, the nested \a value will be set to 1, otherwise
+// it will be 0.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+struct BCSRMMVectorized
+{
+   //**********************************************************************************************
+   enum { value = IsBlockCompressed<MT2>::value &&
+                  MT1::vectorizable && MT3::vectorizable &&
+                  IsRowMajorMatrix<MT1>::value && IsRowMajorMatrix<MT3>::value &&
+                  IsSame<typename MT1::ElementType,typename MT2::ElementType>::value &&
+                  IsSame<typename MT1::ElementType,typename MT3::ElementType>::value &&
+                  IntrinsicTrait<typename MT1::ElementType>::addition &&
+                  IntrinsicTrait<typename MT1::ElementType>::subtraction &&
+                  IntrinsicTrait<typename MT1::ElementType>::multiplication };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKLOAD DISTRIBUTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the block rows of a block compressed matrix by the number of blocks.
+// \ingroup sparse_matrix
+//
+// \param A The block compressed matrix to be partitioned.
+// \param parts The total number of parts.
+// \param index The index of the requested bound \f$[0..parts]\f$.
+// \return The index of the first block row of part \a index.
+//
+// This function splits the block rows of the given matrix into \a parts contiguous ranges with
+// approximately the same number of non-zero blocks and returns the lower bound of the part with
+// the given index. Part \a i consists of the block rows in the range \f$[bound(i)..bound(i+1))\f$.
+// Block rows are never split, such that each part updates a separate range of rows of the target.
+*/
+template< typename MT >  // Type of the block compressed matrix
+size_t bcsrPartition( const MT& A, size_t parts, size_t index )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+   BLAZE_INTERNAL_ASSERT( index <= parts, "Invalid part index" );
+
+   const size_t mb( A.blockRows() );
+
+   if( index == parts )
+      return mb;
+
+   const size_t target( ( A.nonZeroBlocks() * index ) / parts );
+
+   size_t ib ( 0UL );
+   size_t sum( 0UL );
+
+   while( ib < mb && sum < target ) {
+      sum += A.nonZeroBlocks( ib );
+      ++ib;
+   }
+
+   return ib;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default computation of a single block row of a block compressed matrix/dense vector
+//        product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param ib The index of the block row.
+// \param y The array for the \a MT::blockSize results of the block row.
+// \return void
+*/
+template< typename MT    // Type of the block compressed matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+inline typename DisableIf< BCSRMVVectorized<MT,VT,ET> >::Type
+   bcsrmvBlockRow( const MT& A, const VT& x, size_t ib, ET* y )
+{
+   typedef typename MT::BlockType  BlockType;
+
+   const size_t B( MT::blockSize );
+
+   const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+   const BlockType* blocks  ( A.blocks( ib ) );
+   const size_t*    indices ( A.blockIndices( ib ) );
+
+   for( size_t r=0UL; r<B; ++r ) {
+      reset( y[r] );
+   }
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      const size_t j( indices[k]*B );
+      for( size_t c=0UL; c<B; ++c ) {
+         for( size_t r=0UL; r<B; ++r ) {
+            y[r] += blocks[k](r,c) * x[j+c];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized computation of a single block row of a block compressed matrix/dense vector
+//        product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param ib The index of the block row.
+// \param y The array for the \a MT::blockSize results of the block row.
+// \return void
+//
+// This function accumulates the results of all rows of the block row in registers: each column
+// of a (column-major, padded) block is loaded with aligned loads and multiplied with the
+// broadcast according vector element.
+*/
+template< typename MT    // Type of the block compressed matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+inline typename EnableIf< BCSRMVVectorized<MT,VT,ET> >::Type
+   bcsrmvBlockRow( const MT& A, const VT& x, size_t ib, ET* y )
+{
+   typedef typename MT::BlockType  BlockType;
+   typedef IntrinsicTrait<ET>      IT;
+   typedef typename IT::Type       IntrinsicType;
+
+   enum { NN = ( MT::blockSize + IT::size - 1UL ) / IT::size };
+
+   const size_t B( MT::blockSize );
+
+   const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+   const BlockType* blocks  ( A.blocks( ib ) );
+   const size_t*    indices ( A.blockIndices( ib ) );
+
+   IntrinsicType xmm[NN];
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      const size_t j( indices[k]*B );
+      for( size_t c=0UL; c<B; ++c ) {
+         const IntrinsicType x1( set( x[j+c] ) );
+         for( size_t l=0UL; l<NN; ++l ) {
+            xmm[l] = fmadd( blocks[k].load( l*IT::size, c ), x1, xmm[l] );
+         }
+      }
+   }
+
+   ET tmp[NN*IT::size];
+
+   for( size_t l=0UL; l<NN; ++l ) {
+      storeu( tmp+l*IT::size, xmm[l] );
+   }
+
+   for( size_t r=0UL; r<B; ++r ) {
+      y[r] = tmp[r];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized computation of a chunk of columns of a single block row of a block compressed
+//        matrix/dense matrix product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side row-major dense matrix.
+// \param ib The index of the block row.
+// \param j The index of the first column of the chunk.
+// \param xmm The array for the \a MT::blockSize intrinsic results of the chunk.
+// \return void
+//
+// This function computes the \a MT::blockSize rows of the block row for the columns
+// \f$[j..j+IT::size)\f$ of the result. The intermediate results are kept in registers
+// for all blocks of the block row (register blocking).
+*/
+template< typename MT1   // Type of the block compressed matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , typename IT >  // Intrinsic type of the results
+inline void bcsrmmChunk( const MT1& A, const MT2& B, size_t ib, size_t j, IT* xmm )
+{
+   typedef typename MT1::BlockType  BlockType;
+
+   const size_t BS( MT1::blockSize );
+
+   const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+   const BlockType* blocks  ( A.blocks( ib ) );
+   const size_t*    indices ( A.blockIndices( ib ) );
+
+   for( size_t r=0UL; r<BS; ++r ) {
+      xmm[r] = IT();
+   }
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      const size_t j0( indices[k]*BS );
+      for( size_t c=0UL; c<BS; ++c ) {
+         const IT b1( B.load( j0+c, j ) );
+         for( size_t r=0UL; r<BS; ++r ) {
+            xmm[r] = fmadd( set( blocks[k](r,c) ), b1, xmm[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block compressed matrix/dense vector multiplication for a range of block rows
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+//
+// This function computes the elements of \a y that correspond to the block rows in the range
+// \f$[first..last)\f$. The function can be called concurrently for disjoint block row ranges.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void bcsrmvAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t B( MT::blockSize );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   ET tmp[MT::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      bcsrmvBlockRow( A, x, ib, tmp );
+
+      for( size_t r=0UL; r<B; ++r ) {
+         y[ib*B+r] = tmp[r];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block compressed matrix/dense vector multiplication with addition for a range of block
+//        rows (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void bcsrmvAddAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t B( MT::blockSize );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   ET tmp[MT::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      if( A.nonZeroBlocks( ib ) == 0UL ) continue;
+
+      bcsrmvBlockRow( A, x, ib, tmp );
+
+      for( size_t r=0UL; r<B; ++r ) {
+         y[ib*B+r] += tmp[r];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block compressed matrix/dense vector multiplication with subtraction for a range of
+//        block rows (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the block compressed matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void bcsrmvSubAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t B( MT::blockSize );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   ET tmp[MT::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      if( A.nonZeroBlocks( ib ) == 0UL ) continue;
+
+      bcsrmvBlockRow( A, x, ib, tmp );
+
+      for( size_t r=0UL; r<B; ++r ) {
+         y[ib*B+r] -= tmp[r];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default block compressed matrix/dense matrix multiplication for a range of block rows
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+//
+// This function computes the rows of \a C that correspond to the block rows in the range
+// \f$[first..last)\f$. The function can be called concurrently for disjoint block row ranges.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename DisableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef typename MT2::BlockType  BlockType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      const size_t     i       ( ib*BS );
+      const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+      const BlockType* blocks  ( A.blocks( ib ) );
+      const size_t*    indices ( A.blockIndices( ib ) );
+
+      for( size_t r=0UL; r<BS; ++r ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            reset( C(i+r,j) );
+         }
+      }
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t j0( indices[k]*BS );
+         for( size_t c=0UL; c<BS; ++c ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t j=0UL; j<n; ++j ) {
+                  C(i+r,j) += blocks[k](r,c) * B(j0+c,j);
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized block compressed matrix/dense matrix multiplication for a range of block rows
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side row-major dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename EnableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+   typedef typename IT::Type                           IntrinsicType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   IntrinsicType xmm[MT2::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib ) {
+      for( size_t j=0UL; j<n; j+=IT::size ) {
+         bcsrmmChunk( A, B, ib, j, xmm );
+         for( size_t r=0UL; r<BS; ++r ) {
+            C.store( ib*BS+r, j, xmm[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default block compressed matrix/dense matrix multiplication with addition for a range
+//        of block rows (\f$ C+=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename DisableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmAddAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef typename MT2::BlockType  BlockType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      const size_t     i       ( ib*BS );
+      const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+      const BlockType* blocks  ( A.blocks( ib ) );
+      const size_t*    indices ( A.blockIndices( ib ) );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t j0( indices[k]*BS );
+         for( size_t c=0UL; c<BS; ++c ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t j=0UL; j<n; ++j ) {
+                  C(i+r,j) += blocks[k](r,c) * B(j0+c,j);
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized block compressed matrix/dense matrix multiplication with addition for a range
+//        of block rows (\f$ C+=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side row-major dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename EnableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmAddAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+   typedef typename IT::Type                           IntrinsicType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   IntrinsicType xmm[MT2::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      if( A.nonZeroBlocks( ib ) == 0UL ) continue;
+
+      for( size_t j=0UL; j<n; j+=IT::size ) {
+         bcsrmmChunk( A, B, ib, j, xmm );
+         for( size_t r=0UL; r<BS; ++r ) {
+            C.store( ib*BS+r, j, C.load( ib*BS+r, j ) + xmm[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default block compressed matrix/dense matrix multiplication with subtraction for a range
+//        of block rows (\f$ C-=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename DisableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmSubAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef typename MT2::BlockType  BlockType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      const size_t     i       ( ib*BS );
+      const size_t     nonzeros( A.nonZeroBlocks( ib ) );
+      const BlockType* blocks  ( A.blocks( ib ) );
+      const size_t*    indices ( A.blockIndices( ib ) );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t j0( indices[k]*BS );
+         for( size_t c=0UL; c<BS; ++c ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t j=0UL; j<n; ++j ) {
+                  C(i+r,j) -= blocks[k](r,c) * B(j0+c,j);
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized block compressed matrix/dense matrix multiplication with subtraction for a
+//        range of block rows (\f$ C-=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side row-major dense matrix.
+// \param first The index of the first block row to be computed.
+// \param last The index one past the last block row to be computed.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the block compressed matrix
+        , typename MT3 > // Type of the right-hand side dense matrix
+inline typename EnableIf< BCSRMMVectorized<MT1,MT2,MT3> >::Type
+   bcsrmmSubAssign( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+   typedef typename IT::Type                           IntrinsicType;
+
+   const size_t BS( MT2::blockSize );
+   const size_t n ( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows() && C.columns() == n, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( last <= A.blockRows(), "Invalid block row range" );
+
+   IntrinsicType xmm[MT2::blockSize];
+
+   for( size_t ib=first; ib<last; ++ib )
+   {
+      if( A.nonZeroBlocks( ib ) == 0UL ) continue;
+
+      for( size_t j=0UL; j<n; j+=IT::size ) {
+         bcsrmmChunk( A, B, ib, j, xmm );
+         for( size_t r=0UL; r<BS; ++r ) {
+            C.store( ib*BS+r, j, C.load( ib*BS+r, j ) - xmm[r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
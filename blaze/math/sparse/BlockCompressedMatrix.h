@@ -0,0 +1,2203 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a sparse MxN matrix in block compressed row (BCSR) format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix in block compressed row
+//        (BCSR) format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is a row-major sparse matrix that stores its non-zero
+// elements in dense \f$ B \times B \f$ blocks. The type of the elements and the size of the
+// blocks can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of the blocks.
+//
+// The number of rows and columns of the matrix must be multiples of \a B. The matrix is divided
+// into \f$ M/B \times N/B \f$ block rows and block columns. Each non-zero block is stored as a
+// column-major StaticMatrix together with its block column index, and the blocks of each block
+// row are sorted by their block column index. In comparison to a CompressedMatrix only a single
+// index is stored per block instead of per element, and the dense blocks enable vectorized
+// block operations and register blocking in the matrix/vector and matrix/matrix multiplication
+// kernels. The matrix is therefore well suited for the Jacobians and stiffness matrices of
+// multibody and finite element problems, which are composed of small dense blocks.
+//
+// The matrix is assembled block-wise, either via the low-level reserve()/appendBlock()/finalize()
+// interface or via the insertBlock() and addBlock() functions:
+
+   \code
+   using blaze::StaticMatrix;
+
+   blaze::BlockCompressedMatrix<double,3UL> A( 6UL, 9UL );
+
+   StaticMatrix<double,3UL,3UL> block;
+   // ... Initialization of the block
+
+   A.reserve( 3UL );                  // Reserving enough capacity for 3 non-zero blocks
+   A.appendBlock( 0UL, 0UL, block );  // Appending a block in block row 0 and block column 0
+   A.appendBlock( 0UL, 2UL, block );  // Appending a block in block row 0 and block column 2
+   A.finalize( 0UL );                 // Finalizing block row 0
+   A.appendBlock( 1UL, 1UL, block );  // Appending a block in block row 1 and block column 1
+   A.finalize( 1UL );                 // Finalizing block row 1
+
+   A.addBlock( 1UL, 1UL, block );     // Adding to the existing block (1,1)
+   A.addBlock( 1UL, 2UL, block );     // Inserting the new block (1,2)
+
+   blaze::DynamicVector<double,blaze::columnVector> x( 9UL ), y;
+   // ... Initialization of x
+
+   y = A * x;  // Block-wise sparse matrix/dense vector multiplication
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> C( A );  // Conversion to CompressedMatrix
+   blaze::BlockCompressedMatrix<double,3UL> D( C );         // Conversion from CompressedMatrix
+   \endcode
+
+// Element-wise, the BlockCompressedMatrix provides the read-only interface of a row-major sparse
+// matrix (function call operator, row iterators, and lookup functions) and can therefore be used
+// in all sparse matrix expressions. All elements of the stored blocks, including the explicit
+// zeros within a block, are treated as non-zero elements. The result type of all expressions
+// involving a BlockCompressedMatrix is the according CompressedMatrix type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,B>, false >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows and columns of the blocks.
+   enum { blockSize = B };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,B>        This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,false>         ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>          OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>          TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                 ElementType;     //!< Type of the sparse matrix elements.
+   typedef StaticMatrix<Type,B,B,columnMajor>   BlockType;       //!< Type of the dense blocks.
+   typedef const Type&                          ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                          CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                          Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                          ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**Element class definition********************************************************************
+   /*!\brief Representation of a single element of a row of a BlockCompressedMatrix.
+   //
+   // Since the column indices of the elements are not stored explicitly, the element stores
+   // a pointer to the value and the column index computed from the block column index.
+   */
+   class Element : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type            ValueType;       //!< The value type of the element.
+      typedef size_t          IndexType;       //!< The index type of the element.
+      typedef const Type&     Reference;       //!< Reference return type.
+      typedef const Type&     ConstReference;  //!< Reference-to-const return type.
+      typedef const Element*  Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Element class.
+      //
+      // \param value Pointer to the represented value.
+      // \param index The column index of the represented value.
+      */
+      inline Element( const Type* value, size_t index )
+         : value_( value )  // Pointer to the represented value
+         , index_( index )  // The column index of the represented value
+      {}
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      /*!\brief Direct access to the element.
+      //
+      // \return Pointer to the element.
+      */
+      inline Pointer operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Access to the current value of the element.
+      //
+      // \return The current value of the element.
+      */
+      inline ConstReference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Access to the column index of the element.
+      //
+      // \return The column index of the element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the represented value.
+      size_t      index_;  //!< The column index of the represented value.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of a BlockCompressedMatrix.
+   //
+   // The iterator traverses the \a B elements of the according row of each block of the block
+   // row and advances to the next block after the last column of the current block.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                          ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                        PointerType;       //!< Pointer return type.
+      typedef ValueType                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : block_ ( NULL )  // Pointer to the current block
+         , index_ ( NULL )  // Pointer to the block column index of the current block
+         , row_   ( 0UL  )  // The row within the blocks
+         , column_( 0UL  )  // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Pointer to the initial block.
+      // \param index Pointer to the block column index of the initial block.
+      // \param row The row within the blocks.
+      // \param column The initial column within the block.
+      */
+      inline ConstIterator( const BlockType* block, const size_t* index, size_t row, size_t column )
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the block column index of the current block
+         , row_   ( row    )  // The row within the blocks
+         , column_( column )  // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Increment/decrement operators************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( DifferenceType inc ) {
+         const DifferenceType pos( DifferenceType( column_ ) + inc );
+         DifferenceType blocks( pos / DifferenceType( B ) );
+         DifferenceType column( pos % DifferenceType( B ) );
+         if( column < 0 ) {
+            column += DifferenceType( B );
+            --blocks;
+         }
+         block_  += blocks;
+         index_  += blocks;
+         column_  = size_t( column );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( DifferenceType dec ) {
+         return operator+=( -dec );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         if( ++column_ == B ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         if( column_ == 0UL ) {
+            column_ = B;
+            --block_;
+            --index_;
+         }
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      /*!\brief Direct access to the element at the given distance from the current position.
+      //
+      // \param index Access index.
+      // \return Proxy to the accessed element.
+      */
+      inline ReferenceType operator[]( DifferenceType index ) const {
+         return *( ConstIterator( *this ) += index );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Direct access to the current element.
+      //
+      // \return Proxy to the current element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( &(*block_)(row_,column_), (*index_)*B + column_ );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Direct access to the current element.
+      //
+      // \return Proxy to the current element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( &(*block_)(row_,column_), (*index_)*B + column_ );
+      }
+      //*******************************************************************************************
+
+      //**Comparison operators*********************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return index_ == rhs.index_ && column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return index_ < rhs.index_ || ( index_ == rhs.index_ && column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( index_ - rhs.index_ ) * DifferenceType( B ) +
+                ( DifferenceType( column_ ) - DifferenceType( rhs.column_ ) );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, DifferenceType inc ) {
+         return ConstIterator( it ) += inc;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, DifferenceType dec ) {
+         return ConstIterator( it ) -= dec;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BlockType* block_;   //!< Pointer to the current block.
+      const size_t*    index_;   //!< Pointer to the block column index of the current block.
+      size_t           row_;     //!< The row within the blocks.
+      size_t           column_;  //!< The column within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,B>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline BlockCompressedMatrix();
+                            explicit inline BlockCompressedMatrix( size_t m, size_t n );
+                            explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeroBlocks );
+                                     inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   template< typename MT, bool SO >  inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   clear();
+          void   reserve( size_t nonzeroBlocks );
+   inline void   swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Block insertion functions*******************************************************************
+   /*!\name Block insertion functions */
+   //@{
+   template< typename MT, bool SO > inline void       appendBlock( size_t ib, size_t jb, const Matrix<MT,SO>& block );
+                                    inline void       finalize   ( size_t ib );
+   template< typename MT, bool SO >        BlockType& insertBlock( size_t ib, size_t jb, const Matrix<MT,SO>& block );
+   template< typename MT, bool SO > inline BlockType& addBlock   ( size_t ib, size_t jb, const Matrix<MT,SO>& block );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator    find      ( size_t i, size_t j ) const;
+   inline ConstIterator    lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator    upperBound( size_t i, size_t j ) const;
+   inline BlockType*       findBlock ( size_t ib, size_t jb );
+   inline const BlockType* findBlock ( size_t ib, size_t jb ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level block access functions************************************************************
+   /*!\name Low-level block access functions */
+   //@{
+   inline size_t           blockRows() const;
+   inline size_t           blockColumns() const;
+   inline size_t           nonZeroBlocks() const;
+   inline size_t           nonZeroBlocks( size_t ib ) const;
+   inline BlockType*       blocks( size_t ib );
+   inline const BlockType* blocks( size_t ib ) const;
+   inline const size_t*    blockIndices( size_t ib ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >           void build( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void build( const Matrix<MT,SO>& m );
+
+          void   allocateRows( size_t m, size_t n );
+   inline size_t position( size_t ib, size_t jb ) const;
+   inline size_t extendCapacity() const;
+          void   reserveBlocks( size_t nonzeroBlocks );
+
+   static BlockType* allocateBlocks  ( size_t n );
+   static void       deallocateBlocks( BlockType* blocks, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;        //!< The current number of rows of the sparse matrix.
+   size_t     n_;        //!< The current number of columns of the sparse matrix.
+   size_t*    begin_;    //!< Offsets of the first block of each block row.
+   size_t*    end_;      //!< Offsets one past the last block of each block row.
+   size_t*    indices_;  //!< The block column indices of the non-zero blocks.
+   BlockType* blocks_;   //!< The non-zero blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t B >
+const Type BlockCompressedMatrix<Type,B>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix()
+   : m_      ( 0UL )              // The current number of rows of the sparse matrix
+   , n_      ( 0UL )              // The current number of columns of the sparse matrix
+   , begin_  ( new size_t[2UL] )  // Offsets of the first block of each block row
+   , end_    ( begin_+1UL )       // Offsets one past the last block of each block row
+   , indices_( NULL )             // The block column indices of the non-zero blocks
+   , blocks_ ( NULL )             // The non-zero blocks
+{
+   begin_[0UL] = end_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ m \times n \f$ BlockCompressedMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity. In case \a m or \a n
+// is not a multiple of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , begin_  ( NULL )  // Offsets of the first block of each block row
+   , end_    ( NULL )  // Offsets one past the last block of each block row
+   , indices_( NULL )  // The block column indices of the non-zero blocks
+   , blocks_ ( NULL )  // The non-zero blocks
+{
+   allocateRows( m, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ m \times n \f$ BlockCompressedMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeroBlocks The number of expected non-zero blocks.
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// The matrix is initialized to the zero matrix and provides enough capacity for the given
+// number of non-zero blocks. In case \a m or \a n is not a multiple of the block size, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeroBlocks )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , begin_  ( NULL )  // Offsets of the first block of each block row
+   , end_    ( NULL )  // Offsets one past the last block of each block row
+   , indices_( NULL )  // The block column indices of the non-zero blocks
+   , blocks_ ( NULL )  // The non-zero blocks
+{
+   allocateRows( m, n );
+   reserveBlocks( nonzeroBlocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization. The copy only provides the capacity
+// for the currently stored non-zero blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , begin_  ( NULL )  // Offsets of the first block of each block row
+   , end_    ( NULL )  // Offsets one past the last block of each block row
+   , indices_( NULL )  // The block column indices of the non-zero blocks
+   , blocks_ ( NULL )  // The non-zero blocks
+{
+   allocateRows( sm.m_, sm.n_ );
+   reserveBlocks( sm.nonZeroBlocks() );
+
+   const size_t mb( blockRows() );
+
+   for( size_t ib=0UL; ib<mb; ++ib ) {
+      end_[ib] = std::copy( sm.indices_+sm.begin_[ib], sm.indices_+sm.end_[ib], indices_+begin_[ib] ) - indices_;
+      std::copy( sm.blocks_+sm.begin_[ib], sm.blocks_+sm.end_[ib], blocks_+begin_[ib] );
+      begin_[ib+1UL] = end_[ib];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// This constructor converts the given dense or sparse matrix into the block compressed row
+// format. Every block containing at least one non-zero element of \a m is stored as a dense
+// block. In case the number of rows or columns of \a m is not a multiple of the block size,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , size_t B >       // Number of rows and columns of the blocks
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , begin_  ( NULL )  // Offsets of the first block of each block row
+   , end_    ( NULL )  // Offsets one past the last block of each block row
+   , indices_( NULL )  // The block column indices of the non-zero blocks
+   , blocks_ ( NULL )  // The non-zero blocks
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>::~BlockCompressedMatrix()
+{
+   deallocateBlocks( blocks_, end_[blockRows()] );
+   deallocate( indices_ );
+   delete [] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstReference
+   BlockCompressedMatrix<Type,B>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const BlockType* block( findBlock( i/B, j/B ) );
+
+   if( block == NULL )
+      return zero_;
+   else
+      return (*block)(i%B,j%B);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( begin_[i/B] );
+   return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( end_[i/B] );
+   return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// The given matrix is converted into the block compressed row format. In case the number of
+// rows or columns of \a rhs is not a multiple of the block size, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , size_t B >       // Number of rows and columns of the blocks
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix in elements.
+//
+// The capacity is given in elements, i.e. as the number of blocks the matrix can store times
+// \f$ B^2 \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::capacity() const
+{
+   return end_[blockRows()] * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// All \f$ B^2 \f$ elements of the stored blocks are counted as non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros() const
+{
+   return nonZeroBlocks() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nonZeroBlocks( i/B ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero blocks. The size and the capacity of the matrix remain
+// unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::reset()
+{
+   const size_t mb( blockRows() );
+
+   for( size_t ib=0UL; ib<mb; ++ib )
+      end_[ib] = begin_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeroBlocks The new minimum capacity of the sparse matrix in blocks.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeroBlocks
+// blocks. The current values of the matrix elements and the individual capacities of the
+// block rows are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+void BlockCompressedMatrix<Type,B>::reserve( size_t nonzeroBlocks )
+{
+   if( nonzeroBlocks > end_[blockRows()] )
+      reserveBlocks( nonzeroBlocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_, sm.end_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( blocks_, sm.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix into the block compressed row format.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// This function determines the non-zero blocks of each block row in a first pass over the
+// \a B rows of the block row and copies the elements into the blocks in a second pass. It is
+// expected to be called on a matrix without allocated memory.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the sparse matrix
+void BlockCompressedMatrix<Type,B>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  MatrixIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix
+
+   allocateRows( A.rows(), A.columns() );
+
+   const size_t mb( blockRows() );
+   const size_t nb( blockColumns() );
+
+   size_t* const marker( new size_t[nb] );  // The last block row referencing each block column
+   size_t* const counts( new size_t[mb] );  // The number of non-zero blocks per block row
+
+   std::fill( marker, marker+nb, mb );
+
+   // Counting the non-zero blocks of each block row
+   size_t total( 0UL );
+   for( size_t ib=0UL; ib<mb; ++ib ) {
+      counts[ib] = 0UL;
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         const MatrixIterator end( A.end(i) );
+         for( MatrixIterator element=A.begin(i); element!=end; ++element ) {
+            const size_t jb( element->index() / B );
+            if( marker[jb] != ib ) {
+               marker[jb] = ib;
+               ++counts[ib];
+            }
+         }
+      }
+      total += counts[ib];
+   }
+
+   try {
+      reserveBlocks( total );
+   }
+   catch( ... ) {
+      delete [] marker;
+      delete [] counts;
+      throw;
+   }
+
+   // Collecting the sorted block column indices and copying the elements into the blocks
+   std::fill( marker, marker+nb, mb );
+   for( size_t ib=0UL; ib<mb; ++ib )
+   {
+      size_t* const first( indices_+begin_[ib] );
+      size_t* last( first );
+
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         const MatrixIterator end( A.end(i) );
+         for( MatrixIterator element=A.begin(i); element!=end; ++element ) {
+            const size_t jb( element->index() / B );
+            if( marker[jb] != ib ) {
+               marker[jb] = ib;
+               *last++ = jb;
+            }
+         }
+      }
+
+      std::sort( first, last );
+
+      for( size_t k=begin_[ib]; k<begin_[ib]+counts[ib]; ++k ) {
+         blocks_[k].reset();
+      }
+
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         size_t k( begin_[ib] );
+         const MatrixIterator end( A.end(i) );
+         for( MatrixIterator element=A.begin(i); element!=end; ++element ) {
+            const size_t jb( element->index() / B );
+            while( indices_[k] != jb ) ++k;
+            blocks_[k](i%B,element->index()%B) = element->value();
+         }
+      }
+
+      end_[ib] = begin_[ib] + counts[ib];
+      begin_[ib+1UL] = end_[ib];
+      if( ib+1UL != mb )
+         end_[ib+1UL] = end_[ib];
+   }
+
+   delete [] marker;
+   delete [] counts;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a dense or column-major matrix into the block compressed row format.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// This function builds the block structure of the matrix via an intermediate row-major
+// compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+void BlockCompressedMatrix<Type,B>::build( const Matrix<MT,SO>& m )
+{
+   const CompressedMatrix<Type,false> tmp( ~m );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of the block row offsets of an empty \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid setup of block compressed matrix.
+//
+// This function is expected to be called on a matrix without allocated memory.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+void BlockCompressedMatrix<Type,B>::allocateRows( size_t m, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( begin_ == NULL, "Invalid block row offsets detected" );
+
+   if( m % B != 0UL || n % B != 0UL )
+      throw std::invalid_argument( "Invalid setup of block compressed matrix" );
+
+   const size_t mb( m / B );
+
+   begin_ = new size_t[2UL*mb+2UL];
+   end_   = begin_+mb+1UL;
+   m_     = m;
+   n_     = n;
+
+   std::fill( begin_, begin_+2UL*mb+2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of block \f$ (ib,jb) \f$ or of the first block with a larger block
+//        column index.
+//
+// \param ib The block row index.
+// \param jb The block column index.
+// \return The position of the first block of block row \a ib not left of block column \a jb.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::position( size_t ib, size_t jb ) const
+{
+   return std::lower_bound( indices_+begin_[ib], indices_+end_[ib], jb ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new sparse matrix capacity in blocks.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is at least 7 blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::extendCapacity() const
+{
+   size_t nonzeroBlocks( 2UL*end_[blockRows()]+1UL );
+   nonzeroBlocks = blaze::max( nonzeroBlocks, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeroBlocks > end_[blockRows()], "Invalid capacity value" );
+
+   return nonzeroBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of non-zero blocks.
+//
+// \param nonzeroBlocks The number of blocks to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+void BlockCompressedMatrix<Type,B>::reserveBlocks( size_t nonzeroBlocks )
+{
+   const size_t mb( blockRows() );
+   const size_t used( ( mb > 0UL )?( end_[mb-1UL] ):( 0UL ) );
+
+   BLAZE_INTERNAL_ASSERT( used <= nonzeroBlocks, "Invalid capacity value" );
+
+   BlockType* newBlocks ( allocateBlocks( nonzeroBlocks ) );
+   size_t*    newIndices( NULL );
+
+   try {
+      newIndices = allocate<size_t>( nonzeroBlocks );
+   }
+   catch( ... ) {
+      deallocateBlocks( newBlocks, nonzeroBlocks );
+      throw;
+   }
+
+   std::copy( blocks_ , blocks_ +used, newBlocks  );
+   std::copy( indices_, indices_+used, newIndices );
+
+   std::swap( blocks_ , newBlocks  );
+   std::swap( indices_, newIndices );
+   deallocateBlocks( newBlocks, end_[mb] );
+   deallocate( newIndices );
+
+   end_[mb] = nonzeroBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of the given number of default constructed blocks.
+//
+// \param n The number of blocks to be allocated.
+// \return Pointer to the first allocated block.
+// \exception std::bad_alloc Allocation failed.
+//
+// The blocks are placed in raw memory that respects the alignment restrictions of the blocks.
+// In contrast to the allocate() function, no array new expression is instantiated for the
+// (possibly over-aligned) block type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::allocateBlocks( size_t n )
+{
+   const size_t alignment( AlignmentOf<BlockType>::value );
+
+   BlockType* const blocks( reinterpret_cast<BlockType*>(
+      allocate_backend( n*sizeof(BlockType), max( alignment, sizeof(void*) ) ) ) );
+   size_t k( 0UL );
+
+   try {
+      for( ; k<n; ++k )
+         ::new (blocks+k) BlockType();
+   }
+   catch( ... ) {
+      while( k != 0UL )
+         blocks[--k].~BlockType();
+      deallocate_backend( blocks );
+      throw;
+   }
+
+   return blocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of blocks allocated via the allocateBlocks() function.
+//
+// \param blocks Pointer to the first block to be deallocated.
+// \param n The number of allocated blocks.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+void BlockCompressedMatrix<Type,B>::deallocateBlocks( BlockType* blocks, size_t n )
+{
+   if( blocks == NULL )
+      return;
+
+   for( size_t k=0UL; k<n; ++k )
+      blocks[k].~BlockType();
+
+   deallocate_backend( blocks );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending a block to the specified block row of the sparse matrix.
+//
+// \param ib The block row index of the new block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the new block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The \f$ B \times B \f$ block to be appended.
+// \return void
+// \exception std::invalid_argument Invalid assignment to static matrix.
+//
+// This function provides a very efficient way to fill a block compressed matrix with blocks. It
+// appends a new block to the end of the specified block row without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the block column index of the new block must be strictly larger than the largest block
+//    column index of the blocks in the specified block row
+//  - the current number of non-zero blocks in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! In combination with the
+// reserve() and the finalize() function, appendBlock() provides the most efficient way to add
+// new blocks to a (newly created) block compressed matrix. In case the given block is not a
+// \f$ B \times B \f$ matrix, a \a std::invalid_argument exception is thrown.
+//
+// \b Note: Although appendBlock() does not allocate new memory, it still invalidates all
+// iterators returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the block
+        , bool SO >      // Storage order of the block
+inline void BlockCompressedMatrix<Type,B>::appendBlock( size_t ib, size_t jb, const Matrix<MT,SO>& block )
+{
+   BLAZE_USER_ASSERT( ib < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( jb < blockColumns(), "Invalid block column access index" );
+   BLAZE_USER_ASSERT( end_[ib] < end_[blockRows()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[ib] == end_[ib] || jb > indices_[end_[ib]-1UL], "Index is not strictly increasing" );
+
+   blocks_ [end_[ib]] = ~block;
+   indices_[end_[ib]] = jb;
+   ++end_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the block insertion of a block row.
+//
+// \param ib The index of the block row to be finalized \f$[0..M/B-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with blocks.
+// After completion of block row \a ib via the appendBlock() function, this function can be
+// called to finalize block row \a ib and prepare the next block row for insertion process via
+// appendBlock().
+//
+// \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,B>::finalize( size_t ib )
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+
+   begin_[ib+1UL] = end_[ib];
+   if( ib != blockRows()-1UL )
+      end_[ib+1UL] = end_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting a block into the sparse matrix.
+//
+// \param ib The block row index of the new block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the new block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The \f$ B \times B \f$ block to be inserted.
+// \return Reference to the inserted block.
+// \exception std::invalid_argument Invalid assignment to static matrix.
+// \exception std::invalid_argument Bad access index.
+//
+// This function inserts a new block into the sparse matrix. However, duplicate blocks are
+// not allowed. In case the sparse matrix already contains a block at block row \a ib and
+// block column \a jb, a \a std::invalid_argument exception is thrown. In case the current
+// capacity of the matrix is exhausted, the capacity is extended.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the block
+        , bool SO >      // Storage order of the block
+typename BlockCompressedMatrix<Type,B>::BlockType&
+   BlockCompressedMatrix<Type,B>::insertBlock( size_t ib, size_t jb, const Matrix<MT,SO>& block )
+{
+   BLAZE_USER_ASSERT( ib < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( jb < blockColumns(), "Invalid block column access index" );
+
+   const size_t mb ( blockRows() );
+   const size_t pos( position( ib, jb ) );
+
+   if( pos != end_[ib] && indices_[pos] == jb )
+      throw std::invalid_argument( "Bad access index" );
+
+   const BlockType tmp( ~block );
+
+   if( begin_[ib+1UL] - end_[ib] != 0UL ) {
+      std::copy_backward( blocks_ +pos, blocks_ +end_[ib], blocks_ +end_[ib]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[ib], indices_+end_[ib]+1UL );
+      ++end_[ib];
+   }
+   else if( end_[mb] - begin_[mb] != 0UL ) {
+      std::copy_backward( blocks_ +pos, blocks_ +end_[mb-1UL], blocks_ +end_[mb-1UL]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[mb-1UL], indices_+end_[mb-1UL]+1UL );
+
+      for( size_t k=ib+1UL; k<mb+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      BlockType* newBlocks ( allocateBlocks( newCapacity ) );
+      size_t*    newIndices( NULL );
+
+      try {
+         newIndices = allocate<size_t>( newCapacity );
+      }
+      catch( ... ) {
+         deallocateBlocks( newBlocks, newCapacity );
+         throw;
+      }
+
+      std::copy( blocks_ , blocks_ +pos, newBlocks  );
+      std::copy( indices_, indices_+pos, newIndices );
+      std::copy( blocks_ +pos, blocks_ +end_[mb-1UL], newBlocks +pos+1UL );
+      std::copy( indices_+pos, indices_+end_[mb-1UL], newIndices+pos+1UL );
+
+      std::swap( blocks_ , newBlocks  );
+      std::swap( indices_, newIndices );
+      deallocateBlocks( newBlocks, end_[mb] );
+      deallocate( newIndices );
+
+      for( size_t k=ib+1UL; k<mb+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+
+      end_[mb] = newCapacity;
+   }
+
+   blocks_ [pos] = tmp;
+   indices_[pos] = jb;
+
+   return blocks_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a block to the sparse matrix.
+//
+// \param ib The block row index of the block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The \f$ B \times B \f$ block to be added.
+// \return Reference to the updated block.
+// \exception std::invalid_argument Invalid assignment to static matrix.
+//
+// This function adds the given block to the block at block row \a ib and block column \a jb.
+// In case the matrix does not yet contain a block at this position, the block is inserted.
+// This is the typical operation for the assembly of stiffness matrices and Jacobians, where
+// the contributions of several elements or contacts are accumulated in the same block.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the block
+        , bool SO >      // Storage order of the block
+inline typename BlockCompressedMatrix<Type,B>::BlockType&
+   BlockCompressedMatrix<Type,B>::addBlock( size_t ib, size_t jb, const Matrix<MT,SO>& block )
+{
+   BlockType* const existing( findBlock( ib, jb ) );
+
+   if( existing != NULL ) {
+      *existing += ~block;
+      return *existing;
+   }
+   else return insertBlock( ib, jb, block );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( position( i/B, j/B ) );
+
+   if( pos != end_[i/B] && indices_[pos] == j/B )
+      return ConstIterator( blocks_+pos, indices_+pos, i%B, j%B );
+   else
+      return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( position( i/B, j/B ) );
+
+   if( pos != end_[i/B] && indices_[pos] == j/B )
+      return ++ConstIterator( blocks_+pos, indices_+pos, i%B, j%B );
+   else
+      return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param ib The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Pointer to the block in case it is found, \a NULL otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::findBlock( size_t ib, size_t jb )
+{
+   return const_cast<BlockType*>( const_cast<const This&>( *this ).findBlock( ib, jb ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param ib The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Pointer to the block in case it is found, \a NULL otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::findBlock( size_t ib, size_t jb ) const
+{
+   BLAZE_USER_ASSERT( ib < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( jb < blockColumns(), "Invalid block column access index" );
+
+   const size_t pos( position( ib, jb ) );
+
+   if( pos != end_[ib] && indices_[pos] == jb )
+      return blocks_+pos;
+   else return NULL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL BLOCK ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of block rows of the sparse matrix.
+//
+// \return The number of block rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::blockRows() const
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of block columns of the sparse matrix.
+//
+// \return The number of block columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::blockColumns() const
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks of the sparse matrix.
+//
+// \return The number of non-zero blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks() const
+{
+   const size_t mb( blockRows() );
+   size_t nonzeroBlocks( 0UL );
+
+   for( size_t ib=0UL; ib<mb; ++ib )
+      nonzeroBlocks += end_[ib] - begin_[ib];
+
+   return nonzeroBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks of the specified block row.
+//
+// \param ib The index of the block row. The index has to be in the range \f$[0..M/B-1]\f$.
+// \return The number of non-zero blocks of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+   return end_[ib] - begin_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the blocks of the given block row.
+//
+// \param ib The index of the block row. The index has to be in the range \f$[0..M/B-1]\f$.
+// \return Pointer to the first block of the block row.
+//
+// The blocks of the block row are stored contiguously in the order of their block column
+// indices as given by the blockIndices() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::blocks( size_t ib )
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+   return blocks_ + begin_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the blocks of the given block row.
+//
+// \param ib The index of the block row. The index has to be in the range \f$[0..M/B-1]\f$.
+// \return Pointer to the first block of the block row.
+//
+// The blocks of the block row are stored contiguously in the order of their block column
+// indices as given by the blockIndices() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::blocks( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+   return blocks_ + begin_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the block column indices of the given block row.
+//
+// \param ib The index of the block row. The index has to be in the range \f$[0..M/B-1]\f$.
+// \return Pointer to the block column index of the first block of the block row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const size_t* BlockCompressedMatrix<Type,B>::blockIndices( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < blockRows(), "Invalid block row access index" );
+   return indices_ + begin_[ib];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since the BlockCompressedMatrix cannot be assigned to element-wise, this function always
+// returns \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline bool BlockCompressedMatrix<Type,B>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B >
+inline void reset( BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void clear( BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void reset( BlockCompressedMatrix<Type,B>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void clear( BlockCompressedMatrix<Type,B>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m )
+{
+   typedef typename BlockCompressedMatrix<Type,B>::BlockType  BlockType;
+
+   for( size_t ib=0UL; ib<m.blockRows(); ++ib ) {
+      const BlockType* blocks( m.blocks( ib ) );
+      for( size_t k=0UL; k<m.nonZeroBlocks( ib ); ++k )
+         if( !isDefault( blocks[k] ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBLOCKCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t B >
+struct IsBlockCompressed< BlockCompressedMatrix<T,B> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< T1, BlockCompressedMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,B>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, StaticVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< StaticVector<T1,N,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,B>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, HybridVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< HybridVector<T1,N,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, DynamicVector<T2,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, DynamicVector<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< DynamicVector<T1,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef typename MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, size_t B, typename T2, typename I2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, CompressedVector<T2,false,I2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, CompressedVector<T2,false,I2> >::Type  Type;
+};
+
+template< typename T1, typename I1, typename T2, size_t B >
+struct MultTrait< CompressedVector<T1,true,I1>, BlockCompressedMatrix<T2,B> >
+{
+   typedef typename MultTrait< CompressedVector<T1,true,I1>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct MultTrait< BlockCompressedMatrix<T1,B>, DynamicMatrix<T2,SO> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct SubmatrixTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct RowTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct ColumnTrait< BlockCompressedMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,551 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CSRMV.h
+//  \brief Header file for the CSR/CSC sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_CSRMV_H_
+#define _BLAZE_MATH_SPARSE_CSRMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/HasSplitStorage.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the vectorized row kernel of a sparse matrix/dense vector multiplication.
+// \ingroup sparse_matrix
+//
+// In case the sparse matrix stores its values and indices in separate arrays, the dense vector
+// provides direct access to its elements, and the element types of the matrix, the vector, and
+// the result are the same single or double precision type, the nested \a value will be set to 1,
+// otherwise it will be 0.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+struct CSRMVVectorized
+{
+   //**********************************************************************************************
+   enum { value = BLAZE_AVX2_MODE &&
+                  HasSplitStorage<MT>::value && VT::vectorizable &&
+                  IsSame<VT,typename VT::ResultType>::value &&
+                  IsSame<typename MT::ElementType,typename VT::ElementType>::value &&
+                  IsSame<typename MT::ElementType,ET>::value &&
+                  ( IsFloat<ET>::value || IsDouble<ET>::value ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default computation of a single element of a sparse matrix/dense vector product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param i The index of the computed element/row.
+// \return The resulting value.
+*/
+template< typename ET    // Type of the result element
+        , typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector operand
+inline typename DisableIf< CSRMVVectorized<MT,VT,ET>, ET >::Type
+   csrmvRow( const MT& A, const VT& x, size_t i )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   ET tmp = ET();
+
+   const ConstIterator end( A.end(i) );
+   ConstIterator element( A.begin(i) );
+
+   // Early exit in case row 'i' is empty
+   if( element == end )
+      return tmp;
+
+   // Calculating element 'i' for numeric data types
+   if( IsNumeric<ET>::value )
+   {
+      const size_t kpos( A.nonZeros(i) & size_t(-2) );
+      ET tmp2 = ET();
+
+      for( size_t k=0UL; k<kpos; k+=2UL )
+      {
+         const ET     value1( element->value() );
+         const size_t index1( element->index() );
+         ++element;
+         const ET     value2( element->value() );
+         const size_t index2( element->index() );
+         ++element;
+
+         tmp  += value1 * x[index1];
+         tmp2 += value2 * x[index2];
+      }
+      if( element!=end ) {
+         tmp += element->value() * x[element->index()];
+      }
+
+      tmp += tmp2;
+   }
+
+   // Calculating element 'i' for non-numeric data types
+   else {
+      tmp = element->value() * x[element->index()];
+      ++element;
+      for( ; element!=end; ++element )
+         tmp += element->value() * x[element->index()];
+   }
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_AVX2_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized computation of a single element of a sparse matrix/dense vector product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param i The index of the computed element/row.
+// \return The resulting value.
+//
+// This function computes a single element of the multiplication of a sparse matrix with split
+// value/index storage and a dense vector. The values of the non-zero elements of row \a i are
+// loaded contiguously and the according vector elements are gathered based on the contiguous
+// index array.
+*/
+template< typename ET    // Type of the result element
+        , typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector operand
+inline typename EnableIf< CSRMVVectorized<MT,VT,ET>, ET >::Type
+   csrmvRow( const MT& A, const VT& x, size_t i )
+{
+   typedef IntrinsicTrait<ET>       IT;
+   typedef typename IT::Type        IntrinsicType;
+   typedef typename MT::IndexType   IndexType;
+
+   const size_t     nonzeros( A.nonZeros(i) );
+   const ET*        values  ( A.begin(i).values() );
+   const IndexType* indices ( A.begin(i).indices() );
+   const ET*        data    ( x.data() );
+
+   IntrinsicType xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size*2UL) <= nonzeros; k+=IT::size*2UL ) {
+      xmm1 = fmadd( loadu( values+k          ), gather( data, indices+k          ), xmm1 );
+      xmm2 = fmadd( loadu( values+k+IT::size ), gather( data, indices+k+IT::size ), xmm2 );
+   }
+   if( (k+IT::size) <= nonzeros ) {
+      xmm1 = fmadd( loadu( values+k ), gather( data, indices+k ), xmm1 );
+      k += IT::size;
+   }
+
+   ET tmp( sum( xmm1 + xmm2 ) );
+
+   for( ; k<nonzeros; ++k ) {
+      tmp += values[k] * data[indices[k]];
+   }
+
+   return tmp;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW-MAJOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major sparse matrix/dense vector multiplication for a range of rows
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side row-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+//
+// This function computes the elements \f$[first..last)\f$ of \a y. Since every element only
+// depends on a single row of \a A, the function can be called concurrently for disjoint row
+// ranges.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void csrmvAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.rows(), "Invalid row range" );
+
+   for( size_t i=first; i<last; ++i ) {
+      y[i] = csrmvRow<ET>( A, x, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major sparse matrix/dense vector multiplication with addition for a range of rows
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side row-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void csrmvAddAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.rows(), "Invalid row range" );
+
+   for( size_t i=first; i<last; ++i ) {
+      if( A.nonZeros( i ) ) y[i] += csrmvRow<ET>( A, x, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major sparse matrix/dense vector multiplication with subtraction for a range of
+//        rows (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side row-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void csrmvSubAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.rows(), "Invalid row range" );
+
+   for( size_t i=first; i<last; ++i ) {
+      if( A.nonZeros( i ) ) y[i] -= csrmvRow<ET>( A, x, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMN-MAJOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-major sparse matrix/dense vector multiplication for a range of columns
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side column-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first column to be considered.
+// \param last The index one past the last column to be considered.
+// \return void
+//
+// This function resets \a y and accumulates the contributions of the columns \f$[first..last)\f$
+// of \a A. Since the columns scatter into arbitrary elements of \a y, concurrent calls for
+// disjoint column ranges have to use separate target vectors, which are combined afterwards
+// via cscmvReduceAssign(), cscmvReduceAddAssign(), or cscmvReduceSubAssign().
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void cscmvAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.columns(), "Invalid column range" );
+
+   reset( y );
+
+   for( size_t j=first; j<last; ++j )
+   {
+      ConstIterator element( A.begin(j) );
+      const ConstIterator end( A.end(j) );
+
+      for( ; element!=end; ++element ) {
+         if( IsResizable<typename VT1::ElementType>::value &&
+             isDefault( y[element->index()] ) )
+            y[element->index()] = element->value() * x[j];
+         else
+            y[element->index()] += element->value() * x[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-major sparse matrix/dense vector multiplication with addition for a range of
+//        columns (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side column-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first column to be considered.
+// \param last The index one past the last column to be considered.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void cscmvAddAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.columns(), "Invalid column range" );
+
+   for( size_t j=first; j<last; ++j )
+   {
+      ConstIterator element( A.begin(j) );
+      const ConstIterator end( A.end(j) );
+
+      for( ; element!=end; ++element ) {
+         y[element->index()] += element->value() * x[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-major sparse matrix/dense vector multiplication with subtraction for a range of
+//        columns (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side column-major sparse matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first column to be considered.
+// \param last The index one past the last column to be considered.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void cscmvSubAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.columns(), "Invalid column range" );
+
+   for( size_t j=first; j<last; ++j )
+   {
+      ConstIterator element( A.begin(j) );
+      const ConstIterator end( A.end(j) );
+
+      for( ; element!=end; ++element ) {
+         y[element->index()] -= element->value() * x[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combination of partial column-major sparse matrix/dense vector products for a range
+//        of elements (\f$ \vec{y}=\sum_p \vec{y}_p \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param partials The partial products computed by cscmvAssign().
+// \param first The index of the first element to be computed.
+// \param last The index one past the last element to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2 > // Type of the partial dense vectors
+void cscmvReduceAssign( VT1& y, const std::vector<VT2>& partials, size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( !partials.empty(), "Invalid number of partial products" );
+   BLAZE_INTERNAL_ASSERT( last <= y.size(), "Invalid element range" );
+
+   for( size_t i=first; i<last; ++i ) {
+      y[i] = partials[0UL][i];
+   }
+
+   for( size_t p=1UL; p<partials.size(); ++p ) {
+      for( size_t i=first; i<last; ++i ) {
+         y[i] += partials[p][i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition of partial column-major sparse matrix/dense vector products for a range of
+//        elements (\f$ \vec{y}+=\sum_p \vec{y}_p \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param partials The partial products computed by cscmvAssign().
+// \param first The index of the first element to be computed.
+// \param last The index one past the last element to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2 > // Type of the partial dense vectors
+void cscmvReduceAddAssign( VT1& y, const std::vector<VT2>& partials, size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( last <= y.size(), "Invalid element range" );
+
+   for( size_t p=0UL; p<partials.size(); ++p ) {
+      for( size_t i=first; i<last; ++i ) {
+         y[i] += partials[p][i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction of partial column-major sparse matrix/dense vector products for a range of
+//        elements (\f$ \vec{y}-=\sum_p \vec{y}_p \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param partials The partial products computed by cscmvAssign().
+// \param first The index of the first element to be computed.
+// \param last The index one past the last element to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2 > // Type of the partial dense vectors
+void cscmvReduceSubAssign( VT1& y, const std::vector<VT2>& partials, size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( last <= y.size(), "Invalid element range" );
+
+   for( size_t p=0UL; p<partials.size(); ++p ) {
+      for( size_t i=first; i<last; ++i ) {
+         y[i] -= partials[p][i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2885 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactDiagonalMatrix.h
+//  \brief Implementation of a compact MxN diagonal matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/DiagonalAccessProxy.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_diagonal_matrix CompactDiagonalMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ matrix that exclusively stores its
+//        diagonal elements.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalMatrix class template is a sparse matrix with a fixed sparsity pattern:
+// It stores exactly the \f$ \min(M,N) \f$ elements on its diagonal in a single, contiguous
+// array and no index information at all. Thus a \f$ 100000 \times 100000 \f$ diagonal matrix
+// of double precision values requires 800 KB of memory. The type of the elements and the
+// storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class CompactDiagonalMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactDiagonalMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Since every row/column contains at most a single element, the CompactDiagonalMatrix can be
+// used with all sparse matrix operations of the \b Blaze library and all according kernels
+// (as for instance the multiplication with a dense matrix or vector) perform only a single
+// operation per row/column. Its primary purpose is to serve as compact storage for the
+// DiagonalMatrix adaptor:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DiagonalMatrix< CompactDiagonalMatrix<double> > D( 100000UL );  // Stores 100000 elements
+   DynamicMatrix<double> A( 100000UL, 8UL ), B;
+   DynamicVector<double> x( 100000UL ), y;
+
+   for( size_t i=0UL; i<D.rows(); ++i ) {
+      D(i,i) = 1.0 / ...;  // Initialization of the diagonal elements
+   }
+
+   B = D * A;  // Row scaling in O(N*K)
+   B = A * D;  // Column scaling in O(N*K)
+   y = D * x;  // Diagonal scaling in O(N)
+   \endcode
+
+// In contrast to other sparse matrices, all diagonal elements are permanently stored (even if
+// they are zero), i.e. the nonZeros() function always returns \f$ \min(M,N) \f$. Inserting an
+// element on the diagonal via set(), insert(), or append() overwrites the according value and
+// erasing an element resets it to its default value. Since the off-diagonal elements cannot be
+// stored, the attempt to set an off-diagonal element to a non-default value results in a
+// \a std::invalid_argument exception:
+
+   \code
+   blaze::CompactDiagonalMatrix<double> A( 3UL, 3UL );
+
+   A(1,1) = 2.0;  // Setting the diagonal element (1,1)
+   A.set( 2, 2, 3.0 );  // Setting the diagonal element (2,2)
+   A(0,1) = 1.0;  // Invalid assignment to an off-diagonal element; results in an exception!
+   A = B;  // Results in an exception in case B has non-zero off-diagonal elements!
+   \endcode
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompactDiagonalMatrix : public SparseMatrix< CompactDiagonalMatrix<Type,SO>, SO >
+{
+ private:
+   //**DiagonalElement class definition************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Representation of a diagonal element within the compact diagonal matrix.
+   */
+   template< typename ET >  // Type of the represented value (Type or const Type)
+   class DiagonalElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type              ValueType;       //!< The value type of the value-index-pair.
+      typedef size_t            IndexType;       //!< The index type of the value-index-pair.
+      typedef ET&               Reference;       //!< Reference return type.
+      typedef const Type&       ConstReference;  //!< Reference-to-const return type.
+      typedef DiagonalElement*  Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the DiagonalElement class.
+      //
+      // \param value Pointer to the represented value.
+      // \param index The index of the represented element.
+      */
+      inline DiagonalElement( ET* value, size_t index )
+         : value_( value )  // Pointer to the represented value
+         , index_( index )  // The index of the represented element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the diagonal element.
+      //
+      // \param v The new value of the diagonal element.
+      // \return Reference to the assigned diagonal element.
+      */
+      template< typename T > inline DiagonalElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the diagonal element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the assigned diagonal element.
+      */
+      template< typename T > inline DiagonalElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the diagonal element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the assigned diagonal element.
+      */
+      template< typename T > inline DiagonalElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the diagonal element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the assigned diagonal element.
+      */
+      template< typename T > inline DiagonalElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the diagonal element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the assigned diagonal element.
+      */
+      template< typename T > inline DiagonalElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the diagonal element.
+      //
+      // \return Pointer to the diagonal element.
+      */
+      inline Pointer operator->() {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the diagonal element.
+      //
+      // \return The current value of the diagonal element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the diagonal element.
+      //
+      // \return The current index of the diagonal element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ET*    value_;  //!< Pointer to the represented value.
+      size_t index_;  //!< The index of the represented element.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**DiagonalIterator class definition***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Iterator over the elements of the compact diagonal matrix.
+   */
+   template< typename ET >  // Type of the iterated values (Type or const Type)
+   class DiagonalIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef DiagonalElement<ET>        ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the DiagonalIterator class.
+      */
+      inline DiagonalIterator()
+         : pos_  ( NULL )  // Pointer to the current diagonal element
+         , index_( 0UL  )  // The index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the DiagonalIterator class.
+      //
+      // \param pos Pointer to the current diagonal element.
+      // \param index The index of the current diagonal element.
+      */
+      inline DiagonalIterator( ET* pos, size_t index )
+         : pos_  ( pos   )  // Pointer to the current diagonal element
+         , index_( index )  // The index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different DiagonalIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ET2 >
+      inline DiagonalIterator( const DiagonalIterator<ET2>& it )
+         : pos_  ( it.pos_   )  // Pointer to the current diagonal element
+         , index_( it.index_ )  // The index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline DiagonalIterator& operator++() {
+         ++pos_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const DiagonalIterator operator++( int ) {
+         const DiagonalIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline DiagonalIterator& operator--() {
+         --pos_;
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const DiagonalIterator operator--( int ) {
+         const DiagonalIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current diagonal element.
+      //
+      // \return Reference to the current diagonal element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( pos_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current diagonal element.
+      //
+      // \return Pointer to the current diagonal element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( pos_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side matrix iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ET2 >
+      inline bool operator==( const DiagonalIterator<ET2>& rhs ) const {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side matrix iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ET2 >
+      inline bool operator!=( const DiagonalIterator<ET2>& rhs ) const {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two matrix iterators.
+      //
+      // \param rhs The right-hand side matrix iterator.
+      // \return The number of elements between the two matrix iterators.
+      */
+      template< typename ET2 >
+      inline DifferenceType operator-( const DiagonalIterator<ET2>& rhs ) const {
+         return pos_ - rhs.pos_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ET*    pos_;    //!< Pointer to the current diagonal element.
+      size_t index_;  //!< The index of the current diagonal element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ET2 > friend class DiagonalIterator;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactDiagonalMatrix<Type,SO>   This;            //!< Type of this CompactDiagonalMatrix instance.
+   typedef This                             ResultType;      //!< Result type for expression template evaluations.
+   typedef CompactDiagonalMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompactDiagonalMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef DiagonalAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef DiagonalIterator<Type>           Iterator;        //!< Iterator over non-constant elements.
+   typedef DiagonalIterator<const Type>     ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactDiagonalMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompactDiagonalMatrix<ET,SO>  Other;  //!< The type of the other CompactDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompactDiagonalMatrix();
+                            explicit inline CompactDiagonalMatrix( size_t m, size_t n );
+                            explicit inline CompactDiagonalMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit inline CompactDiagonalMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline CompactDiagonalMatrix( const CompactDiagonalMatrix& sm );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompactDiagonalMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline CompactDiagonalMatrix& operator= ( const CompactDiagonalMatrix& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 capacity( size_t i ) const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                              inline Iterator               set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator               insert ( size_t i, size_t j, const Type& value );
+                              inline void                   erase  ( size_t i, size_t j );
+                              inline Iterator               erase  ( size_t i, Iterator pos );
+                              inline Iterator               erase  ( size_t i, Iterator first, Iterator last );
+                                     void                   resize ( size_t m, size_t n, bool preserve=true );
+                              inline void                   reserve( size_t nonzeros );
+                              inline void                   reserve( size_t i, size_t nonzeros );
+                              inline void                   trim   ();
+                              inline void                   trim   ( size_t i );
+                              inline CompactDiagonalMatrix& transpose();
+   template< typename Other > inline CompactDiagonalMatrix& scale( const Other& scalar );
+   template< typename Other > inline CompactDiagonalMatrix& scaleDiagonal( Other scalar );
+                              inline void                   swap( CompactDiagonalMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign   ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+
+   template< typename Other > inline void checkOffDiagonal( const Other& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the sparse matrix.
+   size_t n_;         //!< The current number of columns of the sparse matrix.
+   size_t capacity_;  //!< The maximum capacity of the diagonal.
+   Type* v_;          //!< The diagonal elements of the matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type CompactDiagonalMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactDiagonalMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix()
+   : m_       ( 0UL )   // The current number of rows of the sparse matrix
+   , n_       ( 0UL )   // The current number of columns of the sparse matrix
+   , capacity_( 0UL )   // The maximum capacity of the diagonal
+   , v_       ( NULL )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// All \f$ \min(M,N) \f$ diagonal elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t m, size_t n )
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( min( m, n ) )                // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+//
+// This constructor is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since the diagonal elements are always stored, the number of expected
+// non-zero elements is ignored.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( min( m, n ) )                // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   UNUSED_PARAMETER( nonzeros );
+
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+//
+// This constructor is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since the diagonal elements are always stored, the expected number of
+// non-zero elements per row/column is ignored.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( min( m, n ) )                // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   UNUSED_PARAMETER( nonzeros );
+
+   BLAZE_USER_ASSERT( nonzeros.size() == ( SO ? n : m ), "Size of capacity vector and number of rows/columns don't match" );
+
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompactDiagonalMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const CompactDiagonalMatrix& sm )
+   : m_       ( sm.m_ )                      // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                      // The current number of columns of the sparse matrix
+   , capacity_( sm.size() )                  // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   std::copy( sm.v_, sm.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// The given dense matrix is required to be diagonal, i.e. all off-diagonal elements are required
+// to be default values. Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( (~dm).rows() )               // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )            // The current number of columns of the sparse matrix
+   , capacity_( min( m_, n_ ) )              // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   using blaze::assign;
+
+   std::fill( v_, v_+capacity_, Type() );
+
+   try {
+      assign( *this, ~dm );
+   }
+   catch( ... ) {
+      deallocate( v_ );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// The given sparse matrix is required to be diagonal, i.e. all off-diagonal elements are required
+// to be default values. Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( (~sm).rows() )               // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )            // The current number of columns of the sparse matrix
+   , capacity_( min( m_, n_ ) )              // The maximum capacity of the diagonal
+   , v_       ( allocate<Type>( capacity_ ) )  // The diagonal elements of the matrix
+{
+   using blaze::assign;
+
+   std::fill( v_, v_+capacity_, Type() );
+
+   try {
+      assign( *this, ~sm );
+   }
+   catch( ... ) {
+      deallocate( v_ );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompactDiagonalMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::~CompactDiagonalMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// The function call operator provides access to all elements of the matrix. The attempt to
+// assign a non-default value to an off-diagonal element results in a \a std::invalid_argument
+// exception.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Reference
+   CompactDiagonalMatrix<Type,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstReference
+   CompactDiagonalMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( i == j )
+      return v_[i];
+   else
+      return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid sparse matrix row/column access index" );
+
+   const size_t index( min( i, size() ) );
+   return Iterator( v_+index, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid sparse matrix row/column access index" );
+
+   const size_t index( min( i, size() ) );
+   return ConstIterator( v_+index, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid sparse matrix row/column access index" );
+
+   const size_t index( min( i+1UL, size() ) );
+   return Iterator( v_+index, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid sparse matrix row/column access index" );
+
+   const size_t index( min( i+1UL, size() ) );
+   return ConstIterator( v_+index, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompactDiagonalMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator=( const CompactDiagonalMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+rhs.size(), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// The sparse matrix is resized according to the given matrix and initialized as a copy of
+// the diagonal of this matrix. In case the given matrix contains non-default off-diagonal
+// elements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompactDiagonalMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      CompactDiagonalMatrix tmp( (~rhs).rows(), (~rhs).columns() );
+      assign( tmp, ~rhs );
+      swap( tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix
+// contains non-default off-diagonal elements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompactDiagonalMatrix tmp( *this );
+   addAssign( tmp, ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix
+// contains non-default off-diagonal elements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompactDiagonalMatrix tmp( *this );
+   subAssign( tmp, ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the result of the
+// multiplication is not a diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompactDiagonalMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >::Type&
+   CompactDiagonalMatrix<Type,SO>::operator*=( Other rhs )
+{
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      v_[i] *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >::Type&
+   CompactDiagonalMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   const size_t k( size() );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<k; ++i )
+         v_[i] *= tmp;
+   }
+   else {
+      for( size_t i=0UL; i<k; ++i )
+         v_[i] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+   return ( i < size() )?( 1UL ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// Since all diagonal elements are permanently stored, this function always returns
+// \f$ \min(M,N) \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros() const
+{
+   return size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+   return ( i < size() )?( 1UL ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset()
+{
+   using blaze::reset;
+
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to reset.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset( size_t i )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   if( i < size() )
+      reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting elements of the sparse matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// This function sets the value of a diagonal element of the sparse matrix. The attempt to set
+// an off-diagonal element to a non-default value results in a \a std::invalid_argument
+// exception. Setting an off-diagonal element to its default value has no effect and the
+// function returns the end() iterator of the according row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid sparse matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid sparse matrix column access index" );
+
+   if( i != j ) {
+      checkOffDiagonal( value );
+      return end( SO ? j : i );
+   }
+
+   v_[i] = value;
+   return Iterator( v_+i, i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// Since all diagonal elements are permanently stored, inserting an element on the diagonal
+// overwrites the current value of the element. The attempt to insert a non-default element
+// into an off-diagonal position results in a \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   return set( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// Since the diagonal elements are permanently stored, erasing a diagonal element resets it to
+// its default value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( i == j )
+      reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// Since the diagonal elements are permanently stored, erasing a diagonal element resets it to
+// its default value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::erase( size_t i, Iterator pos )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   if( pos == end( i ) )
+      return pos;
+
+   reset( pos->value() );
+   return ++pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// Since the diagonal elements are permanently stored, erasing a diagonal element resets it to
+// its default value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+{
+   using blaze::reset;
+
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   for( ; first!=last; ++first )
+      reset( first->value() );
+
+   return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. New diagonal elements are default initialized.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompactDiagonalMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t oldSize( size() );
+   const size_t newSize( min( m, n ) );
+
+   if( newSize > capacity_ )
+   {
+      Type* tmp = allocate<Type>( newSize );
+
+      if( preserve ) {
+         std::copy( v_, v_+oldSize, tmp );
+         std::fill( tmp+oldSize, tmp+newSize, Type() );
+      }
+      else {
+         std::fill( tmp, tmp+newSize, Type() );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newSize;
+   }
+   else if( preserve ) {
+      if( newSize > oldSize )
+         std::fill( v_+oldSize, v_+newSize, Type() );
+   }
+   else {
+      std::fill( v_, v_+newSize, Type() );
+   }
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since all diagonal elements are permanently stored, it has no effect.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reserve( size_t nonzeros )
+{
+   UNUSED_PARAMETER( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since all diagonal elements are permanently stored, it has no effect.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   UNUSED_PARAMETER( i, nonzeros );
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// This function is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since all diagonal elements are permanently stored, it has no effect.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::trim()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since all diagonal elements are permanently stored, it has no effect.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::trim( size_t i )
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since the diagonal of a matrix is invariant under transposition, this operation merely swaps
+// the number of rows and columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::transpose()
+{
+   std::swap( m_, n_ );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::scale( const Other& scalar )
+{
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      v_[i] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::scaleDiagonal( Other scalar )
+{
+   return scale( scalar );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::swap( CompactDiagonalMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( v_, sm.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored diagonal elements (\f$ \min(M,N) \f$).
+//
+// \return The number of stored diagonal elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::size() const
+{
+   return min( m_, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking an assignment to an off-diagonal element.
+//
+// \param value The value to be assigned to the off-diagonal element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// This function checks whether the given value can be assigned to an off-diagonal element.
+// In case the value is not a default value, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the assigned value
+inline void CompactDiagonalMatrix<Type,SO>::checkOffDiagonal( const Other& value ) const
+{
+   using blaze::isDefault;
+
+   if( !isDefault( value ) )
+      throw std::invalid_argument( "Invalid assignment to non-diagonal matrix element" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   const size_t index( SO ? j : i );
+   return ( i == j )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const size_t index( SO ? j : i );
+   return ( i == j )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   const size_t index( SO ? j : i );
+   const size_t pos  ( SO ? i : j );
+   return ( index >= pos )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? j : i );
+   const size_t pos  ( SO ? i : j );
+   return ( index >= pos )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   const size_t index( SO ? j : i );
+   const size_t pos  ( SO ? i : j );
+   return ( index > pos )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? j : i );
+   const size_t pos  ( SO ? i : j );
+   return ( index > pos )?( begin( index ) ):( end( index ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// This function provides the low-level interface of all \b Blaze sparse matrices. Since the
+// diagonal elements are permanently stored, appending an element on the diagonal simply sets
+// the according value. The attempt to append a non-default element to an off-diagonal position
+// results in a \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   UNUSED_PARAMETER( check );
+
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   if( i == j )
+      v_[i] = value;
+   else
+      checkOffDiagonal( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is provided for compatibility with the remaining sparse matrices of the
+// \b Blaze library. Since all diagonal elements are permanently stored, it has no effect.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::finalize( size_t i )
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool CompactDiagonalMatrix<Type,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactDiagonalMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         if( i == j )
+            v_[i] = (~rhs)(i,j);
+         else if( !isDefault( (~rhs)(i,j) ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompactDiagonalMatrix<Type,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   reset();
+
+   const size_t iend( SO2 ? (~rhs).columns() : (~rhs).rows() );
+
+   for( size_t i=0UL; i<iend; ++i ) {
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         if( element->index() == i )
+            v_[i] = element->value();
+         else if( !isDefault( element->value() ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactDiagonalMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         if( i == j )
+            v_[i] += (~rhs)(i,j);
+         else if( !isDefault( (~rhs)(i,j) ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompactDiagonalMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t iend( SO2 ? (~rhs).columns() : (~rhs).rows() );
+
+   for( size_t i=0UL; i<iend; ++i ) {
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         if( element->index() == i )
+            v_[i] += element->value();
+         else if( !isDefault( element->value() ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactDiagonalMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         if( i == j )
+            v_[i] -= (~rhs)(i,j);
+         else if( !isDefault( (~rhs)(i,j) ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompactDiagonalMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::isDefault;
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t iend( SO2 ? (~rhs).columns() : (~rhs).rows() );
+
+   for( size_t i=0UL; i<iend; ++i ) {
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+         if( element->index() == i )
+            v_[i] -= element->value();
+         else if( !isDefault( element->value() ) )
+            throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) /* throw() */;
+
+template< typename Type, bool SO >
+inline void move( CompactDiagonalMatrix<Type,SO>& dst, CompactDiagonalMatrix<Type,SO>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compact diagonal matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void clear( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact diagonal matrix is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compact diagonal matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compact diagonal matrix to another.
+// \ingroup compact_diagonal_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void move( CompactDiagonalMatrix<Type,SO>& dst, CompactDiagonalMatrix<Type,SO>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< CompactDiagonalMatrix<T,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef CompactDiagonalMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef CompactDiagonalMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, T2 >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO>, StaticVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO>, HybridVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, DynamicVector<T2,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef typename MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename I2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, CompressedVector<T2,false,I2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO>, CompressedVector<T2,false,I2> >::Type  Type;
+};
+
+template< typename T1, typename I1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true,I1>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef typename MultTrait< CompressedVector<T1,true,I1>, CompressedMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct DivTrait< CompactDiagonalMatrix<T1,SO>, T2 >
+{
+   typedef CompactDiagonalMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MathTrait< CompactDiagonalMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef CompactDiagonalMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
+   typedef CompactDiagonalMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef CompressedMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,15 +42,18 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/DuplicatePolicy.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/TripletAssembly.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -61,6 +64,7 @@
 #include <blaze/math/traits/RowTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsCompressedMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
@@ -77,9 +81,11 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -99,11 +105,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order, and the index type of the matrix can be specified via
+// the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Index >
    class CompressedMatrix;
    \endcode
 
@@ -111,6 +117,13 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - Index: specifies the type of the stored indices of the non-zero elements. Valid index types
+//           are \a size_t (the default) and \a uint32_t. Since every non-zero element is stored
+//           as a value-index pair, 32-bit indices shrink the elements of small value types (for
+//           instance from 16 to 8 bytes for \a float values), but restrict the number of columns
+//           (row-major) or rows (column-major) to \f$ 2^{32} \f$. In case the number of
+//           columns/rows exceeds the range of the index type, a \a std::invalid_argument
+//           exception is thrown.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -201,12 +214,13 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the sparse matrix
-        , bool SO = defaultStorageOrder >  // Storage order
-class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename Index >                 // Index type of the non-zero elements
+class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO,Index>, SO >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,Index>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -250,10 +264,10 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,SO>   This;            //!< Type of this CompressedMatrix instance.
+   typedef CompressedMatrix<Type,SO,Index>   This;            //!< Type of this CompressedMatrix instance.
    typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,Index>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,Index>  TransposeType;   //!< Transpose type for expression template evaluations.
    typedef Type                        ElementType;     //!< Type of the sparse matrix elements.
    typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
    typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
@@ -268,7 +282,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,SO>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,SO,Index>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -289,6 +303,10 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                             explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
                                      inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO2 > inline CompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
+
+   template< typename IT1, typename IT2, typename IT3 >
+   explicit CompressedMatrix( size_t m, size_t n, size_t nonzeros, IT1 rows, IT2 columns,
+                              IT3 values, DuplicatePolicy policy=sumDuplicates );
    template< typename MT, bool SO2 > inline CompressedMatrix( const SparseMatrix<MT,SO2>& sm );
    //@}
    //**********************************************************************************************
@@ -354,8 +372,14 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                                      void              resize ( size_t m, size_t n, bool preserve=true );
                               inline void              reserve( size_t nonzeros );
                                      void              reserve( size_t i, size_t nonzeros );
+                                     void              reserve( const std::vector<size_t>& nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t i );
+
+   template< typename IT1, typename IT2, typename IT3 >
+   void assemble( size_t nonzeros, IT1 rows, IT2 columns, IT3 values,
+                  DuplicatePolicy policy=sumDuplicates );
+
                               inline CompressedMatrix& transpose();
    template< typename Other > inline CompressedMatrix& scale( const Other& scalar );
    template< typename Other > inline CompressedMatrix& scaleDiagonal( Other scalar );
@@ -408,6 +432,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -431,6 +457,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
    BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   BLAZE_STATIC_ASSERT( ( IsSame<Index,size_t>::value || IsSame<Index,uint32_t>::value ) );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -445,8 +472,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_ = Type();
+template< typename Type, bool SO, typename Index >
+const Type CompressedMatrix<Type,SO,Index>::zero_ = Type();
 
 
 
@@ -460,9 +487,10 @@ const Type CompressedMatrix<Type,SO>::zero_ = Type();
 //*************************************************************************************************
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix()
    : m_       ( 0UL )           // The current number of rows of the sparse matrix
    , n_       ( 0UL )           // The current number of columns of the sparse matrix
    , capacity_( 0UL )           // The current capacity of the pointer array
@@ -482,11 +510,12 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix( size_t m, size_t n )
    : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -506,11 +535,12 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -534,11 +564,12 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // row/column. Note that in case of a row-major matrix the given vector must have at least
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+CompressedMatrix<Type,SO,Index>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )   // The current number of columns of the sparse matrix
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
@@ -557,14 +588,61 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$ from unsorted triplets.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of given triplets.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements (\a sumDuplicates or \a overwriteDuplicates).
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This constructor initializes the matrix from \a nonzeros (row, column, value) triplets in
+// arbitrary order (see the assemble() function). The three given random access iterators (or
+// pointers) must refer to at least \a nonzeros elements each. In case any index exceeds the
+// size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+template< typename IT1      // Type of the row index iterator
+        , typename IT2      // Type of the column index iterator
+        , typename IT3 >    // Type of the value iterator
+CompressedMatrix<Type,SO,Index>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, IT1 rows,
+                                             IT2 columns, IT3 values, DuplicatePolicy policy )
+   : m_       ( m )                     // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the sparse matrix
+   , capacity_( m )                     // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+
+   try {
+      assemble( nonzeros, rows, columns, values, policy );
+   }
+   catch( ... ) {
+      deallocate( begin_[0UL] );
+      delete [] begin_;
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief The copy constructor for CompressedMatrix.
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.m_ )                     // The current capacity of the pointer array
@@ -586,16 +664,17 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( (~dm).rows() )                        // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~dm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                  // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )            // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                     // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -612,16 +691,17 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,Index>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( (~sm).rows() )                        // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~sm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                  // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )            // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                     // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -648,9 +728,10 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 //*************************************************************************************************
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
    delete [] begin_;
@@ -673,10 +754,11 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Reference
+   CompressedMatrix<Type,SO,Index>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -693,10 +775,11 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstReference
+   CompressedMatrix<Type,SO,Index>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -722,10 +805,11 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -744,10 +828,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -766,10 +851,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator to the first non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -788,10 +874,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -810,10 +897,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -832,10 +920,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -860,10 +949,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // The sparse matrix is resized according to the given sparse matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>&
+   CompressedMatrix<Type,SO,Index>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -909,22 +999,21 @@ inline CompressedMatrix<Type,SO>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,Index>&
+   CompressedMatrix<Type,SO,Index>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -941,25 +1030,28 @@ inline CompressedMatrix<Type,SO>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,Index>&
+   CompressedMatrix<Type,SO,Index>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
-   if( (~rhs).canAlias( this ) ||
-       (~rhs).rows()     > capacity_ ||
-       (~rhs).nonZeros() > capacity() ) {
+   if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
+   else if( (~rhs).rows()     > capacity_ ||
+            (~rhs).nonZeros() > capacity() ) {
+      CompressedMatrix tmp( (~rhs).rows(), (~rhs).columns(), (~rhs).nonZeros() );
+      smpAssign( tmp, ~rhs );
+      swap( tmp );
+   }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -977,19 +1069,18 @@ inline CompressedMatrix<Type,SO>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,Index>&
+   CompressedMatrix<Type,SO,Index>::operator+=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1005,18 +1096,17 @@ inline CompressedMatrix<Type,SO>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,Index>& CompressedMatrix<Type,SO,Index>::operator-=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1032,12 +1122,13 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,Index>&
+   CompressedMatrix<Type,SO,Index>::operator*=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -1058,10 +1149,11 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,Index> >::Type&
+   CompressedMatrix<Type,SO,Index>::operator*=( Other rhs )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       const Iterator last( end(i) );
@@ -1081,10 +1173,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,Index> >::Type&
+   CompressedMatrix<Type,SO,Index>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1127,9 +1220,10 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 //
 // \return The number of rows of the sparse matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::rows() const
 {
    return m_;
 }
@@ -1141,9 +1235,10 @@ inline size_t CompressedMatrix<Type,SO>::rows() const
 //
 // \return The number of columns of the sparse matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::columns() const
 {
    return n_;
 }
@@ -1155,9 +1250,10 @@ inline size_t CompressedMatrix<Type,SO>::columns() const
 //
 // \return The capacity of the sparse matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::capacity() const
 {
    return end_[m_] - begin_[0UL];
 }
@@ -1175,9 +1271,10 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const
 // in case the storage flag is set to \a columnMajor the function returns the capacity
 // of column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::capacity( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1190,9 +1287,10 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
 //
 // \return The number of non-zero elements in the sparse matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1215,9 +1313,10 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
 // the number of non-zero elements in column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1230,9 +1329,10 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 //
 // \return void
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1251,9 +1351,10 @@ inline void CompressedMatrix<Type,SO>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1268,9 +1369,10 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 //
 // After the clear() function, the size of the sparse matrix is 0.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::clear()
 {
    end_[0UL] = end_[m_];
    m_ = 0UL;
@@ -1291,10 +1393,11 @@ inline void CompressedMatrix<Type,SO>::clear()
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1323,10 +1426,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1351,10 +1455,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::copy_backward( pos, end_[i], end_[i]+1 );
@@ -1427,9 +1532,10 @@ typename CompressedMatrix<Type,SO>::Iterator
 //
 // This function erases an element from the sparse matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1452,10 +1558,11 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
 // \a columnMajor the function erases an element from column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -1480,10 +1587,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -1505,6 +1613,7 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \param n The new number of columns of the sparse matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Index type too small for the given number of columns.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -1513,15 +1622,18 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,SO,Index>::resize( size_t m, size_t n, bool preserve )
 {
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
+   checkIndexRange( n );
+
    if( m > capacity_ )
    {
       Iterator* newBegin( new Iterator[2UL*m+2UL] );
@@ -1597,9 +1709,10 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1621,9 +1734,10 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // In case the storage order is set to \a columnMajor, the function reserves capacity for column
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,SO,Index>::reserve( size_t i, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1681,6 +1795,133 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of all rows/columns of the sparse matrix.
+//
+// \param nonzeros The new minimum capacities of all rows/columns.
+// \return void
+//
+// This function sets the capacity of each row/column \a i of the sparse matrix to at least
+// \a nonzeros[i] elements in a single pass. In case the storage order is set to \a rowMajor,
+// the given vector must contain one capacity per row, in case the storage order is set to
+// \a columnMajor, it must contain one capacity per column. The current values of the sparse
+// matrix are preserved. In case the matrix doesn't contain any non-zero elements and the total
+// capacity suffices, no memory is allocated.
+//
+// After this call the rows/columns can be filled via the append() function in arbitrary order
+// without calling finalize(). Since every row/column has its own storage, distinct rows/columns
+// can even be filled concurrently, as long as each one stays within its capacity:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 3, 4 );
+
+   std::vector<size_t> nonzeros( 3 );
+   nonzeros[0] = 1; nonzeros[1] = 0; nonzeros[2] = 2;
+
+   A.reserve( nonzeros );  // Reserving 1, 0, and 2 elements for the rows 0, 1, and 2
+   A.append( 2, 0, 3.0 );  // Appending the value 3 in row 2 with column index 0
+   A.append( 0, 1, 1.0 );  // Appending the value 1 in row 0 with column index 1
+   A.append( 2, 3, 4.0 );  // Appending the value 4 in row 2 with column index 3
+   \endcode
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,SO,Index>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == rows(), "Invalid number of row capacities" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   size_t total( 0UL );
+   bool   empty( true );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      total += max( nonzeros[i], nonZeros(i) );
+      if( begin_[i] != end_[i] ) empty = false;
+   }
+
+   if( empty && total <= capacity() )
+   {
+      for( size_t i=0UL; i<m_; ++i ) {
+         end_  [i    ] = begin_[i];
+         begin_[i+1UL] = begin_[i] + nonzeros[i];
+      }
+   }
+   else
+   {
+      const size_t newCapacity( max( total, capacity() ) );
+
+      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newEnd   = newBegin+capacity_+1UL;
+
+      newBegin[0UL] = allocate<Element>( newCapacity );
+
+      for( size_t k=0UL; k<m_; ++k ) {
+         newEnd  [k    ] = std::copy( begin_[k], end_[k], newBegin[k] );
+         newBegin[k+1UL] = newBegin[k] + max( nonzeros[k], nonZeros(k) );
+      }
+
+      newEnd[m_] = newBegin[0UL]+newCapacity;
+
+      std::swap( newBegin, begin_ );
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+      end_ = newEnd;
+   }
+
+   BLAZE_INTERNAL_ASSERT( begin_[m_] <= end_[m_], "Invalid pointer calculations" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacing all elements of the matrix by the given unsorted triplets.
+//
+// \param nonzeros The number of given triplets.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements (\a sumDuplicates or \a overwriteDuplicates).
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the matrix by \a nonzeros (row, column, value)
+// triplets, which may be given in arbitrary order. The size of the matrix is not changed. The
+// three given random access iterators (or pointers) must refer to at least \a nonzeros elements
+// each. Duplicate elements are either summed up (\a sumDuplicates) or the last given triplet
+// takes precedence (\a overwriteDuplicates). Explicitly given zeros are stored as elements.
+
+   \code
+   const size_t rows   [] = { 1, 0, 1, 0 };
+   const size_t columns[] = { 2, 1, 0, 1 };
+   const double values [] = { 3.0, 1.0, 2.0, 4.0 };
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 2, 3 );
+   A.assemble( 4, rows, columns, values );  // Results in ( ( 0 5 0 ) ( 2 0 3 ) )
+   \endcode
+
+// In contrast to the insert() function the triplets are sorted by means of two linear-time
+// counting sorts and the matrix is allocated at most once. For large numbers of triplets the
+// sorting is performed in parallel (see the \a SMP_TRIPLETASSEMBLY_THRESHOLD). In case any index
+// exceeds the size of the matrix, a \a std::invalid_argument exception is thrown and the matrix
+// is not modified.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+template< typename IT1      // Type of the row index iterator
+        , typename IT2      // Type of the column index iterator
+        , typename IT3 >    // Type of the value iterator
+void CompressedMatrix<Type,SO,Index>::assemble( size_t nonzeros, IT1 rows, IT2 columns, IT3 values,
+                                          DuplicatePolicy policy )
+{
+   smpAssembleTriplets( *this, nonzeros, rows, columns, values, policy );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all excessive capacity from all rows/columns.
 //
@@ -1691,9 +1932,10 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // matrix) or columns (in case of a columnMajor matrix). Note that this function does not
 // remove the overall capacity but only reduces the capacity per row/column.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1712,9 +1954,10 @@ inline void CompressedMatrix<Type,SO>::trim()
 // or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
 // subsequent row/column.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1730,9 +1973,10 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,SO,Index>& CompressedMatrix<Type,SO,Index>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -1748,9 +1992,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,Index>& CompressedMatrix<Type,SO,Index>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( Iterator element=begin_[i]; element!=end_[i]; ++element )
@@ -1768,9 +2013,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,SO,Index>& CompressedMatrix<Type,SO,Index>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -1792,9 +2038,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Othe
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() */
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -1813,9 +2060,10 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() *
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1827,15 +2075,39 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the range of the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number of columns \a n.
+// \exception std::invalid_argument Index type too small for the given number of columns.
+//
+// This function checks whether all column indices in the range \f$[0..n)\f$ can be stored by
+// means of the index type \a Index. In case the index type is too small, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,SO,Index>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<Index>::max() ) )
+      throw std::invalid_argument( "Index type too small for the given number of columns" );
+   return n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reserving the specified number of sparse matrix elements.
 //
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,SO,Index>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -1881,10 +2153,11 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // invalidation due to inserting operations via the function call operator or the insert()
 // function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -1906,10 +2179,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // invalidation due to inserting operations via the function call operator or the insert()
 // function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -1934,10 +2208,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // iterator is subject to invalidation due to inserting operations via the function call operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -1959,10 +2234,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // iterator is subject to invalidation due to inserting operations via the function call operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
@@ -1985,10 +2261,11 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // iterator is subject to invalidation due to inserting operations via the function call operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::Iterator
+   CompressedMatrix<Type,SO,Index>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2010,10 +2287,11 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // iterator is subject to invalidation due to inserting operations via the function call operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,SO,Index>::ConstIterator
+   CompressedMatrix<Type,SO,Index>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j, FindIndex() );
@@ -2072,9 +2350,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2104,9 +2383,10 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,SO,Index>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2136,9 +2416,10 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,Index>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2156,9 +2437,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,Index>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2175,9 +2457,10 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline bool CompressedMatrix<Type,SO,Index>::canSMPAssign() const
 {
    return false;
 }
@@ -2195,11 +2478,12 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2247,10 +2531,11 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2278,10 +2563,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2324,11 +2610,12 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2350,11 +2637,12 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2376,11 +2664,12 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2402,11 +2691,12 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand sparse matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,Index>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2437,12 +2727,13 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the sparse matrix
-class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+class CompressedMatrix<Type,true,Index> : public SparseMatrix< CompressedMatrix<Type,true,Index>, true >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,Index>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -2486,10 +2777,10 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,true>   This;            //!< Type of this CompressedMatrix instance.
+   typedef CompressedMatrix<Type,true,Index>   This;            //!< Type of this CompressedMatrix instance.
    typedef This                          ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef CompressedMatrix<Type,false,Index>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false,Index>  TransposeType;   //!< Transpose type for expression template evaluations.
    typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
    typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
    typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
@@ -2504,7 +2795,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,true>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,true,Index>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -2525,6 +2816,10 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                            explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
                                     inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO > inline CompressedMatrix( const DenseMatrix<MT,SO>&  dm );
+
+   template< typename IT1, typename IT2, typename IT3 >
+   explicit CompressedMatrix( size_t m, size_t n, size_t nonzeros, IT1 rows, IT2 columns,
+                              IT3 values, DuplicatePolicy policy=sumDuplicates );
    template< typename MT, bool SO > inline CompressedMatrix( const SparseMatrix<MT,SO>& sm );
    //@}
    //**********************************************************************************************
@@ -2590,8 +2885,14 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                                      void              resize ( size_t m, size_t n, bool preserve=true );
                               inline void              reserve( size_t nonzeros );
                                      void              reserve( size_t j, size_t nonzeros );
+                                     void              reserve( const std::vector<size_t>& nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t j );
+
+   template< typename IT1, typename IT2, typename IT3 >
+   void assemble( size_t nonzeros, IT1 rows, IT2 columns, IT3 values,
+                  DuplicatePolicy policy=sumDuplicates );
+
                               inline CompressedMatrix& transpose();
    template< typename Other > inline CompressedMatrix& scale( const Other& scalar );
    template< typename Other > inline CompressedMatrix& scaleDiagonal( Other scalar );
@@ -2644,6 +2945,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -2667,6 +2970,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
    BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   BLAZE_STATIC_ASSERT( ( IsSame<Index,size_t>::value || IsSame<Index,uint32_t>::value ) );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -2682,8 +2986,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_ = Type();
+template< typename Type, typename Index >
+const Type CompressedMatrix<Type,true,Index>::zero_ = Type();
 
 
 
@@ -2698,8 +3002,9 @@ const Type CompressedMatrix<Type,true>::zero_ = Type();
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix()
    : m_       ( 0UL )             // The current number of rows of the sparse matrix
    , n_       ( 0UL )             // The current number of columns of the sparse matrix
    , capacity_( 0UL )             // The current capacity of the pointer array
@@ -2721,9 +3026,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix( size_t m, size_t n )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -2746,9 +3052,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -2774,9 +3081,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the sparse matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+CompressedMatrix<Type,true,Index>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( checkIndexRange( m ) )   // The current number of rows of the sparse matrix
    , n_       ( n )                      // The current number of columns of the sparse matrix
    , capacity_( n )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
@@ -2797,14 +3105,62 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$ from unsorted triplets.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of given triplets.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements (\a sumDuplicates or \a overwriteDuplicates).
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This constructor initializes the matrix from \a nonzeros (row, column, value) triplets in
+// arbitrary order (see the assemble() function). The three given random access iterators (or
+// pointers) must refer to at least \a nonzeros elements each. In case any index exceeds the
+// size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+template< typename IT1      // Type of the row index iterator
+        , typename IT2      // Type of the column index iterator
+        , typename IT3 >    // Type of the value iterator
+CompressedMatrix<Type,true,Index>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, IT1 rows,
+                                               IT2 columns, IT3 values, DuplicatePolicy policy )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the sparse matrix
+   , n_       ( n )                     // The current number of columns of the sparse matrix
+   , capacity_( n )                     // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+{
+   for( size_t j=0UL; j<2UL*n_+2UL; ++j )
+      begin_[j] = NULL;
+
+   try {
+      assemble( nonzeros, rows, columns, values, policy );
+   }
+   catch( ... ) {
+      deallocate( begin_[0UL] );
+      delete [] begin_;
+      throw;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The copy constructor for CompressedMatrix.
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.n_ )                     // The current capacity of the pointer array
@@ -2828,15 +3184,16 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+   : m_       ( checkIndexRange( (~dm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                  // The current number of columns of the sparse matrix
+   , capacity_( n_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )         // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                  // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2855,15 +3212,16 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,Index>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_       ( checkIndexRange( (~sm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                  // The current number of columns of the sparse matrix
+   , capacity_( n_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )         // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                  // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2892,8 +3250,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
    delete [] begin_;
@@ -2918,9 +3277,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Reference
+   CompressedMatrix<Type,true,Index>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2939,9 +3299,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstReference
+   CompressedMatrix<Type,true,Index>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2964,9 +3325,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -2982,9 +3344,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3000,9 +3363,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3018,9 +3382,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3036,9 +3401,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3054,9 +3420,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3083,9 +3450,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // The sparse matrix is resized according to the given sparse matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>&
+   CompressedMatrix<Type,true,Index>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -3133,21 +3501,20 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,Index>&
+   CompressedMatrix<Type,true,Index>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3166,24 +3533,27 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,Index>&
+   CompressedMatrix<Type,true,Index>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
-   if( (~rhs).canAlias( this ) ||
-       (~rhs).columns()  > capacity_ ||
-       (~rhs).nonZeros() > capacity() ) {
+   if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
+   else if( (~rhs).columns()  > capacity_ ||
+            (~rhs).nonZeros() > capacity() ) {
+      CompressedMatrix tmp( (~rhs).rows(), (~rhs).columns(), (~rhs).nonZeros() );
+      smpAssign( tmp, ~rhs );
+      swap( tmp );
+   }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3203,17 +3573,16 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,Index>& CompressedMatrix<Type,true,Index>::operator+=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -3231,17 +3600,16 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,Index>& CompressedMatrix<Type,true,Index>::operator-=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -3259,11 +3627,12 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,Index>&
+   CompressedMatrix<Type,true,Index>::operator*=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -3285,10 +3654,11 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The right-hand side scalar value for the multiplication.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,Index> >::Type&
+   CompressedMatrix<Type,true,Index>::operator*=( Other rhs )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       const Iterator last( end(j) );
@@ -3309,10 +3679,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 // \param rhs The right-hand side scalar value for the division.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,Index> >::Type&
+   CompressedMatrix<Type,true,Index>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -3357,8 +3728,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 //
 // \return The number of rows of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::rows() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::rows() const
 {
    return m_;
 }
@@ -3372,8 +3744,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const
 //
 // \return The number of columns of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::columns() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::columns() const
 {
    return n_;
 }
@@ -3387,8 +3760,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const
 //
 // \return The capacity of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::capacity() const
 {
    return end_[n_] - begin_[0UL];
 }
@@ -3403,8 +3777,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::capacity( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -3419,8 +3794,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
 //
 // \return The number of non-zero elements in the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -3440,8 +3816,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -3456,8 +3833,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -3476,8 +3854,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -3494,8 +3873,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the sparse matrix is 0.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::clear()
 {
    end_[0UL] = end_[n_];
    m_ = 0UL;
@@ -3518,9 +3898,10 @@ inline void CompressedMatrix<Type,true>::clear()
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3551,9 +3932,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3580,9 +3962,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the sparse matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[j+1UL] - end_[j] != 0 ) {
       std::copy_backward( pos, end_[j], end_[j]+1 );
@@ -3657,8 +4040,9 @@ typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases an element from the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3681,9 +4065,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -3708,9 +4093,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -3734,6 +4120,7 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param n The new number of columns of the sparse matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Index type too small for the given number of rows.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -3742,14 +4129,17 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::resize( size_t m, size_t n, bool preserve )
 {
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
+   checkIndexRange( m );
+
    if( n > capacity_ )
    {
       Iterator* newBegin( new Iterator[2UL*n+2UL] );
@@ -3827,8 +4217,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -3849,8 +4240,9 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // elements. The current values of the sparse matrix and all other individual column capacities are
 // preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::reserve( size_t j, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3909,6 +4301,102 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of all columns of the sparse matrix.
+//
+// \param nonzeros The new minimum capacities of all columns.
+// \return void
+//
+// This function sets the capacity of each column \a j of the sparse matrix to at least
+// \a nonzeros[j] elements in a single pass. The current values of the sparse matrix are
+// preserved. In case the matrix doesn't contain any non-zero elements and the total capacity
+// suffices, no memory is allocated. After this call the columns can be filled via the append()
+// function in arbitrary order without calling finalize().
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == columns(), "Invalid number of column capacities" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   size_t total( 0UL );
+   bool   empty( true );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      total += max( nonzeros[j], nonZeros(j) );
+      if( begin_[j] != end_[j] ) empty = false;
+   }
+
+   if( empty && total <= capacity() )
+   {
+      for( size_t j=0UL; j<n_; ++j ) {
+         end_  [j    ] = begin_[j];
+         begin_[j+1UL] = begin_[j] + nonzeros[j];
+      }
+   }
+   else
+   {
+      const size_t newCapacity( max( total, capacity() ) );
+
+      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newEnd   = newBegin+capacity_+1UL;
+
+      newBegin[0UL] = allocate<Element>( newCapacity );
+
+      for( size_t k=0UL; k<n_; ++k ) {
+         newEnd  [k    ] = std::copy( begin_[k], end_[k], newBegin[k] );
+         newBegin[k+1UL] = newBegin[k] + max( nonzeros[k], nonZeros(k) );
+      }
+
+      newEnd[n_] = newBegin[0UL]+newCapacity;
+
+      std::swap( newBegin, begin_ );
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+      end_ = newEnd;
+   }
+
+   BLAZE_INTERNAL_ASSERT( begin_[n_] <= end_[n_], "Invalid pointer calculations" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replacing all elements of the matrix by the given unsorted triplets.
+//
+// \param nonzeros The number of given triplets.
+// \param rows The row indices of the triplets.
+// \param columns The column indices of the triplets.
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements (\a sumDuplicates or \a overwriteDuplicates).
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the matrix by \a nonzeros (row, column, value)
+// triplets, which may be given in arbitrary order. The size of the matrix is not changed. In
+// case any index exceeds the size of the matrix, a \a std::invalid_argument exception is thrown
+// and the matrix is not modified.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+template< typename IT1      // Type of the row index iterator
+        , typename IT2      // Type of the column index iterator
+        , typename IT3 >    // Type of the value iterator
+void CompressedMatrix<Type,true,Index>::assemble( size_t nonzeros, IT1 rows, IT2 columns, IT3 values,
+                                            DuplicatePolicy policy )
+{
+   smpAssembleTriplets( *this, nonzeros, columns, rows, values, policy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Removing all excessive capacity from all columns.
@@ -3919,8 +4407,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -3940,8 +4429,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3959,8 +4449,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedMatrix<Type,true,Index>& CompressedMatrix<Type,true,Index>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -3977,9 +4468,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 // \param scalar The scalar value for the matrix scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,Index>& CompressedMatrix<Type,true,Index>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( Iterator element=begin_[j]; element!=end_[j]; ++element )
@@ -3998,9 +4490,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // \param scalar The scalar value for the diagonal scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,true,Index>& CompressedMatrix<Type,true,Index>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -4024,8 +4517,9 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal(
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw() */
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -4046,8 +4540,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw()
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4060,6 +4555,30 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checking the range of the index type.
+//
+// \param m The number of rows of the matrix.
+// \return The given number of rows \a m.
+// \exception std::invalid_argument Index type too small for the given number of rows.
+//
+// This function checks whether all row indices in the range \f$[0..m)\f$ can be stored by
+// means of the index type \a Index. In case the index type is too small, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedMatrix<Type,true,Index>::checkIndexRange( size_t m )
+{
+   if( m > 0UL && m-1UL > static_cast<size_t>( std::numeric_limits<Index>::max() ) )
+      throw std::invalid_argument( "Index type too small for the given number of rows" );
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Reserving the specified number of sparse matrix elements.
@@ -4067,8 +4586,9 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+void CompressedMatrix<Type,true,Index>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -4115,9 +4635,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -4140,9 +4661,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -4167,9 +4689,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -4191,9 +4714,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4216,9 +4740,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::Iterator
+   CompressedMatrix<Type,true,Index>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -4240,9 +4765,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedMatrix<Type,true,Index>::ConstIterator
+   CompressedMatrix<Type,true,Index>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4300,8 +4826,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4333,8 +4860,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedMatrix<Type,true,Index>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid row access index" );
 
@@ -4365,9 +4893,10 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,Index>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4386,9 +4915,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,Index>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4407,8 +4937,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the sparse matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
+inline bool CompressedMatrix<Type,true,Index>::canSMPAssign() const
 {
    return false;
 }
@@ -4428,10 +4959,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,Index>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4481,9 +5013,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,Index>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4513,9 +5046,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,Index>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4560,10 +5094,11 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,Index>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4587,10 +5122,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,Index>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4614,10 +5150,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,Index>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4641,10 +5178,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename Index >  // Index type of the non-zero elements
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,Index>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4671,23 +5209,23 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Index >
+inline void reset( CompressedMatrix<Type,SO,Index>& m );
 
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename Index >
+inline void reset( CompressedMatrix<Type,SO,Index>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Index >
+inline void clear( CompressedMatrix<Type,SO,Index>& m );
 
-template< typename Type, bool SO >
-inline bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Index >
+inline bool isDefault( const CompressedMatrix<Type,SO,Index>& m );
 
-template< typename Type, bool SO >
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */;
+template< typename Type, bool SO, typename Index >
+inline void swap( CompressedMatrix<Type,SO,Index>& a, CompressedMatrix<Type,SO,Index>& b ) /* throw() */;
 
-template< typename Type, bool SO >
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */;
+template< typename Type, bool SO, typename Index >
+inline void move( CompressedMatrix<Type,SO,Index>& dst, CompressedMatrix<Type,SO,Index>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -4699,9 +5237,10 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 // \param m The matrix to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void reset( CompressedMatrix<Type,SO,Index>& m )
 {
    m.reset();
 }
@@ -4721,9 +5260,10 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void reset( CompressedMatrix<Type,SO,Index>& m, size_t i )
 {
    m.reset( i );
 }
@@ -4737,9 +5277,10 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \param m The matrix to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void clear( CompressedMatrix<Type,SO,Index>& m )
 {
    m.clear();
 }
@@ -4764,9 +5305,10 @@ inline void clear( CompressedMatrix<Type,SO>& m )
    if( isDefault( A ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline bool isDefault( const CompressedMatrix<Type,SO,Index>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -4782,9 +5324,10 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void swap( CompressedMatrix<Type,SO,Index>& a, CompressedMatrix<Type,SO,Index>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -4800,9 +5343,10 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename Index >  // Index type of the non-zero elements
+inline void move( CompressedMatrix<Type,SO,Index>& dst, CompressedMatrix<Type,SO,Index>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -4819,8 +5363,28 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename I >
+struct IsResizable< CompressedMatrix<T,SO,I> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCOMPRESSEDMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename I >
+struct IsCompressedMatrix< CompressedMatrix<T,SO,I> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4839,88 +5403,88 @@ struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename I1, typename T2, size_t M, size_t N >
+struct AddTrait< CompressedMatrix<T1,SO,I1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename I2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename I1, typename T2, size_t M, size_t N >
+struct AddTrait< CompressedMatrix<T1,SO,I1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename I2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO,I1>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename I2 >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename I1, typename T2, typename I2 >
+struct AddTrait< CompressedMatrix<T1,SO,I1>, CompressedMatrix<T2,SO,I2> >
 {
-   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2, typename I2 >
+struct AddTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2,I2> >
 {
-   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false, typename MathTrait<I1,I2>::HighType >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -4936,88 +5500,88 @@ struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename I1, typename T2, size_t M, size_t N >
+struct SubTrait< CompressedMatrix<T1,SO,I1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename I2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename I1, typename T2, size_t M, size_t N >
+struct SubTrait< CompressedMatrix<T1,SO,I1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename I2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO,I1>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename I2 >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename I1, typename T2, typename I2 >
+struct SubTrait< CompressedMatrix<T1,SO,I1>, CompressedMatrix<T2,SO,I2> >
 {
-   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2, typename I2 >
+struct SubTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2,I2> >
 {
-   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false, typename MathTrait<I1,I2>::HighType >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5033,108 +5597,108 @@ struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, T2 >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, I1 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename I2 >
+struct MultTrait< T1, CompressedMatrix<T2,SO,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, I2 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, StaticVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename I2 >
+struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, HybridVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename I2 >
+struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, DynamicVector<T2,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename I2 >
+struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO,I2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename I1, typename T2, typename I2 >
+struct MultTrait< CompressedMatrix<T1,SO,I1>, CompressedVector<T2,false,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename I1, typename T2, bool SO, typename I2 >
+struct MultTrait< CompressedVector<T1,true,I1>, CompressedMatrix<T2,SO,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename I2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename I2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,I2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename I1, typename T2, bool SO2, typename I2 >
+struct MultTrait< CompressedMatrix<T1,SO1,I1>, CompressedMatrix<T2,SO2,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1, typename MathTrait<I1,I2>::HighType >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5150,10 +5714,10 @@ struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename I1, typename T2 >
+struct DivTrait< CompressedMatrix<T1,SO,I1>, T2 >
 {
-   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO, I1 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 /*! \endcond */
@@ -5170,11 +5734,11 @@ struct DivTrait< CompressedMatrix<T1,SO>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename I1, typename T2, typename I2 >
+struct MathTrait< CompressedMatrix<T1,SO,I1>, CompressedMatrix<T2,SO,I2> >
 {
-   typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
-   typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
+   typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO, typename MathTrait<I1,I2>::HighType >  HighType;
+   typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO, typename MathTrait<I1,I2>::HighType >  LowType;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5190,10 +5754,10 @@ struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct SubmatrixTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename I1 >
+struct SubmatrixTrait< CompressedMatrix<T1,SO,I1> >
 {
-   typedef CompressedMatrix<T1,SO>  Type;
+   typedef CompressedMatrix<T1,SO,I1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5209,10 +5773,10 @@ struct SubmatrixTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct RowTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename I1 >
+struct RowTrait< CompressedMatrix<T1,SO,I1> >
 {
-   typedef CompressedVector<T1,true>  Type;
+   typedef CompressedVector<T1,true,I1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5228,10 +5792,10 @@ struct RowTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct ColumnTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename I1 >
+struct ColumnTrait< CompressedMatrix<T1,SO,I1> >
 {
-   typedef CompressedVector<T1,false>  Type;
+   typedef CompressedVector<T1,false,I1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
@@ -76,9 +77,11 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -97,11 +100,11 @@ namespace blaze {
 // \ingroup compressed_vector
 //
 // The CompressedVector class is the representation of an arbitrarily sized sparse vector,
-// which stores only non-zero elements of arbitrary type. The type of the elements and the
-// transpose flag of the vector can be specified via the two template parameters:
+// which stores only non-zero elements of arbitrary type. The type of the elements, the transpose
+// flag, and the index type of the vector can be specified via the three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename Index >
    class CompressedVector;
    \endcode
 
@@ -109,6 +112,12 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
 //          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Index: specifies the type of the stored indices of the non-zero elements. Valid index types
+//           are \a size_t (the default) and \a uint32_t. Since every non-zero element is stored
+//           as a value-index pair, 32-bit indices shrink the elements of small value types (for
+//           instance from 16 to 8 bytes for \a float values), but restrict the size of the
+//           vector to \f$ 2^{32} \f$. In case the size exceeds the range of the index type, a
+//           \a std::invalid_argument exception is thrown.
 //
 // Inserting/accessing elements in a compressed vector can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -184,12 +193,13 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
-class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename Index >                  // Index type of the non-zero elements
+class CompressedVector : public SparseVector< CompressedVector<Type,TF,Index>, TF >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the compressed vector element.
+   typedef ValueIndexPair<Type,Index>  ElementBase;  //!< Base class for the compressed vector element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -233,9 +243,9 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedVector<Type,TF>   This;            //!< Type of this CompressedVector instance.
+   typedef CompressedVector<Type,TF,Index>   This;            //!< Type of this CompressedVector instance.
    typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedVector<Type,!TF>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef CompressedVector<Type,!TF,Index>  TransposeType;   //!< Transpose type for expression template evaluations.
    typedef Type                        ElementType;     //!< Type of the compressed vector elements.
    typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
    typedef const CompressedVector&     CompositeType;   //!< Data type for composite expression templates.
@@ -250,7 +260,7 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    */
    template< typename ET >  // Data type of the other vector
    struct Rebind {
-      typedef CompressedVector<ET,TF>  Other;  //!< The type of the other CompressedVector.
+      typedef CompressedVector<ET,TF,Index>  Other;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -377,6 +387,8 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    //@{
           Iterator insert( Iterator pos, size_t index, const Type& value );
    inline size_t   extendCapacity() const;
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -399,6 +411,7 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
    BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE( ElementBase, Element );
+   BLAZE_STATIC_ASSERT( ( IsSame<Index,size_t>::value || IsSame<Index,uint32_t>::value ) );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -413,9 +426,10 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
 //
 //=================================================================================================
 
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-const Type CompressedVector<Type,TF>::zero_ = Type();
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+const Type CompressedVector<Type,TF,Index>::zero_ = Type();
 
 
 
@@ -429,9 +443,10 @@ const Type CompressedVector<Type,TF>::zero_ = Type();
 //*************************************************************************************************
 /*!\brief The default constructor for CompressedVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>::CompressedVector()
    : size_    ( 0UL )   // The current size/dimension of the compressed vector
    , capacity_( 0UL )   // The maximum capacity of the compressed vector
    , begin_   ( NULL )  // Pointer to the first non-zero element of the compressed vector
@@ -445,13 +460,14 @@ inline CompressedVector<Type,TF>::CompressedVector()
 //
 // \param n The size of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n )
-   : size_    ( n   )   // The current size/dimension of the compressed vector
-   , capacity_( 0UL )   // The maximum capacity of the compressed vector
-   , begin_   ( NULL )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )  // Pointer to the last non-zero element of the compressed vector
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>::CompressedVector( size_t n )
+   : size_    ( checkIndexRange( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )                   // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                  // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -462,10 +478,11 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n )
 // \param n The size of the vector.
 // \param nonzeros The number of expected non-zero elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>::CompressedVector( size_t n, size_t nonzeros )
+   : size_    ( checkIndexRange( n ) )            // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -481,9 +498,10 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
 // The copy constructor is explicitly defined due to the required dynamic memory management
 // and in order to enable/facilitate NRV optimization.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>::CompressedVector( const CompressedVector& sv )
    : size_    ( sv.size_ )                        // The current size/dimension of the compressed vector
    , capacity_( sv.nonZeros() )                   // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
@@ -499,14 +517,15 @@ inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
 //
 // \param dv Dense vector to be copied.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the foreign dense vector
-inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
-   : size_    ( (~dv).size() )  // The current size/dimension of the compressed vector
-   , capacity_( 0UL  )          // The maximum capacity of the compressed vector
-   , begin_   ( NULL )          // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )          // Pointer to the last non-zero element of the compressed vector
+inline CompressedVector<Type,TF,Index>::CompressedVector( const DenseVector<VT,TF>& dv )
+   : size_    ( checkIndexRange( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                             // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                             // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                             // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~dv );
@@ -519,14 +538,15 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
 //
 // \param sv Sparse vector to be copied.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the foreign sparse vector
-inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
-   , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+inline CompressedVector<Type,TF,Index>::CompressedVector( const SparseVector<VT,TF>& sv )
+   : size_    ( checkIndexRange( (~sv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )                 // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_ ) )   // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_ )                           // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~sv );
@@ -545,9 +565,10 @@ inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& s
 //*************************************************************************************************
 /*!\brief The destructor for CompressedVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::~CompressedVector()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>::~CompressedVector()
 {
    deallocate( begin_ );
 }
@@ -573,10 +594,11 @@ inline CompressedVector<Type,TF>::~CompressedVector()
 // into the compressed vector. An alternative for traversing the non-zero elements of the sparse
 // vector are the begin() and end() functions.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::operator[]( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Reference
+   CompressedVector<Type,TF,Index>::operator[]( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -591,10 +613,11 @@ inline typename CompressedVector<Type,TF>::Reference
 // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::operator[]( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstReference
+   CompressedVector<Type,TF,Index>::operator[]( size_t index ) const
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -613,9 +636,10 @@ inline typename CompressedVector<Type,TF>::ConstReference
 //
 // \return Iterator to the first non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::begin()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator CompressedVector<Type,TF,Index>::begin()
 {
    return Iterator( begin_ );
 }
@@ -627,9 +651,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::b
 //
 // \return Iterator to the first non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::begin() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator CompressedVector<Type,TF,Index>::begin() const
 {
    return ConstIterator( begin_ );
 }
@@ -641,9 +666,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 //
 // \return Iterator to the first non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::cbegin() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator CompressedVector<Type,TF,Index>::cbegin() const
 {
    return ConstIterator( begin_ );
 }
@@ -655,9 +681,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 //
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::end()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator CompressedVector<Type,TF,Index>::end()
 {
    return Iterator( end_ );
 }
@@ -669,9 +696,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 //
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::end() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator CompressedVector<Type,TF,Index>::end() const
 {
    return ConstIterator( end_ );
 }
@@ -683,9 +711,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 //
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::cend() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator CompressedVector<Type,TF,Index>::cend() const
 {
    return ConstIterator( end_ );
 }
@@ -709,10 +738,11 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // The compressed vector is resized according to the given compressed vector and initialized
 // as a copy of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const CompressedVector& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline CompressedVector<Type,TF,Index>&
+   CompressedVector<Type,TF,Index>::operator=( const CompressedVector& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -746,22 +776,21 @@ inline CompressedVector<Type,TF>&
 // The vector is resized according to the given dense vector and initialized as a copy of
 // this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side dense vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,Index>&
+   CompressedVector<Type,TF,Index>::operator=( const DenseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
    }
    else {
-      size_ = (~rhs).size();
+      size_ = checkIndexRange( (~rhs).size() );
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -778,22 +807,26 @@ inline CompressedVector<Type,TF>&
 // The vector is resized according to the given sparse vector and initialized as a copy of
 // this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side sparse vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,Index>&
+   CompressedVector<Type,TF,Index>::operator=( const SparseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
-   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
+   if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
    }
+   else if( (~rhs).nonZeros() > capacity_ ) {
+      CompressedVector tmp( (~rhs).size(), (~rhs).nonZeros() );
+      smpAssign( tmp, ~rhs );
+      swap( tmp );
+   }
    else {
-      size_ = (~rhs).size();
+      size_ = checkIndexRange( (~rhs).size() );
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -811,17 +844,16 @@ inline CompressedVector<Type,TF>&
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,Index>& CompressedVector<Type,TF,Index>::operator+=( const Vector<VT,TF>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
 
    return *this;
 }
@@ -838,17 +870,16 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const V
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,Index>& CompressedVector<Type,TF,Index>::operator-=( const Vector<VT,TF>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
 
    return *this;
 }
@@ -866,15 +897,16 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const V
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,Index>& CompressedVector<Type,TF,Index>::operator*=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   CompressedVector<Type,TF> tmp( *this * (~rhs) );
+   CompressedVector<Type,TF,Index> tmp( *this * (~rhs) );
    swap( tmp );
 
    return *this;
@@ -894,10 +926,11 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator*=( const V
 // built-in data type.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
-   CompressedVector<Type,TF>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF,Index> >::Type&
+   CompressedVector<Type,TF,Index>::operator*=( Other rhs )
 {
    for( Iterator element=begin_; element!=end_; ++element )
       element->value_ *= rhs;
@@ -919,10 +952,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
 // type.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
-   CompressedVector<Type,TF>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF,Index> >::Type&
+   CompressedVector<Type,TF,Index>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -959,9 +993,10 @@ inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
 //
 // \return The size of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::size() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedVector<Type,TF,Index>::size() const
 {
    return size_;
 }
@@ -973,9 +1008,10 @@ inline size_t CompressedVector<Type,TF>::size() const
 //
 // \return The capacity of the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::capacity() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedVector<Type,TF,Index>::capacity() const
 {
    return capacity_;
 }
@@ -990,9 +1026,10 @@ inline size_t CompressedVector<Type,TF>::capacity() const
 // Note that the number of non-zero elements is always smaller than the current size of the
 // compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::nonZeros() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedVector<Type,TF,Index>::nonZeros() const
 {
    return end_ - begin_;
 }
@@ -1004,9 +1041,10 @@ inline size_t CompressedVector<Type,TF>::nonZeros() const
 //
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::reset()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::reset()
 {
    end_ = begin_;
 }
@@ -1020,9 +1058,10 @@ inline void CompressedVector<Type,TF>::reset()
 //
 // After the clear() function, the size of the compressed vector is 0.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::clear()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::clear()
 {
    size_ = 0UL;
    end_  = begin_;
@@ -1041,10 +1080,11 @@ inline void CompressedVector<Type,TF>::clear()
 // already contains an element with index \a index its value is modified, else a new element with
 // the given \a value is inserted.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::set( size_t index, const Type& value )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::set( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1071,10 +1111,11 @@ inline typename CompressedVector<Type,TF>::Iterator
 // are not allowed. In case the sparse vector already contains an element with index \a index,
 // a \a std::invalid_argument exception is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( size_t index, const Type& value )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::insert( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1097,10 +1138,11 @@ typename CompressedVector<Type,TF>::Iterator
 // \return Reference to the inserted value.
 // \exception std::invalid_argument Invalid compressed vector access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( Iterator pos, size_t index, const Type& value )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::insert( Iterator pos, size_t index, const Type& value )
 {
     if( nonZeros() != capacity_ ) {
       std::copy_backward( pos, end_, end_+1 );
@@ -1137,9 +1179,10 @@ typename CompressedVector<Type,TF>::Iterator
 //
 // This function erases an element from the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::erase( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::erase( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1158,9 +1201,10 @@ inline void CompressedVector<Type,TF>::erase( size_t index )
 //
 // This function erases an element from the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::erase( Iterator pos )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator CompressedVector<Type,TF,Index>::erase( Iterator pos )
 {
    BLAZE_USER_ASSERT( pos >= begin_ && pos <= end_, "Invalid compressed vector iterator" );
 
@@ -1180,10 +1224,11 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 //
 // This function erases a range of elements from the compressed vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator first, Iterator last )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::erase( Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1202,6 +1247,7 @@ inline typename CompressedVector<Type,TF>::Iterator
 // \param n The new size of the compressed vector.
 // \param preserve \a true if the old values of the vector should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Index type too small for the given size.
 //
 // This function resizes the compressed vector using the given size to \a n. During this
 // operation, new dynamic memory may be allocated in case the capacity of the compressed
@@ -1210,10 +1256,13 @@ inline typename CompressedVector<Type,TF>::Iterator
 // potentially changes all vector elements. In order to preserve the old vector values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::resize( size_t n, bool preserve )
 {
+   checkIndexRange( n );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1235,9 +1284,10 @@ inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 // This function increases the capacity of the compressed vector to at least \a n elements. The
 // current values of the vector elements are preserved.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void CompressedVector<Type,TF>::reserve( size_t n )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+void CompressedVector<Type,TF,Index>::reserve( size_t n )
 {
    if( n > capacity_ ) {
       const size_t newCapacity( n );
@@ -1262,9 +1312,10 @@ void CompressedVector<Type,TF>::reserve( size_t n )
 // \return Reference to the compressed vector.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the scalar value
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other& scalar )
+inline CompressedVector<Type,TF,Index>& CompressedVector<Type,TF,Index>::scale( const Other& scalar )
 {
    for( Iterator element=begin_; element!=end_; ++element )
       element->value_ *= scalar;
@@ -1280,9 +1331,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other&
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) /* throw() */
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::swap( CompressedVector& sv ) /* throw() */
 {
    std::swap( size_, sv.size_ );
    std::swap( capacity_, sv.capacity_ );
@@ -1300,9 +1352,10 @@ inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) /* throw() *
 // This function calculates a new vector capacity based on the current capacity of the sparse
 // vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::extendCapacity() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedVector<Type,TF,Index>::extendCapacity() const
 {
    using blaze::max;
    using blaze::min;
@@ -1318,6 +1371,29 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the range of the index type.
+//
+// \param n The size of the vector.
+// \return The given size \a n.
+// \exception std::invalid_argument Index type too small for the given size.
+//
+// This function checks whether all indices in the range \f$[0..n)\f$ can be stored by means
+// of the index type \a Index. In case the index type is too small, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t CompressedVector<Type,TF,Index>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<Index>::max() ) )
+      throw std::invalid_argument( "Index type too small for the given size" );
+   return n;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1339,9 +1415,10 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const
 // that the returned compressed vector iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::find( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator CompressedVector<Type,TF,Index>::find( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( index ) );
 }
@@ -1361,9 +1438,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::f
 // that the returned compressed vector iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::find( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator CompressedVector<Type,TF,Index>::find( size_t index ) const
 {
    const ConstIterator pos( lowerBound( index ) );
    if( pos != end_ && pos->index_ == index )
@@ -1385,10 +1463,11 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // iterator is subject to invalidation due to inserting operations via the subscript operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::lowerBound( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::lowerBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( index ) );
 }
@@ -1407,10 +1486,11 @@ inline typename CompressedVector<Type,TF>::Iterator
 // iterator is subject to invalidation due to inserting operations via the subscript operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::lowerBound( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator
+   CompressedVector<Type,TF,Index>::lowerBound( size_t index ) const
 {
    return std::lower_bound( begin_, end_, index, FindIndex() );
 }
@@ -1429,10 +1509,11 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // iterator is subject to invalidation due to inserting operations via the subscript operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::upperBound( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::Iterator
+   CompressedVector<Type,TF,Index>::upperBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( index ) );
 }
@@ -1451,10 +1532,11 @@ inline typename CompressedVector<Type,TF>::Iterator
 // iterator is subject to invalidation due to inserting operations via the subscript operator
 // or the insert() function!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::upperBound( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename CompressedVector<Type,TF,Index>::ConstIterator
+   CompressedVector<Type,TF,Index>::upperBound( size_t index ) const
 {
    return std::upper_bound( begin_, end_, index, FindIndex() );
 }
@@ -1493,9 +1575,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::append( size_t index, const Type& value, bool check )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void CompressedVector<Type,TF,Index>::append( size_t index, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
    BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity" );
@@ -1530,9 +1613,10 @@ inline void CompressedVector<Type,TF>::append( size_t index, const Type& value,
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const
+inline bool CompressedVector<Type,TF,Index>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1550,9 +1634,10 @@ inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const
+inline bool CompressedVector<Type,TF,Index>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1569,9 +1654,10 @@ inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current size of the
 // vector).
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool CompressedVector<Type,TF>::canSMPAssign() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline bool CompressedVector<Type,TF,Index>::canSMPAssign() const
 {
    return false;
 }
@@ -1589,10 +1675,11 @@ inline bool CompressedVector<Type,TF>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -1627,10 +1714,11 @@ inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -1658,10 +1746,11 @@ inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    typedef typename AddTrait<This,typename VT::ResultType>::Type  AddType;
 
@@ -1689,14 +1778,15 @@ inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
-   CompressedVector<Type,TF> tmp( serial( *this + (~rhs) ) );
+   CompressedVector<Type,TF,Index> tmp( serial( *this + (~rhs) ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -1713,10 +1803,11 @@ inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    typedef typename SubTrait<This,typename VT::ResultType>::Type  SubType;
 
@@ -1744,14 +1835,15 @@ inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,Index>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
-   CompressedVector<Type,TF> tmp( serial( *this - (~rhs) ) );
+   CompressedVector<Type,TF,Index> tmp( serial( *this - (~rhs) ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -1768,20 +1860,20 @@ inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs
 //*************************************************************************************************
 /*!\name CompressedVector operators */
 //@{
-template< typename Type, bool TF >
-inline void reset( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename Index >
+inline void reset( CompressedVector<Type,TF,Index>& v );
 
-template< typename Type, bool TF >
-inline void clear( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename Index >
+inline void clear( CompressedVector<Type,TF,Index>& v );
 
-template< typename Type, bool TF >
-inline bool isDefault( const CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename Index >
+inline bool isDefault( const CompressedVector<Type,TF,Index>& v );
 
-template< typename Type, bool TF >
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /* throw() */;
+template< typename Type, bool TF, typename Index >
+inline void swap( CompressedVector<Type,TF,Index>& a, CompressedVector<Type,TF,Index>& b ) /* throw() */;
 
-template< typename Type, bool TF >
-inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src ) /* throw() */;
+template< typename Type, bool TF, typename Index >
+inline void move( CompressedVector<Type,TF,Index>& dst, CompressedVector<Type,TF,Index>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -1793,9 +1885,10 @@ inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src
 // \param v The compressed vector to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( CompressedVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void reset( CompressedVector<Type,TF,Index>& v )
 {
    v.reset();
 }
@@ -1809,9 +1902,10 @@ inline void reset( CompressedVector<Type,TF>& v )
 // \param v The compressed vector to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( CompressedVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void clear( CompressedVector<Type,TF,Index>& v )
 {
    v.clear();
 }
@@ -1835,9 +1929,10 @@ inline void clear( CompressedVector<Type,TF>& v )
    if( isDefault( a ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const CompressedVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline bool isDefault( const CompressedVector<Type,TF,Index>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -1853,9 +1948,10 @@ inline bool isDefault( const CompressedVector<Type,TF>& v )
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /* throw() */
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void swap( CompressedVector<Type,TF,Index>& a, CompressedVector<Type,TF,Index>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -1871,9 +1967,10 @@ inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src ) /* throw() */
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void move( CompressedVector<Type,TF,Index>& dst, CompressedVector<Type,TF,Index>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -1890,8 +1987,8 @@ inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< CompressedVector<T,TF> > : public TrueType
+template< typename T, bool TF, typename I >
+struct IsResizable< CompressedVector<T,TF,I> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -1910,46 +2007,46 @@ struct IsResizable< CompressedVector<T,TF> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct AddTrait< CompressedVector<T1,TF,I1>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct AddTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct AddTrait< CompressedVector<T1,TF,I1>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2 >
+struct AddTrait< CompressedVector<T1,TF,I1>, DynamicVector<T2,TF> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename I2 >
+struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct AddTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename AddTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename AddTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -1965,46 +2062,46 @@ struct AddTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct SubTrait< CompressedVector<T1,TF,I1>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct SubTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct SubTrait< CompressedVector<T1,TF,I1>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2 >
+struct SubTrait< CompressedVector<T1,TF,I1>, DynamicVector<T2,TF> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename I2 >
+struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,I2> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct SubTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename SubTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename SubTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2020,142 +2117,142 @@ struct SubTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,TF,I1>, T2 >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I1 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool TF >
-struct MultTrait< T1, CompressedVector<T2,TF> >
+template< typename T1, typename T2, bool TF, typename I2 >
+struct MultTrait< T1, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I2 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,TF,I1>, StaticVector<T2,N,TF> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I1 >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,false>, StaticVector<T2,N,true> >
+template< typename T1, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,false,I1>, StaticVector<T2,N,true> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true, I1 >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,true>, StaticVector<T2,N,false> >
+template< typename T1, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,true,I1>, StaticVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct MultTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I2 >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,false>, CompressedVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename I2 >
+struct MultTrait< StaticVector<T1,N,false>, CompressedVector<T2,true,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, I2 >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,true>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename I2 >
+struct MultTrait< StaticVector<T1,N,true>, CompressedVector<T2,false,I2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,TF,I1>, HybridVector<T2,N,TF> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I1 >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,false>, HybridVector<T2,N,true> >
+template< typename T1, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,false,I1>, HybridVector<T2,N,true> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true, I1 >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,true>, HybridVector<T2,N,false> >
+template< typename T1, typename I1, typename T2, size_t N >
+struct MultTrait< CompressedVector<T1,true,I1>, HybridVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct MultTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I2 >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,false>, CompressedVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename I2 >
+struct MultTrait< HybridVector<T1,N,false>, CompressedVector<T2,true,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, I2 >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename I2 >
+struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false,I2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,TF,I1>, DynamicVector<T2,TF> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I1 >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,false,I1>, DynamicVector<T2,true> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true, I1 >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,true,I1>, DynamicVector<T2,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename I2 >
+struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, I2 >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename T2, typename I2 >
+struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, I2 >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename I2 >
+struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false,I2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct MultTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename I1, typename T2, typename I2 >
+struct MultTrait< CompressedVector<T1,false,I1>, CompressedVector<T2,true,I2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, typename MathTrait<I1,I2>::HighType >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename I1, typename T2, typename I2 >
+struct MultTrait< CompressedVector<T1,true,I1>, CompressedVector<T2,false,I2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
@@ -2173,8 +2270,8 @@ struct MultTrait< CompressedVector<T1,true>, CompressedVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, StaticVector<T2,3UL,false> >
+template< typename T1, typename I1, typename T2 >
+struct CrossTrait< CompressedVector<T1,false,I1>, StaticVector<T2,3UL,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2183,8 +2280,8 @@ struct CrossTrait< CompressedVector<T1,false>, StaticVector<T2,3UL,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename I2 >
+struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false,I2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2193,8 +2290,8 @@ struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct CrossTrait< CompressedVector<T1,false>, HybridVector<T2,N,false> >
+template< typename T1, typename I1, typename T2, size_t N >
+struct CrossTrait< CompressedVector<T1,false,I1>, HybridVector<T2,N,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2203,8 +2300,8 @@ struct CrossTrait< CompressedVector<T1,false>, HybridVector<T2,N,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename I2 >
+struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false,I2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2213,8 +2310,8 @@ struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
+template< typename T1, typename I1, typename T2 >
+struct CrossTrait< CompressedVector<T1,false,I1>, DynamicVector<T2,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2223,8 +2320,8 @@ struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename I2 >
+struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false,I2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2233,8 +2330,8 @@ struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, CompressedVector<T2,false> >
+template< typename T1, typename I1, typename T2, typename I2 >
+struct CrossTrait< CompressedVector<T1,false,I1>, CompressedVector<T2,false,I2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2256,10 +2353,10 @@ struct CrossTrait< CompressedVector<T1,false>, CompressedVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< CompressedVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename I1, typename T2 >
+struct DivTrait< CompressedVector<T1,TF,I1>, T2 >
 {
-   typedef CompressedVector< typename DivTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename DivTrait<T1,T2>::Type, TF, I1 >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 /*! \endcond */
@@ -2276,11 +2373,11 @@ struct DivTrait< CompressedVector<T1,TF>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MathTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct MathTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
 {
-   typedef CompressedVector< typename MathTrait<T1,T2>::HighType, TF >  HighType;
-   typedef CompressedVector< typename MathTrait<T1,T2>::LowType , TF >  LowType;
+   typedef CompressedVector< typename MathTrait<T1,T2>::HighType, TF, typename MathTrait<I1,I2>::HighType >  HighType;
+   typedef CompressedVector< typename MathTrait<T1,T2>::LowType , TF, typename MathTrait<I1,I2>::HighType >  LowType;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2296,10 +2393,10 @@ struct MathTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF >
-struct SubvectorTrait< CompressedVector<T1,TF> >
+template< typename T1, bool TF, typename I1 >
+struct SubvectorTrait< CompressedVector<T1,TF,I1> >
 {
-   typedef CompressedVector<T1,TF>  Type;
+   typedef CompressedVector<T1,TF,I1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
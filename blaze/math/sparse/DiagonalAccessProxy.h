@@ -0,0 +1,921 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DiagonalAccessProxy.h
+//  \brief Header file for the DiagonalAccessProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DIAGONALACCESSPROXY_H_
+#define _BLAZE_MATH_SPARSE_DIAGONALACCESSPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for sparse matrices with a fixed diagonal sparsity pattern.
+// \ingroup math
+//
+// The DiagonalAccessProxy provides safe access to the elements of a non-const sparse matrix
+// that exclusively stores its diagonal elements (as for instance the CompactDiagonalMatrix
+// class template). In contrast to the MatrixAccessProxy, the proxy never inserts or erases
+// elements: Accesses to diagonal elements are directly forwarded to the stored element, whereas
+// accesses to off-diagonal elements always represent a default value. Assigning a non-default
+// value to an off-diagonal element results in a \a std::invalid_argument exception:
+
+   \code
+   blaze::CompactDiagonalMatrix<double> A( 4, 4 );
+
+   A(1,1) = 2.0;  // Assignment to a diagonal element
+   A(1,2) = 0.0;  // Assignment of a default value to an off-diagonal element; has no effect
+   A(1,2) = 1.0;  // Invalid assignment to an off-diagonal element; results in an exception!
+
+   const double result = A(1,1) + A(1,2);  // Reads from off-diagonal elements return 0
+   \endcode
+*/
+template< typename MT >  // Type of the sparse matrix
+class DiagonalAccessProxy : public Proxy< DiagonalAccessProxy<MT>, typename MT::ElementType >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType  RepresentedType;  //!< Type of the represented sparse matrix element.
+   typedef RepresentedType&          RawReference;     //!< Raw reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DiagonalAccessProxy( MT& sm, size_t i, size_t j );
+            inline DiagonalAccessProxy( const DiagonalAccessProxy& dap );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+                          inline DiagonalAccessProxy& operator= ( const DiagonalAccessProxy& dap );
+   template< typename T > inline DiagonalAccessProxy& operator= ( const T& value );
+   template< typename T > inline DiagonalAccessProxy& operator+=( const T& value );
+   template< typename T > inline DiagonalAccessProxy& operator-=( const T& value );
+   template< typename T > inline DiagonalAccessProxy& operator*=( const T& value );
+   template< typename T > inline DiagonalAccessProxy& operator/=( const T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T > inline void check( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT&    sm_;  //!< Reference to the accessed sparse matrix.
+   size_t i_;   //!< Row-index of the accessed sparse matrix element.
+   size_t j_;   //!< Column-index of the accessed sparse matrix element.
+
+   mutable RepresentedType zero_;  //!< Representation of an off-diagonal element.
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   void* operator&() const;  //!< Address operator (private & undefined)
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a DiagonalAccessProxy.
+//
+// \param sm Reference to the accessed sparse matrix.
+// \param i The row-index of the accessed sparse matrix element.
+// \param j The column-index of the accessed sparse matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline DiagonalAccessProxy<MT>::DiagonalAccessProxy( MT& sm, size_t i, size_t j )
+   : sm_  ( sm )  // Reference to the accessed sparse matrix
+   , i_   ( i  )  // Row-index of the accessed sparse matrix element
+   , j_   ( j  )  // Column-index of the accessed sparse matrix element
+   , zero_(    )  // Representation of an off-diagonal element
+{
+   BLAZE_INTERNAL_ASSERT( i_ != j_ || sm_.find(i_,j_) != sm_.end(i_), "Missing diagonal element detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DiagonalAccessProxy.
+//
+// \param dap Diagonal access proxy to be copied.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline DiagonalAccessProxy<MT>::DiagonalAccessProxy( const DiagonalAccessProxy& dap )
+   : sm_  ( dap.sm_ )  // Reference to the accessed sparse matrix
+   , i_   ( dap.i_  )  // Row-index of the accessed sparse matrix element
+   , j_   ( dap.j_  )  // Column-index of the accessed sparse matrix element
+   , zero_(         )  // Representation of an off-diagonal element
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DiagonalAccessProxy.
+//
+// \param dap Diagonal access proxy to be copied.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator=( const DiagonalAccessProxy& dap )
+{
+   check( dap.get() );
+   get() = dap.get();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed sparse matrix element.
+//
+// \param value The new value of the sparse matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator=( const T& value )
+{
+   check( value );
+   get() = value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed sparse matrix element.
+//
+// \param value The right-hand side value to be added to the sparse matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator+=( const T& value )
+{
+   check( value );
+   get() += value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed sparse matrix element.
+//
+// \param value The right-hand side value to be subtracted from the sparse matrix element.
+// \return Reference to the assigned access proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator-=( const T& value )
+{
+   check( value );
+   get() -= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed sparse matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned access proxy.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator*=( const T& value )
+{
+   get() *= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed sparse matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned access proxy.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline DiagonalAccessProxy<MT>& DiagonalAccessProxy<MT>::operator/=( const T& value )
+{
+   get() /= value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed sparse matrix element.
+//
+// \return Direct/raw reference to the accessed sparse matrix element.
+//
+// In case the proxy represents an off-diagonal element, the function returns a reference to
+// a default value that is owned by the proxy.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline typename DiagonalAccessProxy<MT>::RawReference DiagonalAccessProxy<MT>::get() const
+{
+   using blaze::reset;
+
+   if( i_ != j_ ) {
+      reset( zero_ );
+      return zero_;
+   }
+
+   return sm_.find( i_, j_ )->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking an assignment to the accessed sparse matrix element.
+//
+// \param value The value to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+template< typename T >   // Type of the right-hand side value
+inline void DiagonalAccessProxy<MT>::check( const T& value ) const
+{
+   using blaze::isDefault;
+
+   if( i_ != j_ && !isDefault( value ) )
+      throw std::invalid_argument( "Invalid assignment to non-diagonal matrix element" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed sparse matrix element.
+//
+// \return Direct/raw reference to the accessed sparse matrix element.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline DiagonalAccessProxy<MT>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DiagonalAccessProxy operators */
+//@{
+template< typename MT1, typename MT2 >
+inline bool operator==( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator==( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator==( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator!=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator!=( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator!=( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator<( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator<( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator<( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator>( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator>( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator>( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator<=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator<=( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator<=( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT1, typename MT2 >
+inline bool operator>=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs );
+
+template< typename MT, typename T >
+inline bool operator>=( const DiagonalAccessProxy<MT>& lhs, const T& rhs );
+
+template< typename T, typename MT >
+inline bool operator>=( const T& lhs, const DiagonalAccessProxy<MT>& rhs );
+
+template< typename MT >
+inline std::ostream& operator<<( std::ostream& os, const DiagonalAccessProxy<MT>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator==( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename MT, typename T >
+inline bool operator==( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename MT >
+inline bool operator==( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator!=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename MT, typename T >
+inline bool operator!=( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename MT >
+inline bool operator!=( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator<( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator<( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator<( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator>( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator>( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator>( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator<=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator<=( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator<=( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two DiagonalAccessProxy objects.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+inline bool operator>=( const DiagonalAccessProxy<MT1>& lhs, const DiagonalAccessProxy<MT2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a DiagonalAccessProxy object and an object of different type.
+// \ingroup math
+//
+// \param lhs The left-hand side DiagonalAccessProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename MT, typename T >
+inline bool operator>=( const DiagonalAccessProxy<MT>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a DiagonalAccessProxy object.
+// \ingroup math
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side DiagonalAccessProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename MT >
+inline bool operator>=( const T& lhs, const DiagonalAccessProxy<MT>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for the DiagonalAccessProxy class template.
+// \ingroup math
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename MT >
+inline std::ostream& operator<<( std::ostream& os, const DiagonalAccessProxy<MT>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DiagonalAccessProxy global functions */
+//@{
+template< typename MT >
+inline void reset( const DiagonalAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline void clear( const DiagonalAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isDefault( const DiagonalAccessProxy<MT>& proxy );
+
+template< typename MT >
+inline void swap( const DiagonalAccessProxy<MT>& a, const DiagonalAccessProxy<MT>& b ) /* throw() */;
+
+template< typename MT, typename T >
+inline void swap( const DiagonalAccessProxy<MT>& a, T& b ) /* throw() */;
+
+template< typename T, typename MT >
+inline void swap( T& a, const DiagonalAccessProxy<MT>& v ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial value.
+// In case the access proxy represents a vector- or matrix-like data structure that provides a
+// reset() function, this function resets all elements of the vector/matrix to the default initial
+// values.
+*/
+template< typename MT >
+inline void reset( const DiagonalAccessProxy<MT>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial state.
+// In case the access proxy represents a vector- or matrix-like data structure that provides a
+// clear() function, this function clears the vector/matrix to its default initial state.
+*/
+template< typename MT >
+inline void clear( const DiagonalAccessProxy<MT>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isDefault( const DiagonalAccessProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two access proxies.
+// \ingroup math
+//
+// \param a The first access proxy to be swapped.
+// \param b The second access proxy to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename MT >
+inline void swap( const DiagonalAccessProxy<MT>& a, const DiagonalAccessProxy<MT>& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a.get(), b.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of an access proxy with another element.
+// \ingroup math
+//
+// \param a The access proxy to be swapped.
+// \param b The other element to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename MT, typename T >
+inline void swap( const DiagonalAccessProxy<MT>& a, T& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a.get(), b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of an access proxy with another element.
+// \ingroup math
+//
+// \param a The other element to be swapped.
+// \param b The access proxy to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename T, typename MT >
+inline void swap( T& a, const DiagonalAccessProxy<MT>& b ) /* throw() */
+{
+   using std::swap;
+
+   swap( a, b.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
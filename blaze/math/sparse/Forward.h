@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +51,15 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
-template< typename, bool > class CompressedVector;
+template< typename, size_t > class BlockCompressedMatrix;
+template< typename, bool > class CompactDiagonalMatrix;
+template< typename, bool, typename = size_t > class CompressedMatrix;
+template< typename, bool, typename = size_t > class CompressedVector;
+class LevelSchedule;
+template< typename > class SlicedEllpackMatrix;
+class SpGEMMPlan;
+template< typename, bool, typename > class SplitCompressedMatrix;
+template< typename, bool, typename > class SplitCompressedVector;
 
 } // namespace blaze
 
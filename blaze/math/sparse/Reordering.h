@@ -0,0 +1,860 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for bandwidth-reducing and fill-reducing orderings of sparse matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adjacency graph of the symmetrized sparsity pattern of a square sparse matrix.
+// \ingroup sparse_matrix
+//
+// The ReorderingGraph class represents the undirected graph of the sparsity pattern of
+// \f$ A+A^T \f$ (without the diagonal) of a square compressed matrix \a A in compressed form.
+// It provides the Reverse Cuthill-McKee and the nested dissection orderings that are used by
+// the reverseCuthillMcKee() and nestedDissection() functions. Both orderings are based on
+// rooted level structures, i.e. breadth-first searches starting at a pseudo-peripheral node
+// as determined by the algorithm of George and Liu.
+*/
+class ReorderingGraph
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>  Nodes;  //!< List of node indices.
+   //**********************************************************************************************
+
+   //**DegreeLess struct definition****************************************************************
+   /*!\brief Comparison of two nodes by their degree.
+   */
+   struct DegreeLess
+   {
+      explicit inline DegreeLess( const ReorderingGraph& graph ) : graph_( &graph ) {}
+
+      inline bool operator()( size_t a, size_t b ) const {
+         return graph_->degree( a ) < graph_->degree( b );
+      }
+
+      const ReorderingGraph* graph_;  //!< The graph containing the nodes.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename Type, bool SO, typename Index >
+   explicit inline ReorderingGraph( const CompressedMatrix<Type,SO,Index>& A );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline size_t degree( size_t i ) const;
+   inline void   reverseCuthillMcKee( Nodes& perm );
+   inline void   nestedDissection( size_t leafSize, Nodes& perm );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t levelStructure( size_t root, size_t label, Nodes& order, Nodes& levels );
+   inline size_t peripheralNode( size_t root, size_t label, Nodes& order, Nodes& levels );
+   inline void   dissect( const Nodes& nodes, size_t label, size_t leafSize, Nodes& perm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Nodes  begin_;     //!< The offsets of the adjacency lists of all nodes.
+   Nodes  adjacent_;  //!< The concatenated adjacency lists of all nodes.
+   Nodes  label_;     //!< The label of the subgraph each node currently belongs to.
+   Nodes  mark_;      //!< The most recent breadth-first search visiting each node.
+   size_t stamp_;     //!< The number of performed breadth-first searches.
+   size_t labels_;    //!< The number of used subgraph labels.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the adjacency graph of the symmetrized sparsity pattern of the given matrix.
+//
+// \param A The given square compressed matrix.
+//
+// Each off-diagonal element \f$ a_{ij} \f$ results in the undirected edge \f$ (i,j) \f$,
+// independent of the existence of \f$ a_{ji} \f$.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order of the matrix
+        , typename Index >  // Index type of the matrix
+inline ReorderingGraph::ReorderingGraph( const CompressedMatrix<Type,SO,Index>& A )
+   : begin_   ( A.rows()+1UL, 0UL )  // The offsets of the adjacency lists of all nodes
+   , adjacent_()                     // The concatenated adjacency lists of all nodes
+   , label_   ( A.rows(), 0UL )      // The label of the subgraph each node currently belongs to
+   , mark_    ( A.rows(), 0UL )      // The most recent breadth-first search visiting each node
+   , stamp_   ( 0UL )                // The number of performed breadth-first searches
+   , labels_  ( 1UL )                // The number of used subgraph labels
+{
+   typedef typename CompressedMatrix<Type,SO,Index>::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( A.rows() == A.columns(), "Non-square matrix detected" );
+
+   const size_t n( A.rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( element->index() != i ) {
+            ++begin_[i+1UL];
+            ++begin_[element->index()+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      begin_[i+1UL] += begin_[i];
+   }
+
+   adjacent_.resize( begin_[n] );
+   Nodes pos( begin_.begin(), begin_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j != i ) {
+            adjacent_[pos[i]++] = j;
+            adjacent_[pos[j]++] = i;
+         }
+      }
+   }
+
+   // Removing the duplicate edges of symmetric matrices
+   size_t first( 0UL ), kept( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t last( begin_[i+1UL] );
+      std::sort( adjacent_.begin()+first, adjacent_.begin()+last );
+      Nodes::iterator unique( std::unique( adjacent_.begin()+first, adjacent_.begin()+last ) );
+      begin_[i] = kept;
+      kept = std::copy( adjacent_.begin()+first, unique, adjacent_.begin()+kept )
+           - adjacent_.begin();
+      first = last;
+   }
+
+   begin_[n] = kept;
+   adjacent_.resize( kept );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of nodes of the graph.
+//
+// \return The number of nodes.
+*/
+inline size_t ReorderingGraph::size() const
+{
+   return label_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of neighbors of the given node.
+//
+// \param i The index of the node.
+// \return The number of neighbors of the node.
+*/
+inline size_t ReorderingGraph::degree( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid node access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Reverse Cuthill-McKee ordering of the graph.
+//
+// \param perm The resulting permutation (the original index of each new index).
+// \return void
+//
+// Each connected component is numbered by a breadth-first search starting at a pseudo-peripheral
+// node, which visits the neighbors of each node in the order of increasing degree. Afterwards
+// the entire numbering is reversed.
+*/
+inline void ReorderingGraph::reverseCuthillMcKee( Nodes& perm )
+{
+   const size_t n( size() );
+
+   std::fill( label_.begin(), label_.end(), 0UL );
+
+   perm.clear();
+   perm.reserve( n );
+
+   std::vector<bool> numbered( n, false );
+   Nodes order, levels;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      if( numbered[i] ) continue;
+
+      const size_t root( peripheralNode( i, 0UL, order, levels ) );
+
+      size_t head( perm.size() );
+      perm.push_back( root );
+      numbered[root] = true;
+
+      while( head < perm.size() )
+      {
+         const size_t node( perm[head++] );
+         const size_t first( perm.size() );
+
+         for( size_t k=begin_[node]; k<begin_[node+1UL]; ++k ) {
+            const size_t neighbor( adjacent_[k] );
+            if( !numbered[neighbor] ) {
+               numbered[neighbor] = true;
+               perm.push_back( neighbor );
+            }
+         }
+
+         std::stable_sort( perm.begin()+first, perm.end(), DegreeLess( *this ) );
+      }
+   }
+
+   std::reverse( perm.begin(), perm.end() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a nested dissection ordering of the graph.
+//
+// \param leafSize The maximum number of nodes of a subgraph that is not further dissected.
+// \param perm The resulting permutation (the original index of each new index).
+// \return void
+//
+// Each connected component is recursively split into two halves by a level set separator (see
+// the dissect() function). The separator nodes are numbered after the nodes of both halves.
+*/
+inline void ReorderingGraph::nestedDissection( size_t leafSize, Nodes& perm )
+{
+   const size_t n( size() );
+
+   std::fill( label_.begin(), label_.end(), 0UL );
+   labels_ = 1UL;
+
+   perm.clear();
+   perm.reserve( n );
+
+   Nodes nodes( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      nodes[i] = i;
+   }
+
+   dissect( nodes, 0UL, leafSize, perm );
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid number of ordered nodes" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the rooted level structure of the given node within its subgraph.
+//
+// \param root The root node of the level structure.
+// \param label The label of the subgraph.
+// \param order The resulting nodes in breadth-first order.
+// \param levels The resulting offsets of the levels within \a order.
+// \return The number of levels.
+//
+// Only nodes with the given label are visited. The nodes of level \a l are contained in the
+// range \f$ [levels[l]..levels[l+1]) \f$ of \a order.
+*/
+inline size_t ReorderingGraph::levelStructure( size_t root, size_t label,
+                                               Nodes& order, Nodes& levels )
+{
+   BLAZE_INTERNAL_ASSERT( label_[root] == label, "Invalid root node" );
+
+   ++stamp_;
+
+   order.clear();
+   levels.clear();
+
+   order.push_back( root );
+   mark_[root] = stamp_;
+
+   size_t head( 0UL );
+
+   while( head < order.size() )
+   {
+      levels.push_back( head );
+
+      for( const size_t tail=order.size(); head<tail; ++head ) {
+         const size_t node( order[head] );
+         for( size_t k=begin_[node]; k<begin_[node+1UL]; ++k ) {
+            const size_t neighbor( adjacent_[k] );
+            if( label_[neighbor] == label && mark_[neighbor] != stamp_ ) {
+               mark_[neighbor] = stamp_;
+               order.push_back( neighbor );
+            }
+         }
+      }
+   }
+
+   levels.push_back( order.size() );
+
+   return levels.size() - 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines a pseudo-peripheral node within the subgraph of the given node.
+//
+// \param root The starting node of the search.
+// \param label The label of the subgraph.
+// \param order The resulting nodes of the subgraph in breadth-first order.
+// \param levels The resulting offsets of the levels within \a order.
+// \return The pseudo-peripheral node.
+//
+// Starting at the given node, the node of minimum degree in the last level of the current
+// level structure is selected as new root until the number of levels stops to increase. On
+// return, \a order and \a levels contain the level structure rooted at the resulting node.
+*/
+inline size_t ReorderingGraph::peripheralNode( size_t root, size_t label,
+                                               Nodes& order, Nodes& levels )
+{
+   size_t height( levelStructure( root, label, order, levels ) );
+
+   while( true )
+   {
+      size_t candidate( order[levels[height-1UL]] );
+
+      for( size_t k=levels[height-1UL]+1UL; k<levels[height]; ++k ) {
+         if( degree( order[k] ) < degree( candidate ) )
+            candidate = order[k];
+      }
+
+      const size_t newHeight( levelStructure( candidate, label, order, levels ) );
+
+      BLAZE_INTERNAL_ASSERT( newHeight >= height, "Invalid level structure detected" );
+
+      if( newHeight == height )
+         return candidate;
+
+      height = newHeight;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive nested dissection of the given subgraph.
+//
+// \param nodes The nodes of the subgraph (nodes that have already been relabeled are skipped).
+// \param label The label of the subgraph.
+// \param leafSize The maximum number of nodes of a subgraph that is not further dissected.
+// \param perm The permutation the ordered nodes are appended to.
+// \return void
+//
+// Each connected component of the subgraph is handled separately. Small components and
+// components with less than three levels are numbered in breadth-first order. All other
+// components are split at the level of their rooted level structure that contains the median
+// node. Separator nodes that are not adjacent to the upper half are moved to the lower half,
+// the remaining separator nodes are numbered after both recursively ordered halves.
+*/
+inline void ReorderingGraph::dissect( const Nodes& nodes, size_t label,
+                                      size_t leafSize, Nodes& perm )
+{
+   Nodes order, levels, lower, upper, separator;
+
+   for( size_t i=0UL; i<nodes.size(); ++i )
+   {
+      if( label_[nodes[i]] != label ) continue;
+
+      peripheralNode( nodes[i], label, order, levels );
+
+      const size_t height( levels.size() - 1UL );
+
+      if( order.size() <= leafSize || height < 3UL )
+      {
+         const size_t done( labels_++ );
+         for( size_t k=0UL; k<order.size(); ++k ) {
+            label_[order[k]] = done;
+         }
+         perm.insert( perm.end(), order.begin(), order.end() );
+         continue;
+      }
+
+      size_t middle( 1UL );
+      while( middle < height-2UL && levels[middle+1UL] <= order.size()/2UL ) {
+         ++middle;
+      }
+
+      const size_t lowerLabel    ( labels_++ );
+      const size_t upperLabel    ( labels_++ );
+      const size_t separatorLabel( labels_++ );
+
+      lower.assign( order.begin(), order.begin()+levels[middle] );
+      upper.assign( order.begin()+levels[middle+1UL], order.end() );
+      separator.clear();
+
+      for( size_t k=0UL; k<lower.size(); ++k ) {
+         label_[lower[k]] = lowerLabel;
+      }
+
+      for( size_t k=0UL; k<upper.size(); ++k ) {
+         label_[upper[k]] = upperLabel;
+      }
+
+      for( size_t k=levels[middle]; k<levels[middle+1UL]; ++k )
+      {
+         const size_t node( order[k] );
+
+         bool isSeparator( false );
+         for( size_t l=begin_[node]; l<begin_[node+1UL]; ++l ) {
+            if( label_[adjacent_[l]] == upperLabel ) {
+               isSeparator = true;
+               break;
+            }
+         }
+
+         if( isSeparator ) {
+            label_[node] = separatorLabel;
+            separator.push_back( node );
+         }
+         else {
+            label_[node] = lowerLabel;
+            lower.push_back( node );
+         }
+      }
+
+      dissect( lower, lowerLabel, leafSize, perm );
+      dissect( upper, upperLabel, leafSize, perm );
+      perm.insert( perm.end(), separator.begin(), separator.end() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reordering functions */
+//@{
+template< typename Type, bool SO, typename Index >
+void reverseCuthillMcKee( const CompressedMatrix<Type,SO,Index>& A, std::vector<size_t>& perm );
+
+template< typename Type, bool SO, typename Index >
+void nestedDissection( const CompressedMatrix<Type,SO,Index>& A, std::vector<size_t>& perm,
+                       size_t leafSize=64UL );
+
+template< typename Type, bool SO, typename Index >
+size_t bandwidth( const CompressedMatrix<Type,SO,Index>& A );
+
+inline void invertPermutation( const std::vector<size_t>& perm, std::vector<size_t>& inv );
+
+template< typename Type, bool SO, typename Index >
+void permute( const CompressedMatrix<Type,SO,Index>& A, const std::vector<size_t>& perm,
+              CompressedMatrix<Type,SO,Index>& B );
+
+template< typename VT1, bool TF, typename VT2 >
+void permute( const DenseVector<VT1,TF>& x, const std::vector<size_t>& perm,
+              DenseVector<VT2,TF>& y );
+
+template< typename VT1, bool TF, typename VT2 >
+void unpermute( const DenseVector<VT1,TF>& y, const std::vector<size_t>& perm,
+                DenseVector<VT2,TF>& x );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Reverse Cuthill-McKee ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square compressed matrix.
+// \param perm The resulting permutation.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix.
+//
+// This function computes the Reverse Cuthill-McKee (RCM) ordering of the symmetrized sparsity
+// pattern of \a A. The resulting permutation contains the original row/column index of each
+// new row/column index, i.e. the permuted matrix is given by \f$ B(i,j) = A(perm[i],perm[j]) \f$
+// (see the permute() functions). The RCM ordering reduces the bandwidth and profile of the
+// matrix and thereby improves the locality of the accesses to the dense vector in sparse
+// matrix/dense vector multiplications and Gauss-Seidel sweeps:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   blaze::DynamicVector<double> b, x, pb, px;
+   // ... Resizing and initialization
+
+   std::vector<size_t> perm;
+   blaze::reverseCuthillMcKee( A, perm );
+
+   blaze::permute( A, perm, B );   // B = P*A*P^T
+   blaze::permute( b, perm, pb );  // pb = P*b
+   // ... Solving B*px = pb
+   blaze::unpermute( px, perm, x );  // x = P^T*px
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order of the matrix
+        , typename Index >  // Index type of the matrix
+void reverseCuthillMcKee( const CompressedMatrix<Type,SO,Index>& A, std::vector<size_t>& perm )
+{
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix" );
+
+   ReorderingGraph graph( A );
+   graph.reverseCuthillMcKee( perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a nested dissection ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square compressed matrix.
+// \param perm The resulting permutation.
+// \param leafSize The maximum number of rows/columns of a submatrix that is not further dissected.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix.
+//
+// This function computes a nested dissection ordering of the symmetrized sparsity pattern of
+// \a A by recursive bisection with level set separators. The resulting permutation contains the
+// original row/column index of each new row/column index (see reverseCuthillMcKee()). Each
+// dissected part is numbered contiguously and before its separator, which results in a nested
+// block structure of the permuted matrix. In comparison to the Reverse Cuthill-McKee ordering
+// the bandwidth is larger, but the fill-in of factorizations is usually considerably smaller
+// and the contiguous parts can be processed independently by different threads.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order of the matrix
+        , typename Index >  // Index type of the matrix
+void nestedDissection( const CompressedMatrix<Type,SO,Index>& A, std::vector<size_t>& perm,
+                       size_t leafSize )
+{
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix" );
+
+   ReorderingGraph graph( A );
+   graph.nestedDissection( leafSize, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given compressed matrix.
+// \return The bandwidth of the matrix.
+//
+// This function returns the maximum distance \f$ |i-j| \f$ of all non-zero elements
+// \f$ a_{ij} \f$ of the given matrix to the diagonal. It can be used to judge the quality of
+// an ordering computed by the reverseCuthillMcKee() function.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order of the matrix
+        , typename Index >  // Index type of the matrix
+size_t bandwidth( const CompressedMatrix<Type,SO,Index>& A )
+{
+   const size_t n( ( SO )?( A.columns() ):( A.rows() ) );
+
+   size_t width( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( A.begin(i) == A.end(i) ) continue;
+      const size_t first( A.begin(i)->index() );
+      const size_t last ( ( A.end(i)-1 )->index() );
+      width = max( width, ( first < i )?( i-first ):( first-i ) );
+      width = max( width, ( last  < i )?( i-last  ):( last -i ) );
+   }
+
+   return width;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup sparse_matrix
+//
+// \param perm The given permutation.
+// \param inv The resulting inverse permutation.
+// \return void
+// \exception std::invalid_argument Invalid permutation.
+//
+// This function computes the inverse permutation \a inv, i.e. the new index \a inv[i] of each
+// original index \a i. In case \a perm is not a permutation of \f$ [0..N) \f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline void invertPermutation( const std::vector<size_t>& perm, std::vector<size_t>& inv )
+{
+   const size_t n( perm.size() );
+
+   inv.assign( n, n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( perm[k] >= n || inv[perm[k]] != n )
+         throw std::invalid_argument( "Invalid permutation" );
+      inv[perm[k]] = k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square compressed matrix.
+// \param perm The permutation to be applied.
+// \param B The resulting permuted matrix \f$ B(i,j) = A(perm[i],perm[j]) \f$.
+// \return void
+// \exception std::invalid_argument Invalid permutation.
+//
+// This function computes the symmetric permutation \f$ B = P A P^T \f$ of \a A. The resulting
+// matrix is allocated at once and each row/column is built by a single sort of the renumbered
+// indices of the according row/column of \a A. \a A and \a B may be the same matrix. In case
+// \a perm is not a permutation of the rows/columns of \a A, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order of the matrix
+        , typename Index >  // Index type of the matrix
+void permute( const CompressedMatrix<Type,SO,Index>& A, const std::vector<size_t>& perm,
+              CompressedMatrix<Type,SO,Index>& B )
+{
+   typedef typename CompressedMatrix<Type,SO,Index>::ConstIterator  ConstIterator;
+
+   const size_t n( perm.size() );
+
+   if( A.rows() != n || A.columns() != n )
+      throw std::invalid_argument( "Invalid permutation" );
+
+   std::vector<size_t> inv;
+   invertPermutation( perm, inv );
+
+   std::vector<size_t> nonzeros( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      nonzeros[k] = A.nonZeros( perm[k] );
+   }
+
+   CompressedMatrix<Type,SO,Index> tmp( n, n );
+   tmp.reserve( nonzeros );
+
+   std::vector< std::pair<size_t,ConstIterator> > elements;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( perm[k] );
+
+      elements.clear();
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         elements.push_back( std::make_pair( inv[element->index()], element ) );
+      }
+
+      std::sort( elements.begin(), elements.end() );
+
+      for( size_t l=0UL; l<elements.size(); ++l ) {
+         if( SO ) tmp.append( elements[l].first, k, elements[l].second->value() );
+         else     tmp.append( k, elements[l].first, elements[l].second->value() );
+      }
+   }
+
+   B.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given dense vector.
+// \ingroup dense_vector
+//
+// \param x The given dense vector.
+// \param perm The permutation to be applied.
+// \param y The resulting permuted vector \f$ y[i] = x[perm[i]] \f$.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes \f$ y = P x \f$, i.e. it transfers a vector into the ordering of a
+// matrix permuted by the permute() function. \a x and \a y may be the same vector. In case the
+// sizes of the vectors don't match the size of the permutation, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT1  // Type of the given vector
+        , bool TF       // Transpose flag
+        , typename VT2 > // Type of the resulting vector
+void permute( const DenseVector<VT1,TF>& x, const std::vector<size_t>& perm,
+              DenseVector<VT2,TF>& y )
+{
+   const size_t n( perm.size() );
+
+   if( (~x).size() != n || (~y).size() != n )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( static_cast<const void*>( &~x ) == static_cast<const void*>( &~y ) ) {
+      const typename VT1::ResultType tmp( ~x );
+      permute( tmp, perm, y );
+      return;
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      BLAZE_USER_ASSERT( perm[k] < n, "Invalid permutation" );
+      (~y)[k] = (~x)[perm[k]];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverse permutation of the given dense vector.
+// \ingroup dense_vector
+//
+// \param y The given permuted dense vector.
+// \param perm The permutation to be reverted.
+// \param x The resulting vector \f$ x[perm[i]] = y[i] \f$.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes \f$ x = P^T y \f$, i.e. it transfers a vector in the ordering of a
+// matrix permuted by the permute() function (as for instance a solution) back into the original
+// ordering. \a x and \a y may be the same vector. In case the sizes of the vectors don't match
+// the size of the permutation, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the given vector
+        , bool TF       // Transpose flag
+        , typename VT2 > // Type of the resulting vector
+void unpermute( const DenseVector<VT1,TF>& y, const std::vector<size_t>& perm,
+                DenseVector<VT2,TF>& x )
+{
+   const size_t n( perm.size() );
+
+   if( (~y).size() != n || (~x).size() != n )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( static_cast<const void*>( &~x ) == static_cast<const void*>( &~y ) ) {
+      const typename VT1::ResultType tmp( ~y );
+      unpermute( tmp, perm, x );
+      return;
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      BLAZE_USER_ASSERT( perm[k] < n, "Invalid permutation" );
+      (~x)[perm[k]] = (~y)[k];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
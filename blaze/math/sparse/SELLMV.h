@@ -0,0 +1,336 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SELLMV.h
+//  \brief Header file for the sliced ELLPACK sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMV_H_
+#define _BLAZE_MATH_SPARSE_SELLMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the vectorized sliced ELLPACK multiplication kernel.
+// \ingroup sparse_matrix
+//
+// In case AVX2 gathers are available, the dense vector provides direct access to its elements,
+// and the element types of the matrix, the vector, and the result are the same single or double
+// precision type, the nested \a value will be set to 1, otherwise it will be 0.
+*/
+template< typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+struct SELLMVVectorized
+{
+   //**********************************************************************************************
+   enum { value = BLAZE_AVX2_MODE &&
+                  IsSlicedEllpack<MT>::value && VT::vectorizable &&
+                  IsSame<VT,typename VT::ResultType>::value &&
+                  IsSame<typename MT::ElementType,typename VT::ElementType>::value &&
+                  IsSame<typename MT::ElementType,ET>::value &&
+                  ( IsFloat<ET>::value || IsDouble<ET>::value ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHUNK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default computation of a single chunk of a sliced ELLPACK matrix/dense vector product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param c The index of the chunk.
+// \param y The array for the \a MT::chunkSize results of the chunk.
+// \return void
+*/
+template< typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+inline typename DisableIf< SELLMVVectorized<MT,VT,ET> >::Type
+   sellmvChunk( const MT& A, const VT& x, size_t c, ET* y )
+{
+   typedef typename MT::ElementType  MET;
+
+   const size_t C( MT::chunkSize );
+
+   const size_t  width  ( A.chunkWidth( c ) );
+   const MET*    values ( A.chunkValues( c ) );
+   const size_t* indices( A.chunkIndices( c ) );
+
+   for( size_t l=0UL; l<C; ++l ) {
+      reset( y[l] );
+   }
+
+   for( size_t k=0UL; k<width; ++k ) {
+      for( size_t l=0UL; l<C; ++l ) {
+         y[l] += values[k*C+l] * x[indices[k*C+l]];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_AVX2_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized computation of a single chunk of a sliced ELLPACK matrix/dense vector
+//        product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param c The index of the chunk.
+// \param y The array for the \a MT::chunkSize results of the chunk.
+// \return void
+//
+// This function computes all rows of a chunk simultaneously: the k-th elements of all rows
+// of the chunk are loaded with a single aligned load and the according vector elements are
+// gathered based on the contiguous index array.
+*/
+template< typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT    // Type of the dense vector operand
+        , typename ET >  // Type of the result elements
+inline typename EnableIf< SELLMVVectorized<MT,VT,ET> >::Type
+   sellmvChunk( const MT& A, const VT& x, size_t c, ET* y )
+{
+   typedef IntrinsicTrait<ET>  IT;
+   typedef typename IT::Type   IntrinsicType;
+
+   const size_t C( MT::chunkSize );
+
+   const size_t  width  ( A.chunkWidth( c ) );
+   const ET*     values ( A.chunkValues( c ) );
+   const size_t* indices( A.chunkIndices( c ) );
+   const ET*     data   ( x.data() );
+
+   IntrinsicType xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+2UL) <= width; k+=2UL ) {
+      xmm1 = fmadd( load( values+k*C     ), gather( data, indices+k*C     ), xmm1 );
+      xmm2 = fmadd( load( values+(k+1)*C ), gather( data, indices+(k+1)*C ), xmm2 );
+   }
+   if( k < width ) {
+      xmm1 = fmadd( load( values+k*C ), gather( data, indices+k*C ), xmm1 );
+   }
+
+   storeu( y, xmm1 + xmm2 );
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sliced ELLPACK matrix/dense vector multiplication for a range of chunks
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first chunk to be computed.
+// \param last The index one past the last chunk to be computed.
+// \return void
+//
+// This function computes the elements of \a y that correspond to the rows of the chunks in
+// the range \f$[first..last)\f$. Since every row belongs to exactly one chunk, the function
+// can be called concurrently for disjoint chunk ranges.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void sellmvAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t C( MT::chunkSize );
+   const size_t m( A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == m, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.chunks(), "Invalid chunk range" );
+
+   ET tmp[MT::chunkSize];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      sellmvChunk( A, x, c, tmp );
+
+      const size_t* rows ( A.chunkRows( c ) );
+      const size_t  lanes( min( C, m - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l ) {
+         if( A.nonZeros( rows[l] ) ) y[rows[l]] = tmp[l];
+         else reset( y[rows[l]] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sliced ELLPACK matrix/dense vector multiplication with addition for a range of chunks
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first chunk to be computed.
+// \param last The index one past the last chunk to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void sellmvAddAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t C( MT::chunkSize );
+   const size_t m( A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == m, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.chunks(), "Invalid chunk range" );
+
+   ET tmp[MT::chunkSize];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      sellmvChunk( A, x, c, tmp );
+
+      const size_t* rows ( A.chunkRows( c ) );
+      const size_t  lanes( min( C, m - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l ) {
+         if( A.nonZeros( rows[l] ) ) y[rows[l]] += tmp[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sliced ELLPACK matrix/dense vector multiplication with subtraction for a range of
+//        chunks (\f$ \vec{y}-=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param first The index of the first chunk to be computed.
+// \param last The index one past the last chunk to be computed.
+// \return void
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the sliced ELLPACK matrix
+        , typename VT2 > // Type of the right-hand side dense vector
+void sellmvSubAssign( VT1& y, const MT& A, const VT2& x, size_t first, size_t last )
+{
+   typedef typename VT1::ElementType  ET;
+
+   const size_t C( MT::chunkSize );
+   const size_t m( A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == m, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last <= A.chunks(), "Invalid chunk range" );
+
+   ET tmp[MT::chunkSize];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      sellmvChunk( A, x, c, tmp );
+
+      const size_t* rows ( A.chunkRows( c ) );
+      const size_t  lanes( min( C, m - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l ) {
+         if( A.nonZeros( rows[l] ) ) y[rows[l]] -= tmp[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1604 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sparse MxN matrix in sliced ELLPACK (SELL-C-sigma) format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/SplitIterator.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only \f$ M \times N \f$ sparse matrix in sliced ELLPACK (SELL-C-\f$ \sigma \f$)
+//        format.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is a row-major sparse matrix that is tailored to
+// vectorized sparse matrix/dense vector multiplications. The rows of the matrix are grouped
+// into chunks of \a C consecutive rows, where \a C is the SIMD width of the element type as
+// given by the IntrinsicTrait class template. Within a chunk, the non-zero elements are stored
+// column-wise, i.e. the k-th non-zero elements of all \a C rows are stored contiguously, and
+// all rows of a chunk are padded with explicit zeros to the length of the longest row of the
+// chunk. This enables the computation of \a C rows of a matrix/vector product with aligned
+// loads of the values and gathers of the according vector elements, independent of the (short
+// or irregular) length of the individual rows. To reduce the amount of padding, the rows within
+// a window of \f$ \sigma \f$ consecutive rows are sorted by decreasing number of non-zero
+// elements before the chunks are formed. The window size \f$ \sigma \f$ can be specified on
+// construction; it is rounded up to a multiple of \a C:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   blaze::SlicedEllpackMatrix<double> B( A );          // Default sorting window
+   blaze::SlicedEllpackMatrix<double> C( A, 256UL );  // Explicit sorting window of 256 rows
+
+   blaze::DynamicVector<double,blaze::columnVector> x( 1000UL ), y;
+   blaze::DynamicVector<double,blaze::rowVector> z;
+   // ... Initialization of x
+
+   y = B * x;           // Vectorized chunk-wise sparse matrix/dense vector multiplication
+   z = trans( x ) * B;  // Transpose dense vector/sparse matrix multiplication
+   \endcode
+
+// The SlicedEllpackMatrix is built from another matrix (as for instance a CompressedMatrix) and
+// cannot be modified element-wise afterwards. It provides the read-only interface of a row-major
+// sparse matrix (function call operator, row iterators, and lookup functions) and can therefore
+// be used in all sparse matrix expressions. The result type of all expressions involving a
+// SlicedEllpackMatrix is the according CompressedMatrix type. The padding elements are never
+// visible via the interface; they refer to the column index of the last non-zero element of
+// their row.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class SlicedEllpackMatrix : public SparseMatrix< SlicedEllpackMatrix<Type>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows per chunk.
+   enum { chunkSize = IT::size };
+
+   //! The default size of the window for the sorting of the rows.
+   enum { defaultSigma = 32UL * IT::size };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SlicedEllpackMatrix<Type>     This;            //!< Type of this SlicedEllpackMatrix instance.
+   typedef CompressedMatrix<Type,false>  ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>   TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                   Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                   ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of a SlicedEllpackMatrix.
+   //
+   // Since the non-zero elements of a row are interleaved with the elements of the other rows
+   // of the same chunk, the iterator traverses the value and index arrays with a stride of
+   // \a chunkSize elements.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef SplitElement<const Type>         ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                        PointerType;       //!< Pointer return type.
+      typedef ValueType                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : value_( NULL )  // Pointer to the current value
+         , index_( NULL )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the initial value.
+      // \param index Pointer to the initial index.
+      */
+      inline ConstIterator( const Type* value, const size_t* index )
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Increment/decrement operators************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( DifferenceType inc ) {
+         value_ += inc * DifferenceType( chunkSize );
+         index_ += inc * DifferenceType( chunkSize );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( DifferenceType dec ) {
+         value_ -= dec * DifferenceType( chunkSize );
+         index_ -= dec * DifferenceType( chunkSize );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         value_ += chunkSize;
+         index_ += chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         value_ -= chunkSize;
+         index_ -= chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      /*!\brief Direct access to the element at the given distance from the current position.
+      //
+      // \param index Access index.
+      // \return Proxy to the accessed element.
+      */
+      inline ReferenceType operator[]( DifferenceType index ) const {
+         return ReferenceType( value_ + index*DifferenceType( chunkSize ),
+                               index_ + index*DifferenceType( chunkSize ) );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Direct access to the current element.
+      //
+      // \return Proxy to the current element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Direct access to the current element.
+      //
+      // \return Proxy to the current element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Comparison operators*********************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( index_ - rhs.index_ ) / DifferenceType( chunkSize );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, DifferenceType inc ) {
+         return ConstIterator( it ) += inc;
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, DifferenceType dec ) {
+         return ConstIterator( it ) -= dec;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;  //!< Pointer to the current value.
+      const size_t* index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SlicedEllpackMatrix<ET>  Other;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline SlicedEllpackMatrix();
+                            explicit inline SlicedEllpackMatrix( size_t m, size_t n );
+                                     inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+   template< typename MT, bool SO >  inline SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma=defaultSigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t sigma() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level chunk access functions************************************************************
+   /*!\name Low-level chunk access functions */
+   //@{
+   inline size_t        chunks() const;
+   inline size_t        chunkWidth  ( size_t c ) const;
+   inline const Type*   chunkValues ( size_t c ) const;
+   inline const size_t* chunkIndices( size_t c ) const;
+   inline const size_t* chunkRows   ( size_t c ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >           void build( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void build( const Matrix<MT,SO>& m );
+
+   inline size_t offset( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Comparison functor for the sorting of the rows by decreasing number of non-zero elements.
+   struct LongerRow {
+      explicit inline LongerRow( const size_t* lengths ) : lengths_( lengths ) {}
+      inline bool operator()( size_t i, size_t j ) const { return lengths_[i] > lengths_[j]; }
+      const size_t* lengths_;  //!< The number of non-zero elements of the rows.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;     //!< The size of the window for the sorting of the rows.
+   size_t  chunks_;    //!< The number of chunks of the sparse matrix.
+   size_t  nonzeros_;  //!< The total number of non-zero elements (without padding).
+   size_t* offsets_;   //!< Offsets of the first element of each chunk.
+   size_t* lengths_;   //!< The number of non-zero elements of each row.
+   size_t* rows_;      //!< The row index of each chunk lane.
+   size_t* slots_;     //!< The chunk lane of each row.
+   Type*   values_;    //!< The values of the (padded) non-zero elements.
+   size_t* indices_;   //!< The column indices of the (padded) non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >
+const Type SlicedEllpackMatrix<Type>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix()
+   : m_       ( 0UL )                    // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                    // The current number of columns of the sparse matrix
+   , sigma_   ( defaultSigma )           // The size of the window for the sorting of the rows
+   , chunks_  ( 0UL )                    // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                    // The total number of non-zero elements
+   , offsets_ ( new size_t[1] )          // Offsets of the first element of each chunk
+   , lengths_ ( NULL )                   // The number of non-zero elements of each row
+   , rows_    ( NULL )                   // The row index of each chunk lane
+   , slots_   ( NULL )                   // The chunk lane of each row
+   , values_  ( NULL )                   // The values of the (padded) non-zero elements
+   , indices_ ( NULL )                   // The column indices of the (padded) non-zero elements
+{
+   offsets_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ m \times n \f$ SlicedEllpackMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( size_t m, size_t n )
+   : m_       ( m )                                      // The current number of rows of the sparse matrix
+   , n_       ( n )                                      // The current number of columns of the sparse matrix
+   , sigma_   ( defaultSigma )                           // The size of the window for the sorting of the rows
+   , chunks_  ( ( m + chunkSize - 1UL ) / chunkSize )    // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                                    // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks_+1UL] )                // Offsets of the first element of each chunk
+   , lengths_ ( new size_t[m] )                          // The number of non-zero elements of each row
+   , rows_    ( new size_t[m] )                          // The row index of each chunk lane
+   , slots_   ( new size_t[m] )                          // The chunk lane of each row
+   , values_  ( NULL )                                   // The values of the (padded) non-zero elements
+   , indices_ ( NULL )                                   // The column indices of the (padded) non-zero elements
+{
+   std::fill( offsets_, offsets_+chunks_+1UL, 0UL );
+   std::fill( lengths_, lengths_+m_, 0UL );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      rows_[i] = slots_[i] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : m_       ( sm.m_ )                                  // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                  // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                              // The size of the window for the sorting of the rows
+   , chunks_  ( sm.chunks_ )                             // The number of chunks of the sparse matrix
+   , nonzeros_( sm.nonzeros_ )                           // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks_+1UL] )                // Offsets of the first element of each chunk
+   , lengths_ ( new size_t[m_] )                         // The number of non-zero elements of each row
+   , rows_    ( new size_t[m_] )                         // The row index of each chunk lane
+   , slots_   ( new size_t[m_] )                         // The chunk lane of each row
+   , values_  ( allocate<Type>( sm.capacity() ) )        // The values of the (padded) non-zero elements
+   , indices_ ( allocate<size_t>( sm.capacity() ) )      // The column indices of the (padded) non-zero elements
+{
+   std::copy( sm.offsets_, sm.offsets_+chunks_+1UL, offsets_ );
+   std::copy( sm.lengths_, sm.lengths_+m_, lengths_ );
+   std::copy( sm.rows_   , sm.rows_   +m_, rows_    );
+   std::copy( sm.slots_  , sm.slots_  +m_, slots_   );
+   std::copy( sm.values_ , sm.values_ +sm.capacity(), values_  );
+   std::copy( sm.indices_, sm.indices_+sm.capacity(), indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \param sigma The size of the window for the sorting of the rows.
+//
+// This constructor converts the given dense or sparse matrix into the SELL-C-\f$ \sigma \f$
+// format. Within each window of \a sigma consecutive rows the rows are sorted by decreasing
+// number of non-zero elements. The window size is rounded up to a multiple of the chunk size;
+// a window size of \a chunkSize or less disables the sorting across chunks.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type>::SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : m_       ( 0UL )                    // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                    // The current number of columns of the sparse matrix
+   , sigma_   ( max( ( sigma + chunkSize - 1UL ) / chunkSize, 1UL ) * chunkSize )  // The size of the sorting window
+   , chunks_  ( 0UL )                    // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                    // The total number of non-zero elements
+   , offsets_ ( NULL )                   // Offsets of the first element of each chunk
+   , lengths_ ( NULL )                   // The number of non-zero elements of each row
+   , rows_    ( NULL )                   // The row index of each chunk lane
+   , slots_   ( NULL )                   // The chunk lane of each row
+   , values_  ( NULL )                   // The values of the (padded) non-zero elements
+   , indices_ ( NULL )                   // The column indices of the (padded) non-zero elements
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>::~SlicedEllpackMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   delete [] offsets_;
+   delete [] lengths_;
+   delete [] rows_;
+   delete [] slots_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstReference
+   SlicedEllpackMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offset( i ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offset( i ) + lengths_[i]*chunkSize );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SlicedEllpackMatrix<Type>&
+   SlicedEllpackMatrix<Type>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The given matrix is converted into the SELL-C-\f$ \sigma \f$ format using the current
+// sorting window of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type>&
+   SlicedEllpackMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements including the padding elements.
+//
+// \return The number of stored elements of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::capacity() const
+{
+   return offsets_[chunks_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// The returned number does not include the padding elements of the chunks.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return lengths_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the window for the sorting of the rows.
+//
+// \return The size of the sorting window.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets the matrix to a zero matrix of the same size.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SlicedEllpackMatrix<Type>::reset()
+{
+   SlicedEllpackMatrix tmp( m_, n_ );
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SlicedEllpackMatrix<Type>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SlicedEllpackMatrix<Type>::swap( SlicedEllpackMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( chunks_, sm.chunks_ );
+   std::swap( nonzeros_, sm.nonzeros_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( lengths_, sm.lengths_ );
+   std::swap( rows_, sm.rows_ );
+   std::swap( slots_, sm.slots_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix into the SELL-C-\f$ \sigma \f$ format.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+//
+// This function builds the chunk structure of the matrix. It is expected to be called on an
+// empty matrix with an initialized sorting window.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the sparse matrix
+void SlicedEllpackMatrix<Type>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  MatrixIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix
+
+   m_      = A.rows();
+   n_      = A.columns();
+   chunks_ = ( m_ + chunkSize - 1UL ) / chunkSize;
+
+   offsets_ = new size_t[chunks_+1UL];
+   lengths_ = new size_t[m_];
+   rows_    = new size_t[m_];
+   slots_   = new size_t[m_];
+
+   nonzeros_ = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      lengths_[i] = A.nonZeros( i );
+      nonzeros_  += lengths_[i];
+      rows_[i]    = i;
+   }
+
+   // Sorting the rows within each window by decreasing number of non-zero elements
+   if( sigma_ > chunkSize ) {
+      for( size_t i=0UL; i<m_; i+=sigma_ ) {
+         std::stable_sort( rows_+i, rows_+min( i+sigma_, m_ ), LongerRow( lengths_ ) );
+      }
+   }
+
+   for( size_t s=0UL; s<m_; ++s ) {
+      slots_[rows_[s]] = s;
+   }
+
+   // Computing the width of each chunk
+   offsets_[0] = 0UL;
+   for( size_t c=0UL; c<chunks_; ++c ) {
+      const size_t send( min( (c+1UL)*chunkSize, m_ ) );
+      size_t width( 0UL );
+      for( size_t s=c*chunkSize; s<send; ++s ) {
+         width = max( width, lengths_[rows_[s]] );
+      }
+      offsets_[c+1UL] = offsets_[c] + width*chunkSize;
+   }
+
+   values_  = allocate<Type>( offsets_[chunks_] );
+   indices_ = allocate<size_t>( offsets_[chunks_] );
+
+   // Filling the chunks column by column, including the padding elements
+   for( size_t c=0UL; c<chunks_; ++c )
+   {
+      const size_t width( ( offsets_[c+1UL] - offsets_[c] ) / chunkSize );
+
+      for( size_t l=0UL; l<chunkSize; ++l )
+      {
+         const size_t s( c*chunkSize + l );
+         size_t pos( offsets_[c] + l );
+         size_t k( 0UL );
+         size_t last( 0UL );
+
+         if( s < m_ ) {
+            const MatrixIterator end( A.end( rows_[s] ) );
+            for( MatrixIterator element=A.begin( rows_[s] ); element!=end; ++element ) {
+               values_ [pos] = element->value();
+               indices_[pos] = last = element->index();
+               pos += chunkSize;
+               ++k;
+            }
+         }
+
+         for( ; k<width; ++k ) {
+            values_ [pos] = Type();
+            indices_[pos] = last;
+            pos += chunkSize;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a dense or column-major matrix into the SELL-C-\f$ \sigma \f$ format.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// This function builds the chunk structure of the matrix via an intermediate row-major
+// compressed matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+void SlicedEllpackMatrix<Type>::build( const Matrix<MT,SO>& m )
+{
+   const CompressedMatrix<Type,false> tmp( ~m );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first element of row \a i within the element arrays.
+//
+// \param i The row index.
+// \return The position of the first element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::offset( size_t i ) const
+{
+   const size_t s( slots_[i] );
+   return offsets_[s/chunkSize] + s%chunkSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( offset( i ) );
+   size_t first( 0UL );
+   size_t count( lengths_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices_[pos+(first+step)*chunkSize] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+pos+first*chunkSize, indices_+pos+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename SlicedEllpackMatrix<Type>::ConstIterator
+   SlicedEllpackMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( offset( i ) );
+   size_t first( 0UL );
+   size_t count( lengths_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices_[pos+(first+step)*chunkSize] <= j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+pos+first*chunkSize, indices_+pos+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL CHUNK ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::chunks() const
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the given chunk.
+//
+// \param c The index of the chunk. The index has to be in the range \f$[0..chunks()-1]\f$.
+// \return The number of (padded) elements per row of the chunk.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SlicedEllpackMatrix<Type>::chunkWidth( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return ( offsets_[c+1UL] - offsets_[c] ) / chunkSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the given chunk.
+//
+// \param c The index of the chunk. The index has to be in the range \f$[0..chunks()-1]\f$.
+// \return Pointer to the first value of the chunk.
+//
+// The k-th element of lane \a l of the chunk is stored at position \f$ k \cdot C + l \f$.
+// The array is aligned to the alignment of the element type.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const Type* SlicedEllpackMatrix<Type>::chunkValues( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return values_ + offsets_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the column indices of the given chunk.
+//
+// \param c The index of the chunk. The index has to be in the range \f$[0..chunks()-1]\f$.
+// \return Pointer to the first column index of the chunk.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const size_t* SlicedEllpackMatrix<Type>::chunkIndices( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return indices_ + offsets_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the row indices of the lanes of the given chunk.
+//
+// \param c The index of the chunk. The index has to be in the range \f$[0..chunks()-1]\f$.
+// \return Pointer to the row index of the first lane of the chunk.
+//
+// Note that the last chunk of the matrix might contain less than \a chunkSize valid lanes.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const size_t* SlicedEllpackMatrix<Type>::chunkRows( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return rows_ + c*chunkSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since the SlicedEllpackMatrix cannot be assigned to element-wise, this function always
+// returns \a false.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool SlicedEllpackMatrix<Type>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type >
+inline void reset( SlicedEllpackMatrix<Type>& m );
+
+template< typename Type >
+inline void clear( SlicedEllpackMatrix<Type>& m );
+
+template< typename Type >
+inline bool isDefault( const SlicedEllpackMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( SlicedEllpackMatrix<Type>& a, SlicedEllpackMatrix<Type>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void reset( SlicedEllpackMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void clear( SlicedEllpackMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool isDefault( const SlicedEllpackMatrix<Type>& m )
+{
+   typedef typename SlicedEllpackMatrix<Type>::ConstIterator  ConstIterator;
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      for( ConstIterator element=m.begin(i); element!=m.end(i); ++element )
+         if( !isDefault( element->value() ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void swap( SlicedEllpackMatrix<Type>& a, SlicedEllpackMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSLICEDELLPACK SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsSlicedEllpack< SlicedEllpackMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< T1, SlicedEllpackMatrix<T2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, StaticVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< StaticVector<T1,N,true>, SlicedEllpackMatrix<T2> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, HybridVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< HybridVector<T1,N,true>, SlicedEllpackMatrix<T2> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1>, DynamicVector<T2,false> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, DynamicVector<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< DynamicVector<T1,true>, SlicedEllpackMatrix<T2> >
+{
+   typedef typename MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, typename I2 >
+struct MultTrait< SlicedEllpackMatrix<T1>, CompressedVector<T2,false,I2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,false>, CompressedVector<T2,false,I2> >::Type  Type;
+};
+
+template< typename T1, typename I1, typename T2 >
+struct MultTrait< CompressedVector<T1,true,I1>, SlicedEllpackMatrix<T2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,true,I1>, CompressedMatrix<T2,false> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< SlicedEllpackMatrix<T1> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,714 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMM.h
+//  \brief Header file for the two-phase sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCUMULATOR SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the accumulator for a single row of a sparse matrix/sparse matrix product.
+// \ingroup sparse_matrix
+//
+// The row-wise sparse matrix/sparse matrix multiplication (SpGEMM) merges the rows of the
+// right-hand side matrix selected by the non-zero elements of a row of the left-hand side
+// matrix. The number of these scalar multiplications (the \a flops of the row) is an upper
+// bound for the number of non-zero elements in the resulting row and determines the optimal
+// accumulator:
+//
+//  - \a esc: Rows with at most \a escThreshold products are accumulated by expanding all
+//    products into a small buffer, sorting it by column index, and compressing entries with
+//    the same index (expand-sort-compress).
+//  - \a dense: Rows whose products cover a considerable part of the columns (at least one out
+//    of \a denseRatio columns) are accumulated in a dense array of the size of a matrix row.
+//  - \a hash: All other rows are accumulated in an open addressing hash table, whose size is
+//    proportional to the number of products instead of the number of columns.
+*/
+struct SpGEMMAccumulator
+{
+   //**********************************************************************************************
+   enum Kind { esc, hash, dense };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { escThreshold = 32UL };
+   enum { denseRatio   = 16UL };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Selects the accumulator for a row with the given number of products.
+   //
+   // \param flops The number of scalar products of the row.
+   // \param columns The number of columns of the resulting matrix.
+   // \return The selected accumulator.
+   */
+   static inline Kind select( size_t flops, size_t columns ) {
+      if( flops <= escThreshold )
+         return esc;
+      else if( flops * denseRatio >= columns )
+         return dense;
+      else return hash;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the size of the hash table for a row with the given number of products.
+   //
+   // \param flops The number of scalar products of the row.
+   // \return The size of the hash table (a power of two, at least twice the number of products).
+   */
+   static inline size_t hashSize( size_t flops ) {
+      size_t size( 64UL );
+      while( size < 2UL*flops )
+         size *= 2UL;
+      return size;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the hash value of the given column index.
+   //
+   // \param index The column index.
+   // \param mask The size of the hash table minus one.
+   // \return The initial slot of the column index.
+   */
+   static inline size_t hashSlot( size_t index, size_t mask ) {
+      return ( index * 107UL ) & mask;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scratch memory of the symbolic phase of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// The workspace is owned by a single thread and reused for all rows of a row range. The dense
+// marker array is only allocated in case a row of the range selects the dense accumulator.
+*/
+struct SpGEMMSymbolicWorkspace
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the SpGEMMSymbolicWorkspace class.
+   //
+   // \param columns The number of columns of the resulting matrix.
+   */
+   explicit inline SpGEMMSymbolicWorkspace( size_t columns )
+      : columns_( columns )  // The number of columns of the resulting matrix
+      , valid_  ()           // Dense markers for the dense accumulator
+      , indices_()           // Collected column indices
+      , keys_   ()           // Keys of the hash table
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Allocates the dense markers on first use.
+   //
+   // \return void
+   */
+   inline void requireDense() {
+      if( valid_.size() != columns_ )
+         valid_.resize( columns_, 0 );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   size_t              columns_;  //!< The number of columns of the resulting matrix.
+   std::vector<byte>   valid_;    //!< Dense markers for the dense accumulator.
+   std::vector<size_t> indices_;  //!< Collected column indices.
+   std::vector<size_t> keys_;     //!< Keys of the hash table.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scratch memory of the numeric phase of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// In addition to the scratch memory of the symbolic phase, the numeric phase requires storage
+// for the values accumulated by the dense and hash accumulators and for the index-value pairs
+// of the expand-sort-compress accumulator.
+*/
+template< typename Type >  // Type of the resulting elements
+struct SpGEMMNumericWorkspace : public SpGEMMSymbolicWorkspace
+{
+   //**********************************************************************************************
+   typedef std::pair<size_t,Type>  Pair;  //!< Type of the index-value pairs.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Constructor for the SpGEMMNumericWorkspace class template.
+   //
+   // \param columns The number of columns of the resulting matrix.
+   */
+   explicit inline SpGEMMNumericWorkspace( size_t columns )
+      : SpGEMMSymbolicWorkspace( columns )  // Initialization of the base class
+      , values_    ()                       // Accumulated values of the dense accumulator
+      , hashValues_()                       // Accumulated values of the hash table
+      , pairs_     ()                       // Index-value pairs
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Allocates the dense markers and values on first use.
+   //
+   // \return void
+   */
+   inline void requireDense() {
+      SpGEMMSymbolicWorkspace::requireDense();
+      if( values_.size() != columns_ )
+         values_.resize( columns_, Type() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   std::vector<Type> values_;      //!< Accumulated values of the dense accumulator.
+   std::vector<Type> hashValues_;  //!< Accumulated values of the hash table.
+   std::vector<Pair> pairs_;       //!< Index-value pairs.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Ordering of index-value pairs by their index.
+// \ingroup sparse_matrix
+*/
+struct SpGEMMIndexLess
+{
+   //**********************************************************************************************
+   /*!\brief Comparison of the indices of two index-value pairs.
+   //
+   // \param a The left-hand side index-value pair.
+   // \param b The right-hand side index-value pair.
+   // \return \a true if the index of \a a is smaller than the index of \a b, \a false if not.
+   */
+   template< typename Pair >
+   inline bool operator()( const Pair& a, const Pair& b ) const {
+      return a.first < b.first;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMBOLIC PHASE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of scalar products of all rows of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param flops The resulting number of scalar products per row.
+// \return void
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemmFlops( const MT1& A, const MT2& B, std::vector<size_t>& flops )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+
+   flops.resize( A.rows() );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      size_t tmp( 0UL );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         tmp += B.nonZeros( lelem->index() );
+      }
+
+      flops[i] = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of non-zero elements of a single row of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param i The index of the row.
+// \param flops The number of scalar products of row \a i.
+// \param ws The scratch memory of the calling thread.
+// \return The number of structural non-zero elements of row \a i.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+size_t spgemmRowNonZeros( const MT1& A, const MT2& B, size_t i, size_t flops,
+                          SpGEMMSymbolicWorkspace& ws )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+   typedef typename MT2::ConstIterator  RightIterator;
+
+   if( flops == 0UL )
+      return 0UL;
+
+   const LeftIterator lend( A.end(i) );
+   size_t nonzeros( 0UL );
+
+   switch( SpGEMMAccumulator::select( flops, B.columns() ) )
+   {
+      case SpGEMMAccumulator::esc:
+      {
+         ws.indices_.clear();
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+               ws.indices_.push_back( relem->index() );
+            }
+         }
+
+         std::sort( ws.indices_.begin(), ws.indices_.end() );
+         nonzeros = std::unique( ws.indices_.begin(), ws.indices_.end() ) - ws.indices_.begin();
+         break;
+      }
+
+      case SpGEMMAccumulator::hash:
+      {
+         const size_t size( SpGEMMAccumulator::hashSize( flops ) );
+         const size_t mask( size - 1UL );
+
+         ws.keys_.assign( size, size_t(-1) );
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               const size_t index( relem->index() );
+               size_t slot( SpGEMMAccumulator::hashSlot( index, mask ) );
+
+               while( ws.keys_[slot] != index && ws.keys_[slot] != size_t(-1) )
+                  slot = ( slot + 1UL ) & mask;
+
+               if( ws.keys_[slot] == size_t(-1) ) {
+                  ws.keys_[slot] = index;
+                  ++nonzeros;
+               }
+            }
+         }
+         break;
+      }
+
+      case SpGEMMAccumulator::dense:
+      {
+         ws.requireDense();
+         ws.indices_.clear();
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+               if( !ws.valid_[relem->index()] ) {
+                  ws.valid_[relem->index()] = 1;
+                  ws.indices_.push_back( relem->index() );
+               }
+            }
+         }
+
+         nonzeros = ws.indices_.size();
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            ws.valid_[ws.indices_[k]] = 0;
+         }
+         break;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( nonzeros <= flops, "Invalid number of non-zero elements" );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic phase of a sparse matrix/sparse matrix multiplication for a range of rows.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param flops The number of scalar products per row.
+// \param nonzeros The resulting number of non-zero elements per row.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+//
+// This function computes the exact number of structural non-zero elements of the rows
+// \f$ [first..last) \f$ of the product \f$ A*B \f$. Since only the entries \a nonzeros[first]
+// to \a nonzeros[last-1] are written, disjoint row ranges can be processed concurrently.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemmSymbolic( const MT1& A, const MT2& B, const std::vector<size_t>& flops,
+                     std::vector<size_t>& nonzeros, size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( flops.size()    == A.rows(), "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( nonzeros.size() == A.rows(), "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= A.rows(), "Invalid row range" );
+
+   SpGEMMSymbolicWorkspace ws( B.columns() );
+
+   for( size_t i=first; i<last; ++i ) {
+      nonzeros[i] = spgemmRowNonZeros( A, B, i, flops[i], ws );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC PHASE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single row of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param i The index of the row.
+// \param flops The number of scalar products of row \a i.
+// \param ws The scratch memory of the calling thread.
+// \return void
+//
+// This function appends the non-zero elements of row \a i of the product \f$ A*B \f$ in
+// ascending order of their column indices to row \a i of \a C. Elements that cancel out to
+// zero are not appended. Row \a i of \a C must be empty and must provide enough capacity for
+// all structural non-zero elements of the row.
+*/
+template< typename MT3    // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemmRowAssign( MT3& C, const MT1& A, const MT2& B, size_t i, size_t flops,
+                      SpGEMMNumericWorkspace<typename MT3::ElementType>& ws )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+   typedef typename MT2::ConstIterator  RightIterator;
+   typedef typename MT3::ElementType    ET;
+
+   if( flops == 0UL )
+      return;
+
+   const LeftIterator lend( A.end(i) );
+
+   switch( SpGEMMAccumulator::select( flops, B.columns() ) )
+   {
+      case SpGEMMAccumulator::esc:
+      {
+         ws.pairs_.clear();
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+               const ET tmp( lelem->value() * relem->value() );
+               ws.pairs_.push_back( std::make_pair( relem->index(), tmp ) );
+            }
+         }
+
+         std::sort( ws.pairs_.begin(), ws.pairs_.end(), SpGEMMIndexLess() );
+
+         const size_t end( ws.pairs_.size() );
+
+         for( size_t k=0UL; k<end; )
+         {
+            const size_t index( ws.pairs_[k].first );
+            ET tmp( ws.pairs_[k].second );
+
+            for( ++k; k<end && ws.pairs_[k].first == index; ++k )
+               tmp += ws.pairs_[k].second;
+
+            C.append( i, index, tmp, true );
+         }
+         break;
+      }
+
+      case SpGEMMAccumulator::hash:
+      {
+         const size_t size( SpGEMMAccumulator::hashSize( flops ) );
+         const size_t mask( size - 1UL );
+
+         ws.keys_.assign( size, size_t(-1) );
+         if( ws.hashValues_.size() < size )
+            ws.hashValues_.resize( size );
+         ws.indices_.clear();
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               const size_t index( relem->index() );
+               size_t slot( SpGEMMAccumulator::hashSlot( index, mask ) );
+
+               while( ws.keys_[slot] != index && ws.keys_[slot] != size_t(-1) )
+                  slot = ( slot + 1UL ) & mask;
+
+               if( ws.keys_[slot] == size_t(-1) ) {
+                  ws.keys_[slot] = index;
+                  ws.hashValues_[slot] = lelem->value() * relem->value();
+                  ws.indices_.push_back( slot );
+               }
+               else {
+                  ws.hashValues_[slot] += lelem->value() * relem->value();
+               }
+            }
+         }
+
+         ws.pairs_.clear();
+
+         for( size_t k=0UL; k<ws.indices_.size(); ++k ) {
+            const size_t slot( ws.indices_[k] );
+            ws.pairs_.push_back( std::make_pair( ws.keys_[slot], ws.hashValues_[slot] ) );
+         }
+
+         std::sort( ws.pairs_.begin(), ws.pairs_.end(), SpGEMMIndexLess() );
+
+         for( size_t k=0UL; k<ws.pairs_.size(); ++k ) {
+            C.append( i, ws.pairs_[k].first, ws.pairs_[k].second, true );
+         }
+         break;
+      }
+
+      case SpGEMMAccumulator::dense:
+      {
+         ws.requireDense();
+         ws.indices_.clear();
+
+         size_t minIndex( size_t(-1) ), maxIndex( 0UL );
+
+         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const RightIterator rend( B.end( lelem->index() ) );
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               const size_t index( relem->index() );
+
+               if( !ws.valid_[index] ) {
+                  ws.values_[index] = lelem->value() * relem->value();
+                  ws.valid_ [index] = 1;
+                  ws.indices_.push_back( index );
+                  if( index < minIndex ) minIndex = index;
+                  if( index > maxIndex ) maxIndex = index;
+               }
+               else {
+                  ws.values_[index] += lelem->value() * relem->value();
+               }
+            }
+         }
+
+         const size_t nonzeros( ws.indices_.size() );
+
+         if( nonzeros == 0UL )
+            break;
+
+         // Depending on the density of the row, the indices are either sorted or the dense
+         // array is scanned between the smallest and the largest index
+         if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+         {
+            std::sort( ws.indices_.begin(), ws.indices_.end() );
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               const size_t index( ws.indices_[k] );
+               C.append( i, index, ws.values_[index], true );
+               reset( ws.values_[index] );
+               ws.valid_[index] = 0;
+            }
+         }
+         else
+         {
+            for( size_t j=minIndex; j<=maxIndex; ++j ) {
+               if( ws.valid_[j] ) {
+                  C.append( i, j, ws.values_[j], true );
+                  reset( ws.values_[j] );
+                  ws.valid_[j] = 0;
+               }
+            }
+         }
+         break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication for a range of rows.
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param flops The number of scalar products per row.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+//
+// This function computes the rows \f$ [first..last) \f$ of the product \f$ A*B \f$ and appends
+// them to the corresponding rows of \a C. The rows of \a C must be empty and their capacities
+// must have been set by the symbolic phase (see the reserve() function of the CompressedMatrix
+// class template). Since only the given rows of \a C are modified, disjoint row ranges can be
+// processed concurrently.
+*/
+template< typename MT3    // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemmNumeric( MT3& C, const MT1& A, const MT2& B, const std::vector<size_t>& flops,
+                    size_t first, size_t last )
+{
+   BLAZE_INTERNAL_ASSERT( flops.size() == A.rows(), "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= A.rows(), "Invalid row range" );
+
+   SpGEMMNumericWorkspace<typename MT3::ElementType> ws( B.columns() );
+
+   for( size_t i=first; i<last; ++i ) {
+      BLAZE_INTERNAL_ASSERT( C.nonZeros(i) == 0UL, "Invalid non-empty row detected" );
+      spgemmRowAssign( C, A, B, i, flops[i], ws );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIAL SPGEMM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial two-phase assignment of a sparse matrix/sparse matrix multiplication
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+//
+// This function computes the product \f$ A*B \f$ in two phases. The symbolic phase determines
+// the exact number of non-zero elements of each row, which is used to lay out the rows of \a C
+// via the reserve() function. The numeric phase afterwards writes each row directly into its
+// final position. Therefore \a C is allocated at most once and never reallocated during the
+// computation.
+*/
+template< typename MT3    // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemmAssign( MT3& C, const MT1& A, const MT2& B )
+{
+   BLAZE_INTERNAL_ASSERT( C.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()   , "Invalid matrix sizes"      );
+
+   std::vector<size_t> flops;
+   spgemmFlops( A, B, flops );
+
+   std::vector<size_t> nonzeros( A.rows() );
+   spgemmSymbolic( A, B, flops, nonzeros, 0UL, A.rows() );
+
+   C.reset();
+   C.reserve( nonzeros );
+
+   spgemmNumeric( C, A, B, flops, 0UL, A.rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,589 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMMPlan.h
+//  \brief Header file for the SpGEMMPlan class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMMPLAN_H_
+#define _BLAZE_MATH_SPARSE_SPGEMMPLAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Precomputed structure of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// The SpGEMMPlan class stores the result of the symbolic phase of the sparse matrix/sparse
+// matrix multiplication \f$ C=A*B \f$ of two row-major compressed matrices: the sparsity pattern
+// of the resulting matrix and, for each of its non-zero elements, the list of contributing
+// pairs of non-zero elements of \a A and \a B. In applications that repeatedly multiply two
+// matrices with a fixed sparsity pattern but changing values (as for instance time stepping
+// schemes or Galerkin projections in nonlinear solvers), the plan is set up once and all
+// subsequent products are reduced to a numeric phase that only walks the contribution lists
+// and writes the values into the existing storage of the resulting matrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SpGEMMPlan;
+
+   CompressedMatrix<double> A, B, C;
+   // ... Setting up the sparsity pattern and the initial values of A and B
+
+   const SpGEMMPlan plan( A, B );  // Symbolic phase
+
+   for( size_t step=0UL; step<steps; ++step ) {
+      // ... Updating the values of A and B without changing their sparsity pattern
+      multiply( C, plan, A, B );  // Numeric phase
+   }
+   \endcode
+
+// The first call of multiply() lays out \a C according to the pattern of the plan, all further
+// calls neither allocate memory nor search for indices. The numeric phase is executed in parallel
+// according to the active shared memory parallelization mode. It can be run serially via a
+// serial section (see the BLAZE_SERIAL_SECTION macro).
+//
+// Note that the plan refers to the non-zero elements of \a A and \a B by their position within
+// their row. Therefore all elements have to be explicitly stored in the same order as during
+// the setup of the plan, even if their value is zero. Changing the number of non-zero elements
+// of any row of \a A or \a B results in a \a std::invalid_argument exception, all other changes
+// of the sparsity patterns result in undefined behavior. For the same reason elements of the
+// product that cancel out to zero are stored explicitly in \a C.
+*/
+class SpGEMMPlan
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SpGEMMPlan();
+
+   template< typename T1, typename T2 >
+   explicit inline SpGEMMPlan( const CompressedMatrix<T1,false>& A,
+                               const CompressedMatrix<T2,false>& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t products() const;
+   inline size_t products( size_t i ) const;
+   inline void   clear();
+
+   template< typename T1, typename T2 >
+   void analyze( const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B );
+
+   template< typename T1, typename T2 >
+   inline bool isCompatible( const CompressedMatrix<T1,false>& A,
+                             const CompressedMatrix<T2,false>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Type >
+   void layout( CompressedMatrix<Type,false>& C ) const;
+
+   template< typename Type, typename T1, typename T2 >
+   void assign( CompressedMatrix<Type,false>& C, const CompressedMatrix<T1,false>& A,
+                const CompressedMatrix<T2,false>& B, size_t first, size_t last ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private struct Product**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Single scalar product of the sparse matrix multiplication.
+   */
+   struct Product
+   {
+      size_t index_;  //!< The column index of the product.
+      size_t lhs_;    //!< The position of the left-hand side element within its row.
+      size_t rhs_;    //!< The position of the right-hand side element within its row.
+
+      inline bool operator<( const Product& p ) const { return index_ < p.index_; }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t rows_;     //!< The number of rows of the resulting matrix.
+   size_t columns_;  //!< The number of columns of the resulting matrix.
+
+   std::vector<size_t> lhsNonZeros_;  //!< The number of non-zero elements per row of A.
+   std::vector<size_t> rhsNonZeros_;  //!< The number of non-zero elements per row of B.
+   std::vector<size_t> products_;     //!< The number of scalar products per row of C.
+   std::vector<size_t> rowBegin_;     //!< The first non-zero element of each row of C.
+   std::vector<size_t> indices_;      //!< The column indices of the non-zero elements of C.
+   std::vector<size_t> begin_;        //!< The first contribution of each non-zero element of C.
+   std::vector<size_t> lhs_;          //!< The positions of the contributing elements of A.
+   std::vector<size_t> rhs_;          //!< The positions of the contributing elements of B.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SpGEMMPlan.
+//
+// The default constructor creates an empty plan for the multiplication of two 0x0 matrices.
+*/
+inline SpGEMMPlan::SpGEMMPlan()
+   : rows_       ( 0UL )  // The number of rows of the resulting matrix
+   , columns_    ( 0UL )  // The number of columns of the resulting matrix
+   , lhsNonZeros_()       // The number of non-zero elements per row of A
+   , rhsNonZeros_()       // The number of non-zero elements per row of B
+   , products_   ()       // The number of scalar products per row of C
+   , rowBegin_   ( 1UL )  // The first non-zero element of each row of C
+   , indices_    ()       // The column indices of the non-zero elements of C
+   , begin_      ( 1UL )  // The first contribution of each non-zero element of C
+   , lhs_        ()       // The positions of the contributing elements of A
+   , rhs_        ()       // The positions of the contributing elements of B
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the multiplication of the two given matrices.
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This constructor performs the symbolic phase of the sparse matrix multiplication \f$ A*B \f$
+// (see the analyze() function).
+*/
+template< typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+inline SpGEMMPlan::SpGEMMPlan( const CompressedMatrix<T1,false>& A,
+                               const CompressedMatrix<T2,false>& B )
+   : rows_       ( 0UL )  // The number of rows of the resulting matrix
+   , columns_    ( 0UL )  // The number of columns of the resulting matrix
+   , lhsNonZeros_()       // The number of non-zero elements per row of A
+   , rhsNonZeros_()       // The number of non-zero elements per row of B
+   , products_   ()       // The number of scalar products per row of C
+   , rowBegin_   ( 1UL )  // The first non-zero element of each row of C
+   , indices_    ()       // The column indices of the non-zero elements of C
+   , begin_      ( 1UL )  // The first contribution of each non-zero element of C
+   , lhs_        ()       // The positions of the contributing elements of A
+   , rhs_        ()       // The positions of the contributing elements of B
+{
+   analyze( A, B );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the resulting matrix.
+//
+// \return The number of rows of the resulting matrix.
+*/
+inline size_t SpGEMMPlan::rows() const
+{
+   return rows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the resulting matrix.
+//
+// \return The number of columns of the resulting matrix.
+*/
+inline size_t SpGEMMPlan::columns() const
+{
+   return columns_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the resulting matrix.
+//
+// \return The number of non-zero elements of the resulting matrix.
+*/
+inline size_t SpGEMMPlan::nonZeros() const
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the specified row of the resulting matrix.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+inline size_t SpGEMMPlan::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows_, "Invalid row access index" );
+   return rowBegin_[i+1UL] - rowBegin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of scalar products of the numeric phase.
+//
+// \return The total number of scalar products.
+*/
+inline size_t SpGEMMPlan::products() const
+{
+   return lhs_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of scalar products of the specified row of the resulting matrix.
+//
+// \param i The index of the row.
+// \return The number of scalar products of row \a i.
+*/
+inline size_t SpGEMMPlan::products( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows_, "Invalid row access index" );
+   return products_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the plan to the multiplication of two 0x0 matrices.
+//
+// \return void
+*/
+inline void SpGEMMPlan::clear()
+{
+   rows_    = 0UL;
+   columns_ = 0UL;
+
+   lhsNonZeros_.clear();
+   rhsNonZeros_.clear();
+   products_.clear();
+   rowBegin_.assign( 1UL, 0UL );
+   indices_.clear();
+   begin_.assign( 1UL, 0UL );
+   lhs_.clear();
+   rhs_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of the sparse matrix multiplication of the two given matrices.
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function determines the sparsity pattern of the product \f$ A*B \f$ and the list of
+// contributing pairs of elements of \a A and \a B for each of its non-zero elements. The
+// contributions of each element are stored in ascending order of the contributing elements
+// of \a A, i.e. the numeric phase sums up the products in the same order as the row-wise
+// sparse matrix multiplication. Any previous setting of the plan is discarded.
+*/
+template< typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void SpGEMMPlan::analyze( const CompressedMatrix<T1,false>& A, const CompressedMatrix<T2,false>& B )
+{
+   typedef typename CompressedMatrix<T1,false>::ConstIterator  LeftIterator;
+   typedef typename CompressedMatrix<T2,false>::ConstIterator  RightIterator;
+
+   if( A.columns() != B.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   clear();
+
+   rows_    = A.rows();
+   columns_ = B.columns();
+
+   lhsNonZeros_.resize( A.rows() );
+   rhsNonZeros_.resize( B.rows() );
+   products_.resize( A.rows() );
+   rowBegin_.resize( A.rows()+1UL );
+
+   for( size_t k=0UL; k<B.rows(); ++k ) {
+      rhsNonZeros_[k] = B.nonZeros(k);
+   }
+
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      size_t tmp( 0UL );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         tmp += rhsNonZeros_[lelem->index()];
+      }
+
+      lhsNonZeros_[i] = A.nonZeros(i);
+      products_[i] = tmp;
+      total += tmp;
+   }
+
+   lhs_.reserve( total );
+   rhs_.reserve( total );
+
+   std::vector<Product> row;
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      row.clear();
+
+      const LeftIterator lbegin( A.begin(i) );
+      const LeftIterator lend  ( A.end(i) );
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem )
+      {
+         const RightIterator rbegin( B.begin( lelem->index() ) );
+         const RightIterator rend  ( B.end  ( lelem->index() ) );
+
+         for( RightIterator relem=rbegin; relem!=rend; ++relem ) {
+            const Product p = { relem->index(), size_t( lelem - lbegin ),
+                                size_t( relem - rbegin ) };
+            row.push_back( p );
+         }
+      }
+
+      std::stable_sort( row.begin(), row.end() );
+
+      for( size_t k=0UL; k<row.size(); )
+      {
+         const size_t index( row[k].index_ );
+
+         for( ; k<row.size() && row[k].index_ == index; ++k ) {
+            lhs_.push_back( row[k].lhs_ );
+            rhs_.push_back( row[k].rhs_ );
+         }
+
+         indices_.push_back( index );
+         begin_.push_back( lhs_.size() );
+      }
+
+      rowBegin_[i+1UL] = indices_.size();
+   }
+
+   BLAZE_INTERNAL_ASSERT( lhs_.size() == total, "Invalid number of scalar products" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the plan can be used for the multiplication of the given matrices.
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \return \a true in case the matrices match the plan, \a false if not.
+//
+// This function checks the sizes of the given matrices and the number of non-zero elements of
+// each of their rows against the setting of the plan. The column indices of the non-zero
+// elements are not checked.
+*/
+template< typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+inline bool SpGEMMPlan::isCompatible( const CompressedMatrix<T1,false>& A,
+                                      const CompressedMatrix<T2,false>& B ) const
+{
+   if( A.rows() != rows_ || B.columns() != columns_ || A.columns() != B.rows() ||
+       B.rows() != rhsNonZeros_.size() )
+      return false;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      if( A.nonZeros(i) != lhsNonZeros_[i] )
+         return false;
+   }
+
+   for( size_t k=0UL; k<B.rows(); ++k ) {
+      if( B.nonZeros(k) != rhsNonZeros_[k] )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lays out the given matrix according to the sparsity pattern of the plan.
+//
+// \param C The resulting row-major sparse matrix.
+// \return void
+//
+// In case the size of \a C or the number of non-zero elements of any of its rows differs from
+// the plan, \a C is resized and filled with the sparsity pattern of the product. The values
+// of the new elements are default initialized. Otherwise \a C is assumed to already contain
+// the pattern and is not modified.
+*/
+template< typename Type >  // Data type of the resulting sparse matrix
+void SpGEMMPlan::layout( CompressedMatrix<Type,false>& C ) const
+{
+   if( C.rows() == rows_ && C.columns() == columns_ && C.nonZeros() == nonZeros() )
+   {
+      size_t i( 0UL );
+      while( i < rows_ && C.nonZeros(i) == nonZeros(i) ) ++i;
+      if( i == rows_ ) return;
+   }
+
+   std::vector<size_t> nonzeros( rows_ );
+   for( size_t i=0UL; i<rows_; ++i ) {
+      nonzeros[i] = nonZeros(i);
+   }
+
+   C.resize( rows_, columns_, false );
+   C.reset();
+   C.reserve( nonzeros );
+
+   for( size_t i=0UL; i<rows_; ++i ) {
+      for( size_t k=rowBegin_[i]; k<rowBegin_[i+1UL]; ++k ) {
+         C.append( i, indices_[k], Type() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of the sparse matrix multiplication for a range of rows.
+//
+// \param C The resulting row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+//
+// This function computes the rows \f$ [first..last) \f$ of the product \f$ A*B \f$ and writes
+// their values into the existing non-zero elements of \a C. \a C must have been laid out via
+// the layout() function and \a A and \a B must be compatible to the plan (see isCompatible()).
+// Since only the given rows of \a C are modified, disjoint row ranges can be processed
+// concurrently.
+*/
+template< typename Type  // Data type of the resulting sparse matrix
+        , typename T1    // Data type of the left-hand side sparse matrix
+        , typename T2 >  // Data type of the right-hand side sparse matrix
+void SpGEMMPlan::assign( CompressedMatrix<Type,false>& C, const CompressedMatrix<T1,false>& A,
+                         const CompressedMatrix<T2,false>& B, size_t first, size_t last ) const
+{
+   typedef typename CompressedMatrix<Type,false>::Iterator  ResultIterator;
+   typedef typename CompressedMatrix<T1,false>::ConstIterator  LeftIterator;
+
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= rows_, "Invalid row range" );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      BLAZE_INTERNAL_ASSERT( C.nonZeros(i) == nonZeros(i), "Invalid layout of the resulting matrix" );
+
+      const LeftIterator lbegin( A.begin(i) );
+      ResultIterator element( C.begin(i) );
+
+      for( size_t k=rowBegin_[i]; k<rowBegin_[i+1UL]; ++k, ++element )
+      {
+         BLAZE_INTERNAL_ASSERT( element->index() == indices_[k], "Invalid layout of the resulting matrix" );
+
+         size_t c( begin_[k] );
+         const size_t cend( begin_[k+1UL] );
+
+         LeftIterator lelem( lbegin + lhs_[c] );
+         Type tmp( lelem->value() * ( B.begin( lelem->index() ) + rhs_[c] )->value() );
+
+         for( ++c; c<cend; ++c ) {
+            lelem = lbegin + lhs_[c];
+            tmp += lelem->value() * ( B.begin( lelem->index() ) + rhs_[c] )->value();
+         }
+
+         element->value() = tmp;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
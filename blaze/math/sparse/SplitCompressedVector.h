@@ -0,0 +1,2385 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitCompressedVector.h
+//  \brief Implementation of an arbitrarily sized compressed vector with split value/index storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+#define _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/SplitIterator.h>
+#include <blaze/math/sparse/VectorAccessProxy.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/HasSplitStorage.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup split_compressed_vector SplitCompressedVector
+// \ingroup sparse_vector
+*/
+/*!\brief Efficient implementation of an arbitrary sized sparse vector with split value/index
+//        storage.
+// \ingroup split_compressed_vector
+//
+// The SplitCompressedVector class template is a variant of the CompressedVector class template
+// that stores the values and the indices of its non-zero elements in two separate arrays instead
+// of a single array of value-index pairs. The type of the elements, the transpose flag, and the
+// index type of the vector can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool TF, typename Index >
+   class SplitCompressedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. SplitCompressedVector can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Index: specifies the type of the stored indices of the non-zero elements. Valid index types
+//           are \a size_t (the default) and \a uint32_t. 32-bit indices halve the memory traffic
+//           for the index array, but restrict the size of the vector to \f$ 2^{32} \f$. In
+//           case the size exceeds the range of the index type, a \a std::invalid_argument
+//           exception is thrown.
+//
+// The SplitCompressedVector provides the same interface and the same iterator semantics as the
+// CompressedVector and can therefore be used as a drop-in replacement:
+
+   \code
+   blaze::SplitCompressedVector<double> a( 10 );
+
+   a[2] = 2.0;              // Access via the subscript operator
+   a.set( 4, -1.2 );        // Setting an element via the set() function
+   a.insert( 5, 3.7 );      // Inserting an element via the insert() function
+   a.reserve( 10 );         // Reserving space for 10 non-zero elements
+   a.append( 7, -2.1 );     // Appending the value -2.1 at index 7
+
+   for( SplitCompressedVector<double>::Iterator it=a.begin(); it!=a.end(); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// The non-zero elements are accessed via proxy objects referring to the according positions in
+// the value and index arrays. Additionally, the iterators provide direct access to both arrays
+// via their values() and indices() member functions. The split storage reduces the memory
+// traffic for operations that only access the values (as for instance the scaling or the
+// length() and sqrLength() functions) and enables vectorized kernels for these operations.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename Index = size_t >         // Index type of the non-zero elements
+class SplitCompressedVector : public SparseVector< SplitCompressedVector<Type,TF,Index>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SplitCompressedVector<Type,TF,Index>   This;            //!< Type of this SplitCompressedVector instance.
+   typedef This                                   ResultType;      //!< Result type for expression template evaluations.
+   typedef SplitCompressedVector<Type,!TF,Index>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                   ElementType;     //!< Type of the compressed vector elements.
+   typedef const Type&                            ReturnType;      //!< Return type for expression template evaluations.
+   typedef const SplitCompressedVector&           CompositeType;   //!< Data type for composite expression templates.
+   typedef VectorAccessProxy<This>                Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                            ConstReference;  //!< Reference to a constant vector value.
+   typedef Index                                  IndexType;       //!< Type of the indices of the non-zero elements.
+   typedef SplitIterator<Type,Index>              Iterator;        //!< Iterator over non-constant elements.
+   typedef SplitIterator<const Type,Index>        ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SplitCompressedVector with different data/element type.
+   */
+   template< typename ET >  // Data type of the other vector
+   struct Rebind {
+      typedef SplitCompressedVector<ET,TF,Index>  Other;  //!< The type of the other SplitCompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                           explicit inline SplitCompressedVector();
+                           explicit inline SplitCompressedVector( size_t size );
+                           explicit inline SplitCompressedVector( size_t size, size_t nonzeros );
+                                    inline SplitCompressedVector( const SplitCompressedVector& sv );
+   template< typename VT >          inline SplitCompressedVector( const DenseVector<VT,TF>&  dv );
+   template< typename VT >          inline SplitCompressedVector( const SparseVector<VT,TF>& sv );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SplitCompressedVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                           inline SplitCompressedVector& operator= ( const SplitCompressedVector& rhs );
+   template< typename VT > inline SplitCompressedVector& operator= ( const DenseVector<VT,TF>&  rhs );
+   template< typename VT > inline SplitCompressedVector& operator= ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator*=( const Vector<VT,TF>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 size() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 nonZeros() const;
+                              inline void                   reset();
+                              inline void                   clear();
+                              inline Iterator               set   ( size_t index, const Type& value );
+                              inline Iterator               insert( size_t index, const Type& value );
+                              inline void                   erase ( size_t index );
+                              inline Iterator               erase ( Iterator pos );
+                              inline Iterator               erase ( Iterator first, Iterator last );
+                              inline void                   resize( size_t n, bool preserve=true );
+                                     void                   reserve( size_t n );
+   template< typename Other > inline SplitCompressedVector& scale( const Other& scalar );
+                              inline void                   swap( SplitCompressedVector& sv ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t index );
+   inline ConstIterator find      ( size_t index ) const;
+   inline Iterator      lowerBound( size_t index );
+   inline ConstIterator lowerBound( size_t index ) const;
+   inline Iterator      upperBound( size_t index );
+   inline ConstIterator upperBound( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append( size_t index, const Type& value, bool check=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename VT > inline void assign   ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void assign   ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void addAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void subAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the vector element type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename Other >
+   struct VectorizedScale {
+      enum { value = IsVectorizable<Type>::value && IT::multiplication &&
+                     ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                     IsSame<Type,Other>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          Iterator insert( Iterator pos, size_t index, const Type& value );
+   inline size_t   extendCapacity() const;
+
+   static inline size_t checkIndexRange( size_t n );
+
+   template< typename Other >
+   inline typename DisableIf< VectorizedScale<Other> >::Type scaleValues( const Other& scalar );
+
+   template< typename Other >
+   inline typename EnableIf< VectorizedScale<Other> >::Type scaleValues( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  size_;      //!< The current size/dimension of the compressed vector.
+   size_t  capacity_;  //!< The maximum capacity of the compressed vector.
+   size_t  nonzeros_;  //!< The current number of non-zero elements of the compressed vector.
+   Type*   values_;    //!< The values of the non-zero elements.
+   Index*  indices_;   //!< The indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( ( IsSame<Index,size_t>::value || IsSame<Index,uint32_t>::value ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool TF, typename Index >
+const Type SplitCompressedVector<Type,TF,Index>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SplitCompressedVector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector()
+   : size_    ( 0UL )   // The current size/dimension of the compressed vector
+   , capacity_( 0UL )   // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )   // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )  // The values of the non-zero elements
+   , indices_ ( NULL )  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector( size_t n )
+   : size_    ( checkIndexRange( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                  // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL  )                  // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )                  // The values of the non-zero elements
+   , indices_ ( NULL )                  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \param nonzeros The number of expected non-zero elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector( size_t n, size_t nonzeros )
+   : size_    ( checkIndexRange( n ) )          // The current size/dimension of the compressed vector
+   , capacity_( nonzeros )                      // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )                           // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )   // The values of the non-zero elements
+   , indices_ ( allocate<Index>( capacity_ ) )  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SplitCompressedVector.
+//
+// \param sv Compressed vector to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector( const SplitCompressedVector& sv )
+   : size_    ( sv.size_ )                      // The current size/dimension of the compressed vector
+   , capacity_( sv.nonzeros_ )                  // The maximum capacity of the compressed vector
+   , nonzeros_( sv.nonzeros_ )                  // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )   // The values of the non-zero elements
+   , indices_ ( allocate<Index>( capacity_ ) )  // The indices of the non-zero elements
+{
+   std::copy( sv.values_ , sv.values_ +nonzeros_, values_  );
+   std::copy( sv.indices_, sv.indices_+nonzeros_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense vectors.
+//
+// \param dv Dense vector to be copied.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the foreign dense vector
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector( const DenseVector<VT,TF>& dv )
+   : size_    ( checkIndexRange( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                             // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL  )                             // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )                             // The values of the non-zero elements
+   , indices_ ( NULL )                             // The indices of the non-zero elements
+{
+   using blaze::assign;
+   assign( *this, ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse vectors.
+//
+// \param sv Sparse vector to be copied.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the foreign sparse vector
+inline SplitCompressedVector<Type,TF,Index>::SplitCompressedVector( const SparseVector<VT,TF>& sv )
+   : size_    ( checkIndexRange( (~sv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )                 // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )                              // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )      // The values of the non-zero elements
+   , indices_ ( allocate<Index>( capacity_ ) )     // The indices of the non-zero elements
+{
+   using blaze::assign;
+   assign( *this, ~sv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SplitCompressedVector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>::~SplitCompressedVector()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position \a index. In case the
+// compressed vector does not yet store an element for index \a index, a new element is inserted
+// into the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Reference
+   SplitCompressedVector<Type,TF,Index>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   return Reference( *this, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstReference
+   SplitCompressedVector<Type,TF,Index>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const ConstIterator pos( find( index ) );
+
+   if( pos == end() )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator SplitCompressedVector<Type,TF,Index>::begin()
+{
+   return Iterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator SplitCompressedVector<Type,TF,Index>::begin() const
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator SplitCompressedVector<Type,TF,Index>::cbegin() const
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator SplitCompressedVector<Type,TF,Index>::end()
+{
+   return Iterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator SplitCompressedVector<Type,TF,Index>::end() const
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator SplitCompressedVector<Type,TF,Index>::cend() const
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SplitCompressedVector.
+//
+// \param rhs Compressed vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The compressed vector is resized according to the given compressed vector and initialized
+// as a copy of this vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline SplitCompressedVector<Type,TF,Index>&
+   SplitCompressedVector<Type,TF,Index>::operator=( const SplitCompressedVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.nonzeros_ > capacity_ ) {
+      SplitCompressedVector tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      std::copy( rhs.values_ , rhs.values_ +rhs.nonzeros_, values_  );
+      std::copy( rhs.indices_, rhs.indices_+rhs.nonzeros_, indices_ );
+      size_     = rhs.size_;
+      nonzeros_ = rhs.nonzeros_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense vectors.
+//
+// \param rhs Dense vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The vector is resized according to the given dense vector and initialized as a
+// copy of this vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side dense vector
+inline SplitCompressedVector<Type,TF,Index>&
+   SplitCompressedVector<Type,TF,Index>::operator=( const DenseVector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      SplitCompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = checkIndexRange( (~rhs).size() );
+      nonzeros_ = 0UL;
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse vectors.
+//
+// \param rhs Sparse vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The vector is resized according to the given sparse vector and initialized as a
+// copy of this vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side sparse vector
+inline SplitCompressedVector<Type,TF,Index>&
+   SplitCompressedVector<Type,TF,Index>::operator=( const SparseVector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
+      SplitCompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = checkIndexRange( (~rhs).size() );
+      nonzeros_ = 0UL;
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,Index>& SplitCompressedVector<Type,TF,Index>::operator+=( const Vector<VT,TF>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   addAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,Index>& SplitCompressedVector<Type,TF,Index>::operator-=( const Vector<VT,TF>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   subAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,Index>& SplitCompressedVector<Type,TF,Index>::operator*=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   SplitCompressedVector<Type,TF,Index> tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a compressed vector
+//        and a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector<Type,TF,Index> >::Type&
+   SplitCompressedVector<Type,TF,Index>::operator*=( Other rhs )
+{
+   scaleValues( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a compressed vector by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the compressed vector.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector<Type,TF,Index> >::Type&
+   SplitCompressedVector<Type,TF,Index>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type            DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      scaleValues( Tmp(1)/static_cast<Tmp>( rhs ) );
+   }
+   else {
+      for( size_t k=0UL; k<nonzeros_; ++k )
+         values_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the compressed vector.
+//
+// \return The size of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t SplitCompressedVector<Type,TF,Index>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed vector.
+//
+// \return The capacity of the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t SplitCompressedVector<Type,TF,Index>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed vector.
+//
+// \return The number of non-zero elements in the compressed vector.
+//
+// Note that the number of non-zero elements is always smaller than the current size of the
+// compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t SplitCompressedVector<Type,TF,Index>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::reset()
+{
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed vector.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed vector is 0.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::clear()
+{
+   size_     = 0UL;
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed vector.
+//
+// \param index The index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Reference to the set value.
+//
+// This function sets the value of an element of the compressed vector. In case the compressed
+// vector already contains an element with index \a index its value is modified, else a new
+// element with the given \a value is inserted.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::set( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index ) {
+      pos->value() = value;
+      return pos;
+   }
+   else return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Reference to the inserted value.
+// \exception std::invalid_argument Invalid compressed vector access index.
+//
+// This function inserts a new element into the compressed vector. However, duplicate elements
+// are not allowed. In case the sparse vector already contains an element with index \a index,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::insert( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param pos The position of the new element.
+// \param index The index of the new element.
+// \param value The value of the element to be inserted.
+// \return Reference to the inserted value.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::insert( Iterator pos, size_t index, const Type& value )
+{
+   const size_t k( pos.indices() - indices_ );
+
+   if( nonzeros_ != capacity_ ) {
+      std::copy_backward( values_ +k, values_ +nonzeros_, values_ +nonzeros_+1UL );
+      std::copy_backward( indices_+k, indices_+nonzeros_, indices_+nonzeros_+1UL );
+      values_ [k] = value;
+      indices_[k] = static_cast<Index>( index );
+      ++nonzeros_;
+
+      return Iterator( values_+k, indices_+k );
+   }
+   else {
+      size_t newCapacity( extendCapacity() );
+
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      Index*  newIndices( allocate<Index>( newCapacity ) );
+
+      std::copy( values_ , values_ +k, newValues  );
+      std::copy( indices_, indices_+k, newIndices );
+      newValues [k] = value;
+      newIndices[k] = static_cast<Index>( index );
+      std::copy( values_ +k, values_ +nonzeros_, newValues +k+1UL );
+      std::copy( indices_+k, indices_+nonzeros_, newIndices+k+1UL );
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+
+      capacity_ = newCapacity;
+      ++nonzeros_;
+
+      return Iterator( values_+k, indices_+k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param index The index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::erase( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( find( index ) );
+   if( pos != end() )
+      erase( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator SplitCompressedVector<Type,TF,Index>::erase( Iterator pos )
+{
+   BLAZE_USER_ASSERT( pos >= begin() && pos <= end(), "Invalid compressed vector iterator" );
+
+   if( pos != end() ) {
+      const size_t k( pos.indices() - indices_ );
+      std::copy( values_ +k+1UL, values_ +nonzeros_, values_ +k );
+      std::copy( indices_+k+1UL, indices_+nonzeros_, indices_+k );
+      --nonzeros_;
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed vector.
+//
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::erase( Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   if( first != last ) {
+      const size_t k1( first.indices() - indices_ );
+      const size_t k2( last.indices()  - indices_ );
+      std::copy( values_ +k2, values_ +nonzeros_, values_ +k1 );
+      std::copy( indices_+k2, indices_+nonzeros_, indices_+k1 );
+      nonzeros_ -= k2 - k1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed vector.
+//
+// \param n The new size of the compressed vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the compressed vector using the given size to \a n. During this
+// operation, new dynamic memory may be allocated in case the capacity of the compressed
+// vector is too small. Note that this function may invalidate all existing views (subvectors,
+// ...) on the vector if it is used to shrink the vector. Additionally, the resize operation
+// potentially changes all vector elements. In order to preserve the old vector values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::resize( size_t n, bool preserve )
+{
+   checkIndexRange( n );
+
+   if( preserve ) {
+      nonzeros_ = std::lower_bound( indices_, indices_+nonzeros_, n ) - indices_;
+   }
+   else {
+      nonzeros_ = 0UL;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed vector.
+//
+// \param n The new minimum capacity of the compressed vector.
+// \return void
+//
+// This function increases the capacity of the compressed vector to at least \a n elements.
+// The current values of the compressed vector are preserved.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+void SplitCompressedVector<Type,TF,Index>::reserve( size_t n )
+{
+   if( n > capacity_ )
+   {
+      const size_t newCapacity( n );
+
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      Index*  newIndices( allocate<Index>( newCapacity ) );
+
+      std::copy( values_ , values_ +nonzeros_, newValues  );
+      std::copy( indices_, indices_+nonzeros_, newIndices );
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+
+      capacity_ = newCapacity;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed vector by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the scalar value
+inline SplitCompressedVector<Type,TF,Index>& SplitCompressedVector<Type,TF,Index>::scale( const Other& scalar )
+{
+   scaleValues( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+//
+// \param sv The compressed vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::swap( SplitCompressedVector& sv ) /* throw() */
+{
+   std::swap( size_, sv.size_ );
+   std::swap( capacity_, sv.capacity_ );
+   std::swap( nonzeros_, sv.nonzeros_ );
+   std::swap( values_ , sv.values_  );
+   std::swap( indices_, sv.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether all indices of a vector of the given size can be represented.
+//
+// \param n The size of the vector.
+// \return The given size \a n.
+// \exception std::invalid_argument Index type too small for the given size.
+//
+// This function checks whether all indices in the range \f$[0..n)\f$ can be stored by means
+// of the index type \a Index. In case the index type is too small, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t SplitCompressedVector<Type,TF,Index>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<Index>::max() ) )
+      throw std::invalid_argument( "Index type too small for the given size" );
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new vector capacity.
+//
+// \return The new compressed vector capacity.
+//
+// This function calculates a new vector capacity based on the current capacity of the sparse
+// vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline size_t SplitCompressedVector<Type,TF,Index>::extendCapacity() const
+{
+   using blaze::max;
+   using blaze::min;
+
+   size_t nonzeros( 2UL*capacity_+1UL );
+   nonzeros = max( nonzeros, 7UL   );
+   nonzeros = min( nonzeros, size_ );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default scaling of the non-zero values of the compressed vector.
+//
+// \param scalar The scalar value for the scaling.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the scalar value
+inline typename DisableIf< typename SplitCompressedVector<Type,TF,Index>::BLAZE_TEMPLATE VectorizedScale<Other> >::Type
+   SplitCompressedVector<Type,TF,Index>::scaleValues( const Other& scalar )
+{
+   for( size_t k=0UL; k<nonzeros_; ++k )
+      values_[k] *= scalar;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized scaling of the non-zero values of the compressed vector.
+//
+// \param scalar The scalar value for the scaling.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the scalar value
+inline typename EnableIf< typename SplitCompressedVector<Type,TF,Index>::BLAZE_TEMPLATE VectorizedScale<Other> >::Type
+   SplitCompressedVector<Type,TF,Index>::scaleValues( const Other& scalar )
+{
+   typedef typename IT::Type  IntrinsicType;
+
+   const IntrinsicType factor( blaze::set( scalar ) );
+
+   size_t k( 0UL );
+
+   for( ; (k+IT::size) <= nonzeros_; k+=IT::size ) {
+      storeu( values_+k, loadu( values_+k ) * factor );
+   }
+   for( ; k<nonzeros_; ++k ) {
+      values_[k] *= scalar;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator or the insert() function!
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator SplitCompressedVector<Type,TF,Index>::find( size_t index )
+{
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index )
+      return pos;
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator SplitCompressedVector<Type,TF,Index>::find( size_t index ) const
+{
+   const ConstIterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index )
+      return pos;
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index not less then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator
+// or the insert() function!
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::lowerBound( size_t index )
+{
+   const Index* pos( std::lower_bound( indices_, indices_+nonzeros_, index ) );
+   return Iterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator
+   SplitCompressedVector<Type,TF,Index>::lowerBound( size_t index ) const
+{
+   const Index* pos( std::lower_bound( indices_, indices_+nonzeros_, index ) );
+   return ConstIterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index greater then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator
+// or the insert() function!
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::Iterator
+   SplitCompressedVector<Type,TF,Index>::upperBound( size_t index )
+{
+   const Index* pos( std::upper_bound( indices_, indices_+nonzeros_, index ) );
+   return Iterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename SplitCompressedVector<Type,TF,Index>::ConstIterator
+   SplitCompressedVector<Type,TF,Index>::upperBound( size_t index ) const
+{
+   const Index* pos( std::upper_bound( indices_, indices_+nonzeros_, index ) );
+   return ConstIterator( values_+( pos-indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed vector with elements. It
+// appends a new element to the end of the compressed vector without any memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the compressed vector
+//  - the current number of non-zero elements must be smaller than the capacity of the vector
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void SplitCompressedVector<Type,TF,Index>::append( size_t index, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( nonzeros_ == 0UL || indices_[nonzeros_-1UL] < index, "Index is not strictly increasing" );
+
+   values_[nonzeros_] = value;
+
+   if( !check || !isDefault( values_[nonzeros_] ) ) {
+      indices_[nonzeros_] = static_cast<Index>( index );
+      ++nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,Index>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,Index>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline bool SplitCompressedVector<Type,TF,Index>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,Index>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   for( size_t i=0UL; i<size_; ++i )
+   {
+      if( nonzeros_ == capacity_ )
+         reserve( extendCapacity() );
+
+      values_[nonzeros_] = (~rhs)[i];
+
+      if( !isDefault( values_[nonzeros_] ) ) {
+         indices_[nonzeros_] = static_cast<Index>( i );
+         ++nonzeros_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,Index>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   for( typename VT::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      append( element->index(), element->value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,Index>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   typedef typename AddTrait<This,typename VT::ResultType>::Type  AddType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( AddType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( AddType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename AddType::CompositeType );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const AddType tmp( serial( *this + (~rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,Index>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SplitCompressedVector<Type,TF,Index> tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,Index>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   typedef typename SubTrait<This,typename VT::ResultType>::Type  SubType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( SubType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( SubType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename SubType::CompositeType );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const SubType tmp( serial( *this - (~rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,Index>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SplitCompressedVector<Type,TF,Index> tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPLITCOMPRESSEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SplitCompressedVector operators */
+//@{
+template< typename Type, bool TF, typename Index >
+inline void reset( SplitCompressedVector<Type,TF,Index>& v );
+
+template< typename Type, bool TF, typename Index >
+inline void clear( SplitCompressedVector<Type,TF,Index>& v );
+
+template< typename Type, bool TF, typename Index >
+inline bool isDefault( const SplitCompressedVector<Type,TF,Index>& v );
+
+template< typename Type, bool TF, typename Index >
+inline typename EnableIf< And< IsVectorizable<Type>, Or< IsFloat<Type>, IsDouble<Type> > >, Type >::Type
+   length( const SplitCompressedVector<Type,TF,Index>& v );
+
+template< typename Type, bool TF, typename Index >
+inline typename EnableIf< And< IsVectorizable<Type>, Or< IsFloat<Type>, IsDouble<Type> > >, const Type >::Type
+   sqrLength( const SplitCompressedVector<Type,TF,Index>& v );
+
+template< typename Type, bool TF, typename Index >
+inline void swap( SplitCompressedVector<Type,TF,Index>& a, SplitCompressedVector<Type,TF,Index>& b ) /* throw() */;
+
+template< typename Type, bool TF, typename Index >
+inline void move( SplitCompressedVector<Type,TF,Index>& dst, SplitCompressedVector<Type,TF,Index>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given split compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be resetted.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void reset( SplitCompressedVector<Type,TF,Index>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given split compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be cleared.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void clear( SplitCompressedVector<Type,TF,Index>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given split compressed vector is in default state.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the compressed vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false. The following example demonstrates the use of the \a isDefault() function:
+
+   \code
+   blaze::SplitCompressedVector<double> a;
+   // ... Resizing and initialization
+   if( isDefault( a ) ) { ... }
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline bool isDefault( const SplitCompressedVector<Type,TF,Index>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized calculation of the square length of a split compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The given split compressed vector.
+// \return The square length of the vector.
+//
+// This overload of the sqrLength() function is selected for split compressed vectors with
+// single or double precision element type. Since the values of the non-zero elements are
+// stored contiguously, the sum of squares is computed with packed fused multiply-add operations
+// on the value array, without touching the index array.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename EnableIf< And< IsVectorizable<Type>, Or< IsFloat<Type>, IsDouble<Type> > >, const Type >::Type
+   sqrLength( const SplitCompressedVector<Type,TF,Index>& v )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const Type*  values( v.begin().values() );
+   const size_t nonzeros( v.nonZeros() );
+
+   IntrinsicType xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size*2UL) <= nonzeros; k+=IT::size*2UL ) {
+      const IntrinsicType a1( loadu( values+k          ) );
+      const IntrinsicType a2( loadu( values+k+IT::size ) );
+      xmm1 = fmadd( a1, a1, xmm1 );
+      xmm2 = fmadd( a2, a2, xmm2 );
+   }
+   if( (k+IT::size) <= nonzeros ) {
+      const IntrinsicType a1( loadu( values+k ) );
+      xmm1 = fmadd( a1, a1, xmm1 );
+      k += IT::size;
+   }
+
+   Type sqrlen( sum( xmm1 + xmm2 ) );
+
+   for( ; k<nonzeros; ++k ) {
+      sqrlen += values[k] * values[k];
+   }
+
+   return sqrlen;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized calculation of the length of a split compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The given split compressed vector.
+// \return The length of the vector.
+//
+// This overload of the length() function is selected for split compressed vectors with single
+// or double precision element type and is based on the vectorized sqrLength() function.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline typename EnableIf< And< IsVectorizable<Type>, Or< IsFloat<Type>, IsDouble<Type> > >, Type >::Type
+   length( const SplitCompressedVector<Type,TF,Index>& v )
+{
+   return std::sqrt( sqrLength( v ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two split compressed vectors.
+// \ingroup split_compressed_vector
+//
+// \param a The first compressed vector to be swapped.
+// \param b The second compressed vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void swap( SplitCompressedVector<Type,TF,Index>& a, SplitCompressedVector<Type,TF,Index>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one split compressed vector to another.
+// \ingroup split_compressed_vector
+//
+// \param dst The destination vector.
+// \param src The source vector.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Index >  // Index type of the non-zero elements
+inline void move( SplitCompressedVector<Type,TF,Index>& dst, SplitCompressedVector<Type,TF,Index>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASSPLITSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename I >
+struct HasSplitStorage< SplitCompressedVector<T,TF,I> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename I >
+struct IsResizable< SplitCompressedVector<T,TF,I> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct AddTrait< SplitCompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef SplitCompressedVector< typename AddTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct AddTrait< SplitCompressedVector<T1,TF,I1>, StaticVector<T2,N,TF> >
+{
+   typedef typename AddTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct AddTrait< StaticVector<T1,N,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename AddTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct AddTrait< SplitCompressedVector<T1,TF,I1>, HybridVector<T2,N,TF> >
+{
+   typedef typename AddTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct AddTrait< HybridVector<T1,N,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2 >
+struct AddTrait< SplitCompressedVector<T1,TF,I1>, DynamicVector<T2,TF> >
+{
+   typedef typename AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename I2 >
+struct AddTrait< DynamicVector<T1,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct AddTrait< SplitCompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
+{
+   typedef typename AddTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct AddTrait< CompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename AddTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct SubTrait< SplitCompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef SplitCompressedVector< typename SubTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct SubTrait< SplitCompressedVector<T1,TF,I1>, StaticVector<T2,N,TF> >
+{
+   typedef typename SubTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct SubTrait< StaticVector<T1,N,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename SubTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, size_t N >
+struct SubTrait< SplitCompressedVector<T1,TF,I1>, HybridVector<T2,N,TF> >
+{
+   typedef typename SubTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename I2 >
+struct SubTrait< HybridVector<T1,N,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2 >
+struct SubTrait< SplitCompressedVector<T1,TF,I1>, DynamicVector<T2,TF> >
+{
+   typedef typename SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename I2 >
+struct SubTrait< DynamicVector<T1,TF>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct SubTrait< SplitCompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >
+{
+   typedef typename SubTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >::Type  Type;
+};
+
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct SubTrait< CompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef typename SubTrait< CompressedVector<T1,TF,I1>, CompressedVector<T2,TF,I2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1, typename T2 >
+struct MultTrait< SplitCompressedVector<T1,TF,I1>, T2 >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, I1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool TF, typename I2 >
+struct MultTrait< T1, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, I2 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct MultTrait< SplitCompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, typename MathTrait<I1,I2>::HighType >  Type;
+};
+
+template< typename T1, typename I1, typename T2, typename I2 >
+struct MultTrait< SplitCompressedVector<T1,false,I1>, SplitCompressedVector<T2,true,I2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,false>, CompressedVector<T2,true> >::Type  Type;
+};
+
+template< typename T1, typename I1, typename T2, typename I2 >
+struct MultTrait< SplitCompressedVector<T1,true,I1>, SplitCompressedVector<T2,false,I2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, bool TF1, typename I1, typename T2, size_t N, bool TF2 >
+struct MultTrait< SplitCompressedVector<T1,TF1,I1>, StaticVector<T2,N,TF2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,TF1>, StaticVector<T2,N,TF2> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF1, typename T2, bool TF2, typename I2 >
+struct MultTrait< StaticVector<T1,N,TF1>, SplitCompressedVector<T2,TF2,I2> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,TF1>, CompressedVector<T2,TF2> >::Type  Type;
+};
+
+template< typename T1, bool TF1, typename I1, typename T2, size_t N, bool TF2 >
+struct MultTrait< SplitCompressedVector<T1,TF1,I1>, HybridVector<T2,N,TF2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,TF1>, HybridVector<T2,N,TF2> >::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF1, typename T2, bool TF2, typename I2 >
+struct MultTrait< HybridVector<T1,N,TF1>, SplitCompressedVector<T2,TF2,I2> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,TF1>, CompressedVector<T2,TF2> >::Type  Type;
+};
+
+template< typename T1, bool TF1, typename I1, typename T2, bool TF2 >
+struct MultTrait< SplitCompressedVector<T1,TF1,I1>, DynamicVector<T2,TF2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,TF1>, DynamicVector<T2,TF2> >::Type  Type;
+};
+
+template< typename T1, bool TF1, typename T2, bool TF2, typename I2 >
+struct MultTrait< DynamicVector<T1,TF1>, SplitCompressedVector<T2,TF2,I2> >
+{
+   typedef typename MultTrait< DynamicVector<T1,TF1>, CompressedVector<T2,TF2> >::Type  Type;
+};
+
+template< typename T1, bool TF1, typename I1, typename T2, bool TF2, typename I2 >
+struct MultTrait< SplitCompressedVector<T1,TF1,I1>, CompressedVector<T2,TF2,I2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,TF1,I1>, CompressedVector<T2,TF2,I2> >::Type  Type;
+};
+
+template< typename T1, bool TF1, typename I1, typename T2, bool TF2, typename I2 >
+struct MultTrait< CompressedVector<T1,TF1,I1>, SplitCompressedVector<T2,TF2,I2> >
+{
+   typedef typename MultTrait< CompressedVector<T1,TF1,I1>, CompressedVector<T2,TF2,I2> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CROSSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename I1, typename T2, typename I2 >
+struct CrossTrait< SplitCompressedVector<T1,false,I1>, SplitCompressedVector<T2,false,I2> >
+{
+   typedef typename CrossTrait< CompressedVector<T1,false>, CompressedVector<T2,false> >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1, typename T2 >
+struct DivTrait< SplitCompressedVector<T1,TF,I1>, T2 >
+{
+   typedef SplitCompressedVector< typename DivTrait<T1,T2>::Type, TF, I1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1, typename T2, typename I2 >
+struct MathTrait< SplitCompressedVector<T1,TF,I1>, SplitCompressedVector<T2,TF,I2> >
+{
+   typedef SplitCompressedVector< typename MathTrait<T1,T2>::HighType, TF, typename MathTrait<I1,I2>::HighType >  HighType;
+   typedef SplitCompressedVector< typename MathTrait<T1,T2>::LowType , TF, typename MathTrait<I1,I2>::HighType >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename I1 >
+struct SubvectorTrait< SplitCompressedVector<T1,TF,I1> >
+{
+   typedef SplitCompressedVector<T1,TF,I1>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,525 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitIterator.h
+//  \brief Header file for the SplitElement and SplitIterator class templates
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SPLITITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPLITELEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Representation of a single non-zero element of a sparse vector or matrix with split
+//        value/index storage.
+// \ingroup math
+//
+// The SplitElement class template represents a single non-zero element of a sparse vector or
+// sparse matrix that stores the values and indices of its non-zero elements in two separate
+// arrays (as for instance SplitCompressedVector and SplitCompressedMatrix). In contrast to the
+// ValueIndexPair class, a SplitElement does not contain the value and the index itself, but
+// refers to the according positions within the two arrays. The value of the element can be
+// modified via value() or the assignment operators, whereas the index is read-only. The stored
+// index type \a Index (per default \a size_t) may be a smaller unsigned integral type; the
+// index() function always returns the index as \a size_t.
+*/
+template< typename Type            // Type of the represented value (possibly const qualified)
+        , typename Index = size_t >  // Type of the stored index
+class SplitElement : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename RemoveConst<Type>::Type  ValueType;       //!< The value type of the element.
+   typedef size_t                            IndexType;       //!< The index type of the element.
+   typedef Type&                             Reference;       //!< Reference return type.
+   typedef const ValueType&                  ConstReference;  //!< Reference-to-const return type.
+   typedef SplitElement*                     Pointer;         //!< Pointer return type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SplitElement class.
+   //
+   // \param value Pointer to the represented value.
+   // \param index Pointer to the index of the represented value.
+   */
+   inline SplitElement( Type* value, const Index* index )
+      : value_( value )  // Pointer to the represented value
+      , index_( index )  // Pointer to the index of the represented value
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operator*************************************************************************
+   /*!\brief Assignment to the represented value.
+   //
+   // \param v The new value of the element.
+   // \return Reference to the assigned element.
+   */
+   template< typename T > inline SplitElement& operator=( const T& v ) {
+      *value_ = v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment to the represented value.
+   //
+   // \param v The right-hand side value for the addition.
+   // \return Reference to the assigned element.
+   */
+   template< typename T > inline SplitElement& operator+=( const T& v ) {
+      *value_ += v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment to the represented value.
+   //
+   // \param v The right-hand side value for the subtraction.
+   // \return Reference to the assigned element.
+   */
+   template< typename T > inline SplitElement& operator-=( const T& v ) {
+      *value_ -= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Multiplication assignment operator**********************************************************
+   /*!\brief Multiplication assignment to the represented value.
+   //
+   // \param v The right-hand side value for the multiplication.
+   // \return Reference to the assigned element.
+   */
+   template< typename T > inline SplitElement& operator*=( const T& v ) {
+      *value_ *= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Division assignment operator****************************************************************
+   /*!\brief Division assignment to the represented value.
+   //
+   // \param v The right-hand side value for the division.
+   // \return Reference to the assigned element.
+   */
+   template< typename T > inline SplitElement& operator/=( const T& v ) {
+      *value_ /= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element.
+   //
+   // \return Pointer to the element.
+   */
+   inline Pointer operator->() {
+      return this;
+   }
+   //**********************************************************************************************
+
+   //**Value function******************************************************************************
+   /*!\brief Access to the current value of the element.
+   //
+   // \return The current value of the element.
+   */
+   inline Reference value() const {
+      return *value_;
+   }
+   //**********************************************************************************************
+
+   //**Index function******************************************************************************
+   /*!\brief Access to the current index of the element.
+   //
+   // \return The current index of the element.
+   */
+   inline IndexType index() const {
+      return *index_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*        value_;  //!< Pointer to the represented value.
+   const Index* index_;  //!< Pointer to the index of the represented value.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPLITITERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the non-zero elements of a sparse vector or matrix with split value/index
+//        storage.
+// \ingroup math
+//
+// The SplitIterator class template is a random access iterator over the non-zero elements of
+// a sparse vector or sparse matrix that stores the values and indices of its non-zero elements
+// in two separate arrays. It simultaneously traverses both arrays and provides access to the
+// current element via a SplitElement. Additionally, the values() and indices() functions give
+// direct access to the two underlying arrays starting at the current position, which enables
+// vectorized kernels to process the values and indices via contiguous loads.
+*/
+template< typename Type            // Type of the iterated values (possibly const qualified)
+        , typename Index = size_t >  // Type of the stored indices
+class SplitIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef SplitElement<Type,Index>         ValueType;         //!< Type of the underlying elements.
+   typedef ValueType                        PointerType;       //!< Pointer return type.
+   typedef ValueType                        ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Default constructor*************************************************************************
+   /*!\brief Default constructor for the SplitIterator class.
+   */
+   inline SplitIterator()
+      : value_( NULL )  // Pointer to the current value
+      , index_( NULL )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SplitIterator class.
+   //
+   // \param value Pointer to the current value.
+   // \param index Pointer to the current index.
+   */
+   inline SplitIterator( Type* value, const Index* index )
+      : value_( value )  // Pointer to the current value
+      , index_( index )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Conversion constructor**********************************************************************
+   /*!\brief Conversion constructor from different SplitIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename Type2 >
+   inline SplitIterator( const SplitIterator<Type2,Index>& it )
+      : value_( it.values()  )  // Pointer to the current value
+      , index_( it.indices() )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline SplitIterator& operator+=( DifferenceType inc ) {
+      value_ += inc;
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline SplitIterator& operator-=( DifferenceType dec ) {
+      value_ -= dec;
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline SplitIterator& operator++() {
+      ++value_;
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SplitIterator operator++( int ) {
+      const SplitIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline SplitIterator& operator--() {
+      --value_;
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SplitIterator operator--( int ) {
+      const SplitIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Direct access to the element at the given distance from the current position.
+   //
+   // \param index Distance of the accessed element from the current position.
+   // \return The accessed element.
+   */
+   inline ReferenceType operator[]( DifferenceType index ) const {
+      return ReferenceType( value_+index, index_+index );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the current element.
+   //
+   // \return The current element.
+   */
+   inline ReferenceType operator*() const {
+      return ReferenceType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the current element.
+   //
+   // \return The current element.
+   */
+   inline PointerType operator->() const {
+      return PointerType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Values function*****************************************************************************
+   /*!\brief Low-level access to the value array starting at the current position.
+   //
+   // \return Pointer to the current value.
+   */
+   inline Type* values() const {
+      return value_;
+   }
+   //**********************************************************************************************
+
+   //**Indices function****************************************************************************
+   /*!\brief Low-level access to the index array starting at the current position.
+   //
+   // \return Pointer to the current index.
+   */
+   inline const Index* indices() const {
+      return index_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   template< typename Type2 >
+   inline bool operator==( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ == rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   template< typename Type2 >
+   inline bool operator!=( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ != rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   template< typename Type2 >
+   inline bool operator<( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ < rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   template< typename Type2 >
+   inline bool operator>( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ > rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   template< typename Type2 >
+   inline bool operator<=( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ <= rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   template< typename Type2 >
+   inline bool operator>=( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ >= rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   template< typename Type2 >
+   inline DifferenceType operator-( const SplitIterator<Type2,Index>& rhs ) const {
+      return index_ - rhs.indices();
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a SplitIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SplitIterator operator+( const SplitIterator& it, DifferenceType inc ) {
+      return SplitIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a SplitIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SplitIterator operator+( DifferenceType inc, const SplitIterator& it ) {
+      return SplitIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a SplitIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const SplitIterator operator-( const SplitIterator& it, DifferenceType dec ) {
+      return SplitIterator( it.value_ - dec, it.index_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*        value_;  //!< Pointer to the current value.
+   const Index* index_;  //!< Pointer to the current index.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
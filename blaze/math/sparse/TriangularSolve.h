@@ -0,0 +1,895 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TriangularSolve.h
+//  \brief Header file for sparse triangular solves
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SPARSE_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/adaptors/Forward.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level-set analysis of a sparse triangular matrix.
+// \ingroup sparse_matrix
+//
+// The LevelSchedule class partitions the rows of a square sparse matrix into levels (also
+// called wavefronts) for the solution of a lower or upper triangular system \f$ A*x=b \f$. A row
+// belongs to level \f$ l \f$ in case it depends on at least one row of level \f$ l-1 \f$, but on
+// no row of a higher level. Therefore all rows of the same level can be computed independently
+// of each other as soon as all previous levels are complete. The analysis only depends on the
+// sparsity pattern of the matrix and is usually set up once and reused for many solves with
+// changing values and right-hand sides, as for instance in incomplete factorization
+// preconditioners and Gauss-Seidel smoothers:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LevelSchedule;
+
+   CompressedMatrix<double> L;
+   DynamicVector<double> x, b;
+   // ... Setting up the lower triangular matrix and the right-hand side
+
+   const LevelSchedule schedule( L, true );  // Analysis of the lower triangular part of L
+
+   solve( L, schedule, x, b );  // Parallel forward substitution
+   \endcode
+
+// The analysis only considers the diagonal elements and the elements of the requested triangular
+// part of the matrix. All elements of the opposite triangular part are ignored. In case the
+// matrix is not square or in case a diagonal element is not stored, a \a std::invalid_argument
+// exception is thrown.
+*/
+class LevelSchedule
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Iterator over the rows of a level.
+   typedef std::vector<size_t>::const_iterator  ConstIterator;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LevelSchedule();
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A, bool lower );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        rows() const;
+   inline size_t        rows( size_t l ) const;
+   inline size_t        nonZeros() const;
+   inline size_t        levels() const;
+   inline bool          isLower() const;
+   inline ConstIterator begin( size_t l ) const;
+   inline ConstIterator end  ( size_t l ) const;
+   inline void          clear();
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, bool lower );
+
+   template< typename MT, bool SO >
+   inline bool isCompatible( const SparseMatrix<MT,SO>& A ) const;
+
+   template< typename MT, typename VT1, typename VT2 >
+   inline void substitute( const MT& A, VT1& x, const VT2& b,
+                           ConstIterator first, ConstIterator last ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t              rows_;      //!< The number of rows of the analyzed matrix.
+   size_t              nonZeros_;  //!< The number of non-zero elements of the analyzed matrix.
+   bool                lower_;     //!< \a true for a lower, \a false for an upper triangular part.
+   std::vector<size_t> levels_;    //!< The offsets of all levels within the row list.
+   std::vector<size_t> order_;     //!< The rows of all levels in ascending order per level.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular solve functions */
+//@{
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+void forwardSubstitution( const SparseMatrix<MT,SO>& L, DenseVector<VT1,TF>& x,
+                          const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+void backSubstitution( const SparseMatrix<MT,SO>& U, DenseVector<VT1,TF>& x,
+                       const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+inline void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+inline void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+inline void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF, typename VT2 >
+inline void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single row of the solution of a row-major lower triangular system.
+// \ingroup sparse_matrix
+//
+// \param L The row-major lower triangular matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \param i The index of the row to be computed.
+// \return \a true if the row has been computed, \a false in case of a missing diagonal element.
+//
+// All elements \f$ x_j \f$ with \f$ j<i \f$ that row \a i depends on must already be computed.
+// All elements of \a L above the diagonal are ignored.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline bool substituteLower( const MT& L, VT1& x, const VT2& b, size_t i )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT1::ElementType   ElementType;
+
+   const ConstIterator end( L.end(i) );
+   ConstIterator element( L.begin(i) );
+
+   ElementType sum( b[i] );
+
+   for( ; element!=end && element->index() < i; ++element ) {
+      sum -= element->value() * x[element->index()];
+   }
+
+   if( element == end || element->index() != i )
+      return false;
+
+   x[i] = sum / element->value();
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single row of the solution of a row-major upper triangular system.
+// \ingroup sparse_matrix
+//
+// \param U The row-major upper triangular matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \param i The index of the row to be computed.
+// \return \a true if the row has been computed, \a false in case of a missing diagonal element.
+//
+// All elements \f$ x_j \f$ with \f$ j>i \f$ that row \a i depends on must already be computed.
+// All elements of \a U below the diagonal are ignored.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline bool substituteUpper( const MT& U, VT1& x, const VT2& b, size_t i )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT1::ElementType   ElementType;
+
+   const ConstIterator end( U.end(i) );
+   ConstIterator element( U.begin(i) );
+
+   while( element != end && element->index() < i ) {
+      ++element;
+   }
+
+   if( element == end || element->index() != i )
+      return false;
+
+   const ConstIterator diagonal( element );
+   ElementType sum( b[i] );
+
+   for( ++element; element!=end; ++element ) {
+      sum -= element->value() * x[element->index()];
+   }
+
+   x[i] = sum / diagonal->value();
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward substitution with a row-major or column-major lower triangular matrix.
+// \ingroup sparse_matrix
+//
+// \param L The lower triangular matrix.
+// \param x The solution vector, initialized with the right-hand side in the column-major case.
+// \param b The right-hand side vector.
+// \param SO The storage order of \a L (\a rowMajor or \a columnMajor).
+// \return void
+// \exception std::invalid_argument Singular triangular matrix.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void forwardSubstitution_backend( const MT& L, VT1& x, const VT2& b, bool SO )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT1::ElementType   ElementType;
+
+   const size_t n( L.rows() );
+
+   if( !SO ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         if( !substituteLower( L, x, b, i ) )
+            throw std::invalid_argument( "Singular triangular matrix" );
+      }
+      return;
+   }
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const ConstIterator end( L.end(j) );
+      ConstIterator element( L.begin(j) );
+
+      while( element != end && element->index() < j ) {
+         ++element;
+      }
+
+      if( element == end || element->index() != j )
+         throw std::invalid_argument( "Singular triangular matrix" );
+
+      x[j] /= element->value();
+      const ElementType xj( x[j] );
+
+      for( ++element; element!=end; ++element ) {
+         x[element->index()] -= element->value() * xj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Back substitution with a row-major or column-major upper triangular matrix.
+// \ingroup sparse_matrix
+//
+// \param U The upper triangular matrix.
+// \param x The solution vector, initialized with the right-hand side in the column-major case.
+// \param b The right-hand side vector.
+// \param SO The storage order of \a U (\a rowMajor or \a columnMajor).
+// \return void
+// \exception std::invalid_argument Singular triangular matrix.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void backSubstitution_backend( const MT& U, VT1& x, const VT2& b, bool SO )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT1::ElementType   ElementType;
+
+   const size_t n( U.rows() );
+
+   if( !SO ) {
+      for( size_t i=n; i>0UL; --i ) {
+         if( !substituteUpper( U, x, b, i-1UL ) )
+            throw std::invalid_argument( "Singular triangular matrix" );
+      }
+      return;
+   }
+
+   for( size_t j=n; j>0UL; --j )
+   {
+      const ConstIterator begin( U.begin(j-1UL) );
+      const ConstIterator end  ( U.end(j-1UL) );
+      ConstIterator diagonal( begin );
+
+      while( diagonal != end && diagonal->index() < j-1UL ) {
+         ++diagonal;
+      }
+
+      if( diagonal == end || diagonal->index() != j-1UL )
+         throw std::invalid_argument( "Singular triangular matrix" );
+
+      x[j-1UL] /= diagonal->value();
+      const ElementType xj( x[j-1UL] );
+
+      for( ConstIterator element=begin; element!=diagonal; ++element ) {
+         x[element->index()] -= element->value() * xj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the lower triangular system \f$ L*x=b \f$ by forward substitution.
+// \ingroup sparse_matrix
+//
+// \param L The square lower triangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Singular triangular matrix.
+//
+// This function solves \f$ L*x=b \f$ with the lower triangular part of the given sparse matrix.
+// All elements above the diagonal are ignored, i.e. \a L can be a LowerMatrix or UniLowerMatrix
+// adaptor as well as a general sparse matrix. Row-major matrices are processed row-wise (each
+// \f$ x_i \f$ is computed by a single sparse dot product), column-major matrices column-wise
+// (each \f$ x_j \f$ updates the remaining right-hand side). \a x and \a b may be the same vector.
+// In case the sizes of \a L, \a x, and \a b don't match, a \a std::invalid_argument exception is
+// thrown. In case a diagonal element of \a L is not stored, a \a std::invalid_argument exception
+// is thrown and \a x is left in a partially computed state.
+*/
+template< typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+void forwardSubstitution( const SparseMatrix<MT,SO>& L, DenseVector<VT1,TF>& x,
+                          const DenseVector<VT2,TF>& b )
+{
+   const size_t n( (~L).rows() );
+
+   if( (~L).columns() != n || (~x).size() != n || (~b).size() != n )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   typename MT::CompositeType A( ~L );
+
+   if( !SO ) {
+      forwardSubstitution_backend( A, ~x, ~b, rowMajor );
+   }
+   else {
+      if( static_cast<const void*>( &~x ) != static_cast<const void*>( &~b ) ) {
+         for( size_t i=0UL; i<n; ++i )
+            (~x)[i] = (~b)[i];
+      }
+      forwardSubstitution_backend( A, ~x, ~x, columnMajor );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the upper triangular system \f$ U*x=b \f$ by back substitution.
+// \ingroup sparse_matrix
+//
+// \param U The square upper triangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Singular triangular matrix.
+//
+// This function solves \f$ U*x=b \f$ with the upper triangular part of the given sparse matrix.
+// All elements below the diagonal are ignored, i.e. \a U can be an UpperMatrix or UniUpperMatrix
+// adaptor as well as a general sparse matrix. \a x and \a b may be the same vector. In case the
+// sizes of \a U, \a x, and \a b don't match, a \a std::invalid_argument exception is thrown. In
+// case a diagonal element of \a U is not stored, a \a std::invalid_argument exception is thrown
+// and \a x is left in a partially computed state.
+*/
+template< typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+void backSubstitution( const SparseMatrix<MT,SO>& U, DenseVector<VT1,TF>& x,
+                       const DenseVector<VT2,TF>& b )
+{
+   const size_t n( (~U).rows() );
+
+   if( (~U).columns() != n || (~x).size() != n || (~b).size() != n )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   typename MT::CompositeType A( ~U );
+
+   if( !SO ) {
+      backSubstitution_backend( A, ~x, ~b, rowMajor );
+   }
+   else {
+      if( static_cast<const void*>( &~x ) != static_cast<const void*>( &~b ) ) {
+         for( size_t i=0UL; i<n; ++i )
+            (~x)[i] = (~b)[i];
+      }
+      backSubstitution_backend( A, ~x, ~x, columnMajor );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the lower triangular system \f$ L*x=b \f$.
+// \ingroup sparse_matrix
+//
+// \param L The sparse lower triangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Singular triangular matrix.
+//
+// This function solves \f$ L*x=b \f$ by forward substitution (see forwardSubstitution()).
+*/
+template< typename MT   // Type of the adapted sparse matrix
+        , bool SO       // Storage order of the adapted sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const LowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b )
+{
+   forwardSubstitution( L, x, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the lower unitriangular system \f$ L*x=b \f$.
+// \ingroup sparse_matrix
+//
+// \param L The sparse lower unitriangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves \f$ L*x=b \f$ by forward substitution (see forwardSubstitution()).
+*/
+template< typename MT   // Type of the adapted sparse matrix
+        , bool SO       // Storage order of the adapted sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const UniLowerMatrix<MT,SO,false>& L, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b )
+{
+   forwardSubstitution( L, x, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the upper triangular system \f$ U*x=b \f$.
+// \ingroup sparse_matrix
+//
+// \param U The sparse upper triangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Singular triangular matrix.
+//
+// This function solves \f$ U*x=b \f$ by back substitution (see backSubstitution()).
+*/
+template< typename MT   // Type of the adapted sparse matrix
+        , bool SO       // Storage order of the adapted sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const UpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b )
+{
+   backSubstitution( U, x, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the upper unitriangular system \f$ U*x=b \f$.
+// \ingroup sparse_matrix
+//
+// \param U The sparse upper unitriangular matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves \f$ U*x=b \f$ by back substitution (see backSubstitution()).
+*/
+template< typename MT   // Type of the adapted sparse matrix
+        , bool SO       // Storage order of the adapted sparse matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF       // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const UniUpperMatrix<MT,SO,false>& U, DenseVector<VT1,TF>& x,
+                   const DenseVector<VT2,TF>& b )
+{
+   backSubstitution( U, x, b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+*/
+inline LevelSchedule::LevelSchedule()
+   : rows_    ( 0UL )       // The number of rows of the analyzed matrix
+   , nonZeros_( 0UL )       // The number of non-zero elements of the analyzed matrix
+   , lower_   ( true )      // true for a lower, false for an upper triangular matrix
+   , levels_  ( 1UL, 0UL )  // The offsets of all levels within the row list
+   , order_   ()            // The rows of all levels in ascending order per level
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-set analysis of the given triangular matrix.
+//
+// \param A The square sparse matrix to be analyzed.
+// \param lower \a true for the lower, \a false for the upper triangular part of \a A.
+// \exception std::invalid_argument Invalid non-square matrix.
+// \exception std::invalid_argument Singular triangular matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A, bool lower )
+   : rows_    ( 0UL )       // The number of rows of the analyzed matrix
+   , nonZeros_( 0UL )       // The number of non-zero elements of the analyzed matrix
+   , lower_   ( true )      // true for a lower, false for an upper triangular matrix
+   , levels_  ( 1UL, 0UL )  // The offsets of all levels within the row list
+   , order_   ()            // The rows of all levels in ascending order per level
+{
+   analyze( A, lower );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the analyzed matrix.
+//
+// \return The number of rows of the analyzed matrix.
+*/
+inline size_t LevelSchedule::rows() const
+{
+   return rows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the specified level.
+//
+// \param l The index of the level.
+// \return The number of rows of the level.
+*/
+inline size_t LevelSchedule::rows( size_t l ) const
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return levels_[l+1UL] - levels_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the analyzed matrix.
+//
+// \return The number of non-zero elements of the analyzed matrix.
+*/
+inline size_t LevelSchedule::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels.
+//
+// \return The number of levels.
+//
+// The number of levels is the length of the longest dependency chain of the triangular system.
+// In case of a diagonal matrix all rows form a single level, in case of a bidiagonal matrix
+// each row forms its own level.
+*/
+inline size_t LevelSchedule::levels() const
+{
+   return levels_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the lower or the upper triangular part has been analyzed.
+//
+// \return \a true for the lower triangular part, \a false for the upper triangular part.
+*/
+inline bool LevelSchedule::isLower() const
+{
+   return lower_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first row of the specified level.
+//
+// \param l The index of the level.
+// \return Iterator to the first row of the level.
+//
+// The rows of each level are stored in ascending order.
+*/
+inline LevelSchedule::ConstIterator LevelSchedule::begin( size_t l ) const
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return order_.begin() + levels_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last row of the specified level.
+//
+// \param l The index of the level.
+// \return Iterator just past the last row of the level.
+*/
+inline LevelSchedule::ConstIterator LevelSchedule::end( size_t l ) const
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return order_.begin() + levels_[l+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the schedule to the analysis of an empty matrix.
+//
+// \return void
+*/
+inline void LevelSchedule::clear()
+{
+   rows_     = 0UL;
+   nonZeros_ = 0UL;
+   lower_    = true;
+   levels_.assign( 1UL, 0UL );
+   order_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Level-set analysis of the given triangular matrix.
+//
+// \param A The square sparse matrix to be analyzed.
+// \param lower \a true for the lower, \a false for the upper triangular part of \a A.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix.
+// \exception std::invalid_argument Singular triangular matrix.
+//
+// This function replaces the current schedule by the analysis of the given matrix. The level of
+// each row is one more than the maximum level of all rows it depends on. Afterwards the rows are
+// grouped by level by means of a counting sort. In case \a A is not square or a diagonal element
+// of \a A is not stored, a \a std::invalid_argument exception is thrown and the schedule is not
+// modified.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void LevelSchedule::analyze( const SparseMatrix<MT,SO>& A, bool lower )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  RowIterator;
+
+   const size_t n( (~A).rows() );
+
+   if( (~A).columns() != n )
+      throw std::invalid_argument( "Invalid non-square matrix" );
+
+   CT tmp( ~A );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t height( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( ( lower )?( k ):( n-1UL-k ) );
+      bool diagonal( false );
+
+      // In the row-major case row i depends on the preceding rows j. In the column-major case
+      // column i is final and all subsequent rows j depend on it.
+      for( RowIterator element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j == i )
+            diagonal = true;
+         else if( ( ( j < i ) != SO ) != lower )
+            continue;
+         else if( SO )
+            level[j] = ( level[j] > level[i] )?( level[j] ):( level[i]+1UL );
+         else
+            level[i] = ( level[i] > level[j] )?( level[i] ):( level[j]+1UL );
+      }
+
+      if( !diagonal )
+         throw std::invalid_argument( "Singular triangular matrix" );
+
+      if( level[i] >= height )
+         height = level[i] + 1UL;
+   }
+
+   std::vector<size_t> levels( height+1UL, 0UL );
+   std::vector<size_t> order( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++levels[level[i]+1UL];
+   }
+
+   for( size_t l=0UL; l<height; ++l ) {
+      levels[l+1UL] += levels[l];
+   }
+
+   std::vector<size_t> pos( levels.begin(), levels.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      order[pos[level[i]]++] = i;
+   }
+
+   rows_     = n;
+   nonZeros_ = (~A).nonZeros();
+   lower_    = lower;
+   levels_.swap( levels );
+   order_.swap( order );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given matrix matches the analyzed matrix.
+//
+// \param A The sparse matrix to be checked.
+// \return \a true in case the size and the number of non-zero elements match, \a false if not.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline bool LevelSchedule::isCompatible( const SparseMatrix<MT,SO>& A ) const
+{
+   return ( (~A).rows()     == rows_ &&
+            (~A).columns()  == rows_ &&
+            (~A).nonZeros() == nonZeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the given rows of the solution of a row-major triangular system.
+//
+// \param A The analyzed row-major sparse matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \param first Iterator to the first row to be computed.
+// \param last Iterator just past the last row to be computed.
+// \return void
+//
+// All given rows must belong to the same level and all previous levels must be complete. In
+// this case the rows can be computed concurrently by several threads. \a x and \a b may be
+// the same vector.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline void LevelSchedule::substitute( const MT& A, VT1& x, const VT2& b,
+                                       ConstIterator first, ConstIterator last ) const
+{
+   if( lower_ ) {
+      for( ; first!=last; ++first ) {
+         const bool computed( substituteLower( A, x, b, *first ) );
+         BLAZE_INTERNAL_ASSERT( computed, "Missing diagonal element detected" );
+         UNUSED_PARAMETER( computed );
+      }
+   }
+   else {
+      for( ; first!=last; ++first ) {
+         const bool computed( substituteUpper( A, x, b, *first ) );
+         BLAZE_INTERNAL_ASSERT( computed, "Missing diagonal element detected" );
+         UNUSED_PARAMETER( computed );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,685 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletAssembly.h
+//  \brief Header file for the bulk assembly of compressed matrices from triplets
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETASSEMBLY_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETASSEMBLY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DuplicatePolicy.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bulk assembly of a compressed matrix from unsorted (row, column, value) triplets.
+// \ingroup sparse_matrix
+//
+// The TripletAssembler class template sorts a range of triplets by means of two stable counting
+// sorts, first by their minor index (the column index in case of a row-major matrix) and then by
+// their major index (the row index in case of a row-major matrix). Afterwards the triplets of
+// each row/column are in ascending order of their minor index and duplicates are adjacent in
+// the order of the given triplets. In contrast to a comparison based sort the work is linear in
+// the number of triplets.
+//
+// The assembly is split into phases, which are executed in the following order:
+//
+//  -# \a countMinor: Counting the minor indices of the triplets of each part of the input.
+//  -# minorOffsets(): Validation of all indices and computation of the scatter offsets.
+//  -# \a scatterMinor: Stable sort of the triplets of each part by their minor index.
+//  -# \a countMajor: Counting the major indices of the triplets of each part.
+//  -# majorOffsets(): Computation of the scatter offsets and of the first triplet of each row.
+//  -# \a scatterMajor: Stable sort of the triplets of each part by their major index.
+//  -# \a countNonZeros: Counting the distinct elements of each row/column.
+//  -# The target matrix is reset and its rows/columns are laid out via the reserve() function.
+//  -# \a appendElements: Combination of duplicates and appending all elements of each row/column.
+//
+// All phases are executed via the run() function, either for a range of parts (the first four
+// phases) or for a range of rows/columns (the last two phases). Since every part and every
+// row/column is processed independently, disjoint ranges can be executed concurrently. Each
+// part requires a histogram of the size of the major and minor dimension, therefore the number
+// of parts should be chosen via the tripletParts() function.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+class TripletAssembler
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Phases of the assembly.
+   enum Phase { countMinor, scatterMinor, countMajor, scatterMajor, countNonZeros, appendElements };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TripletAssembler( IT1 major, IT2 minor, IT3 values, size_t triplets,
+                                     size_t majorSize, size_t minorSize, size_t parts,
+                                     DuplicatePolicy policy );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     parts() const;
+   inline size_t                     majorSize() const;
+   inline size_t                     triplets( size_t i ) const;
+   inline const std::vector<size_t>& nonZeros() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assembly functions**************************************************************************
+   /*!\name Assembly functions */
+   //@{
+   bool minorOffsets();
+   void majorOffsets();
+
+   template< typename MT >
+   void run( Phase phase, size_t first, size_t last, MT& matrix );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Assembly functions**************************************************************************
+   /*!\name Assembly functions */
+   //@{
+   void count  ( size_t part, bool major );
+   void scatter( size_t part, bool major );
+   void offsets( bool major );
+
+   template< typename MT >
+   void append( MT& matrix, size_t i );
+
+   template< typename Type, typename Index >
+   static inline void append( CompressedMatrix<Type,false,Index>& matrix,
+                              size_t i, size_t j, const Type& value );
+
+   template< typename Type, typename Index >
+   static inline void append( CompressedMatrix<Type,true,Index>& matrix,
+                              size_t j, size_t i, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   IT1 major_;              //!< The major indices of the triplets.
+   IT2 minor_;              //!< The minor indices of the triplets.
+   IT3 values_;             //!< The values of the triplets.
+   size_t triplets_;        //!< The total number of triplets.
+   size_t majorSize_;       //!< The number of rows/columns of the target matrix.
+   size_t minorSize_;       //!< The number of columns/rows of the target matrix.
+   size_t parts_;           //!< The number of parts of the input.
+   DuplicatePolicy policy_; //!< The treatment of duplicate elements.
+
+   std::vector<size_t> counts_;    //!< The histograms (and scatter offsets) of all parts.
+   std::vector<byte>   invalid_;   //!< Flags for invalid indices in each part.
+   std::vector<size_t> minorPerm_; //!< The triplets sorted by their minor index.
+   std::vector<size_t> perm_;      //!< The triplets sorted by their major and minor index.
+   std::vector<size_t> start_;     //!< The first triplet of each row/column in \a perm_.
+   std::vector<size_t> nonzeros_;  //!< The number of distinct elements of each row/column.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TripletAssembler class template.
+//
+// \param major The major indices of the triplets (row indices in case of a row-major matrix).
+// \param minor The minor indices of the triplets (column indices in case of a row-major matrix).
+// \param values The values of the triplets.
+// \param triplets The total number of triplets.
+// \param majorSize The number of rows (row-major) or columns (column-major) of the target matrix.
+// \param minorSize The number of columns (row-major) or rows (column-major) of the target matrix.
+// \param parts The number of parts of the input \f$[1..\infty)\f$.
+// \param policy The treatment of duplicate elements.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline TripletAssembler<IT1,IT2,IT3>::TripletAssembler( IT1 major, IT2 minor, IT3 values,
+                                                        size_t triplets, size_t majorSize,
+                                                        size_t minorSize, size_t parts,
+                                                        DuplicatePolicy policy )
+   : major_    ( major )      // The major indices of the triplets
+   , minor_    ( minor )      // The minor indices of the triplets
+   , values_   ( values )     // The values of the triplets
+   , triplets_ ( triplets )   // The total number of triplets
+   , majorSize_( majorSize )  // The number of rows/columns of the target matrix
+   , minorSize_( minorSize )  // The number of columns/rows of the target matrix
+   , parts_    ( parts )      // The number of parts of the input
+   , policy_   ( policy )     // The treatment of duplicate elements
+   , counts_   ()             // The histograms (and scatter offsets) of all parts
+   , invalid_  ( parts, 0 )   // Flags for invalid indices in each part
+   , minorPerm_( triplets )   // The triplets sorted by their minor index
+   , perm_     ( triplets )   // The triplets sorted by their major and minor index
+   , start_    ( majorSize+1UL, 0UL )  // The first triplet of each row/column
+   , nonzeros_ ( majorSize, 0UL )      // The number of distinct elements of each row/column
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+
+   const size_t size( ( majorSize > minorSize )?( majorSize ):( minorSize ) );
+   counts_.resize( parts * ( ( size > 0UL )?( size ):( 1UL ) ), 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of parts of the input.
+//
+// \return The number of parts.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline size_t TripletAssembler<IT1,IT2,IT3>::parts() const
+{
+   return parts_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the target matrix.
+//
+// \return The size of the major dimension.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline size_t TripletAssembler<IT1,IT2,IT3>::majorSize() const
+{
+   return majorSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of triplets of the given row/column.
+//
+// \param i The index of the row/column.
+// \return The number of triplets of row/column \a i (including duplicates).
+//
+// This function can only be used after the majorOffsets() function.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline size_t TripletAssembler<IT1,IT2,IT3>::triplets( size_t i ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < majorSize_, "Invalid row/column access index" );
+   return start_[i+1UL] - start_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of distinct elements of all rows/columns.
+//
+// \return The number of distinct elements per row/column.
+//
+// The result is only valid after the \a countNonZeros phase.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+inline const std::vector<size_t>& TripletAssembler<IT1,IT2,IT3>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSEMBLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the scatter offsets of the minor pass.
+//
+// \return \a true in case all indices are valid, \a false if not.
+//
+// This function validates the indices of all triplets and converts the histograms of the
+// \a countMinor phase into the scatter offsets of the \a scatterMinor phase.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+bool TripletAssembler<IT1,IT2,IT3>::minorOffsets()
+{
+   for( size_t p=0UL; p<parts_; ++p ) {
+      if( invalid_[p] )
+         return false;
+   }
+
+   offsets( false );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the scatter offsets of the major pass.
+//
+// \return void
+//
+// This function converts the histograms of the \a countMajor phase into the scatter offsets of
+// the \a scatterMajor phase and determines the first triplet of each row/column.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void TripletAssembler<IT1,IT2,IT3>::majorOffsets()
+{
+   offsets( true );
+
+   for( size_t i=0UL; i<majorSize_; ++i ) {
+      start_[i] = counts_[i];
+   }
+   start_[majorSize_] = triplets_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes a phase of the assembly for a range of parts or rows/columns.
+//
+// \param phase The phase to be executed.
+// \param first The first part (or row/column) to be processed.
+// \param last The part (or row/column) one past the last one to be processed.
+// \param matrix The target matrix (only used in the \a appendElements phase).
+// \return void
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+template< typename MT >   // Type of the target matrix
+void TripletAssembler<IT1,IT2,IT3>::run( Phase phase, size_t first, size_t last, MT& matrix )
+{
+   BLAZE_INTERNAL_ASSERT( first <= last, "Invalid range detected" );
+
+   for( size_t k=first; k<last; ++k )
+   {
+      switch( phase ) {
+         case countMinor  : count  ( k, false ); break;
+         case scatterMinor: scatter( k, false ); break;
+         case countMajor  : count  ( k, true  ); break;
+         case scatterMajor: scatter( k, true  ); break;
+         case countNonZeros:
+         {
+            size_t nonzeros( 0UL );
+            for( size_t t=start_[k]; t<start_[k+1UL]; ++t ) {
+               if( t == start_[k] || minor_[perm_[t]] != minor_[perm_[t-1UL]] )
+                  ++nonzeros;
+            }
+            nonzeros_[k] = nonzeros;
+            break;
+         }
+         case appendElements: append( matrix, k ); break;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counts the major or minor indices of a single part of the input.
+//
+// \param part The index of the part.
+// \param major \a true for counting the major indices, \a false for the minor indices.
+// \return void
+//
+// The histogram of the part is reset before counting. The minor pass counts the triplets in
+// input order and additionally validates their indices, the major pass counts the triplets in
+// the order of the minor pass.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void TripletAssembler<IT1,IT2,IT3>::count( size_t part, bool major )
+{
+   const size_t first( (  part       * triplets_ ) / parts_ );
+   const size_t last ( ( (part+1UL) * triplets_ ) / parts_ );
+
+   if( major )
+   {
+      size_t* counts( &counts_[0] + part*majorSize_ );
+      std::fill( counts, counts+majorSize_, 0UL );
+
+      for( size_t k=first; k<last; ++k ) {
+         ++counts[ static_cast<size_t>( major_[ minorPerm_[k] ] ) ];
+      }
+   }
+   else
+   {
+      size_t* counts( &counts_[0] + part*minorSize_ );
+      std::fill( counts, counts+minorSize_, 0UL );
+
+      for( size_t k=first; k<last; ++k )
+      {
+         const size_t i( static_cast<size_t>( major_[k] ) );
+         const size_t j( static_cast<size_t>( minor_[k] ) );
+
+         if( i >= majorSize_ || j >= minorSize_ ) {
+            invalid_[part] = 1;
+            return;
+         }
+
+         ++counts[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatters the triplets of a single part of the input according to their index.
+//
+// \param part The index of the part.
+// \param major \a true for sorting by the major indices, \a false for the minor indices.
+// \return void
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void TripletAssembler<IT1,IT2,IT3>::scatter( size_t part, bool major )
+{
+   const size_t first( (  part       * triplets_ ) / parts_ );
+   const size_t last ( ( (part+1UL) * triplets_ ) / parts_ );
+
+   if( major )
+   {
+      size_t* offsets( &counts_[0] + part*majorSize_ );
+
+      for( size_t k=first; k<last; ++k ) {
+         const size_t t( minorPerm_[k] );
+         perm_[ offsets[ static_cast<size_t>( major_[t] ) ]++ ] = t;
+      }
+   }
+   else
+   {
+      size_t* offsets( &counts_[0] + part*minorSize_ );
+
+      for( size_t k=first; k<last; ++k ) {
+         minorPerm_[ offsets[ static_cast<size_t>( minor_[k] ) ]++ ] = k;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the histograms of all parts into scatter offsets.
+//
+// \param major \a true for the major pass, \a false for the minor pass.
+// \return void
+//
+// After this function the histogram of each part contains the position of its first triplet
+// of each index. The triplets of an index are ordered by part, which preserves the order of
+// the input.
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void TripletAssembler<IT1,IT2,IT3>::offsets( bool major )
+{
+   const size_t size( ( major )?( majorSize_ ):( minorSize_ ) );
+
+   size_t sum( 0UL );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      for( size_t p=0UL; p<parts_; ++p ) {
+         const size_t tmp( counts_[p*size+i] );
+         counts_[p*size+i] = sum;
+         sum += tmp;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( sum == triplets_, "Invalid number of triplets" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Combines the duplicates of a single row/column and appends all its elements.
+//
+// \param matrix The target matrix.
+// \param i The index of the row/column.
+// \return void
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+template< typename MT >   // Type of the target matrix
+void TripletAssembler<IT1,IT2,IT3>::append( MT& matrix, size_t i )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t end( start_[i+1UL] );
+
+   for( size_t t=start_[i]; t<end; )
+   {
+      const size_t j( static_cast<size_t>( minor_[perm_[t]] ) );
+      ET value( values_[perm_[t]] );
+
+      for( ++t; t<end && static_cast<size_t>( minor_[perm_[t]] ) == j; ++t ) {
+         if( policy_ == sumDuplicates )
+            value += values_[perm_[t]];
+         else value = values_[perm_[t]];
+      }
+
+      append( matrix, i, j, value );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends an element to a row-major compressed matrix.
+//
+// \param matrix The target matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+template< typename Type    // Data type of the target matrix
+        , typename Index > // Index type of the target matrix
+inline void TripletAssembler<IT1,IT2,IT3>::append( CompressedMatrix<Type,false,Index>& matrix,
+                                                   size_t i, size_t j, const Type& value )
+{
+   matrix.append( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends an element to a column-major compressed matrix.
+//
+// \param matrix The target matrix.
+// \param j The column index of the element.
+// \param i The row index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+template< typename Type    // Data type of the target matrix
+        , typename Index > // Index type of the target matrix
+inline void TripletAssembler<IT1,IT2,IT3>::append( CompressedMatrix<Type,true,Index>& matrix,
+                                                   size_t j, size_t i, const Type& value )
+{
+   matrix.append( i, j, value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of parts for the parallel assembly of a compressed matrix.
+// \ingroup sparse_matrix
+//
+// \param threads The number of available threads.
+// \param triplets The total number of triplets.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \return The number of parts \f$[1..threads]\f$.
+//
+// Since each part of the input requires a histogram of the size of the larger dimension of the
+// matrix, the number of parts is limited such that the histograms don't require more memory
+// than the triplets themselves.
+*/
+inline size_t tripletParts( size_t threads, size_t triplets, size_t m, size_t n )
+{
+   const size_t size( ( m > n )?( m ):( n ) );
+   const size_t parts( 1UL + triplets / ( size + 1UL ) );
+
+   return ( parts < threads )?( parts ):( ( threads > 0UL )?( threads ):( 1UL ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial bulk assembly of a compressed matrix from unsorted triplets.
+// \ingroup sparse_matrix
+//
+// \param matrix The target compressed matrix.
+// \param triplets The total number of triplets.
+// \param major The major indices of the triplets (row indices in case of a row-major matrix).
+// \param minor The minor indices of the triplets (column indices in case of a row-major matrix).
+// \param values The values of the triplets.
+// \param policy The treatment of duplicate elements.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the elements of the given matrix by the given triplets (see the
+// TripletAssembler class template). The matrix is allocated at most once. In case any index
+// exceeds the size of the matrix, a \a std::invalid_argument exception is thrown and the
+// matrix is not modified.
+*/
+template< typename Type   // Data type of the target matrix
+        , bool SO         // Storage order of the target matrix
+        , typename Index  // Index type of the target matrix
+        , typename IT1    // Type of the major index iterator
+        , typename IT2    // Type of the minor index iterator
+        , typename IT3 >  // Type of the value iterator
+void assembleTriplets( CompressedMatrix<Type,SO,Index>& matrix, size_t triplets,
+                       IT1 major, IT2 minor, IT3 values, DuplicatePolicy policy )
+{
+   typedef TripletAssembler<IT1,IT2,IT3>  Assembler;
+
+   const size_t majorSize( ( SO )?( matrix.columns() ):( matrix.rows() ) );
+   const size_t minorSize( ( SO )?( matrix.rows() ):( matrix.columns() ) );
+
+   Assembler assembler( major, minor, values, triplets, majorSize, minorSize, 1UL, policy );
+
+   assembler.run( Assembler::countMinor, 0UL, 1UL, matrix );
+
+   if( !assembler.minorOffsets() )
+      throw std::invalid_argument( "Invalid triplet index" );
+
+   assembler.run( Assembler::scatterMinor, 0UL, 1UL, matrix );
+   assembler.run( Assembler::countMajor  , 0UL, 1UL, matrix );
+   assembler.majorOffsets();
+   assembler.run( Assembler::scatterMajor , 0UL, 1UL, matrix );
+   assembler.run( Assembler::countNonZeros, 0UL, majorSize, matrix );
+
+   matrix.reset();
+   matrix.reserve( assembler.nonZeros() );
+
+   assembler.run( Assembler::appendElements, 0UL, majorSize, matrix );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
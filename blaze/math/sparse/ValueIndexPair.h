@@ -64,9 +64,14 @@ namespace blaze {
 // \ingroup math
 //
 // The ValueIndexPair class represents a single index-value-pair of a sparse vector or sparse
-// matrix.
+// matrix. The type of the stored index can be specified via the second template parameter
+// (by default \c size_t). A narrower index type (as for instance \c uint32_t) reduces the
+// size of the value-index-pair in case the size of the value type does not exceed the size
+// of the index type (e.g. 8 instead of 16 bytes for a \c float value). Independent of the
+// index type, the index() function returns the index as \c size_t.
 */
-template< typename Type >  // Type of the value element
+template< typename Type            // Type of the value element
+        , typename Index = size_t >  // Type of the stored index
 class ValueIndexPair : private SparseElement
 {
  public:
@@ -120,15 +125,15 @@ class ValueIndexPair : private SparseElement
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Type   value_;  //!< Value of the value-index-pair.
-   size_t index_;  //!< Index of the value-index-pair.
+   Type  value_;  //!< Value of the value-index-pair.
+   Index index_;  //!< Index of the value-index-pair.
    //@}
    //**********************************************************************************************
 
  private:
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   template< typename Other > friend class ValueIndexPair;
+   template< typename OT, typename OI > friend class ValueIndexPair;
    /*! \endcond */
    //**********************************************************************************************
 
@@ -155,8 +160,9 @@ class ValueIndexPair : private SparseElement
 //*************************************************************************************************
 /*!\brief Default constructor for value-index-pairs.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair()
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
+inline ValueIndexPair<Type,Index>::ValueIndexPair()
    : value_()  // Value of the value-index-pair
    , index_()  // Index of the value-index-pair
 {}
@@ -169,10 +175,11 @@ inline ValueIndexPair<Type>::ValueIndexPair()
 // \param v The value of the value-index-pair.
 // \param i The index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
+inline ValueIndexPair<Type,Index>::ValueIndexPair( const Type& v, size_t i )
    : value_( v )  // Value of the value-index-pair
-   , index_( i )  // Index of the value-index-pair
+   , index_( static_cast<Index>( i ) )  // Index of the value-index-pair
 {}
 //*************************************************************************************************
 
@@ -195,13 +202,14 @@ inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value-index-pair
-inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
-   ValueIndexPair<Type>::operator=( const Other& rhs )
+inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type,Index>& >::Type
+   ValueIndexPair<Type,Index>::operator=( const Other& rhs )
 {
    value_ = rhs.value();
-   index_ = rhs.index();
+   index_ = static_cast<Index>( rhs.index() );
    return *this;
 }
 //*************************************************************************************************
@@ -213,10 +221,11 @@ inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
-   ValueIndexPair<Type>::operator=( const Other& v )
+inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type,Index>& >::Type
+   ValueIndexPair<Type,Index>::operator=( const Other& v )
 {
    value_ = v;
    return *this;
@@ -230,9 +239,10 @@ inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
 // \param v The right-hand side value to be added to the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
+inline ValueIndexPair<Type,Index>& ValueIndexPair<Type,Index>::operator+=( const Other& v )
 {
    value_ += v;
    return *this;
@@ -246,9 +256,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
 // \param v The right-hand side value to be subtracted from the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
+inline ValueIndexPair<Type,Index>& ValueIndexPair<Type,Index>::operator-=( const Other& v )
 {
    value_ -= v;
    return *this;
@@ -262,9 +273,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
 // \param v The right-hand side value for the multiplication.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
+inline ValueIndexPair<Type,Index>& ValueIndexPair<Type,Index>::operator*=( const Other& v )
 {
    value_ *= v;
    return *this;
@@ -278,9 +290,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
 // \param v The right-hand side value for the division
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
+inline ValueIndexPair<Type,Index>& ValueIndexPair<Type,Index>::operator/=( const Other& v )
 {
    value_ /= v;
    return *this;
@@ -301,8 +314,9 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
+inline typename ValueIndexPair<Type,Index>::Reference ValueIndexPair<Type,Index>::value()
 {
    return value_;
 }
@@ -314,8 +328,9 @@ inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value() const
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
+inline typename ValueIndexPair<Type,Index>::ConstReference ValueIndexPair<Type,Index>::value() const
 {
    return value_;
 }
@@ -327,10 +342,11 @@ inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value
 //
 // \return The current index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::IndexType ValueIndexPair<Type>::index() const
+template< typename Type     // Type of the value element
+        , typename Index >  // Type of the stored index
+inline typename ValueIndexPair<Type,Index>::IndexType ValueIndexPair<Type,Index>::index() const
 {
-   return index_;
+   return static_cast<IndexType>( index_ );
 }
 //*************************************************************************************************
 
@@ -0,0 +1,99 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/traits/BatchTrait.h
+//  \brief Header file for the batch trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_TRAITS_BATCHTRAIT_H_
+#define _BLAZE_MATH_TRAITS_BATCHTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the resulting batch type of a batch operation.
+// \ingroup batch
+//
+// The BatchTrait class template selects the batch type that is able to store the result of a
+// batch operation with the element type \a T and members of size \a M x \a N. In case the
+// \a V flag is set the result is a batch of vectors, i.e. either a batch of column vectors
+// (for \a N equal to 1) or a batch of row vectors (for \a M equal to 1). Otherwise the result
+// is a batch of matrices. The resulting type is defined via the nested type \a Type:
+
+   \code
+   // Batch of 3x3 double precision matrices
+   typedef blaze::BatchTrait<double,3UL,3UL,false>::Type  Type1;
+
+   // Batch of 6-dimensional double precision column vectors
+   typedef blaze::BatchTrait<double,6UL,1UL,true>::Type  Type2;
+   \endcode
+*/
+template< typename T  // Element type of the batch members
+        , size_t M    // Number of rows of the batch members
+        , size_t N    // Number of columns of the batch members
+        , bool V >    // Vector flag
+struct BatchTrait
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   typedef typename IfTrue< V && N == 1UL
+                          , StaticVectorBatch<T,M,columnVector>
+                          , typename IfTrue< V && M == 1UL
+                                           , StaticVectorBatch<T,N,rowVector>
+                                           , StaticMatrixBatch<T,M,N>
+                                           >::Type
+                          >::Type  Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
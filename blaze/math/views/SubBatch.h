@@ -0,0 +1,267 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/SubBatch.h
+//  \brief Header file for the SubBatch class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_VIEWS_SUBBATCH_H_
+#define _BLAZE_MATH_VIEWS_SUBBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/Batch.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief View on a contiguous range of members of a batch.
+// \ingroup batch
+//
+// The SubBatch class template represents a view on a contiguous range of members of a batch
+// or batch expression. Since the members of a batch are stored in blocks of \a IT::size
+// interleaved members, a subbatch has to start at the beginning of a block and has to either
+// comprise complete blocks or to extend to the end of the underlying batch. A subbatch can be
+// created via the subbatch() function:
+
+   \code
+   typedef blaze::StaticMatrixBatch<double,3UL,3UL>  BatchType;
+
+   BatchType A( 1000UL ), B( 1000UL );
+   // ... Initialization
+
+   // Assigning the product of the members 512 to 999 of A and B to the according members of A
+   blaze::SubBatch<BatchType> sb = subbatch( A, 512UL, 488UL );
+   sb = subbatch( A * B, 512UL, 488UL );
+   \endcode
+*/
+template< typename BT >  // Type of the batch
+class SubBatch : public Batch< SubBatch<BT> >
+               , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the batch expression.
+   typedef typename SelectType< IsExpression<BT>::value, BT, BT& >::Type  Operand;
+
+   typedef IntrinsicTrait<typename BT::ElementType>  IT;  //!< Intrinsic trait for the batch element type.
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flags for the size of the batch members.
+   enum { rows     = BT::rows
+        , columns  = BT::columns
+        , isVector = BT::isVector };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SubBatch<BT>                 This;           //!< Type of this SubBatch instance.
+   typedef typename BT::ResultType      ResultType;     //!< Result type for expression template evaluations.
+   typedef typename BT::ElementType     ElementType;    //!< Type of the batch elements.
+   typedef typename BT::IntrinsicType   IntrinsicType;  //!< Intrinsic type of the batch elements.
+   typedef const SubBatch&              CompositeType;  //!< Data type for composite expression templates.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief The constructor for SubBatch.
+   //
+   // \param batch The batch containing the subbatch.
+   // \param index The index of the first member of the subbatch.
+   // \param n The number of members of the subbatch.
+   // \exception std::invalid_argument Invalid subbatch specification.
+   //
+   // In case the subbatch does not start at the beginning of a block, does not end at the end
+   // of a block or the underlying batch, or is not completely contained in the underlying batch,
+   // a \a std::invalid_argument exception is thrown.
+   */
+   explicit inline SubBatch( Operand batch, size_t index, size_t n )
+      : batch_ ( batch )             // The batch containing the subbatch
+      , offset_( index / IT::size )  // The index of the first block of the subbatch
+      , size_  ( n )                 // The number of members of the subbatch
+   {
+      if( index % IT::size != 0UL || index + n > batch.size() ||
+          ( n % IT::size != 0UL && index + n != batch.size() ) )
+         throw std::invalid_argument( "Invalid subbatch specification" );
+   }
+   //**********************************************************************************************
+
+   //**Assignment operator*************************************************************************
+   /*!\brief Assignment of a batch to the subbatch.
+   //
+   // \param rhs Batch to be assigned.
+   // \return Reference to the assigned subbatch.
+   // \exception std::invalid_argument Batch sizes do not match.
+   */
+   template< typename BT2 >  // Type of the right-hand side batch
+   inline SubBatch& operator=( const Batch<BT2>& rhs ) {
+      if( (~rhs).size() != size_ )
+         throw std::invalid_argument( "Batch sizes do not match" );
+      assign( *this, ~rhs );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current number of members of the subbatch.
+   //
+   // \return The number of members of the subbatch.
+   */
+   inline size_t size() const {
+      return size_;
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the current number of blocks of members of the subbatch.
+   //
+   // \return The number of blocks of members of the subbatch.
+   */
+   inline size_t blocks() const {
+      return ( size_ + IT::size - 1UL ) / IT::size;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the subbatch can be used in SMP assignments.
+   //
+   // \return \a false since a subbatch is only used as part of an SMP assignment.
+   */
+   inline bool canSMPAssign() const {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Load of all elements of a block of members of the subbatch.
+   //
+   // \param block Index of the block of members of the subbatch.
+   // \param values The target array for the \a rows * \a columns intrinsic values of the block.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void load( size_t block, IntrinsicType* values ) const {
+      BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+      batch_.load( offset_+block, values );
+   }
+   //**********************************************************************************************
+
+   //**Store function******************************************************************************
+   /*!\brief Store of all elements of a block of members of the subbatch.
+   //
+   // \param block Index of the block of members of the subbatch.
+   // \param values The \a rows * \a columns intrinsic values of the block to be stored.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void store( size_t block, const IntrinsicType* values ) {
+      BLAZE_INTERNAL_ASSERT( block < blocks(), "Invalid block access index" );
+      batch_.store( offset_+block, values );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand      batch_;   //!< The batch containing the subbatch.
+   const size_t offset_;  //!< The index of the first block of the subbatch.
+   const size_t size_;    //!< The number of members of the subbatch.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a contiguous range of members of the given batch.
+// \ingroup batch
+//
+// \param batch The batch containing the subbatch.
+// \param index The index of the first member of the subbatch.
+// \param n The number of members of the subbatch.
+// \return View on the specified subbatch.
+// \exception std::invalid_argument Invalid subbatch specification.
+*/
+template< typename BT >  // Type of the batch
+inline SubBatch<BT> subbatch( Batch<BT>& batch, size_t index, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SubBatch<BT>( ~batch, index, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a contiguous range of members of the given constant batch.
+// \ingroup batch
+//
+// \param batch The constant batch containing the subbatch.
+// \param index The index of the first member of the subbatch.
+// \param n The number of members of the subbatch.
+// \return View on the specified subbatch.
+// \exception std::invalid_argument Invalid subbatch specification.
+*/
+template< typename BT >  // Type of the batch
+inline const SubBatch<const BT> subbatch( const Batch<BT>& batch, size_t index, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SubBatch<const BT>( ~batch, index, n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
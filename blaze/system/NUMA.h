@@ -0,0 +1,98 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/NUMA.h
+//  \brief System settings for the NUMA-aware memory allocation and initialization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_SYSTEM_NUMA_H_
+#define _BLAZE_SYSTEM_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/Types.h>
+#include <blaze/config/NUMA.h>
+
+
+
+
+//=================================================================================================
+//
+//  NUMA INTERLEAVING CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-interleaved allocation of large arrays.
+// \ingroup system
+//
+// This compilation switch enables/disables the interleaved allocation of large arrays on NUMA
+// systems. The interleaving is only active in case the according switch in the configuration
+// file <tt>./blaze/config/NUMA.h</tt> is set and the Blaze library is compiled on a Linux
+// system.
+*/
+#if BLAZE_USE_NUMA_INTERLEAVING && defined(__linux__)
+#define BLAZE_NUMA_INTERLEAVING_MODE 1
+#else
+#define BLAZE_NUMA_INTERLEAVING_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLEL INITIALIZATION CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel initialization of dense vectors and matrices.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallel initialization of large dense vectors
+// and matrices. The parallel initialization is only active in case the according switch in the
+// configuration file <tt>./blaze/config/NUMA.h</tt> is set and one of the shared-memory
+// parallelizations is active.
+*/
+#if BLAZE_USE_PARALLEL_INITIALIZATION && ( BLAZE_OPENMP_PARALLEL_MODE      || \
+                                          BLAZE_CPP_THREADS_PARALLEL_MODE || \
+                                          BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_PARALLEL_INITIALIZATION_MODE 1
+#else
+#define BLAZE_PARALLEL_INITIALIZATION_MODE 0
+#endif
+//*************************************************************************************************
+
+#endif
@@ -123,4 +123,29 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  THREAD PINNING CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the pinning of the worker threads.
+// \ingroup system
+//
+// This compilation switch enables/disables the pinning of the worker threads of the C++11 and
+// Boost thread-based parallelization. The pinning is only active in case the according switch
+// in the <tt>./blaze/config/SMP.h</tt> configuration file is set and the Blaze library is
+// compiled on a Linux system.
+*/
+#if BLAZE_USE_THREAD_PINNING && defined(__linux__)
+#define BLAZE_THREAD_PINNING_MODE 1
+#else
+#define BLAZE_THREAD_PINNING_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -40,7 +40,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/config/Tuning.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Unused.h>
+#endif
 
 
 
@@ -51,6 +63,70 @@
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+// In case the runtime thresholds are activated, the thresholds of the configuration file serve
+// as default values of the runtime thresholds and are therefore renamed.
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#  define DMATDVECMULT_THRESHOLD        DEFAULT_DMATDVECMULT_THRESHOLD
+#  define TDMATDVECMULT_THRESHOLD       DEFAULT_TDMATDVECMULT_THRESHOLD
+#  define TDVECDMATMULT_THRESHOLD       DEFAULT_TDVECDMATMULT_THRESHOLD
+#  define TDVECTDMATMULT_THRESHOLD      DEFAULT_TDVECTDMATMULT_THRESHOLD
+#  define DMATDMATMULT_THRESHOLD        DEFAULT_DMATDMATMULT_THRESHOLD
+#  define DMATTDMATMULT_THRESHOLD       DEFAULT_DMATTDMATMULT_THRESHOLD
+#  define TDMATDMATMULT_THRESHOLD       DEFAULT_TDMATDMATMULT_THRESHOLD
+#  define TDMATTDMATMULT_THRESHOLD      DEFAULT_TDMATTDMATMULT_THRESHOLD
+#  define SMP_DVECASSIGN_THRESHOLD      DEFAULT_SMP_DVECASSIGN_THRESHOLD
+#  define SMP_DVECDVECADD_THRESHOLD     DEFAULT_SMP_DVECDVECADD_THRESHOLD
+#  define SMP_DVECDVECSUB_THRESHOLD     DEFAULT_SMP_DVECDVECSUB_THRESHOLD
+#  define SMP_DVECDVECMULT_THRESHOLD    DEFAULT_SMP_DVECDVECMULT_THRESHOLD
+#  define SMP_DVECSCALARMULT_THRESHOLD  DEFAULT_SMP_DVECSCALARMULT_THRESHOLD
+#  define SMP_DMATDVECMULT_THRESHOLD    DEFAULT_SMP_DMATDVECMULT_THRESHOLD
+#  define SMP_TDMATDVECMULT_THRESHOLD   DEFAULT_SMP_TDMATDVECMULT_THRESHOLD
+#  define SMP_TDVECDMATMULT_THRESHOLD   DEFAULT_SMP_TDVECDMATMULT_THRESHOLD
+#  define SMP_TDVECTDMATMULT_THRESHOLD  DEFAULT_SMP_TDVECTDMATMULT_THRESHOLD
+#  define SMP_DMATSVECMULT_THRESHOLD    DEFAULT_SMP_DMATSVECMULT_THRESHOLD
+#  define SMP_TDMATSVECMULT_THRESHOLD   DEFAULT_SMP_TDMATSVECMULT_THRESHOLD
+#  define SMP_TSVECDMATMULT_THRESHOLD   DEFAULT_SMP_TSVECDMATMULT_THRESHOLD
+#  define SMP_TSVECTDMATMULT_THRESHOLD  DEFAULT_SMP_TSVECTDMATMULT_THRESHOLD
+#  define SMP_SMATDVECMULT_THRESHOLD    DEFAULT_SMP_SMATDVECMULT_THRESHOLD
+#  define SMP_TSMATDVECMULT_THRESHOLD   DEFAULT_SMP_TSMATDVECMULT_THRESHOLD
+#  define SMP_TDVECSMATMULT_THRESHOLD   DEFAULT_SMP_TDVECSMATMULT_THRESHOLD
+#  define SMP_TDVECTSMATMULT_THRESHOLD  DEFAULT_SMP_TDVECTSMATMULT_THRESHOLD
+#  define SMP_SMATSVECMULT_THRESHOLD    DEFAULT_SMP_SMATSVECMULT_THRESHOLD
+#  define SMP_TSMATSVECMULT_THRESHOLD   DEFAULT_SMP_TSMATSVECMULT_THRESHOLD
+#  define SMP_TSVECSMATMULT_THRESHOLD   DEFAULT_SMP_TSVECSMATMULT_THRESHOLD
+#  define SMP_TSVECTSMATMULT_THRESHOLD  DEFAULT_SMP_TSVECTSMATMULT_THRESHOLD
+#  define SMP_DMATASSIGN_THRESHOLD      DEFAULT_SMP_DMATASSIGN_THRESHOLD
+#  define SMP_DMATDMATADD_THRESHOLD     DEFAULT_SMP_DMATDMATADD_THRESHOLD
+#  define SMP_DMATTDMATADD_THRESHOLD    DEFAULT_SMP_DMATTDMATADD_THRESHOLD
+#  define SMP_DMATDMATSUB_THRESHOLD     DEFAULT_SMP_DMATDMATSUB_THRESHOLD
+#  define SMP_DMATTDMATSUB_THRESHOLD    DEFAULT_SMP_DMATTDMATSUB_THRESHOLD
+#  define SMP_DMATSCALARMULT_THRESHOLD  DEFAULT_SMP_DMATSCALARMULT_THRESHOLD
+#  define SMP_DMATDMATMULT_THRESHOLD    DEFAULT_SMP_DMATDMATMULT_THRESHOLD
+#  define SMP_DMATTDMATMULT_THRESHOLD   DEFAULT_SMP_DMATTDMATMULT_THRESHOLD
+#  define SMP_TDMATDMATMULT_THRESHOLD   DEFAULT_SMP_TDMATDMATMULT_THRESHOLD
+#  define SMP_TDMATTDMATMULT_THRESHOLD  DEFAULT_SMP_TDMATTDMATMULT_THRESHOLD
+#  define SMP_DMATSMATMULT_THRESHOLD    DEFAULT_SMP_DMATSMATMULT_THRESHOLD
+#  define SMP_DMATTSMATMULT_THRESHOLD   DEFAULT_SMP_DMATTSMATMULT_THRESHOLD
+#  define SMP_TDMATSMATMULT_THRESHOLD   DEFAULT_SMP_TDMATSMATMULT_THRESHOLD
+#  define SMP_TDMATTSMATMULT_THRESHOLD  DEFAULT_SMP_TDMATTSMATMULT_THRESHOLD
+#  define SMP_SMATDMATMULT_THRESHOLD    DEFAULT_SMP_SMATDMATMULT_THRESHOLD
+#  define SMP_SMATTDMATMULT_THRESHOLD   DEFAULT_SMP_SMATTDMATMULT_THRESHOLD
+#  define SMP_TSMATDMATMULT_THRESHOLD   DEFAULT_SMP_TSMATDMATMULT_THRESHOLD
+#  define SMP_TSMATTDMATMULT_THRESHOLD  DEFAULT_SMP_TSMATTDMATMULT_THRESHOLD
+#  define SMP_SMATSMATMULT_THRESHOLD    DEFAULT_SMP_SMATSMATMULT_THRESHOLD
+#  define SMP_SMATTSMATMULT_THRESHOLD   DEFAULT_SMP_SMATTSMATMULT_THRESHOLD
+#  define SMP_TSMATSMATMULT_THRESHOLD   DEFAULT_SMP_TSMATSMATMULT_THRESHOLD
+#  define SMP_TSMATTSMATMULT_THRESHOLD  DEFAULT_SMP_TSMATTSMATMULT_THRESHOLD
+#  define SMP_DVECTDVECMULT_THRESHOLD   DEFAULT_SMP_DVECTDVECMULT_THRESHOLD
+#  define SMP_BATCHASSIGN_THRESHOLD     DEFAULT_SMP_BATCHASSIGN_THRESHOLD
+#  define SMP_TRIPLETASSEMBLY_THRESHOLD DEFAULT_SMP_TRIPLETASSEMBLY_THRESHOLD
+#  define SMP_TRIANGULARSOLVE_THRESHOLD DEFAULT_SMP_TRIANGULARSOLVE_THRESHOLD
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
 #include <blaze/config/Thresholds.h>
 
 
@@ -119,9 +195,588 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCHASSIGN_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TRIPLETASSEMBLY_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TRIANGULARSOLVE_THRESHOLD >= 0UL );
 
 }
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#  undef DMATDVECMULT_THRESHOLD
+#  undef TDMATDVECMULT_THRESHOLD
+#  undef TDVECDMATMULT_THRESHOLD
+#  undef TDVECTDMATMULT_THRESHOLD
+#  undef DMATDMATMULT_THRESHOLD
+#  undef DMATTDMATMULT_THRESHOLD
+#  undef TDMATDMATMULT_THRESHOLD
+#  undef TDMATTDMATMULT_THRESHOLD
+#  undef SMP_DVECASSIGN_THRESHOLD
+#  undef SMP_DVECDVECADD_THRESHOLD
+#  undef SMP_DVECDVECSUB_THRESHOLD
+#  undef SMP_DVECDVECMULT_THRESHOLD
+#  undef SMP_DVECSCALARMULT_THRESHOLD
+#  undef SMP_DMATDVECMULT_THRESHOLD
+#  undef SMP_TDMATDVECMULT_THRESHOLD
+#  undef SMP_TDVECDMATMULT_THRESHOLD
+#  undef SMP_TDVECTDMATMULT_THRESHOLD
+#  undef SMP_DMATSVECMULT_THRESHOLD
+#  undef SMP_TDMATSVECMULT_THRESHOLD
+#  undef SMP_TSVECDMATMULT_THRESHOLD
+#  undef SMP_TSVECTDMATMULT_THRESHOLD
+#  undef SMP_SMATDVECMULT_THRESHOLD
+#  undef SMP_TSMATDVECMULT_THRESHOLD
+#  undef SMP_TDVECSMATMULT_THRESHOLD
+#  undef SMP_TDVECTSMATMULT_THRESHOLD
+#  undef SMP_SMATSVECMULT_THRESHOLD
+#  undef SMP_TSMATSVECMULT_THRESHOLD
+#  undef SMP_TSVECSMATMULT_THRESHOLD
+#  undef SMP_TSVECTSMATMULT_THRESHOLD
+#  undef SMP_DMATASSIGN_THRESHOLD
+#  undef SMP_DMATDMATADD_THRESHOLD
+#  undef SMP_DMATTDMATADD_THRESHOLD
+#  undef SMP_DMATDMATSUB_THRESHOLD
+#  undef SMP_DMATTDMATSUB_THRESHOLD
+#  undef SMP_DMATSCALARMULT_THRESHOLD
+#  undef SMP_DMATDMATMULT_THRESHOLD
+#  undef SMP_DMATTDMATMULT_THRESHOLD
+#  undef SMP_TDMATDMATMULT_THRESHOLD
+#  undef SMP_TDMATTDMATMULT_THRESHOLD
+#  undef SMP_DMATSMATMULT_THRESHOLD
+#  undef SMP_DMATTSMATMULT_THRESHOLD
+#  undef SMP_TDMATSMATMULT_THRESHOLD
+#  undef SMP_TDMATTSMATMULT_THRESHOLD
+#  undef SMP_SMATDMATMULT_THRESHOLD
+#  undef SMP_SMATTDMATMULT_THRESHOLD
+#  undef SMP_TSMATDMATMULT_THRESHOLD
+#  undef SMP_TSMATTDMATMULT_THRESHOLD
+#  undef SMP_SMATSMATMULT_THRESHOLD
+#  undef SMP_SMATTSMATMULT_THRESHOLD
+#  undef SMP_TSMATSMATMULT_THRESHOLD
+#  undef SMP_TSMATTSMATMULT_THRESHOLD
+#  undef SMP_DVECTDVECMULT_THRESHOLD
+#  undef SMP_BATCHASSIGN_THRESHOLD
+#  undef SMP_TRIPLETASSEMBLY_THRESHOLD
+#  undef SMP_TRIANGULARSOLVE_THRESHOLD
+/*! \endcond */
+//*************************************************************************************************
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The total number of runtime thresholds.
+// \ingroup config
+*/
+const size_t thresholdCount = 55UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the names of all runtime thresholds.
+// \ingroup config
+//
+// \return Array of the names of all runtime thresholds.
+*/
+inline const char* const* thresholdNames()
+{
+   static const char* const names[thresholdCount] = {
+        "DMATDVECMULT_THRESHOLD",
+        "TDMATDVECMULT_THRESHOLD",
+        "TDVECDMATMULT_THRESHOLD",
+        "TDVECTDMATMULT_THRESHOLD",
+        "DMATDMATMULT_THRESHOLD",
+        "DMATTDMATMULT_THRESHOLD",
+        "TDMATDMATMULT_THRESHOLD",
+        "TDMATTDMATMULT_THRESHOLD",
+        "SMP_DVECASSIGN_THRESHOLD",
+        "SMP_DVECDVECADD_THRESHOLD",
+        "SMP_DVECDVECSUB_THRESHOLD",
+        "SMP_DVECDVECMULT_THRESHOLD",
+        "SMP_DVECSCALARMULT_THRESHOLD",
+        "SMP_DMATDVECMULT_THRESHOLD",
+        "SMP_TDMATDVECMULT_THRESHOLD",
+        "SMP_TDVECDMATMULT_THRESHOLD",
+        "SMP_TDVECTDMATMULT_THRESHOLD",
+        "SMP_DMATSVECMULT_THRESHOLD",
+        "SMP_TDMATSVECMULT_THRESHOLD",
+        "SMP_TSVECDMATMULT_THRESHOLD",
+        "SMP_TSVECTDMATMULT_THRESHOLD",
+        "SMP_SMATDVECMULT_THRESHOLD",
+        "SMP_TSMATDVECMULT_THRESHOLD",
+        "SMP_TDVECSMATMULT_THRESHOLD",
+        "SMP_TDVECTSMATMULT_THRESHOLD",
+        "SMP_SMATSVECMULT_THRESHOLD",
+        "SMP_TSMATSVECMULT_THRESHOLD",
+        "SMP_TSVECSMATMULT_THRESHOLD",
+        "SMP_TSVECTSMATMULT_THRESHOLD",
+        "SMP_DMATASSIGN_THRESHOLD",
+        "SMP_DMATDMATADD_THRESHOLD",
+        "SMP_DMATTDMATADD_THRESHOLD",
+        "SMP_DMATDMATSUB_THRESHOLD",
+        "SMP_DMATTDMATSUB_THRESHOLD",
+        "SMP_DMATSCALARMULT_THRESHOLD",
+        "SMP_DMATDMATMULT_THRESHOLD",
+        "SMP_DMATTDMATMULT_THRESHOLD",
+        "SMP_TDMATDMATMULT_THRESHOLD",
+        "SMP_TDMATTDMATMULT_THRESHOLD",
+        "SMP_DMATSMATMULT_THRESHOLD",
+        "SMP_DMATTSMATMULT_THRESHOLD",
+        "SMP_TDMATSMATMULT_THRESHOLD",
+        "SMP_TDMATTSMATMULT_THRESHOLD",
+        "SMP_SMATDMATMULT_THRESHOLD",
+        "SMP_SMATTDMATMULT_THRESHOLD",
+        "SMP_TSMATDMATMULT_THRESHOLD",
+        "SMP_TSMATTDMATMULT_THRESHOLD",
+        "SMP_SMATSMATMULT_THRESHOLD",
+        "SMP_SMATTSMATMULT_THRESHOLD",
+        "SMP_TSMATSMATMULT_THRESHOLD",
+        "SMP_TSMATTSMATMULT_THRESHOLD",
+        "SMP_DVECTDVECMULT_THRESHOLD",
+        "SMP_BATCHASSIGN_THRESHOLD",
+        "SMP_TRIPLETASSEMBLY_THRESHOLD",
+        "SMP_TRIANGULARSOLVE_THRESHOLD"
+   };
+
+   return names;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the runtime threshold with the given name.
+// \ingroup config
+//
+// \param name The name of the threshold.
+// \return The index of the threshold or \a thresholdCount in case the name is unknown.
+*/
+inline size_t thresholdIndex( const std::string& name )
+{
+   const char* const* names( thresholdNames() );
+
+   size_t index( 0UL );
+   while( index < thresholdCount && name != names[index] ) {
+      ++index;
+   }
+
+   return index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given value for the runtime threshold with the given index.
+// \ingroup config
+//
+// \param index The index of the threshold.
+// \param value The value to be checked.
+// \return \a true in case the value is valid, \a false if not.
+//
+// The BLAS thresholds (i.e. the first eight thresholds) must be larger than 0, whereas the SMP
+// thresholds can be set to any value.
+*/
+inline bool isValidThreshold( size_t index, size_t value )
+{
+   return index >= 8UL || value > 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the thresholds from the given tuning file stream.
+// \ingroup config
+//
+// \param is The input stream of the tuning file.
+// \param values The values of all runtime thresholds.
+// \param strict \a true in case invalid entries are considered an error, \a false if not.
+// \return \a true in case the tuning file could be read successfully, \a false if not.
+//
+// Each line of a tuning file contains the name of a threshold followed by its value. Empty
+// lines and comments starting with '#' are ignored. In case \a strict is set to \a false,
+// invalid entries are skipped, otherwise the function returns \a false for the first invalid
+// entry.
+*/
+inline bool readThresholds( std::istream& is, size_t* values, bool strict )
+{
+   std::string line, name, rest;
+   size_t value( 0UL );
+
+   while( std::getline( is, line ) )
+   {
+      const std::string::size_type comment( line.find( '#' ) );
+      if( comment != std::string::npos )
+         line.erase( comment );
+
+      std::istringstream iss( line );
+
+      if( !( iss >> name ) )
+         continue;
+
+      const size_t index( thresholdIndex( name ) );
+
+      if( index == thresholdCount || !( iss >> value ) || ( iss >> rest ) ||
+          !isValidThreshold( index, value ) ) {
+         if( strict ) return false;
+         else continue;
+      }
+
+      values[index] = value;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the thresholds from the default tuning file.
+// \ingroup config
+//
+// \param values The values of all runtime thresholds.
+// \return \a true in case a tuning file has been read, \a false if not.
+//
+// This function reads the tuning file specified by the \c BLAZE_THRESHOLDS_FILE environment
+// variable or, in case the environment variable is not set, the tuning file specified by the
+// BLAZE_THRESHOLDS_FILE setting. In case the tuning file does not exist, the default values
+// are kept. Invalid entries of the tuning file are skipped.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline bool loadDefaultThresholds( size_t* values )
+{
+   const char* env = std::getenv( "BLAZE_THRESHOLDS_FILE" );
+
+   std::ifstream file( ( env == NULL )?( BLAZE_THRESHOLDS_FILE ):( env ) );
+
+   if( !file.is_open() )
+      return false;
+
+   return readThresholds( file, values, false );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current values of all runtime thresholds.
+// \ingroup config
+//
+// \return Array of the values of all runtime thresholds.
+//
+// The values are initialized with the compile time defaults of the configuration file
+// <tt>./blaze/config/Thresholds.h</tt> and are updated from the default tuning file upon
+// the first call of the function.
+*/
+inline size_t* thresholdValues()
+{
+   static size_t values[thresholdCount] = {
+        DEFAULT_DMATDVECMULT_THRESHOLD,
+        DEFAULT_TDMATDVECMULT_THRESHOLD,
+        DEFAULT_TDVECDMATMULT_THRESHOLD,
+        DEFAULT_TDVECTDMATMULT_THRESHOLD,
+        DEFAULT_DMATDMATMULT_THRESHOLD,
+        DEFAULT_DMATTDMATMULT_THRESHOLD,
+        DEFAULT_TDMATDMATMULT_THRESHOLD,
+        DEFAULT_TDMATTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_DVECASSIGN_THRESHOLD,
+        DEFAULT_SMP_DVECDVECADD_THRESHOLD,
+        DEFAULT_SMP_DVECDVECSUB_THRESHOLD,
+        DEFAULT_SMP_DVECDVECMULT_THRESHOLD,
+        DEFAULT_SMP_DVECSCALARMULT_THRESHOLD,
+        DEFAULT_SMP_DMATDVECMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATDVECMULT_THRESHOLD,
+        DEFAULT_SMP_TDVECDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDVECTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_DMATSVECMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATSVECMULT_THRESHOLD,
+        DEFAULT_SMP_TSVECDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSVECTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATDVECMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATDVECMULT_THRESHOLD,
+        DEFAULT_SMP_TDVECSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDVECTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATSVECMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATSVECMULT_THRESHOLD,
+        DEFAULT_SMP_TSVECSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSVECTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_DMATASSIGN_THRESHOLD,
+        DEFAULT_SMP_DMATDMATADD_THRESHOLD,
+        DEFAULT_SMP_DMATTDMATADD_THRESHOLD,
+        DEFAULT_SMP_DMATDMATSUB_THRESHOLD,
+        DEFAULT_SMP_DMATTDMATSUB_THRESHOLD,
+        DEFAULT_SMP_DMATSCALARMULT_THRESHOLD,
+        DEFAULT_SMP_DMATDMATMULT_THRESHOLD,
+        DEFAULT_SMP_DMATTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_DMATSMATMULT_THRESHOLD,
+        DEFAULT_SMP_DMATTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TDMATTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATDMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATDMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATTDMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATSMATMULT_THRESHOLD,
+        DEFAULT_SMP_SMATTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATSMATMULT_THRESHOLD,
+        DEFAULT_SMP_TSMATTSMATMULT_THRESHOLD,
+        DEFAULT_SMP_DVECTDVECMULT_THRESHOLD,
+        DEFAULT_SMP_BATCHASSIGN_THRESHOLD,
+        DEFAULT_SMP_TRIPLETASSEMBLY_THRESHOLD,
+        DEFAULT_SMP_TRIANGULARSOLVE_THRESHOLD
+   };
+
+   static const bool loaded( loadDefaultThresholds( values ) );
+   UNUSED_PARAMETER( loaded );
+
+   return values;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime representation of a single threshold.
+// \ingroup config
+//
+// The Threshold class represents a single threshold in case the runtime thresholds are active.
+// It implicitly converts to the current value of the threshold and can therefore be used as a
+// replacement of the compile time constants. Since it is an aggregate, all threshold objects
+// are statically initialized and can safely be used during the dynamic initialization phase.
+*/
+struct Threshold
+{
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const {
+      return thresholdValues()[index];
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t index;  //!< The index of the threshold.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+const Threshold DMATDVECMULT_THRESHOLD        = {  0UL };  //!< Runtime value of the DMATDVECMULT_THRESHOLD.
+const Threshold TDMATDVECMULT_THRESHOLD       = {  1UL };  //!< Runtime value of the TDMATDVECMULT_THRESHOLD.
+const Threshold TDVECDMATMULT_THRESHOLD       = {  2UL };  //!< Runtime value of the TDVECDMATMULT_THRESHOLD.
+const Threshold TDVECTDMATMULT_THRESHOLD      = {  3UL };  //!< Runtime value of the TDVECTDMATMULT_THRESHOLD.
+const Threshold DMATDMATMULT_THRESHOLD        = {  4UL };  //!< Runtime value of the DMATDMATMULT_THRESHOLD.
+const Threshold DMATTDMATMULT_THRESHOLD       = {  5UL };  //!< Runtime value of the DMATTDMATMULT_THRESHOLD.
+const Threshold TDMATDMATMULT_THRESHOLD       = {  6UL };  //!< Runtime value of the TDMATDMATMULT_THRESHOLD.
+const Threshold TDMATTDMATMULT_THRESHOLD      = {  7UL };  //!< Runtime value of the TDMATTDMATMULT_THRESHOLD.
+const Threshold SMP_DVECASSIGN_THRESHOLD      = {  8UL };  //!< Runtime value of the SMP_DVECASSIGN_THRESHOLD.
+const Threshold SMP_DVECDVECADD_THRESHOLD     = {  9UL };  //!< Runtime value of the SMP_DVECDVECADD_THRESHOLD.
+const Threshold SMP_DVECDVECSUB_THRESHOLD     = { 10UL };  //!< Runtime value of the SMP_DVECDVECSUB_THRESHOLD.
+const Threshold SMP_DVECDVECMULT_THRESHOLD    = { 11UL };  //!< Runtime value of the SMP_DVECDVECMULT_THRESHOLD.
+const Threshold SMP_DVECSCALARMULT_THRESHOLD  = { 12UL };  //!< Runtime value of the SMP_DVECSCALARMULT_THRESHOLD.
+const Threshold SMP_DMATDVECMULT_THRESHOLD    = { 13UL };  //!< Runtime value of the SMP_DMATDVECMULT_THRESHOLD.
+const Threshold SMP_TDMATDVECMULT_THRESHOLD   = { 14UL };  //!< Runtime value of the SMP_TDMATDVECMULT_THRESHOLD.
+const Threshold SMP_TDVECDMATMULT_THRESHOLD   = { 15UL };  //!< Runtime value of the SMP_TDVECDMATMULT_THRESHOLD.
+const Threshold SMP_TDVECTDMATMULT_THRESHOLD  = { 16UL };  //!< Runtime value of the SMP_TDVECTDMATMULT_THRESHOLD.
+const Threshold SMP_DMATSVECMULT_THRESHOLD    = { 17UL };  //!< Runtime value of the SMP_DMATSVECMULT_THRESHOLD.
+const Threshold SMP_TDMATSVECMULT_THRESHOLD   = { 18UL };  //!< Runtime value of the SMP_TDMATSVECMULT_THRESHOLD.
+const Threshold SMP_TSVECDMATMULT_THRESHOLD   = { 19UL };  //!< Runtime value of the SMP_TSVECDMATMULT_THRESHOLD.
+const Threshold SMP_TSVECTDMATMULT_THRESHOLD  = { 20UL };  //!< Runtime value of the SMP_TSVECTDMATMULT_THRESHOLD.
+const Threshold SMP_SMATDVECMULT_THRESHOLD    = { 21UL };  //!< Runtime value of the SMP_SMATDVECMULT_THRESHOLD.
+const Threshold SMP_TSMATDVECMULT_THRESHOLD   = { 22UL };  //!< Runtime value of the SMP_TSMATDVECMULT_THRESHOLD.
+const Threshold SMP_TDVECSMATMULT_THRESHOLD   = { 23UL };  //!< Runtime value of the SMP_TDVECSMATMULT_THRESHOLD.
+const Threshold SMP_TDVECTSMATMULT_THRESHOLD  = { 24UL };  //!< Runtime value of the SMP_TDVECTSMATMULT_THRESHOLD.
+const Threshold SMP_SMATSVECMULT_THRESHOLD    = { 25UL };  //!< Runtime value of the SMP_SMATSVECMULT_THRESHOLD.
+const Threshold SMP_TSMATSVECMULT_THRESHOLD   = { 26UL };  //!< Runtime value of the SMP_TSMATSVECMULT_THRESHOLD.
+const Threshold SMP_TSVECSMATMULT_THRESHOLD   = { 27UL };  //!< Runtime value of the SMP_TSVECSMATMULT_THRESHOLD.
+const Threshold SMP_TSVECTSMATMULT_THRESHOLD  = { 28UL };  //!< Runtime value of the SMP_TSVECTSMATMULT_THRESHOLD.
+const Threshold SMP_DMATASSIGN_THRESHOLD      = { 29UL };  //!< Runtime value of the SMP_DMATASSIGN_THRESHOLD.
+const Threshold SMP_DMATDMATADD_THRESHOLD     = { 30UL };  //!< Runtime value of the SMP_DMATDMATADD_THRESHOLD.
+const Threshold SMP_DMATTDMATADD_THRESHOLD    = { 31UL };  //!< Runtime value of the SMP_DMATTDMATADD_THRESHOLD.
+const Threshold SMP_DMATDMATSUB_THRESHOLD     = { 32UL };  //!< Runtime value of the SMP_DMATDMATSUB_THRESHOLD.
+const Threshold SMP_DMATTDMATSUB_THRESHOLD    = { 33UL };  //!< Runtime value of the SMP_DMATTDMATSUB_THRESHOLD.
+const Threshold SMP_DMATSCALARMULT_THRESHOLD  = { 34UL };  //!< Runtime value of the SMP_DMATSCALARMULT_THRESHOLD.
+const Threshold SMP_DMATDMATMULT_THRESHOLD    = { 35UL };  //!< Runtime value of the SMP_DMATDMATMULT_THRESHOLD.
+const Threshold SMP_DMATTDMATMULT_THRESHOLD   = { 36UL };  //!< Runtime value of the SMP_DMATTDMATMULT_THRESHOLD.
+const Threshold SMP_TDMATDMATMULT_THRESHOLD   = { 37UL };  //!< Runtime value of the SMP_TDMATDMATMULT_THRESHOLD.
+const Threshold SMP_TDMATTDMATMULT_THRESHOLD  = { 38UL };  //!< Runtime value of the SMP_TDMATTDMATMULT_THRESHOLD.
+const Threshold SMP_DMATSMATMULT_THRESHOLD    = { 39UL };  //!< Runtime value of the SMP_DMATSMATMULT_THRESHOLD.
+const Threshold SMP_DMATTSMATMULT_THRESHOLD   = { 40UL };  //!< Runtime value of the SMP_DMATTSMATMULT_THRESHOLD.
+const Threshold SMP_TDMATSMATMULT_THRESHOLD   = { 41UL };  //!< Runtime value of the SMP_TDMATSMATMULT_THRESHOLD.
+const Threshold SMP_TDMATTSMATMULT_THRESHOLD  = { 42UL };  //!< Runtime value of the SMP_TDMATTSMATMULT_THRESHOLD.
+const Threshold SMP_SMATDMATMULT_THRESHOLD    = { 43UL };  //!< Runtime value of the SMP_SMATDMATMULT_THRESHOLD.
+const Threshold SMP_SMATTDMATMULT_THRESHOLD   = { 44UL };  //!< Runtime value of the SMP_SMATTDMATMULT_THRESHOLD.
+const Threshold SMP_TSMATDMATMULT_THRESHOLD   = { 45UL };  //!< Runtime value of the SMP_TSMATDMATMULT_THRESHOLD.
+const Threshold SMP_TSMATTDMATMULT_THRESHOLD  = { 46UL };  //!< Runtime value of the SMP_TSMATTDMATMULT_THRESHOLD.
+const Threshold SMP_SMATSMATMULT_THRESHOLD    = { 47UL };  //!< Runtime value of the SMP_SMATSMATMULT_THRESHOLD.
+const Threshold SMP_SMATTSMATMULT_THRESHOLD   = { 48UL };  //!< Runtime value of the SMP_SMATTSMATMULT_THRESHOLD.
+const Threshold SMP_TSMATSMATMULT_THRESHOLD   = { 49UL };  //!< Runtime value of the SMP_TSMATSMATMULT_THRESHOLD.
+const Threshold SMP_TSMATTSMATMULT_THRESHOLD  = { 50UL };  //!< Runtime value of the SMP_TSMATTSMATMULT_THRESHOLD.
+const Threshold SMP_DVECTDVECMULT_THRESHOLD   = { 51UL };  //!< Runtime value of the SMP_DVECTDVECMULT_THRESHOLD.
+const Threshold SMP_BATCHASSIGN_THRESHOLD     = { 52UL };  //!< Runtime value of the SMP_BATCHASSIGN_THRESHOLD.
+const Threshold SMP_TRIPLETASSEMBLY_THRESHOLD = { 53UL };  //!< Runtime value of the SMP_TRIPLETASSEMBLY_THRESHOLD.
+const Threshold SMP_TRIANGULARSOLVE_THRESHOLD = { 54UL };  //!< Runtime value of the SMP_TRIANGULARSOLVE_THRESHOLD.
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline size_t getThreshold( const std::string& name );
+inline void setThreshold( const std::string& name, size_t value );
+inline void loadThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function is only available in case the runtime thresholds are activated (see the
+// BLAZE_USE_RUNTIME_THRESHOLDS switch in the configuration file <tt>./blaze/config/Tuning.h</tt>).
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   const size_t index( thresholdIndex( name ) );
+
+   if( index == thresholdCount )
+      throw std::invalid_argument( "Invalid threshold name" );
+
+   return thresholdValues()[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function sets the value of the given threshold. Note that the BLAS thresholds must be
+// larger than 0. Also note that the runtime thresholds are not synchronized. Therefore this
+// function must be called before any parallel evaluation is started and must not be called
+// while another thread evaluates an operation or while an asynchronous assignment is pending.
+// This function is only available in case the runtime thresholds are activated (see the
+// BLAZE_USE_RUNTIME_THRESHOLDS switch in the configuration file <tt>./blaze/config/Tuning.h</tt>).
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   const size_t index( thresholdIndex( name ) );
+
+   if( index == thresholdCount )
+      throw std::invalid_argument( "Invalid threshold name" );
+
+   if( !isValidThreshold( index, value ) )
+      throw std::invalid_argument( "Invalid threshold value" );
+
+   thresholdValues()[index] = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading the thresholds from the given tuning file.
+// \ingroup config
+//
+// \param file The name of the tuning file.
+// \return void
+// \exception std::runtime_error Tuning file could not be opened.
+// \exception std::runtime_error Invalid tuning file.
+//
+// This function loads the thresholds from the given tuning file. Each line of a tuning file
+// contains the name of a threshold followed by its value. Empty lines and comments starting
+// with '#' are ignored:
+
+   \code
+   # Tuned thresholds
+   DMATDVECMULT_THRESHOLD    2250000
+   SMP_DVECASSIGN_THRESHOLD  16000
+   \endcode
+
+// Thresholds that are not contained in the tuning file keep their current values. In case the
+// tuning file contains an invalid entry, a \a std::runtime_error exception is thrown and none
+// of the thresholds is changed. Note that the runtime thresholds are not synchronized. Therefore
+// this function must be called before any parallel evaluation is started and must not be called
+// while another thread evaluates an operation or while an asynchronous assignment is pending.
+// This function is only available in case the runtime thresholds are activated (see the
+// BLAZE_USE_RUNTIME_THRESHOLDS switch in the configuration file <tt>./blaze/config/Tuning.h</tt>).
+*/
+inline void loadThresholds( const std::string& file )
+{
+   std::ifstream is( file.c_str() );
+
+   if( !is.is_open() )
+      throw std::runtime_error( "Tuning file could not be opened" );
+
+   size_t* values( thresholdValues() );
+   size_t tmp[thresholdCount];
+   std::copy( values, values+thresholdCount, tmp );
+
+   if( !readThresholds( is, tmp, true ) )
+      throw std::runtime_error( "Invalid tuning file" );
+
+   std::copy( tmp, tmp+thresholdCount, values );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
+
 #endif
@@ -233,6 +233,77 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512F mode. In case the AVX512F mode is enabled
+// (i.e. in case AVX-512 foundation functionality is available) the Blaze library attempts to
+// vectorize the linear algebra operations on single and double precision floating point values
+// and on 32-bit and 64-bit integral values by 512-bit AVX-512 intrinsics. In case the AVX512F
+// mode is disabled, the Blaze library chooses AVX/AVX2 (or older) functionality instead.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512BW mode. In case the AVX512BW mode is enabled
+// (i.e. in case the AVX-512 byte and word instructions are available) the Blaze library also
+// vectorizes the linear algebra operations on 8-bit and 16-bit integral values by 512-bit
+// AVX-512 intrinsics. In case the AVX512BW mode is disabled, these operations are vectorized by
+// AVX2 (or older) intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512DQ mode. In case the AVX512DQ mode is enabled
+// (i.e. in case the AVX-512 doubleword and quadword instructions are available) the Blaze library
+// additionally vectorizes the multiplication of 64-bit integral values by AVX-512 intrinsics. In
+// case the AVX512DQ mode is disabled, 64-bit integral multiplications are not vectorized.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the FMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the FMA mode. In case the FMA mode is enabled
+// (i.e. in case FMA functionality is available) the Blaze library attempts to combine the
+// multiplications and additions/subtractions in the inner loops of the dense linear algebra
+// kernels into fused multiply-add operations. In case the FMA mode is disabled, the Blaze
+// library chooses separate intrinsic multiplications and additions/subtractions.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__FMA__)
+#  define BLAZE_FMA_MODE 1
+#else
+#  define BLAZE_FMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -250,6 +321,27 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime dispatch is requested via the
+// BLAZE_USE_RUNTIME_DISPATCH switch and supported by the compiler and platform), the Blaze
+// library relays several dense kernels to precompiled variants for different instruction
+// sets, which are selected at program startup. In case the runtime dispatch mode is disabled,
+// all kernels use the instruction set selected at compile time.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && \
+    defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && \
+    ( defined(__x86_64__) || defined(__i386__) ) && ( __GNUC__ >= 5 )
+#  define BLAZE_DISPATCH_MODE 1
+#else
+#  define BLAZE_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -262,12 +354,17 @@
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE  || BLAZE_SSE_MODE   );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE  || BLAZE_SSE2_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE     || BLAZE_SSE_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE     || BLAZE_SSE2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE    || BLAZE_SSE3_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE     || BLAZE_SSSE3_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE      || BLAZE_SSE4_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE     || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_FMA_MODE      || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || !BLAZE_MIC_MODE    );
 
 }
 /*! \endcond */
@@ -282,7 +379,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -46,11 +46,13 @@
 #include <cstdlib>
 #include <new>
 #include <stdexcept>
+#include <blaze/system/NUMA.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/NUMA.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -76,12 +78,25 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. In case the NUMA interleaving is activated (see the BLAZE_USE_NUMA_INTERLEAVING
+// switch in the configuration file <tt>./blaze/config/NUMA.h</tt>), arrays of at least
+// numaInterleavingThreshold bytes are allocated in complete memory pages, which are
+// distributed across all NUMA nodes.
 */
 inline byte* allocate_backend( size_t size, size_t alignment )
 {
    void* raw( NULL );
 
+#if BLAZE_NUMA_INTERLEAVING_MODE
+   const bool interleave( size >= numaInterleavingThreshold );
+
+   if( interleave ) {
+      const size_t page( pageSize() );
+      size = ( ( size + page - 1UL ) / page ) * page;
+      if( alignment < page ) alignment = page;
+   }
+#endif
+
 #if defined(_MSC_VER)
    raw = _aligned_malloc( size, alignment );
    if( raw == NULL )
@@ -90,6 +105,12 @@ inline byte* allocate_backend( size_t size, size_t alignment )
 #endif
       throw std::bad_alloc();
 
+#if BLAZE_NUMA_INTERLEAVING_MODE
+   if( interleave ) {
+      interleaveMemory( raw, size );
+   }
+#endif
+
    return reinterpret_cast<byte*>( raw );
 }
 /*! \endcond */
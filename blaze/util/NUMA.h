@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NUMA.h
+//  \brief Header file for the NUMA memory placement and thread pinning functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_UTIL_NUMA_H_
+#define _BLAZE_UTIL_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#endif
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS NUMANODES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The NUMA nodes the process is allowed to allocate memory from.
+// \ingroup util
+//
+// The NumaNodes class determines the set of NUMA nodes the calling process is allowed to
+// allocate memory from (see for instance \c numactl \c --membind). The node set is determined
+// via the \c get_mempolicy system call, which does not require to link against \c libnuma. In
+// case the node set cannot be determined, the set is empty.
+*/
+class NumaNodes
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The constructor of the NumaNodes class.
+   */
+   NumaNodes()
+      : count_( 0UL )  // The number of allowed NUMA nodes
+   {
+      for( size_t i=0UL; i<words; ++i )
+         mask_[i] = 0UL;
+
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+      const unsigned long memsAllowed( 1UL << 2 );  // The MPOL_F_MEMS_ALLOWED flag
+      const unsigned long nodes( maxNodes );
+      int* const mode( 0 );
+      void* const address( 0 );
+
+      if( syscall( SYS_get_mempolicy, mode, mask_, nodes, address, memsAllowed ) != 0L ) {
+         for( size_t i=0UL; i<words; ++i )
+            mask_[i] = 0UL;
+      }
+
+      for( size_t i=0UL; i<maxNodes; ++i ) {
+         if( mask_[i/bits] & ( 1UL << ( i%bits ) ) )
+            ++count_;
+      }
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of allowed NUMA nodes.
+   //
+   // \return The number of allowed NUMA nodes.
+   */
+   inline size_t count() const {
+      return count_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the node mask of the allowed NUMA nodes.
+   //
+   // \return Pointer to the first word of the node mask.
+   */
+   inline const unsigned long* mask() const {
+      return mask_;
+   }
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   enum { maxNodes = 1024 };                     //!< Maximum number of NUMA nodes.
+   enum { bits     = sizeof(unsigned long)*8 };  //!< Number of bits per mask word.
+   enum { words    = maxNodes / bits };          //!< Number of mask words.
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   unsigned long mask_[words];  //!< The node mask of the allowed NUMA nodes.
+   size_t count_;               //!< The number of allowed NUMA nodes.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS CPUSET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The CPUs the process is allowed to run on.
+// \ingroup util
+//
+// The CpuSet class determines the CPUs the calling thread is allowed to run on at the time of
+// construction (see for instance \c taskset or \c numactl \c --physcpubind). The CPUs are
+// stored in ascending order. In case the CPUs cannot be determined, the set is empty.
+*/
+class CpuSet
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The constructor of the CpuSet class.
+   */
+   CpuSet()
+      : cpus_()  // The IDs of the allowed CPUs
+   {
+#if defined(__linux__) && defined(CPU_SETSIZE)
+      cpu_set_t set;
+      CPU_ZERO( &set );
+
+      if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+         for( int cpu=0; cpu<CPU_SETSIZE; ++cpu ) {
+            if( CPU_ISSET( cpu, &set ) )
+               cpus_.push_back( cpu );
+         }
+      }
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of allowed CPUs.
+   //
+   // \return The number of allowed CPUs.
+   */
+   inline size_t size() const {
+      return cpus_.size();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the ID of the i-th allowed CPU.
+   //
+   // \param index Index of the CPU \f$[0..size()-1]\f$.
+   // \return The ID of the CPU.
+   */
+   inline int operator[]( size_t index ) const {
+      return cpus_[index];
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::vector<int> cpus_;  //!< The IDs of the allowed CPUs.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NUMA functions */
+//@{
+inline size_t pageSize();
+inline void interleaveMemory( void* address, size_t size );
+inline void pinThread( size_t index );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of a memory page.
+// \ingroup util
+//
+// \return The size of a memory page in Byte.
+*/
+inline size_t pageSize()
+{
+#if defined(__linux__)
+   static const long size( sysconf( _SC_PAGESIZE ) );
+   return ( size > 0L )?( static_cast<size_t>( size ) ):( 4096UL );
+#else
+   return 4096UL;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Distributing the memory pages of the given memory range across all NUMA nodes.
+// \ingroup util
+//
+// \param address The page-aligned address of the first byte of the memory range.
+// \param size The size of the memory range in Byte.
+// \return void
+//
+// This function sets the memory policy of the given memory range such that its memory pages
+// are distributed round-robin across all NUMA nodes the process is allowed to allocate from.
+// The policy only affects memory pages that have not been touched yet. Therefore the function
+// should be called directly after the allocation of the memory range. The function uses the
+// \c mbind system call and therefore is only available on Linux systems. On all other systems,
+// on systems with a single NUMA node, and in case the system call fails, the function has no
+// effect.
+*/
+inline void interleaveMemory( void* address, size_t size )
+{
+#if defined(__linux__) && defined(SYS_mbind)
+   static const NumaNodes nodes;
+
+   if( nodes.count() < 2UL || size == 0UL )
+      return;
+
+   const unsigned long interleave( 3UL );  // The MPOL_INTERLEAVE memory policy
+   const unsigned long maxnode( NumaNodes::maxNodes+1UL );
+   const unsigned long flags( 0UL );
+
+   syscall( SYS_mbind, address, size, interleave, nodes.mask(), maxnode, flags );
+#else
+   UNUSED_PARAMETER( address, size );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the calling thread to a single CPU.
+// \ingroup util
+//
+// \param index The index of the thread.
+// \return void
+//
+// This function binds the calling thread to the CPU with the given index within the set of
+// CPUs the process is allowed to run on. In case the index exceeds the number of available
+// CPUs, the CPUs are reused in a round-robin fashion. The set of CPUs is determined by the
+// first call of the function. The function is only available on Linux systems. On all other
+// systems and in case the binding fails, the function has no effect.
+*/
+inline void pinThread( size_t index )
+{
+#if defined(__linux__) && defined(CPU_SETSIZE)
+   static const CpuSet cpus;
+
+   if( cpus.size() == 0UL )
+      return;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpus[index % cpus.size()], &set );
+
+   sched_setaffinity( 0, sizeof( set ), &set );
+#else
+   UNUSED_PARAMETER( index );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,8 +42,11 @@
 
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -259,7 +262,7 @@ class Thread : private NonCopyable
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -325,6 +328,7 @@ class Thread : private NonCopyable
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          index_;       //!< Index of the thread within the managing thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -350,6 +354,7 @@ class Thread : private NonCopyable
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param index The index of the thread within the thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -358,9 +363,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t index )
    : terminated_( false )  // Thread termination flag
    , pool_      ( pool  )  // Handle to the managing thread pool
+   , index_     ( index )  // Index of the thread within the thread pool
    , thread_    ( 0     )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( boost::bind( &Thread::run, this ) ) );
@@ -632,7 +638,10 @@ inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 //*************************************************************************************************
 /*!\brief Execution function for threads in a thread pool.
 //
-// This function is executed by any thread managed by a thread pool.
+// This function is executed by any thread managed by a thread pool. In case the thread pinning
+// is activated (see the BLAZE_USE_THREAD_PINNING switch in the configuration file
+// <tt>./blaze/config/SMP.h</tt>), the thread is bound to a single CPU before it starts to
+// execute tasks.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -643,6 +652,11 @@ void Thread<TT,MT,LT,CT>::run()
    // Checking the thread pool handle
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
+   // Binding the thread to a single CPU
+#if BLAZE_THREAD_PINNING_MODE
+   pinThread( index_ );
+#endif
+
    // Executing scheduled tasks
    while( pool_->executeTask() ) {}
 
@@ -898,7 +898,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.pushBack( new ManagedThread( this ) );
+   threads_.pushBack( new ManagedThread( this, total_ ) );
    ++total_;
    ++expected_;
    ++active_;
@@ -0,0 +1,855 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the work-stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingpool_general General
+//
+// The WorkStealingPool class template represents a thread pool for fork/join parallelism with
+// the same scheduling interface as the ThreadPool class template. In contrast to the ThreadPool,
+// which manages all tasks in a single queue protected by a mutex, the WorkStealingPool is
+// optimized for the low-latency execution of a few, short tasks per fork/join step:
+//
+//  - Each worker thread owns a lock-free deque (see threadpool::WorkStealingDeque). Scheduled
+//    tasks are pushed into a separate submission deque, from which the idle workers steal. A
+//    worker that finds the submission deque well filled moves several tasks at once into its
+//    own deque, from which they can in turn be stolen by the other workers.
+//  - Idle workers keep looking for tasks for a short while (spin) before they are put to sleep
+//    on a condition variable (park). Thus back-to-back fork/join steps are picked up without
+//    any wake-up latency, whereas idle workers don't consume CPU time in the long run.
+//  - The wait() function is a fork/join barrier in which the calling thread takes part in the
+//    execution of the scheduled tasks instead of blocking. It only falls asleep in case all
+//    remaining tasks are already executed by worker threads.
+//
+// As the ThreadPool, a pool of size \a n manages \a n worker threads, which execute the scheduled
+// tasks independent of any call to the wait() function. A thread calling wait() additionally
+// takes part in the execution of the remaining tasks.
+//
+// \section workstealingpool_setup Creating a work-stealing pool
+//
+// In addition to the four template arguments of the ThreadPool class template (the type of
+// the thread, the mutex, the lock, and the condition variable), the WorkStealingPool class
+// template requires the atomic class template as fifth template argument:
+
+   \code
+   typedef blaze::WorkStealingPool< std::thread
+                                  , std::mutex
+                                  , std::unique_lock< std::mutex >
+                                  , std::condition_variable
+                                  , std::atomic >  StdWorkStealingPool;
+
+   typedef blaze::WorkStealingPool< boost::thread
+                                  , boost::mutex
+                                  , boost::unique_lock< boost::mutex >
+                                  , boost::condition_variable
+                                  , boost::atomic >  BoostWorkStealingPool;
+
+   StdWorkStealingPool pool( 4 );
+
+   for( size_t i=0; i<4; ++i ) {
+      pool.schedule( task, i );  // Scheduling task(i) for execution
+   }
+
+   pool.wait();  // Executing tasks until all scheduled tasks are complete
+   \endcode
+
+// In case the BLAZE_USE_WORK_STEALING switch is activated, the WorkStealingPool is used by
+// the C++11 and Boost thread-based parallelization instead of the ThreadPool. As the thread
+// pool, the work-stealing pool is not able to propagate exceptions thrown by a task. Also,
+// tasks must not wait for the completion of other tasks of the same pool.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+class WorkStealingPool : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef Thread<TT,MT,LT,CT>                ManagedThread;  //!< Type of the managed threads.
+   typedef PtrVector<ManagedThread>           Threads;        //!< Type of the thread container.
+   typedef threadpool::Task                   Task;           //!< Type of a single task.
+   typedef threadpool::WorkStealingDeque<AT>  Deque;          //!< Type of a task deque.
+   typedef PtrVector<Deque>                   Deques;         //!< Type of the deque container.
+   typedef MT                                 Mutex;          //!< Type of the mutex.
+   typedef LT                                 Lock;           //!< Type of a locking object.
+   typedef CT                                 Condition;      //!< Condition variable type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of unsuccessful attempts to find a task before an idle thread is put to sleep.
+   enum { spinCount = 4096 };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void schedule( Callable func );
+
+   template< typename Callable, typename A1 >
+   void schedule( Callable func, A1 a1 );
+
+   template< typename Callable, typename A1, typename A2 >
+   void schedule( Callable func, A1 a1, A2 a2 );
+
+   template< typename Callable, typename A1, typename A2, typename A3 >
+   void schedule( Callable func, A1 a1, A2 a2, A3 a3 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void  push   ( Task* task );
+   Task* acquire( size_t index );
+   void  execute( Task* task );
+   void  park   ();
+   void  work   ( size_t index );
+   void  wakeup ();
+   void  start  ( size_t n );
+   void  stop   ();
+
+   static inline void relax();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t        size_;      //!< Total number of worker threads.
+   Threads       threads_;   //!< The worker threads of the pool.
+   Deques        deques_;    //!< The submission deque followed by the deques of the workers.
+   AT<size_t>    pending_;   //!< Number of scheduled, but not yet completed tasks.
+   AT<size_t>    sleepers_;  //!< Number of parked worker threads.
+   AT<size_t>    waiters_;   //!< Number of parked waiting threads.
+   AT<bool>      stop_;      //!< Termination flag for the worker threads.
+   size_t        signal_;    //!< Wake-up counter for the parked worker threads.
+   mutable Mutex submit_;    //!< Synchronization mutex for the submission deque.
+   mutable Mutex mutex_;     //!< Synchronization mutex for parking threads.
+   Condition     idle_;      //!< Wait condition for parked worker threads.
+   Condition     done_;      //!< Wait condition for parked waiting threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of worker threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+WorkStealingPool<TT,MT,LT,CT,AT>::WorkStealingPool( size_t n )
+   : size_    ( 0UL )    // Total number of worker threads
+   , threads_ ()         // The worker threads of the pool
+   , deques_  ()         // The submission deque followed by the deques of the workers
+   , pending_ ( 0UL )    // Number of scheduled, but not yet completed tasks
+   , sleepers_( 0UL )    // Number of parked worker threads
+   , waiters_ ( 0UL )    // Number of parked waiting threads
+   , stop_    ( false )  // Termination flag for the worker threads
+   , signal_  ( 0UL )    // Wake-up counter for the parked worker threads
+   , submit_  ()         // Synchronization mutex for the submission deque
+   , mutex_   ()         // Synchronization mutex for parking threads
+   , idle_    ()         // Wait condition for parked worker threads
+   , done_    ()         // Wait condition for parked waiting threads
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+   deques_.pushBack( new Deque() );
+   start( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor terminates all worker threads. Tasks that have not been started yet are
+// executed by the worker threads before they terminate.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+WorkStealingPool<TT,MT,LT,CT,AT>::~WorkStealingPool()
+{
+   stop();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case no tasks are pending, \a false if not.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline bool WorkStealingPool<TT,MT,LT,CT,AT>::isEmpty() const
+{
+   return pending_.load() == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the work-stealing pool.
+//
+// \return The total number of worker threads.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline size_t WorkStealingPool<TT,MT,LT,CT,AT>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable without arguments and must return void.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Callable >            // Type of the function/functor
+void WorkStealingPool<TT,MT,LT,CT,AT>::schedule( Callable func )
+{
+   push( new Task( func ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given unary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with one argument and must return void.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Callable              // Type of the function/functor
+        , typename A1 >                  // Type of the first argument
+void WorkStealingPool<TT,MT,LT,CT,AT>::schedule( Callable func, A1 a1 )
+{
+   push( new Task( boost::bind<void>( func, a1 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given binary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with two arguments and must return void.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Callable              // Type of the function/functor
+        , typename A1                    // Type of the first argument
+        , typename A2 >                  // Type of the second argument
+void WorkStealingPool<TT,MT,LT,CT,AT>::schedule( Callable func, A1 a1, A2 a2 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given ternary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with three arguments and must return void.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+template< typename Callable              // Type of the function/functor
+        , typename A1                    // Type of the first argument
+        , typename A2                    // Type of the second argument
+        , typename A3 >                  // Type of the third argument
+void WorkStealingPool<TT,MT,LT,CT,AT>::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2, a3 ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the number of worker threads of the work-stealing pool.
+//
+// \param n The new number of worker threads \f$[1..\infty)\f$.
+// \param block Ignored; the function always blocks until the old worker threads terminated.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function replaces all worker threads by \a n new worker threads. Before the old
+// worker threads terminate, they execute all tasks that have not been started yet.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+   if( n == size_ )
+      return;
+
+   stop();
+   start( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function implements the join of a fork/join step: the calling thread executes scheduled
+// tasks until no task is left. Afterwards it spins until the remaining tasks have been completed
+// by the worker threads and eventually parks until the last task has been completed.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::wait()
+{
+   size_t attempts( 0UL );
+
+   while( pending_.load() != 0UL )
+   {
+      Task* task( NULL );
+
+      if( !deques_[0UL]->isEmpty() ) {
+         Lock lock( submit_ );
+         task = deques_[0UL]->pop();
+      }
+
+      for( size_t i=1UL; task == NULL && i<deques_.size(); ++i ) {
+         task = deques_[i]->steal();
+      }
+
+      if( task != NULL ) {
+         execute( task );
+         attempts = 0UL;
+      }
+      else if( ++attempts > spinCount ) {
+         Lock lock( mutex_ );
+         ++waiters_;
+         while( pending_.load() != 0UL ) {
+            done_.wait( lock );
+         }
+         --waiters_;
+      }
+      else {
+         relax();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a new task to the submission deque.
+//
+// \param task The task to be added.
+// \return void
+//
+// In case any worker thread is parked, this function wakes up one worker thread.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::push( Task* task )
+{
+   ++pending_;
+
+   {
+      Lock lock( submit_ );
+      deques_[0UL]->push( task );
+   }
+
+   // The sequentially consistent accesses to the deque and the sleeper count guarantee that
+   // either the parking worker sees the new task or this thread sees the parking worker.
+   if( sleepers_.load() != 0UL ) {
+      wakeup();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a task for the given worker thread.
+//
+// \param index The index of the worker thread.
+// \return The acquired task, or \c NULL in case no task was found.
+//
+// The worker thread first takes the newest task of its own deque. Otherwise it steals from the
+// submission deque and, in case it is well filled, moves up to half of the tasks per worker into
+// its own deque. Finally, it tries to steal from the deques of the other worker threads.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+typename WorkStealingPool<TT,MT,LT,CT,AT>::Task*
+   WorkStealingPool<TT,MT,LT,CT,AT>::acquire( size_t index )
+{
+   Deque& own( *deques_[index+1UL] );
+
+   Task* task( own.pop() );
+
+   if( task != NULL )
+      return task;
+
+   task = deques_[0UL]->steal();
+
+   if( task != NULL ) {
+      bool refilled( false );
+      for( size_t batch=deques_[0UL]->size()/(2UL*size_); batch>0UL; --batch ) {
+         Task* next( deques_[0UL]->steal() );
+         if( next == NULL ) break;
+         own.push( next );
+         refilled = true;
+      }
+      if( refilled && sleepers_.load() != 0UL ) {
+         wakeup();
+      }
+      return task;
+   }
+
+   const size_t workers( deques_.size() - 1UL );
+
+   for( size_t i=1UL; task == NULL && i<workers; ++i ) {
+      task = deques_[( index + i ) % workers + 1UL]->steal();
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing and destroying the given task.
+//
+// \param task The task to be executed.
+// \return void
+//
+// In case the last pending task is completed and a thread is parked in the wait() function,
+// the waiting thread is woken up.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::execute( Task* task )
+{
+   (*task)();
+   delete task;
+
+   if( --pending_ == 0UL && waiters_.load() != 0UL ) {
+      Lock lock( mutex_ );
+      done_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parking the calling worker thread until new tasks are scheduled.
+//
+// \return void
+//
+// The worker thread is only parked in case all deques are empty. Since both the submission of
+// new tasks and the refill of a worker's deque wake up a parked worker thread, no stealable task
+// is left behind while a worker thread sleeps.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::park()
+{
+   Lock lock( mutex_ );
+
+   const size_t signal( signal_ );
+   ++sleepers_;
+
+   bool empty( true );
+   for( size_t i=0UL; empty && i<deques_.size(); ++i ) {
+      empty = deques_[i]->isEmpty();
+   }
+
+   if( empty ) {
+      while( signal_ == signal && !stop_.load() ) {
+         idle_.wait( lock );
+      }
+   }
+
+   --sleepers_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up a single parked worker thread.
+//
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::wakeup()
+{
+   Lock lock( mutex_ );
+   ++signal_;
+   idle_.notify_one();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution function of the worker threads.
+//
+// \param index The index of the worker thread.
+// \return void
+//
+// Each worker thread repeatedly acquires and executes tasks. In case no task is found within
+// \a spinCount attempts, the worker thread is parked. After the termination flag has been set,
+// the worker thread returns as soon as no more tasks can be found. In case the thread pinning
+// is activated (see the BLAZE_USE_THREAD_PINNING switch in the configuration file
+// <tt>./blaze/config/SMP.h</tt>), the worker thread is bound to a single CPU before it starts
+// to execute tasks.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::work( size_t index )
+{
+#if BLAZE_THREAD_PINNING_MODE
+   pinThread( index );
+#endif
+
+   size_t attempts( 0UL );
+
+   while( true )
+   {
+      Task* task( acquire( index ) );
+
+      if( task != NULL ) {
+         execute( task );
+         attempts = 0UL;
+      }
+      else if( stop_.load() && deques_[0UL]->isEmpty() && deques_[index+1UL]->isEmpty() ) {
+         return;
+      }
+      else if( ++attempts > spinCount ) {
+         park();
+         attempts = 0UL;
+      }
+      else {
+         relax();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating the given number of worker threads.
+//
+// \param n The total number of worker threads.
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::start( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.isEmpty(), "Active worker threads detected" );
+   BLAZE_INTERNAL_ASSERT( deques_.size() == 1UL, "Invalid number of deques detected" );
+
+   stop_.store( false );
+   size_ = n;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      deques_.pushBack( new Deque() );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      threads_.pushBack( new ManagedThread( boost::bind( &WorkStealingPool::work, this, i ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating all worker threads.
+//
+// \return void
+//
+// This function sets the termination flag, wakes up all parked worker threads and joins them.
+// Afterwards only the submission deque is left.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+void WorkStealingPool<TT,MT,LT,CT,AT>::stop()
+{
+   {
+      Lock lock( mutex_ );
+      stop_.store( true );
+      idle_.notify_all();
+   }
+
+   for( typename Threads::Iterator thread=threads_.begin(); thread!=threads_.end(); ++thread ) {
+      thread->join();
+   }
+
+   threads_.clear();
+
+   while( deques_.size() > 1UL ) {
+      deques_.popBack();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Signaling the processor that the calling thread is spinning.
+//
+// \return void
+//
+// In case SSE2 is available the function issues a pause instruction, which reduces the power
+// consumption of a spinning thread and frees execution resources for a hyperthreaded sibling.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline void WorkStealingPool<TT,MT,LT,CT,AT>::relax()
+{
+#if BLAZE_SSE2_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
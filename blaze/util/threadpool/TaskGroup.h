@@ -0,0 +1,299 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Header file for the TaskGroup class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/exception_ptr.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of tasks with a common completion state.
+// \ingroup threads
+//
+// The TaskGroup class represents a set of tasks that have been scheduled by the same thread and
+// that can be waited for independently of any other scheduled task. Next to a FIFO queue of the
+// not yet started tasks it keeps track of the number of pending tasks, i.e. the number of tasks
+// that have been pushed into the group but that have not been completed yet, and of the first
+// exception thrown by any of its tasks. The pending counter is atomic, such that completing a
+// task does not require any locking. The synchronization mutex of the task group protects the
+// queue and the exception and is used to wake up the waiting thread after the last task has
+// been completed. Since every task group has its own mutex, task groups of different threads
+// never contend with each other. Task groups are managed via shared pointers, which allows
+// the tasks scheduled for a task group to keep the group alive.
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+class TaskGroup : public boost::enable_shared_from_this< TaskGroup<MT,LT,CT,AT> >
+                , private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isDone() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void push( Task task );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool                 execute();
+   inline boost::exception_ptr wait   ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TaskQueue            queue_;    //!< FIFO queue of the not yet started tasks.
+   AT<size_t>           pending_;  //!< Number of pushed, but not yet completed tasks.
+   boost::exception_ptr error_;    //!< The first exception thrown by a task of the group.
+   MT                   mutex_;    //!< Synchronization mutex of the task group.
+   CT                   done_;     //!< Wait condition for the completion of all tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the TaskGroup class.
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline TaskGroup<MT,LT,CT,AT>::TaskGroup()
+   : queue_  (     )  // FIFO queue of the not yet started tasks
+   , pending_( 0UL )  // Number of pushed, but not yet completed tasks
+   , error_  (     )  // The first exception thrown by a task of the group
+   , mutex_  (     )  // Synchronization mutex of the task group
+   , done_   (     )  // Wait condition for the completion of all tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks of the task group have been completed.
+//
+// \return \a true in case all tasks have been completed, \a false if not.
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline bool TaskGroup<MT,LT,CT,AT>::isDone() const
+{
+   return pending_.load() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the end of the task group.
+//
+// \param task The task to be added to the task group.
+// \return void
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline void TaskGroup<MT,LT,CT,AT>::push( Task task )
+{
+   LT lock( mutex_ );
+   queue_.push( task );
+   ++pending_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the first not yet started task of the task group.
+//
+// \return \a true in case a task has been executed, \a false if all tasks have been started.
+//
+// This function removes the first task from the task group and executes it in the calling
+// thread. The completion of the task is reported no matter whether the task has been completed
+// successfully or has failed with an exception. In the latter case the exception is stored in
+// the task group (unless another task has already failed) and is returned by the wait()
+// function. In case the last pending task of the group has been completed, the waiting thread
+// is notified.
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline bool TaskGroup<MT,LT,CT,AT>::execute()
+{
+   Task task;
+
+   {
+      LT lock( mutex_ );
+
+      if( queue_.isEmpty() )
+         return false;
+
+      task = queue_.pop();
+   }
+
+   boost::exception_ptr error;
+
+   try {
+      task();
+   }
+   catch( ... ) {
+      error = boost::current_exception();
+   }
+
+   BLAZE_INTERNAL_ASSERT( pending_.load() > 0UL, "No pending task detected" );
+
+   if( error ) {
+      LT lock( mutex_ );
+      if( !error_ )
+         error_ = error;
+   }
+
+   if( --pending_ == 0UL ) {
+      LT lock( mutex_ );
+      done_.notify_all();
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the task group to be completed.
+//
+// \return The first exception thrown by a task of the group (or an empty exception pointer).
+//
+// This function blocks until all pending tasks of the task group have been completed. The
+// returned exception is removed from the task group, which afterwards can be reused.
+*/
+template< typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic class template
+inline boost::exception_ptr TaskGroup<MT,LT,CT,AT>::wait()
+{
+   LT lock( mutex_ );
+
+   while( pending_.load() != 0UL ) {
+      done_.wait( lock );
+   }
+
+   const boost::exception_ptr error( error_ );
+   error_ = boost::exception_ptr();
+   return error;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,435 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Lock-free work-stealing deque for the work-stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingDeque class template implements the dynamically growing circular deque by
+// Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005). The owner of the deque
+// pushes and pops tasks at the bottom end in LIFO order, all other threads steal tasks from
+// the top end in FIFO order. None of the operations acquires a lock: the owner only competes
+// with the thieves for the very last task and the thieves compete among each other by means
+// of a single compare-and-swap operation on the top index.\n
+// The template argument \a AT specifies the atomic class template (\c std::atomic or
+// \c boost::atomic). All atomic operations use the default sequentially consistent memory
+// ordering. Only a single thread at a time is allowed to call the push() and pop() functions,
+// whereas the steal() function can be called concurrently by an arbitrary number of threads.
+// Buffers that have been replaced due to a growth of the deque are kept alive until the
+// destruction of the deque since concurrent thieves might still access them.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+class WorkStealingDeque : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef AT<ptrdiff_t>  Index;  //!< Type of the atomic top and bottom indices.
+   typedef AT<Task*>      Slot;   //!< Type of a single atomic task slot.
+   //**********************************************************************************************
+
+   //**Private class Buffer************************************************************************
+   /*!\brief Circular buffer for the tasks of the deque.
+   */
+   struct Buffer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param capacity The capacity of the buffer (must be a power of two).
+      */
+      explicit inline Buffer( size_t capacity )
+         : mask_ ( capacity - 1UL )          // Bit mask for the index computation
+         , slots_( new Slot[capacity] )      // The task slots of the buffer
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor for the Buffer class.
+      */
+      inline ~Buffer() {
+         delete [] slots_;
+      }
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the capacity of the buffer.
+      //
+      // \return The capacity of the buffer.
+      */
+      inline ptrdiff_t capacity() const {
+         return static_cast<ptrdiff_t>( mask_ + 1UL );
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Access to the task at the given position.
+      //
+      // \param index The logical position of the task.
+      // \return The task at the given position.
+      */
+      inline Task* get( ptrdiff_t index ) const {
+         return slots_[static_cast<size_t>( index ) & mask_].load();
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Storing a task at the given position.
+      //
+      // \param index The logical position of the task.
+      // \param task The task to be stored.
+      // \return void
+      */
+      inline void put( ptrdiff_t index, Task* task ) {
+         slots_[static_cast<size_t>( index ) & mask_].store( task );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t mask_;   //!< Bit mask for the index computation.
+      Slot*  slots_;  //!< The task slots of the buffer.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkStealingDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()    const;
+   inline bool   isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  push ( Task* task );
+   inline Task* pop  ();
+   inline Task* steal();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Buffer* grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Index                top_;      //!< Index of the oldest task (thief end).
+   Index                bottom_;   //!< Index one past the newest task (owner end).
+   AT<Buffer*>          buffer_;   //!< The current circular buffer.
+   std::vector<Buffer*> retired_;  //!< Replaced buffers that might still be read by thieves.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for WorkStealingDeque.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline WorkStealingDeque<AT>::WorkStealingDeque()
+   : top_    ( 0 )                     // Index of the oldest task
+   , bottom_ ( 0 )                     // Index one past the newest task
+   , buffer_ ( new Buffer( 64UL ) )    // The current circular buffer
+   , retired_()                        // Replaced buffers that might still be read by thieves
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingDeque class.
+//
+// The destructor destroys any remaining task in the deque.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline WorkStealingDeque<AT>::~WorkStealingDeque()
+{
+   Buffer* buffer( buffer_.load() );
+
+   for( ptrdiff_t i=top_.load(); i<bottom_.load(); ++i ) {
+      delete buffer->get( i );
+   }
+
+   delete buffer;
+
+   for( size_t i=0UL; i<retired_.size(); ++i ) {
+      delete retired_[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the deque.
+//
+// \return The current size.
+//
+// In case the deque is accessed concurrently, the returned size is only a snapshot.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline size_t WorkStealingDeque<AT>::size() const
+{
+   const ptrdiff_t top   ( top_.load() );
+   const ptrdiff_t bottom( bottom_.load() );
+   return ( bottom > top )?( static_cast<size_t>( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the deque has no elements.
+//
+// \return \a true if the deque is empty, \a false if it is not.
+//
+// In case the deque is accessed concurrently, the result is only a snapshot.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline bool WorkStealingDeque<AT>::isEmpty() const
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom end of the deque.
+//
+// \param task The task to be added (must not be \c NULL).
+// \return void
+//
+// This function must only be called by the owner of the deque. In case the buffer is full, the
+// capacity of the deque is doubled.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline void WorkStealingDeque<AT>::push( Task* task )
+{
+   BLAZE_INTERNAL_ASSERT( task != NULL, "Invalid task detected" );
+
+   const ptrdiff_t bottom( bottom_.load() );
+   const ptrdiff_t top   ( top_.load() );
+   Buffer* buffer( buffer_.load() );
+
+   if( bottom - top >= buffer->capacity() - 1 ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->put( bottom, task );
+   bottom_.store( bottom + 1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the newest task from the bottom end of the deque.
+//
+// \return The newest task, or \c NULL in case the deque is empty.
+//
+// This function must only be called by the owner of the deque. In case only a single task is
+// left, the owner competes with all thieves for it.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline Task* WorkStealingDeque<AT>::pop()
+{
+   const ptrdiff_t bottom( bottom_.load() - 1 );
+   Buffer* buffer( buffer_.load() );
+   bottom_.store( bottom );
+
+   ptrdiff_t top( top_.load() );
+
+   if( top > bottom ) {
+      bottom_.store( bottom + 1 );
+      return NULL;
+   }
+
+   Task* task( buffer->get( bottom ) );
+
+   if( top == bottom ) {
+      if( !top_.compare_exchange_strong( top, top + 1 ) )
+         task = NULL;
+      bottom_.store( bottom + 1 );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the oldest task from the top end of the deque.
+//
+// \return The oldest task, or \c NULL in case the deque is empty or the steal failed.
+//
+// This function can be called concurrently by an arbitrary number of threads. In case another
+// thread has taken the oldest task concurrently, the function gives up and returns \c NULL,
+// even if the deque still contains tasks.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+inline Task* WorkStealingDeque<AT>::steal()
+{
+   ptrdiff_t top( top_.load() );
+   const ptrdiff_t bottom( bottom_.load() );
+
+   if( top >= bottom )
+      return NULL;
+
+   Task* task( buffer_.load()->get( top ) );
+
+   if( !top_.compare_exchange_strong( top, top + 1 ) )
+      return NULL;
+
+   return task;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Doubling the capacity of the deque.
+//
+// \param buffer The current, full buffer.
+// \param top The current top index.
+// \param bottom The current bottom index.
+// \return The new buffer.
+//
+// This function copies all tasks of the given buffer into a buffer with twice the capacity and
+// publishes the new buffer. The old buffer is retired, but not destroyed.
+*/
+template< template< typename > class AT >  // Type of the atomic class template
+typename WorkStealingDeque<AT>::Buffer*
+   WorkStealingDeque<AT>::grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom )
+{
+   Buffer* tmp( new Buffer( 2UL * static_cast<size_t>( buffer->capacity() ) ) );
+
+   for( ptrdiff_t i=top; i<bottom; ++i ) {
+      tmp->put( i, buffer->get( i ) );
+   }
+
+   retired_.push_back( buffer );
+   buffer_.store( tmp );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,626 @@
+//=================================================================================================
+/*!
+//  \file src/main/Thresholds.cpp
+//  \brief Source file for the calibration of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+//! The calibration requires the runtime thresholds of the Blaze library.
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Timing.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blaze::columnMajor;
+using blaze::rowMajor;
+using blaze::rowVector;
+using blaze::columnVector;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+typedef blaze::DynamicVector<double,columnVector>  VT;   //!< Type of a column vector.
+typedef blaze::DynamicVector<double,rowVector>     TVT;  //!< Type of a row vector.
+typedef blaze::DynamicMatrix<double,rowMajor>      MT;   //!< Type of a row-major matrix.
+typedef blaze::DynamicMatrix<double,columnMajor>   TMT;  //!< Type of a column-major matrix.
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Largest possible threshold value.
+//
+// This value is used to deactivate the parallel execution and the BLAS kernels during the
+// calibration of a single threshold.
+*/
+const size_t inf = std::numeric_limits<size_t>::max();
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum duration of a single time measurement in seconds.
+*/
+const double minTime = 0.01;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of repetitions of each time measurement.
+*/
+const size_t reps = 3UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with non-zero values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< bool TF >
+void init( blaze::DynamicVector<double,TF>& v )
+{
+   for( size_t i=0UL; i<v.size(); ++i )
+      v[i] = 1.0 + 0.001*( i % 1000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with non-zero values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< bool SO >
+void init( blaze::DynamicMatrix<double,SO>& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = 1.0 + 0.001*( ( i + j ) % 1000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vector/vector operation \f$ c = a \circ b \f$ for vectors of size \f$ N \f$.
+//
+// The template argument \a OP selects the operation (0: assignment, 1: addition, 2: subtraction,
+// 3: componentwise multiplication, 4: scalar multiplication).
+*/
+template< int OP >
+struct VecVecOp
+{
+   explicit VecVecOp( size_t N ) : a( N ), b( N ), c( N ) { init( a ); init( b ); }
+
+   void operator()() {
+      switch( OP ) {
+         case 0 : c = a;       break;
+         case 1 : c = a + b;   break;
+         case 2 : c = a - b;   break;
+         case 3 : c = a * b;   break;
+         default: c = a * 2.1; break;
+      }
+   }
+
+   VT a, b, c;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/matrix operation \f$ C = A \circ B \f$ for \f$ N \times N \f$ matrices.
+//
+// The template argument \a OP selects the operation (0: assignment, 1: addition, 2: subtraction,
+// 3: scalar multiplication), \a BT the type of the right-hand side matrix operand.
+*/
+template< int OP, typename BT >
+struct MatMatOp
+{
+   explicit MatMatOp( size_t N ) : A( N, N ), B( N, N ), C( N, N ) { init( A ); init( B ); }
+
+   void operator()() {
+      switch( OP ) {
+         case 0 : C = A;       break;
+         case 1 : C = A + B;   break;
+         case 2 : C = A - B;   break;
+         default: C = A * 2.1; break;
+      }
+   }
+
+   MT A;
+   BT B;
+   MT C;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication \f$ y = A x \f$ for a \f$ N \times N \f$ matrix of type AT.
+*/
+template< typename AT >
+struct MatVecMult
+{
+   explicit MatVecMult( size_t N ) : A( N, N ), x( N ), y( N ) { init( A ); init( x ); }
+
+   void operator()() { y = A * x; }
+
+   AT A;
+   VT x, y;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vector/matrix multiplication \f$ y^T = x^T A \f$ for a \f$ N \times N \f$ matrix of type AT.
+*/
+template< typename AT >
+struct VecMatMult
+{
+   explicit VecMatMult( size_t N ) : A( N, N ), x( N ), y( N ) { init( A ); init( x ); }
+
+   void operator()() { y = x * A; }
+
+   AT A;
+   TVT x, y;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/matrix multiplication \f$ C = A B \f$ for \f$ N \times N \f$ matrices.
+*/
+template< typename AT, typename BT >
+struct MatMatMult
+{
+   explicit MatMatMult( size_t N ) : A( N, N ), B( N, N ), C( N, N ) { init( A ); init( B ); }
+
+   void operator()() { C = A * B; }
+
+   AT A;
+   BT B;
+   MT C;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Outer product \f$ C = a b^T \f$ for vectors of size \f$ N \f$.
+*/
+struct OuterProduct
+{
+   explicit OuterProduct( size_t N ) : a( N ), b( N ), C( N, N ) { init( a ); init( b ); }
+
+   void operator()() { C = a * b; }
+
+   VT a;
+   TVT b;
+   MT C;
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the given operation the given number of times.
+//
+// \param op The operation to be executed.
+// \param steps The number of executions.
+// \param serial \a true for a single-threaded execution, \a false for the default execution.
+// \return void
+*/
+template< typename OP >
+void execute( OP& op, size_t steps, bool serial )
+{
+   if( serial ) {
+      BLAZE_SERIAL_SECTION {
+         for( size_t step=0UL; step<steps; ++step )
+            op();
+      }
+   }
+   else {
+      for( size_t step=0UL; step<steps; ++step )
+         op();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \param serial \a true for a single-threaded execution, \a false for the default execution.
+// \return The minimum runtime of a single execution in seconds.
+*/
+template< typename OP >
+double measure( OP& op, bool serial )
+{
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   do {
+      timer.start();
+      execute( op, steps, serial );
+      timer.end();
+      steps *= 2UL;
+   }
+   while( timer.last() < minTime );
+
+   steps /= 2UL;
+
+   double best( timer.last() );
+   for( size_t rep=1UL; rep<reps; ++rep ) {
+      timer.start();
+      execute( op, steps, serial );
+      timer.end();
+      best = std::min( best, timer.last() );
+   }
+
+   return best / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds for the calibration of a single threshold.
+//
+// \param blas The calibrated BLAS thresholds.
+// \return void
+//
+// This function deactivates the parallel execution of all operations. The BLAS thresholds
+// are set to the given calibrated values.
+*/
+void resetThresholds( const size_t* blas )
+{
+   const char* const* names( blaze::thresholdNames() );
+
+   for( size_t i=0UL; i<blaze::thresholdCount; ++i ) {
+      blaze::setThreshold( names[i], ( i < 8UL )?( blas[i] ):( inf ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point between two variants of the given operation.
+//
+// \param name The name of the threshold to be calibrated.
+// \param first The initial size \f$ N \f$ of the operation.
+// \param last The maximum size \f$ N \f$ of the operation.
+// \param slow The threshold value selecting the default variant.
+// \param fast The threshold value selecting the alternative variant.
+// \param serial \a true for a single-threaded measurement, \a false for the default execution.
+// \return The largest size \f$ N \f$ for which the default variant is faster.
+//
+// This function increases the size \f$ N \f$ of the operation geometrically from \a first to
+// \a last. For each size both variants are measured. The crossover point is the last size
+// before the first two consecutive sizes for which the alternative variant is faster. In case
+// no crossover point is found, the function returns \a last.
+*/
+template< typename OP >
+size_t crossover( const std::string& name, size_t first, size_t last,
+                  size_t slow, size_t fast, bool serial )
+{
+   size_t wins( 0UL ), prev( 0UL ), lastSlow( 0UL );
+
+   for( size_t N=first; N<=last; N=std::max( N+1UL, N+N/4UL ) )
+   {
+      OP op( N );
+
+      blaze::setThreshold( name, slow );
+      const double t1( measure( op, serial ) );
+
+      blaze::setThreshold( name, fast );
+      const double t2( measure( op, serial ) );
+
+      if( t2 < t1 ) {
+         if( ++wins == 2UL ) return lastSlow;
+      }
+      else {
+         wins = 0UL;
+         lastSlow = N;
+      }
+
+      prev = N;
+   }
+
+   return prev;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of a single SMP threshold.
+//
+// \param name The name of the SMP threshold.
+// \param first The initial size \f$ N \f$ of the operation.
+// \param last The maximum size \f$ N \f$ of the operation.
+// \param blas The calibrated BLAS thresholds.
+// \param values The calibrated values of all thresholds.
+// \return void
+*/
+template< typename OP >
+void calibrateSMP( const std::string& name, size_t first, size_t last,
+                   const size_t* blas, size_t* values )
+{
+   std::cout << "   " << name << "..." << std::flush;
+
+   resetThresholds( blas );
+   const size_t N( crossover<OP>( name, first, last, inf, 0UL, false ) );
+   values[blaze::thresholdIndex( name )] = N;
+
+   std::cout << " " << N << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of a single BLAS threshold.
+//
+// \param name The name of the BLAS threshold.
+// \param first The initial size \f$ N \f$ of the \f$ N \times N \f$ matrix operand.
+// \param last The maximum size \f$ N \f$ of the \f$ N \times N \f$ matrix operand.
+// \param values The calibrated values of all thresholds.
+// \return void
+*/
+template< typename OP >
+void calibrateBLAS( const std::string& name, size_t first, size_t last, size_t* values )
+{
+   std::cout << "   " << name << "..." << std::flush;
+
+   const size_t N( crossover<OP>( name, first, last, inf, 1UL, true ) + 1UL );
+   values[blaze::thresholdIndex( name )] = N*N;
+   blaze::setThreshold( name, N*N );
+
+   std::cout << " " << N*N << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given thresholds as configuration file of the Blaze library.
+//
+// \param file The name of the configuration file.
+// \param values The values of all thresholds.
+// \return void
+// \exception std::runtime_error File could not be opened.
+//
+// The resulting file can be used as replacement for the configuration file
+// <tt>./blaze/config/Thresholds.h</tt>.
+*/
+void writeHeader( const std::string& file, const size_t* values )
+{
+   std::ofstream os( file.c_str() );
+
+   if( !os.is_open() )
+      throw std::runtime_error( "Header file '" + file + "' could not be opened" );
+
+   const char* const* names( blaze::thresholdNames() );
+
+   os << "//=================================================================================================\n"
+      << "/*!\n"
+      << "//  \\file blaze/config/Thresholds.h\n"
+      << "//  \\brief Configuration of the thresholds for matrix/vector and matrix/matrix multiplications\n"
+      << "//\n"
+      << "//  This file has been generated by the threshold calibration of the Blaze benchmark suite.\n"
+      << "//  For a detailed description of the thresholds see the default configuration file.\n"
+      << "*/\n"
+      << "//=================================================================================================\n"
+      << "\n"
+      << "namespace blaze {\n"
+      << "\n";
+
+   for( size_t i=0UL; i<blaze::thresholdCount; ++i ) {
+      os << "const size_t " << names[i] << " = " << values[i] << "UL;\n";
+   }
+
+   os << "\n"
+      << "} // namespace blaze\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given thresholds as tuning file for the runtime thresholds.
+//
+// \param file The name of the tuning file.
+// \param values The values of all thresholds.
+// \return void
+// \exception std::runtime_error File could not be opened.
+*/
+void writeTuningFile( const std::string& file, const size_t* values )
+{
+   std::ofstream os( file.c_str() );
+
+   if( !os.is_open() )
+      throw std::runtime_error( "Tuning file '" + file + "' could not be opened" );
+
+   const char* const* names( blaze::thresholdNames() );
+
+   os << "# Blaze thresholds generated by the threshold calibration of the Blaze benchmark suite\n";
+
+   for( size_t i=0UL; i<blaze::thresholdCount; ++i ) {
+      os << names[i] << " " << values[i] << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the calibration of the Blaze thresholds.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The calibration measures the crossover points between the Blaze kernels and the BLAS kernels
+// (in case the BLAS mode is active) and between the serial and the parallel execution of the
+// dense vector and matrix operations (in case a shared memory parallelization is active). The
+// thresholds of the sparse operations are not calibrated and keep their current values. The
+// resulting thresholds are written as configuration file and as tuning file for the runtime
+// thresholds.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 3 ) {
+      std::cerr << " Invalid use of program 'Thresholds'!\n"
+                << "   Use: ./thresholds [<header file> [<tuning file>]]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string header( ( argc > 1 )?( argv[1] ):( "Thresholds.h" ) );
+   const std::string tuning( ( argc > 2 )?( argv[2] ):( "blaze.thresholds" ) );
+
+   size_t values[blaze::thresholdCount];
+   std::copy( blaze::thresholdValues(), blaze::thresholdValues()+blaze::thresholdCount, values );
+
+   std::cout << "\n Calibration of the Blaze thresholds:\n";
+
+   try {
+      resetThresholds( values );
+
+#if BLAZE_BLAS_MODE
+      std::cout << "\n  BLAS thresholds:\n";
+      calibrateBLAS< MatVecMult<MT> >        ( "DMATDVECMULT_THRESHOLD"  , 16UL, 3000UL, values );
+      calibrateBLAS< MatVecMult<TMT> >       ( "TDMATDVECMULT_THRESHOLD" , 16UL, 3000UL, values );
+      calibrateBLAS< VecMatMult<MT> >        ( "TDVECDMATMULT_THRESHOLD" , 16UL, 3000UL, values );
+      calibrateBLAS< VecMatMult<TMT> >       ( "TDVECTDMATMULT_THRESHOLD", 16UL, 3000UL, values );
+      calibrateBLAS< MatMatMult<MT,MT> >     ( "DMATDMATMULT_THRESHOLD"  ,  8UL, 1000UL, values );
+      calibrateBLAS< MatMatMult<MT,TMT> >    ( "DMATTDMATMULT_THRESHOLD" ,  8UL, 1000UL, values );
+      calibrateBLAS< MatMatMult<TMT,MT> >    ( "TDMATDMATMULT_THRESHOLD" ,  8UL, 1000UL, values );
+      calibrateBLAS< MatMatMult<TMT,TMT> >   ( "TDMATTDMATMULT_THRESHOLD",  8UL, 1000UL, values );
+#else
+      std::cout << "\n  BLAS thresholds: skipped (BLAS mode not active)\n";
+#endif
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+      std::cout << "\n  SMP thresholds (" << blaze::getNumThreads() << " threads):\n";
+      calibrateSMP< VecVecOp<0> >            ( "SMP_DVECASSIGN_THRESHOLD"    , 1000UL, 4000000UL, values, values );
+      calibrateSMP< VecVecOp<1> >            ( "SMP_DVECDVECADD_THRESHOLD"   , 1000UL, 4000000UL, values, values );
+      calibrateSMP< VecVecOp<2> >            ( "SMP_DVECDVECSUB_THRESHOLD"   , 1000UL, 4000000UL, values, values );
+      calibrateSMP< VecVecOp<3> >            ( "SMP_DVECDVECMULT_THRESHOLD"  , 1000UL, 4000000UL, values, values );
+      calibrateSMP< VecVecOp<4> >            ( "SMP_DVECSCALARMULT_THRESHOLD", 1000UL, 4000000UL, values, values );
+      calibrateSMP< MatVecMult<MT> >         ( "SMP_DMATDVECMULT_THRESHOLD"  ,   16UL,    3000UL, values, values );
+      calibrateSMP< MatVecMult<TMT> >        ( "SMP_TDMATDVECMULT_THRESHOLD" ,   16UL,    3000UL, values, values );
+      calibrateSMP< VecMatMult<MT> >         ( "SMP_TDVECDMATMULT_THRESHOLD" ,   16UL,    3000UL, values, values );
+      calibrateSMP< VecMatMult<TMT> >        ( "SMP_TDVECTDMATMULT_THRESHOLD",   16UL,    3000UL, values, values );
+      calibrateSMP< MatMatOp<0,MT> >         ( "SMP_DMATASSIGN_THRESHOLD"    ,   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatOp<1,MT> >         ( "SMP_DMATDMATADD_THRESHOLD"   ,   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatOp<1,TMT> >        ( "SMP_DMATTDMATADD_THRESHOLD"  ,   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatOp<2,MT> >         ( "SMP_DMATDMATSUB_THRESHOLD"   ,   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatOp<2,TMT> >        ( "SMP_DMATTDMATSUB_THRESHOLD"  ,   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatOp<3,MT> >         ( "SMP_DMATSCALARMULT_THRESHOLD",   16UL,    2000UL, values, values );
+      calibrateSMP< MatMatMult<MT,MT> >      ( "SMP_DMATDMATMULT_THRESHOLD"  ,    8UL,     500UL, values, values );
+      calibrateSMP< MatMatMult<MT,TMT> >     ( "SMP_DMATTDMATMULT_THRESHOLD" ,    8UL,     500UL, values, values );
+      calibrateSMP< MatMatMult<TMT,MT> >     ( "SMP_TDMATDMATMULT_THRESHOLD" ,    8UL,     500UL, values, values );
+      calibrateSMP< MatMatMult<TMT,TMT> >    ( "SMP_TDMATTDMATMULT_THRESHOLD",    8UL,     500UL, values, values );
+      calibrateSMP< OuterProduct >           ( "SMP_DVECTDVECMULT_THRESHOLD" ,   16UL,    2000UL, values, values );
+#else
+      std::cout << "\n  SMP thresholds: skipped (no shared memory parallelization active)\n";
+#endif
+
+      writeHeader( header, values );
+      writeTuningFile( tuning, values );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during the calibration: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Calibrated thresholds written to '" << header << "' and '" << tuning << "'\n"
+             << std::endl;
+}
+//*************************************************************************************************
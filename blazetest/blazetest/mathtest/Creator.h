@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blazetest/mathtest/creator/CompactDiagonal.h>
 #include <blazetest/mathtest/creator/Complex.h>
 #include <blazetest/mathtest/creator/CompressedDiagonal.h>
 #include <blazetest/mathtest/creator/CompressedLower.h>
@@ -60,6 +61,11 @@
 #include <blazetest/mathtest/creator/HybridSymmetric.h>
 #include <blazetest/mathtest/creator/HybridUpper.h>
 #include <blazetest/mathtest/creator/HybridVector.h>
+#include <blazetest/mathtest/creator/PackedLower.h>
+#include <blazetest/mathtest/creator/PackedSymmetric.h>
+#include <blazetest/mathtest/creator/PackedUpper.h>
+#include <blazetest/mathtest/creator/SplitCompressedMatrix.h>
+#include <blazetest/mathtest/creator/SplitCompressedVector.h>
 #include <blazetest/mathtest/creator/StaticDiagonal.h>
 #include <blazetest/mathtest/creator/StaticLower.h>
 #include <blazetest/mathtest/creator/StaticMatrix.h>
@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockCompressedMatrix class template. It
+// performs a series of both compile time as well as runtime tests. All operations are checked
+// against the according operations on a row-major CompressedMatrix. Since the block compressed
+// format stores complete blocks, the number of non-zero elements is checked separately on the
+// level of blocks.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::BlockCompressedMatrix<double,3>                 MT;    //!< Type of the block compressed matrix.
+   typedef blaze::BlockCompressedMatrix<double,6>                 MT6;   //!< Type of the block compressed matrix with 6x6 blocks.
+   typedef blaze::BlockCompressedMatrix<float,2>                  FMT;   //!< Type of the single precision block compressed matrix.
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>        RMT;   //!< Type of the reference matrix.
+   typedef blaze::CompressedMatrix<float,blaze::rowMajor>         FRMT;  //!< Type of the single precision reference matrix.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>           DMT;   //!< Type of the row-major dense matrices.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>        TDMT;  //!< Type of the column-major dense matrices.
+   typedef blaze::DynamicVector<double,blaze::columnVector>       VT;    //!< Type of the column vectors.
+   typedef blaze::DynamicVector<float,blaze::columnVector>        FVT;   //!< Type of the single precision column vectors.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAssembly    ();
+   void testLookup      ();
+   void testMatVecMult  ();
+   void testMatMatMult  ();
+   void testReset       ();
+   void testSwap        ();
+
+   template< typename Type1, typename Type2 >
+   void checkMatrix( const Type1& matrix, const Type2& expected ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkVector( const Type1& vector, const Type2& expected ) const;
+
+   template< typename Type >
+   void checkBlocks( const Type& matrix, size_t expectedBlocks ) const;
+
+   template< typename Type >
+   void initialize( Type& matrix, size_t m, size_t n, size_t nonzeros ) const;
+
+   template< typename Type >
+   void initialize( Type& vector, size_t n ) const;
+
+   template< typename Type >
+   size_t countBlocks( const Type& matrix, size_t B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT, MT::ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::OppositeType, MT::OppositeType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::TransposeType, MT::TransposeType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given block compressed matrix against the given reference matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given matrix. In case a
+// difference is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the matrix
+        , typename Type2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const Type1& matrix, const Type2& expected ) const
+{
+   bool equal( matrix.rows() == expected.rows() && matrix.columns() == expected.columns() );
+
+   for( size_t i=0UL; equal && i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; equal && j<matrix.columns(); ++j ) {
+         if( matrix(i,j) != expected(i,j) )
+            equal = false;
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Rows         : " << matrix.rows() << " (expected " << expected.rows() << ")\n"
+          << "   Columns      : " << matrix.columns() << " (expected " << expected.columns() << ")\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given result vector against the given reference vector.
+//
+// \param vector The vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given vectors differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the vector
+        , typename Type2 >  // Type of the expected vector
+void ClassTest::checkVector( const Type1& vector, const Type2& expected ) const
+{
+   if( vector != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result vector detected\n"
+          << " Details:\n"
+          << "   Result:\n" << vector << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero blocks of the given block compressed matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedBlocks The expected number of non-zero blocks of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the actual number of non-zero blocks does not correspond to the given expected
+// number or the number of non-zero elements is not consistent with the number of blocks,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkBlocks( const Type& matrix, size_t expectedBlocks ) const
+{
+   const size_t B( Type::blockSize );
+
+   if( matrix.nonZeroBlocks() != expectedBlocks || matrix.nonZeros() != expectedBlocks*B*B ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero blocks\n"
+          << " Details:\n"
+          << "   Number of non-zero blocks         : " << matrix.nonZeroBlocks() << "\n"
+          << "   Expected number of non-zero blocks: " << expectedBlocks << "\n"
+          << "   Number of non-zeros               : " << matrix.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given reference matrix.
+//
+// \param matrix The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \return void
+//
+// The matrix is initialized with small random integral values in order to guarantee exact
+// results of all operations irrespective of the order of the floating point operations.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::initialize( Type& matrix, size_t m, size_t n, size_t nonzeros ) const
+{
+   typedef typename Type::ElementType  ET;
+
+   matrix.resize( m, n, false );
+   matrix.reset();
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   nonzeros = ( nonzeros < m*n )?( nonzeros ):( m*n );
+
+   while( matrix.nonZeros() < nonzeros ) {
+      matrix( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) =
+         static_cast<ET>( blaze::rand<int>( 1, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small random integral values.
+//
+// \param vector The vector to be initialized.
+// \param n The size of the vector.
+// \return void
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::initialize( Type& vector, size_t n ) const
+{
+   typedef typename Type::ElementType  ET;
+
+   vector.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector[i] = static_cast<ET>( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counting the number of \a B x \a B blocks of the given matrix containing non-zeros.
+//
+// \param matrix The reference matrix.
+// \param B The size of the blocks.
+// \return The number of blocks containing at least one non-zero element.
+*/
+template< typename Type >  // Type of the matrix
+size_t ClassTest::countBlocks( const Type& matrix, size_t B ) const
+{
+   size_t blocks( 0UL );
+
+   for( size_t ib=0UL; ib<matrix.rows()/B; ++ib ) {
+      for( size_t jb=0UL; jb<matrix.columns()/B; ++jb ) {
+         bool nonzero( false );
+         for( size_t i=ib*B; !nonzero && i<(ib+1UL)*B; ++i ) {
+            for( size_t j=jb*B; !nonzero && j<(jb+1UL)*B; ++j ) {
+               if( matrix.find(i,j) != matrix.end(i) )
+                  nonzero = true;
+            }
+         }
+         if( nonzero ) ++blocks;
+      }
+   }
+
+   return blocks;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -105,12 +105,14 @@ class ClassTest
    void testResize      ();
    void testReserve     ();
    void testTrim        ();
+   void testAssemble    ();
    void testTranspose   ();
    void testSwap        ();
    void testFind        ();
    void testLowerBound  ();
    void testUpperBound  ();
    void testIsDefault   ();
+   void testIndexType   ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
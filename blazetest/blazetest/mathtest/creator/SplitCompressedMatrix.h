@@ -0,0 +1,191 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/creator/SplitCompressedMatrix.h
+//  \brief Specialization of the Creator class template for SplitCompressedMatrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CREATOR_SPLITCOMPRESSEDMATRIX_H_
+#define _BLAZETEST_MATHTEST_CREATOR_SPLITCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/SplitCompressedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/creator/Default.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Specialization of the Creator class template for split compressed \f$ M \times N \f$
+//        matrices.
+//
+// This specialization of the Creator class template is able to create random split compressed
+// matrices.
+*/
+template< typename T    // Element type of the split compressed matrix
+        , bool SO       // Storage order of the split compressed matrix
+        , typename I >  // Index type of the split compressed matrix
+class Creator< blaze::SplitCompressedMatrix<T,SO,I> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef blaze::SplitCompressedMatrix<T,SO,I>  Type;  //!< Type to be created by the Creator.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Creator( const Creator<T>& elementCreator = Creator<T>() );
+   explicit inline Creator( size_t m, size_t n, size_t nonzeros,
+                            const Creator<T>& elementCreator = Creator<T>() );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   const blaze::SplitCompressedMatrix<T,SO,I> operator()() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The number of rows of the split compressed matrix.
+   size_t n_;         //!< The number of columns of the split compressed matrix.
+   size_t nonzeros_;  //!< The number of non-zero elements in the split compressed matrix.
+   Creator<T> ec_;    //!< Creator for the elements of the split compressed matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the creator specialization for SplitCompressedMatrix.
+//
+// \param elementCreator The creator for the elements of the split compressed matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename T    // Element type of the split compressed matrix
+        , bool SO       // Storage order of the split compressed matrix
+        , typename I >  // Index type of the split compressed matrix
+inline Creator< blaze::SplitCompressedMatrix<T,SO,I> >::Creator( const Creator<T>& elementCreator )
+   : m_( 3UL )              // The number of rows of the split compressed matrix
+   , n_( 3UL )              // The number of columns of the split compressed matrix
+   , nonzeros_( 3UL )       // The total number of non-zero elements in the split compressed matrix
+   , ec_( elementCreator )  // Creator for the elements of the split compressed matrix
+{
+   if( m_ * n_ < nonzeros_ )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the creator specialization for SplitCompressedMatrix.
+//
+// \param m The number of rows of the split compressed matrix.
+// \param n The number of columns of the split compressed matrix.
+// \param nonzeros The number of non-zero elements in the split compressed matrix.
+// \param elementCreator The creator for the elements of the split compressed matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename T    // Element type of the split compressed matrix
+        , bool SO       // Storage order of the split compressed matrix
+        , typename I >  // Index type of the split compressed matrix
+inline Creator< blaze::SplitCompressedMatrix<T,SO,I> >::Creator( size_t m, size_t n, size_t nonzeros,
+                                                                 const Creator<T>& elementCreator )
+   : m_( m )                // The number of rows of the split compressed matrix
+   , n_( n )                // The number of columns of the split compressed matrix
+   , nonzeros_( nonzeros )  // The total number of non-zero elements in the split compressed matrix
+   , ec_( elementCreator )  // Creator for the elements of the split compressed matrix
+{
+   if( m_ * n_ < nonzeros_ )
+      throw std::invalid_argument( "Invalid number of non-zero elements" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a randomly created split compressed matrix.
+//
+// \return The randomly generated split compressed matrix.
+*/
+template< typename T    // Element type of the split compressed matrix
+        , bool SO       // Storage order of the split compressed matrix
+        , typename I >  // Index type of the split compressed matrix
+inline const blaze::SplitCompressedMatrix<T,SO,I> Creator< blaze::SplitCompressedMatrix<T,SO,I> >::operator()() const
+{
+   blaze::SplitCompressedMatrix<T,SO,I> matrix( m_, n_, nonzeros_ );
+   while( matrix.nonZeros() < nonzeros_ )
+      matrix( blaze::rand<size_t>(0,m_-1), blaze::rand<size_t>(0,n_-1) ) = ec_();
+   return matrix;
+}
+//*************************************************************************************************
+
+} // namespace blazetest
+
+#endif
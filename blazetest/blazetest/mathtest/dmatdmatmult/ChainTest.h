@@ -0,0 +1,357 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/ChainTest.h
+//  \brief Header file for the dense matrix/dense matrix multiplication chain test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_CHAINTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_CHAINTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense matrix/dense matrix multiplication chain test.
+//
+// This class represents a test suite for the evaluation of chains of dense matrix/dense matrix
+// multiplications. It performs a series of runtime tests to assure that the result of a chain
+// of three dense matrices is correct independent of the order in which the chain is evaluated.
+*/
+class ChainTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>     DMat;   //!< Row-major dense matrix type.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>  TDMat;  //!< Column-major dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ChainTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO1, bool SO2, bool SO3 >
+   void testChain( size_t m, size_t k, size_t n, size_t p );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the evaluation of a chain of three dense matrices.
+//
+// \param m The number of rows of the first matrix.
+// \param k The number of columns of the first matrix.
+// \param n The number of columns of the second matrix.
+// \param p The number of columns of the third matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// chains \f$ (A*B)*C \f$ and \f$ A*(B*C) \f$ of a \f$ m \times k \f$ matrix \f$ A \f$, a
+// \f$ k \times n \f$ matrix \f$ B \f$, and a \f$ n \times p \f$ matrix \f$ C \f$ to both a
+// row-major and a column-major dense matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the first matrix
+        , bool SO2    // Storage order of the second matrix
+        , bool SO3 >  // Storage order of the third matrix
+void ChainTest::testChain( size_t m, size_t k, size_t n, size_t p )
+{
+   blaze::DynamicMatrix<int,SO1> A( m, k );
+   blaze::DynamicMatrix<int,SO2> B( k, n );
+   blaze::DynamicMatrix<int,SO3> C( n, p );
+
+   initialize( A );
+   initialize( B );
+   initialize( C );
+
+   const DMat AB( A * B );
+   const DMat BC( B * C );
+   const DMat result( AB * C );
+
+   std::ostringstream oss;
+   oss << ( SO1 ? "TDMat" : "DMat" ) << "/" << ( SO2 ? "TDMat" : "DMat" ) << "/" << ( SO3 ? "TDMat" : "DMat" )
+       << " (" << m << "x" << k << ")*(" << k << "x" << n << ")*(" << n << "x" << p << ")";
+   const std::string label( oss.str() );
+
+
+   //=====================================================================================
+   // Left-to-right chains
+   //=====================================================================================
+
+   {
+      test_ = label + " - Assignment of (A*B)*C";
+
+      DMat dres;
+      TDMat tdres;
+
+      dres  = ( A * B ) * C;
+      tdres = ( A * B ) * C;
+
+      checkResult( dres , result );
+      checkResult( tdres, result );
+   }
+
+   {
+      test_ = label + " - Addition assignment of (A*B)*C";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  += ( A * B ) * C;
+      tdres += ( A * B ) * C;
+
+      checkResult( dres , 2*result );
+      checkResult( tdres, 2*result );
+   }
+
+   {
+      test_ = label + " - Subtraction assignment of (A*B)*C";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  -= ( A * B ) * C;
+      tdres -= ( A * B ) * C;
+
+      checkResult( dres , 0*result );
+      checkResult( tdres, 0*result );
+   }
+
+
+   //=====================================================================================
+   // Right-to-left chains
+   //=====================================================================================
+
+   {
+      test_ = label + " - Assignment of A*(B*C)";
+
+      DMat dres;
+      TDMat tdres;
+
+      dres  = A * ( B * C );
+      tdres = A * ( B * C );
+
+      checkResult( dres , A * BC );
+      checkResult( tdres, A * BC );
+   }
+
+   {
+      test_ = label + " - Addition assignment of A*(B*C)";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  += A * ( B * C );
+      tdres += A * ( B * C );
+
+      checkResult( dres , 2*result );
+      checkResult( tdres, 2*result );
+   }
+
+   {
+      test_ = label + " - Subtraction assignment of A*(B*C)";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  -= A * ( B * C );
+      tdres -= A * ( B * C );
+
+      checkResult( dres , 0*result );
+      checkResult( tdres, 0*result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void ChainTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix.
+//
+// \param mat The dense matrix to be initialized.
+// \return void
+//
+// This function initializes the given dense matrix with small, deterministic integral values.
+*/
+template< typename MT >  // Type of the dense matrix
+void ChainTest::initialize( MT& mat )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = static_cast<int>( ( i*7UL + j*3UL + mat.rows() ) % 11UL ) - 5;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the evaluation of dense matrix/dense matrix multiplication chains.
+//
+// \return void
+*/
+void runTest()
+{
+   ChainTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix/dense matrix multiplication chain test.
+*/
+#define RUN_DMATDMATMULT_CHAIN_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,429 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/SymmetricProductTest.h
+//  \brief Header file for the dense matrix/dense matrix multiplication symmetric product test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_SYMMETRICPRODUCTTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_SYMMETRICPRODUCTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense matrix/dense matrix multiplication symmetric product test.
+//
+// This class represents a test suite for the symmetric rank-k update kernel (see the smmm()
+// function) that is used for products of a dense matrix with its own transpose. It performs
+// a series of runtime tests of the products \f$ X*X^T \f$ and \f$ X^T*X \f$ of row-major and
+// column-major matrices, of submatrices, and of scaled products. The dimensions are chosen
+// such that the large multiplication kernels are selected.
+*/
+class SymmetricProductTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DMat;   //!< Row-major dense matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  TDMat;  //!< Column-major dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SymmetricProductTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testProduct( size_t m, size_t n );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void testOperation( const std::string& label, const MT1& A, const MT2& B, const MT3& result );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& mat );
+
+   template< typename MT1, typename MT2 >
+   const DMat reference( const MT1& A, const MT2& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the products of a dense matrix with its own transpose.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the products \f$ X*X^T \f$ and \f$ X^T*X \f$ of a \f$ m \times n \f$
+// matrix \f$ X \f$, the according products of a submatrix of \f$ X \f$, the product of two
+// different submatrices of \f$ X \f$ with the same spacing, and the scaled products. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the matrix
+void SymmetricProductTest::testProduct( size_t m, size_t n )
+{
+   typedef blaze::DynamicMatrix<double,SO>  MT;
+
+   MT X( m, n );
+   initialize( X );
+
+   std::ostringstream oss;
+   oss << ( SO ? "TDMat" : "DMat" ) << " (" << m << "x" << n << ")";
+   const std::string label( oss.str() );
+
+
+   //=====================================================================================
+   // Products of the full matrix
+   //=====================================================================================
+
+   testOperation( label + " - X*trans(X)", X, trans( X ), reference( X, trans( X ) ) );
+   testOperation( label + " - trans(X)*X", trans( X ), X, reference( trans( X ), X ) );
+
+
+   //=====================================================================================
+   // Products of submatrices
+   //=====================================================================================
+
+   {
+      const size_t mm( m - 3UL );
+      const size_t nn( n - 5UL );
+
+      const MT Y( submatrix( X, 2UL, 3UL, mm, nn ) );
+
+      testOperation( label + " - S*trans(S) with S=submatrix(X)",
+                     submatrix( X, 2UL, 3UL, mm, nn ), trans( submatrix( X, 2UL, 3UL, mm, nn ) ),
+                     reference( Y, trans( Y ) ) );
+      testOperation( label + " - trans(S)*S with S=submatrix(X)",
+                     trans( submatrix( X, 2UL, 3UL, mm, nn ) ), submatrix( X, 2UL, 3UL, mm, nn ),
+                     reference( trans( Y ), Y ) );
+   }
+
+   {
+      const size_t mm( m - 1UL );
+
+      const MT Y( submatrix( X, 0UL, 0UL, mm, n ) );
+      const MT Z( submatrix( X, 1UL, 0UL, mm, n ) );
+
+      testOperation( label + " - S*trans(T) with overlapping submatrices S and T of X",
+                     submatrix( X, 0UL, 0UL, mm, n ), trans( submatrix( X, 1UL, 0UL, mm, n ) ),
+                     reference( Y, trans( Z ) ) );
+   }
+
+
+   //=====================================================================================
+   // Scaled products
+   //=====================================================================================
+
+   {
+      test_ = label + " - Scaled products";
+
+      const DMat result( reference( X, trans( X ) ) );
+      const DMat tresult( reference( trans( X ), X ) );
+
+      DMat dres;
+      TDMat tdres;
+
+      dres  = 2.0 * X * trans( X );
+      tdres = 2.0 * X * trans( X );
+
+      checkResult( dres , 2.0*result );
+      checkResult( tdres, 2.0*result );
+
+      dres  = ( trans( X ) * X ) * 2.0;
+      tdres = ( trans( X ) * X ) * 2.0;
+
+      checkResult( dres , 2.0*tresult );
+      checkResult( tdres, 2.0*tresult );
+
+      dres  = ( X * trans( X ) ) / 0.5;
+      tdres = ( X * trans( X ) ) / 0.5;
+
+      checkResult( dres , 2.0*result );
+      checkResult( tdres, 2.0*result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the assignments of a single dense matrix/dense matrix multiplication.
+//
+// \param label The label of the test case.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param result The expected result of the multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// product \f$ A*B \f$ to both a row-major and a column-major dense matrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2    // Type of the right-hand side matrix operand
+        , typename MT3 >  // Type of the expected result
+void SymmetricProductTest::testOperation( const std::string& label, const MT1& A, const MT2& B,
+                                          const MT3& result )
+{
+   {
+      test_ = label + " - Assignment";
+
+      DMat dres;
+      TDMat tdres;
+
+      dres  = A * B;
+      tdres = A * B;
+
+      checkResult( dres , result );
+      checkResult( tdres, result );
+   }
+
+   {
+      test_ = label + " - Addition assignment";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  += A * B;
+      tdres += A * B;
+
+      checkResult( dres , 2.0*result );
+      checkResult( tdres, 2.0*result );
+   }
+
+   {
+      test_ = label + " - Subtraction assignment";
+
+      DMat dres( result );
+      TDMat tdres( result );
+
+      dres  -= A * B;
+      tdres -= A * B;
+
+      checkResult( dres , 0.0*result );
+      checkResult( tdres, 0.0*result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// Since all matrices are initialized with small integral values, the computed and the expected
+// result have to match exactly. In case they differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void SymmetricProductTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix.
+//
+// \param mat The dense matrix to be initialized.
+// \return void
+//
+// This function initializes the given dense matrix with small, deterministic integral values.
+*/
+template< typename MT >  // Type of the dense matrix
+void SymmetricProductTest::initialize( MT& mat )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = static_cast<double>( static_cast<int>( ( i*7UL + j*3UL + i*j ) % 11UL ) - 5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Elementwise computation of the reference result of a matrix multiplication.
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return The product \f$ A*B \f$.
+//
+// This function computes the product of the two given matrices by means of a straightforward
+// triple loop, which does not make use of any of the multiplication kernels.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+const SymmetricProductTest::DMat SymmetricProductTest::reference( const MT1& A, const MT2& B )
+{
+   DMat C( A.rows(), B.columns(), 0.0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         for( size_t k=0UL; k<A.columns(); ++k ) {
+            C(i,j) += A(i,k) * B(k,j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix/dense matrix multiplication of symmetric products.
+//
+// \return void
+*/
+void runTest()
+{
+   SymmetricProductTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix/dense matrix multiplication symmetric
+//        product test.
+*/
+#define RUN_DMATDMATMULT_SYMMETRICPRODUCT_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -125,6 +125,9 @@ class ClassTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkElements( const Type& matrix, const typename Type::ElementType& value ) const;
    //@}
    //**********************************************************************************************
 
@@ -506,6 +509,54 @@ void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expected
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking all elements including the padding elements of the given dynamic matrix.
+//
+// \param matrix The dynamic matrix to be checked.
+// \param value The expected value of all matrix elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all elements of the given dynamic matrix are equal to the given
+// value and that all padding elements (i.e. the elements between the end of a row/column and
+// the beginning of the next row/column) are default initialized. In case an element does not
+// correspond to the expected value, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dynamic matrix
+void ClassTest::checkElements( const Type& matrix, const typename Type::ElementType& value ) const
+{
+   typedef typename Type::ElementType  ET;
+
+   const bool   rowMajor( blaze::IsRowMajorMatrix<Type>::value );
+   const size_t m( rowMajor ? matrix.rows() : matrix.columns() );
+   const size_t n( rowMajor ? matrix.columns() : matrix.rows() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<matrix.spacing(); ++j )
+      {
+         const ET& element( matrix.data()[i*matrix.spacing()+j] );
+         const ET  expected( ( j < n )?( value ):( ET() ) );
+
+         if( element != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid " << ( j < n ? "matrix" : "padding" ) << " element detected in "
+                << ( rowMajor ? "row " : "column " ) << i << "\n"
+                << " Details:\n"
+                << "   Number of rows   : " << matrix.rows() << "\n"
+                << "   Number of columns: " << matrix.columns() << "\n"
+                << "   Spacing          : " << matrix.spacing() << "\n"
+                << "   Index            : " << j << "\n"
+                << "   Element          : " << element << "\n"
+                << "   Expected element : " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,184 @@
+//=================================================================================================
+/*!
+//  \file blazetest/blazetest/mathtest/smpsparse/OperationTest.h
+//  \brief Header file for the SMP sparse operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMPSPARSE_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_SMPSPARSE_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpsparse {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP assignments to sparse targets.
+//
+// This class represents a test suite for the thread-parallel sparse assignments and sparse
+// matrix/dense vector multiplications of the C++11/Boost thread backend. The test has to be
+// compiled with the Boost thread parallelization activated and executed with more than one
+// thread. All operands are larger than the according SMP thresholds and have very skewed row
+// (or column) lengths, such that the parts of the nonzero-balanced partitioning differ
+// significantly from an equal distribution of the rows (or columns). The results are compared
+// to straightforward reference implementations.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>      MT;   //!< Row-major sparse matrix type.
+   typedef blaze::CompressedMatrix<double,blaze::columnMajor>   TMT;  //!< Column-major sparse matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>         DMT;  //!< Dense reference matrix type.
+   typedef blaze::CompressedVector<double,blaze::columnVector>  SVT;  //!< Sparse vector type.
+   typedef blaze::DynamicVector<double,blaze::columnVector>     DVT;  //!< Dense vector type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testThreads();
+   void testPartition();
+   void testRowMajorAssign();
+   void testColumnMajorAssign();
+   void testVectorAssign();
+   void testRowMajorMatVecMult();
+   void testColumnMajorMatVecMult();
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& ref ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& ref ) const;
+
+   void checkNonZeros( size_t nonzeros, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initSkewed( MT& A, size_t n ) const;
+   void initSkewed( TMT& A, size_t n ) const;
+   void initIdentity( MT& A, size_t n ) const;
+   void initIdentity( TMT& A, size_t n ) const;
+   void initDense( DVT& v, size_t n ) const;
+   void initSparse( SVT& v, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignments to sparse targets.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse operation test.
+*/
+#define RUN_SMPSPARSE_OPERATION_TEST \
+   blazetest::mathtest::smpsparse::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpsparse
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,303 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/spgemmplan/ClassTest.h
+//  \brief Header file for the SpGEMMPlan class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+#ifndef _BLAZETEST_MATHTEST_SPGEMMPLAN_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SPGEMMPLAN_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace spgemmplan {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SpGEMMPlan class.
+//
+// This class represents a test suite for the blaze::SpGEMMPlan class and the plan-based sparse
+// matrix/sparse matrix multiplication. All products are checked against the according sparse
+// matrix multiplication expression.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  MT;   //!< Type of the row-major sparse matrices.
+   typedef blaze::CompressedMatrix<float,blaze::rowMajor>   FMT;  //!< Type of the single precision sparse matrices.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testMultiply    ();
+   void testReuse       ();
+   void testAliasing    ();
+   void testErrors      ();
+
+   template< typename Type1, typename Type2 >
+   void checkMatrix( const Type1& matrix, const Type2& expected ) const;
+
+   void checkPlan( const blaze::SpGEMMPlan& plan, const MT& expected, size_t products ) const;
+
+   template< typename Type >
+   void initialize( Type& matrix, size_t m, size_t n, size_t nonzeros ) const;
+
+   template< typename Type >
+   void randomize( Type& matrix ) const;
+
+   template< typename Type1, typename Type2 >
+   size_t countProducts( const Type1& A, const Type2& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given matrix against the given reference matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given matrix. In case a
+// difference is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the matrix
+        , typename Type2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const Type1& matrix, const Type2& expected ) const
+{
+   bool equal( matrix.rows() == expected.rows() && matrix.columns() == expected.columns() );
+
+   for( size_t i=0UL; equal && i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; equal && j<matrix.columns(); ++j ) {
+         if( matrix(i,j) != expected(i,j) )
+            equal = false;
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Rows         : " << matrix.rows() << " (expected " << expected.rows() << ")\n"
+          << "   Columns      : " << matrix.columns() << " (expected " << expected.columns() << ")\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix.
+//
+// \param matrix The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \return void
+//
+// The matrix is initialized with small random integral values in order to guarantee exact
+// results of all operations irrespective of the order of the floating point operations.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::initialize( Type& matrix, size_t m, size_t n, size_t nonzeros ) const
+{
+   typedef typename Type::ElementType  ET;
+
+   matrix.resize( m, n, false );
+   matrix.reset();
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   nonzeros = ( nonzeros < m*n )?( nonzeros ):( m*n );
+
+   while( matrix.nonZeros() < nonzeros ) {
+      matrix( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) =
+         static_cast<ET>( blaze::rand<int>( 1, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigning new random values to the non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+//
+// This function changes the values of all non-zero elements of the given matrix without
+// changing its sparsity pattern. Some of the new values are zero.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::randomize( Type& matrix ) const
+{
+   typedef typename Type::ElementType  ET;
+   typedef typename Type::Iterator     Iterator;
+
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( Iterator element=matrix.begin(i); element!=matrix.end(i); ++element ) {
+         element->value() = static_cast<ET>( blaze::rand<int>( -4, 4 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counting the number of scalar products of the sparse matrix multiplication.
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \return The number of scalar products of the multiplication \f$ A*B \f$.
+*/
+template< typename Type1    // Type of the left-hand side matrix
+        , typename Type2 >  // Type of the right-hand side matrix
+size_t ClassTest::countProducts( const Type1& A, const Type2& B ) const
+{
+   typedef typename Type1::ConstIterator  ConstIterator;
+
+   size_t products( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         products += B.nonZeros( element->index() );
+      }
+   }
+
+   return products;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SpGEMMPlan class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SpGEMMPlan class test.
+*/
+#define RUN_SPGEMMPLAN_CLASS_TEST \
+   blazetest::mathtest::spgemmplan::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace spgemmplan
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
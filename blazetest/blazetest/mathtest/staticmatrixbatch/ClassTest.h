@@ -0,0 +1,336 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/staticmatrixbatch/ClassTest.h
+//  \brief Header file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/StaticVectorBatch.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the StaticMatrixBatch class template.
+//
+// This class represents a test suite for the blaze::StaticMatrixBatch and the
+// blaze::StaticVectorBatch class templates. It performs a series of both compile time as well
+// as runtime tests. All batch operations are checked member by member against the according
+// operations on StaticMatrix and StaticVector.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::StaticMatrixBatch<double,3UL,3UL>                  MB;   //!< Type of the 3x3 matrix batch.
+   typedef blaze::StaticMatrixBatch<double,2UL,3UL>                  RMB;  //!< Type of the 2x3 matrix batch.
+   typedef blaze::StaticVectorBatch<double,3UL,blaze::columnVector>  VB;   //!< Type of the column vector batch.
+   typedef blaze::StaticVectorBatch<double,3UL,blaze::rowVector>     TVB;  //!< Type of the row vector batch.
+   typedef MB::MemberType                                            MT;   //!< Type of the 3x3 batch members.
+   typedef RMB::MemberType                                           RMT;  //!< Type of the 2x3 batch members.
+   typedef VB::MemberType                                            VT;   //!< Type of the vector batch members.
+   typedef TVB::MemberType                                           TVT;  //!< Type of the row vector batch members.
+
+   typedef std::vector< MT, blaze::AlignedAllocator<MT> >    MV;   //!< Reference members of the 3x3 matrix batch.
+   typedef std::vector< RMT, blaze::AlignedAllocator<RMT> >  RMV;  //!< Reference members of the 2x3 matrix batch.
+   typedef std::vector< VT, blaze::AlignedAllocator<VT> >    VV;   //!< Reference members of the column vector batch.
+   typedef std::vector< TVT, blaze::AlignedAllocator<TVT> >  TVV;  //!< Reference members of the row vector batch.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAddAssign   ();
+   void testSubAssign   ();
+   void testMultAssign  ();
+   void testScaling     ();
+   void testTranspose   ();
+   void testMatVecMult  ();
+   void testResize      ();
+   void testSubbatch    ();
+   void testSwap        ();
+
+   template< typename Type >
+   void checkSize( const Type& batch, size_t expectedSize ) const;
+
+   template< typename Type, typename Members >
+   void checkMembers( const Type& batch, const Members& expected ) const;
+
+   template< typename Type, typename Members >
+   void initialize( Type& batch, Members& members, size_t n ) const;
+
+   template< typename Type, size_t M, size_t N, bool SO >
+   void randomize( blaze::StaticMatrix<Type,M,N,SO>& m ) const;
+
+   template< typename Type, size_t N, bool TF >
+   void randomize( blaze::StaticVector<Type,N,TF>& v ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MB, MB::ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( VB, VB::ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( TVB, TVB::ResultType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of members of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of members of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of members of the given batch. In case the actual size
+// does not correspond to the given expected size, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Type of the batch
+void ClassTest::checkSize( const Type& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Size         : " << batch.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the members of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expected The expected batch members.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares all members of the given batch to the given expected members. In
+// case a difference is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type       // Type of the batch
+        , typename Members >  // Type of the expected members
+void ClassTest::checkMembers( const Type& batch, const Members& expected ) const
+{
+   checkSize( batch, expected.size() );
+
+   for( size_t k=0UL; k<expected.size(); ++k )
+   {
+      if( batch.get( k ) != expected[k] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch member detected\n"
+             << " Details:\n"
+             << "   Batch size   : " << batch.size() << "\n"
+             << "   Member index : " << k << "\n"
+             << "   Result:\n" << batch.get( k ) << "\n"
+             << "   Expected result:\n" << expected[k] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given batch and the according reference members.
+//
+// \param batch The batch to be initialized.
+// \param members The according reference members.
+// \param n The number of batch members.
+// \return void
+//
+// The batch members are initialized with small random integral values in order to guarantee
+// exact results of all batch operations irrespective of the order of the floating point
+// operations.
+*/
+template< typename Type       // Type of the batch
+        , typename Members >  // Type of the reference members
+void ClassTest::initialize( Type& batch, Members& members, size_t n ) const
+{
+   batch.resize( n, false );
+   members.resize( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      randomize( members[k] );
+      batch.set( k, members[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small random integral values.
+//
+// \param m The matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+void ClassTest::randomize( blaze::StaticMatrix<Type,M,N,SO>& m ) const
+{
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         m(i,j) = static_cast<Type>( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small random integral values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , size_t N       // Number of elements
+        , bool TF >      // Transpose flag
+void ClassTest::randomize( blaze::StaticVector<Type,N,TF>& v ) const
+{
+   for( size_t i=0UL; i<N; ++i )
+      v[i] = static_cast<Type>( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the StaticMatrixBatch class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the StaticMatrixBatch class test.
+*/
+#define RUN_STATICMATRIXBATCH_CLASS_TEST \
+   blazetest::mathtest::staticmatrixbatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/threadbackend/ClassTest.h
+//  \brief Header file for the thread backend test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_THREADBACKEND_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_THREADBACKEND_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace threadbackend {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the C++11/Boost thread backend.
+//
+// This class represents the collection of tests for the task groups of the thread backend. It
+// checks that the wait() function only waits for the tasks of the calling thread, that several
+// threads can perform SMP assignments at the same time, that the exception of a failing task is
+// rethrown by the wait() function, that tasks of the thread pool can themselves schedule
+// tasks and wait for them, and that the worker threads are marked as busy while executing a
+// task. The test has to be compiled with the Boost thread parallelization activated.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::TheThreadBackend                           Backend;  //!< Type of the tested thread backend.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      MT;       //!< Row-major dense matrix type.
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;       //!< Dense column vector type.
+   //**********************************************************************************************
+
+   //**Caller class********************************************************************************
+   /*!\brief Functor for a user thread using the thread backend.
+   */
+   struct Caller
+   {
+      //*******************************************************************************************
+      /*!\brief Constructor for the Caller functor.
+      //
+      // \param A The matrix operand of the matrix/vector multiplication.
+      // \param x The vector operand of the matrix/vector multiplication.
+      // \param ref The reference result of the matrix/vector multiplication.
+      // \param error The container for the error message of the thread.
+      */
+      inline Caller( const MT& A, const VT& x, const VT& ref, std::string& error )
+         : A_    ( &A     )  // The matrix operand of the matrix/vector multiplication
+         , x_    ( &x     )  // The vector operand of the matrix/vector multiplication
+         , ref_  ( &ref   )  // The reference result of the matrix/vector multiplication
+         , error_( &error )  // The container for the error message of the thread
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Repeatedly schedules tasks and SMP assignments and checks their completion.
+      //
+      // \return void
+      */
+      void operator()() const;
+      //*******************************************************************************************
+
+      const MT*    A_;      //!< The matrix operand of the matrix/vector multiplication.
+      const VT*    x_;      //!< The vector operand of the matrix/vector multiplication.
+      const VT*    ref_;    //!< The reference result of the matrix/vector multiplication.
+      std::string* error_;  //!< The container for the error message of the thread.
+   };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testWait();
+   void testConcurrentCallers();
+   void testException();
+   void testNestedWait();
+   void testTaskActivity();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void block    ( boost::atomic<size_t>* started, const boost::atomic<bool>* release,
+                          boost::atomic<size_t>* finished );
+   static void increment( boost::atomic<size_t>* count );
+   static void fail     ( boost::atomic<size_t>* count );
+   static void fork     ( boost::atomic<size_t>* count, size_t n );
+
+   static void checkActivity        ( boost::thread::id caller, boost::atomic<size_t>* errors,
+                                      boost::atomic<size_t>* finished );
+   static void checkDetachedActivity( boost::atomic<size_t>* errors,
+                                      boost::atomic<size_t>* finished );
+
+   void checkCount( const boost::atomic<size_t>& count, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the thread backend.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the thread backend class test.
+*/
+#define RUN_THREADBACKEND_CLASS_TEST \
+   blazetest::mathtest::threadbackend::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadbackend
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
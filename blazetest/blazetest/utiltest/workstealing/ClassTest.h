@@ -0,0 +1,217 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/workstealing/ClassTest.h
+//  \brief Header file for the work-stealing deque and pool test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_WORKSTEALING_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_WORKSTEALING_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealing {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the WorkStealingDeque and WorkStealingPool class templates.
+//
+// This class represents the collection of tests for the lock-free WorkStealingDeque and the
+// WorkStealingPool class templates. Both class templates are tested with Boost threads. The
+// concurrent tests check that no task is lost or executed (or stolen) more than once.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::threadpool::Task                              Task;   //!< Type of a single task.
+   typedef blaze::threadpool::WorkStealingDeque<boost::atomic>  Deque;  //!< Type of the tested deque.
+
+   //! Type of the tested work-stealing pool.
+   typedef blaze::WorkStealingPool< boost::thread
+                                  , boost::mutex
+                                  , boost::unique_lock< boost::mutex >
+                                  , boost::condition_variable
+                                  , boost::atomic >  Pool;
+   //**********************************************************************************************
+
+   //**Thief class*********************************************************************************
+   /*!\brief Functor for a thread stealing tasks from a deque.
+   */
+   struct Thief
+   {
+      //*******************************************************************************************
+      /*!\brief Constructor for the Thief functor.
+      //
+      // \param deque The deque to steal from.
+      // \param done The flag indicating that the owner stopped pushing tasks.
+      // \param stolen The container for the stolen tasks.
+      */
+      inline Thief( Deque& deque, const boost::atomic<bool>& done, std::vector<Task*>& stolen )
+         : deque_ ( &deque  )  // The deque to steal from
+         , done_  ( &done   )  // The flag indicating that the owner stopped pushing tasks
+         , stolen_( &stolen )  // The container for the stolen tasks
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Stealing tasks until the owner is done and the deque is empty.
+      //
+      // \return void
+      */
+      void operator()() const {
+         while( !done_->load() || !deque_->isEmpty() ) {
+            Task* task( deque_->steal() );
+            if( task != NULL ) stolen_->push_back( task );
+         }
+      }
+      //*******************************************************************************************
+
+      Deque*                     deque_;   //!< The deque to steal from.
+      const boost::atomic<bool>* done_;    //!< The flag indicating that the owner stopped pushing.
+      std::vector<Task*>*        stolen_;  //!< The container for the stolen tasks.
+   };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDequePushPop();
+   void testDequeSteal();
+   void testDequeConcurrentSteal();
+   void testPoolSchedule();
+   void testPoolForkJoin();
+   void testPoolResize();
+   void testPoolShutdown();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void record   ( std::vector<size_t>* ids, size_t id );
+   static void increment( std::vector<size_t>* counts, boost::atomic<size_t>* total, size_t id );
+
+   void checkOrder ( const std::vector<size_t>& ids, const std::vector<size_t>& expected ) const;
+   void checkCounts( const std::vector<size_t>& counts, const boost::atomic<size_t>& total ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the WorkStealingDeque and WorkStealingPool class templates.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the work-stealing class test.
+*/
+#define RUN_WORKSTEALING_CLASS_TEST \
+   blazetest::utiltest::workstealing::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace workstealing
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,504 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/asyncassign/OperationTest.cpp
+//  \brief Source file for the asynchronous assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/asyncassign/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace asyncassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the asynchronous assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testDefaultFuture();
+   testVectorAssign();
+   testMatrixAssign();
+   testChaining();
+   testErrorForwarding();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a default constructed Future.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a default constructed Future is ready and that waiting for it
+// returns immediately. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testDefaultFuture()
+{
+   test_ = "Default constructed Future";
+
+   const blaze::Future future = blaze::Future();
+
+   checkReady( future );
+   future.wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignments to a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment, addition assignment, and subtraction
+// assignment of a dense vector addition to a dense vector. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testVectorAssign()
+{
+   const size_t n( 50000UL );
+
+   VT a, b;
+   init( a, n, 0UL );
+   init( b, n, 3UL );
+
+   VT ref( a + b );
+   VT c;
+
+   {
+      test_ = "Asynchronous dense vector assignment";
+
+      const blaze::Future future( asyncAssign( c, a + b ) );
+      future.wait();
+
+      checkReady ( future );
+      checkVector( c, ref );
+   }
+
+   {
+      test_ = "Asynchronous dense vector addition assignment";
+
+      const blaze::Future future( asyncAddAssign( c, a + b ) );
+      future.wait();
+
+      ref *= 2.0;
+      checkReady ( future );
+      checkVector( c, ref );
+   }
+
+   {
+      test_ = "Asynchronous dense vector subtraction assignment";
+
+      const blaze::Future future( asyncSubAssign( c, a + b ) );
+      future.wait();
+
+      ref /= 2.0;
+      checkReady ( future );
+      checkVector( c, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignments to a dense matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment, addition assignment, and subtraction
+// assignment of a dense matrix addition to a dense matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMatrixAssign()
+{
+   const size_t n( 300UL );
+
+   MT A, B;
+   init( A, n, 0UL );
+   init( B, n, 3UL );
+
+   MT ref( A + B );
+   MT C;
+
+   {
+      test_ = "Asynchronous dense matrix assignment";
+
+      const blaze::Future future( asyncAssign( C, A + B ) );
+      future.wait();
+
+      checkReady ( future );
+      checkMatrix( C, ref );
+   }
+
+   {
+      test_ = "Asynchronous dense matrix addition assignment";
+
+      const blaze::Future future( asyncAddAssign( C, A + B ) );
+      future.wait();
+
+      ref *= 2.0;
+      checkReady ( future );
+      checkMatrix( C, ref );
+   }
+
+   {
+      test_ = "Asynchronous dense matrix subtraction assignment";
+
+      const blaze::Future future( asyncSubAssign( C, A + B ) );
+      future.wait();
+
+      ref /= 2.0;
+      checkReady ( future );
+      checkMatrix( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of chained asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a chain of asynchronous assignments, in which every assignment reads
+// the target of the preceding assignment. Additionally, several independent chains are
+// started at the same time. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testChaining()
+{
+   test_ = "Chained asynchronous assignments";
+
+   const size_t n( 50000UL );
+
+   VT a, b;
+   init( a, n, 0UL );
+   init( b, n, 3UL );
+
+   VT ref( 2.0*( a + b ) + a - b );
+
+   const size_t chains( 4UL );
+
+   std::vector<VT> c( chains ), d( chains );
+   std::vector<blaze::Future> futures( chains );
+
+   for( size_t i=0UL; i<chains; ++i ) {
+      const blaze::Future f1( asyncAssign   ( c[i], a + b           ) );
+      const blaze::Future f2( asyncAssign   ( d[i], c[i] * 2.0, f1 ) );
+      const blaze::Future f3( asyncAddAssign( d[i], a,          f2 ) );
+      futures[i] = asyncSubAssign( d[i], b, f3 );
+   }
+
+   for( size_t i=0UL; i<chains; ++i ) {
+      futures[i].wait();
+      checkReady ( futures[i] );
+      checkVector( d[i], ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the forwarding of exceptions along a chain of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts an asynchronous assignment that fails with an exception (an assignment
+// of a vector of invalid size to a fixed-size vector) and a chain of assignments depending on
+// it. Waiting for any of the assignments has to rethrow the exception, and the assignments
+// depending on the failed assignment must not be performed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testErrorForwarding()
+{
+   test_ = "Exception forwarding along a chain of asynchronous assignments";
+
+   const size_t n( 50000UL );
+
+   VT a;
+   init( a, n, 0UL );
+
+   SVT s( 1.0, 2.0, 3.0 );
+   VT d( n, 1.0 );
+
+   const blaze::Future f1( asyncAssign   ( s, a        ) );
+   const blaze::Future f2( asyncAssign   ( d, a,    f1 ) );
+   const blaze::Future f3( asyncAddAssign( d, a*s[0], f2 ) );
+
+   const blaze::Future futures[] = { f3, f2, f1 };
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      bool caught( false );
+
+      try {
+         futures[i].wait();
+      }
+      catch( std::invalid_argument& ) {
+         caught = true;
+      }
+
+      if( !caught ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exception of the failed assignment not rethrown\n"
+             << " Details:\n"
+             << "   Assignment = " << 3UL-i << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkReady( futures[i] );
+   }
+
+   checkVector( s, SVT( 1.0, 2.0, 3.0 ) );
+   checkVector( d, VT( n, 1.0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given Future is ready.
+//
+// \param future The Future to be checked.
+// \return void
+// \exception std::runtime_error Future not ready.
+*/
+void OperationTest::checkReady( const blaze::Future& future ) const
+{
+   if( !future.isReady() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Future not ready after waiting\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result vector.
+//
+// \param result The computed result vector.
+// \param ref The reference result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result vector element by element with the reference
+// result. Since all operands hold small integral values, the results have to match exactly.
+// In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the computed result vector
+        , typename VT2 >  // Type of the reference result vector
+void OperationTest::checkVector( const VT1& result, const VT2& ref ) const
+{
+   if( result.size() != ref.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size\n"
+          << " Details:\n"
+          << "   Result   = " << result.size() << "\n"
+          << "   Expected = " << ref.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.size(); ++i ) {
+      if( result[i] != ref[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Index    = " << i << "\n"
+             << "   Result   = " << result[i] << "\n"
+             << "   Expected = " << ref[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result matrix.
+//
+// \param result The computed result matrix.
+// \param ref The reference result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result matrix element by element with the reference
+// result. Since all operands hold small integral values, the results have to match exactly.
+// In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the computed result matrix
+        , typename MT2 >  // Type of the reference result matrix
+void OperationTest::checkMatrix( const MT1& result, const MT2& ref ) const
+{
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix dimensions\n"
+          << " Details:\n"
+          << "   Result   = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected = " << ref.rows() << "x" << ref.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( result(i,j) != ref(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   Element  = (" << i << "," << j << ")\n"
+                << "   Result   = " << result(i,j) << "\n"
+                << "   Expected = " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \param n The size of the vector.
+// \param offset The offset of the values.
+// \return void
+*/
+void OperationTest::init( VT& v, size_t n, size_t offset ) const
+{
+   v.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      v[i] = static_cast<double>( ( i + offset ) % 7UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a square dense matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \param offset The offset of the values.
+// \return void
+*/
+void OperationTest::init( MT& A, size_t n, size_t offset ) const
+{
+   A.resize( n, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = static_cast<double>( ( i + j + offset ) % 7UL );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace asyncassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment test..." << std::endl;
+
+   try
+   {
+      RUN_ASYNCASSIGN_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
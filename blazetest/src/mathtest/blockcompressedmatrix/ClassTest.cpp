@@ -0,0 +1,714 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/Views.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAssembly();
+   testLookup();
+   testMatVecMult();
+   testMatMatMult();
+   testReset();
+   testSwap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkMatrix( mat, RMT() );
+      checkBlocks( mat, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "BlockCompressedMatrix size constructor";
+
+      MT mat( 12UL, 9UL );
+
+      checkMatrix( mat, RMT( 12UL, 9UL ) );
+      checkBlocks( mat, 0UL );
+   }
+
+   // Size constructor (invalid size)
+   {
+      test_ = "BlockCompressedMatrix size constructor (invalid size)";
+
+      try {
+         MT mat( 12UL, 10UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of matrix with invalid number of columns succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Conversion constructor (CompressedMatrix)
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (CompressedMatrix)";
+
+      for( size_t m=0UL; m<=30UL; m+=6UL ) {
+         RMT ref;
+         initialize( ref, m, 18UL, m*4UL );
+
+         MT mat( ref );
+
+         checkMatrix( mat, ref );
+         checkBlocks( mat, countBlocks( ref, 3UL ) );
+
+         MT6 mat6( ref );
+
+         checkMatrix( mat6, ref );
+         checkBlocks( mat6, countBlocks( ref, 6UL ) );
+      }
+   }
+
+   // Conversion constructor (column-major CompressedMatrix)
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      RMT ref;
+      initialize( ref, 66UL, 126UL, 1000UL );
+
+      const RMT::OppositeType tmp( ref );
+      MT mat( tmp );
+
+      checkMatrix( mat, ref );
+      checkBlocks( mat, countBlocks( ref, 3UL ) );
+   }
+
+   // Conversion constructor (DynamicMatrix)
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (DynamicMatrix)";
+
+      RMT ref;
+      initialize( ref, 30UL, 12UL, 50UL );
+
+      const DMT tmp( ref );
+      MT mat( tmp );
+
+      checkMatrix( mat, ref );
+      checkBlocks( mat, countBlocks( ref, 3UL ) );
+   }
+
+   // Conversion to CompressedMatrix
+   {
+      test_ = "BlockCompressedMatrix conversion to CompressedMatrix";
+
+      RMT ref;
+      initialize( ref, 63UL, 45UL, 300UL );
+
+      const MT mat( ref );
+      const RMT conv( mat );
+      const RMT::OppositeType tconv( mat );
+
+      checkMatrix( conv , ref );
+      checkMatrix( tconv, ref );
+   }
+
+   // Copy constructor
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      RMT ref;
+      initialize( ref, 66UL, 126UL, 2000UL );
+
+      MT mat1( ref );
+      MT mat2( mat1 );
+
+      checkMatrix( mat2, ref );
+      checkBlocks( mat2, mat1.nonZeroBlocks() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   // Copy assignment
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      RMT ref;
+      initialize( ref, 39UL, 30UL, 300UL );
+
+      MT mat1( ref );
+      MT mat2( 3UL, 3UL );
+      mat2 = mat1;
+
+      checkMatrix( mat2, ref );
+   }
+
+   // Matrix assignment
+   {
+      test_ = "BlockCompressedMatrix matrix assignment";
+
+      RMT ref1, ref2;
+      initialize( ref1, 39UL, 30UL, 300UL );
+      initialize( ref2, 39UL, 30UL, 300UL );
+
+      MT mat;
+      mat = ref1;
+      checkMatrix( mat, ref1 );
+
+      mat = ref1 + ref2;
+      checkMatrix( mat, RMT( ref1 + ref2 ) );
+   }
+
+   // Self assignment
+   {
+      test_ = "BlockCompressedMatrix self assignment";
+
+      RMT ref;
+      initialize( ref, 21UL, 18UL, 100UL );
+
+      MT mat( ref );
+      const MT& alias( mat );
+      mat = alias;
+
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block-wise assembly of a BlockCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the appendBlock(), finalize(), insertBlock(), and addBlock()
+// functions of the BlockCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssembly()
+{
+   typedef blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>  BT;
+
+   BT block1, block2;
+   for( size_t i=0UL; i<3UL; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         block1(i,j) = static_cast<double>( i*3UL+j+1UL );
+         block2(i,j) = static_cast<double>( 10UL*(i+1UL) );
+      }
+   }
+
+   // Appending blocks
+   {
+      test_ = "BlockCompressedMatrix::appendBlock()";
+
+      MT mat( 9UL, 12UL, 4UL );
+      mat.appendBlock( 0UL, 1UL, block1 );
+      mat.appendBlock( 0UL, 3UL, block2 );
+      mat.finalize( 0UL );
+      mat.finalize( 1UL );
+      mat.appendBlock( 2UL, 0UL, block2 );
+      mat.appendBlock( 2UL, 2UL, block1 );
+      mat.finalize( 2UL );
+
+      DMT ref( 9UL, 12UL, 0.0 );
+      submatrix( ref, 0UL, 3UL, 3UL, 3UL ) = block1;
+      submatrix( ref, 0UL, 9UL, 3UL, 3UL ) = block2;
+      submatrix( ref, 6UL, 0UL, 3UL, 3UL ) = block2;
+      submatrix( ref, 6UL, 6UL, 3UL, 3UL ) = block1;
+
+      checkMatrix( mat, ref );
+      checkBlocks( mat, 4UL );
+
+      if( mat.nonZeroBlocks( 0UL ) != 2UL || mat.nonZeroBlocks( 1UL ) != 0UL ||
+          mat.nonZeroBlocks( 2UL ) != 2UL || mat.nonZeros( 3UL ) != 0UL || mat.nonZeros( 7UL ) != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of blocks per block row\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Inserting and adding blocks
+   {
+      test_ = "BlockCompressedMatrix::insertBlock() and BlockCompressedMatrix::addBlock()";
+
+      MT mat( 9UL, 9UL );
+      DMT ref( 9UL, 9UL, 0.0 );
+
+      mat.insertBlock( 1UL, 2UL, block1 );
+      submatrix( ref, 3UL, 6UL, 3UL, 3UL ) = block1;
+      mat.insertBlock( 1UL, 0UL, block2 );
+      submatrix( ref, 3UL, 0UL, 3UL, 3UL ) = block2;
+      mat.insertBlock( 0UL, 1UL, block1 );
+      submatrix( ref, 0UL, 3UL, 3UL, 3UL ) = block1;
+      mat.insertBlock( 2UL, 2UL, block2 );
+      submatrix( ref, 6UL, 6UL, 3UL, 3UL ) = block2;
+      mat.addBlock( 1UL, 2UL, block2 );
+      submatrix( ref, 3UL, 6UL, 3UL, 3UL ) += block2;
+      mat.addBlock( 1UL, 1UL, block1 );
+      submatrix( ref, 3UL, 3UL, 3UL, 3UL ) = block1;
+      mat.findBlock( 0UL, 1UL )->operator()( 2UL, 0UL ) = -1.0;
+      ref(2UL,3UL) = -1.0;
+
+      checkMatrix( mat, ref );
+      checkBlocks( mat, 5UL );
+
+      if( mat.findBlock( 0UL, 0UL ) != NULL || mat.findBlock( 2UL, 2UL ) == NULL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block lookup result\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.insertBlock( 1UL, 1UL, block1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing block succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() functions and
+// of the row iterators of the BlockCompressedMatrix class template. The results are compared
+// to a CompressedMatrix that explicitly stores all elements of the non-zero blocks. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "BlockCompressedMatrix lookup functions";
+
+   RMT tmp;
+   initialize( tmp, 36UL, 24UL, 100UL );
+
+   const MT mat( tmp );
+   const RMT ref( mat );
+
+   if( ref.nonZeros() != mat.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of stored elements\n"
+          << " Details:\n"
+          << "   Number of elements         : " << mat.nonZeros() << "\n"
+          << "   Expected number of elements: " << ref.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      // Iteration over the row
+      {
+         RMT::ConstIterator refIt( ref.begin(i) );
+         MT::ConstIterator it( mat.begin(i) );
+
+         for( ; it!=mat.end(i) && refIt!=ref.end(i); ++it, ++refIt ) {
+            if( it->index() != refIt->index() || it->value() != refIt->value() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid row element detected\n"
+                   << " Details:\n"
+                   << "   Row             : " << i << "\n"
+                   << "   Element         : (" << it->index() << "," << it->value() << ")\n"
+                   << "   Expected element: (" << refIt->index() << "," << refIt->value() << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( it != mat.end(i) || refIt != ref.end(i) ||
+             size_t( mat.end(i) - mat.begin(i) ) != ref.nonZeros(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of row elements detected\n"
+                << " Details:\n"
+                << "   Row                         : " << i << "\n"
+                << "   Number of elements          : " << ( mat.end(i) - mat.begin(i) ) << "\n"
+                << "   Expected number of elements : " << ref.nonZeros(i) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Lookup of all elements of the row
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const bool found( mat.find(i,j) != mat.end(i) );
+         const bool expectedFound( ref.find(i,j) != ref.end(i) );
+
+         const size_t lbound( mat.lowerBound(i,j) - mat.begin(i) );
+         const size_t ubound( mat.upperBound(i,j) - mat.begin(i) );
+         const size_t expectedLbound( ref.lowerBound(i,j) - ref.begin(i) );
+         const size_t expectedUbound( ref.upperBound(i,j) - ref.begin(i) );
+
+         if( found != expectedFound || lbound != expectedLbound || ubound != expectedUbound ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lookup result detected\n"
+                << " Details:\n"
+                << "   Element            : (" << i << "," << j << ")\n"
+                << "   Found              : " << found << " (expected " << expectedFound << ")\n"
+                << "   Lower bound offset : " << lbound << " (expected " << expectedLbound << ")\n"
+                << "   Upper bound offset : " << ubound << " (expected " << expectedUbound << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a BlockCompressedMatrix with a dense
+// column vector. All results are compared to the according products with a CompressedMatrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   // Multiplication with 3x3 blocks
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication (3x3 blocks)";
+
+      for( size_t m=0UL; m<=60UL; m+=15UL ) {
+         for( size_t n=0UL; n<=60UL; n+=30UL )
+         {
+            RMT ref;
+            initialize( ref, m, n, m*n/8UL );
+
+            VT x;
+            initialize( x, n );
+
+            const MT mat( ref );
+            const VT expected( ref * x );
+
+            VT y( m );
+
+            y = mat * x;
+            checkVector( y, expected );
+
+            y += mat * x;
+            checkVector( y, VT( 2.0 * expected ) );
+
+            y -= mat * x;
+            checkVector( y, expected );
+
+            y = 2.0 * ( mat * x );
+            checkVector( y, VT( 2.0 * expected ) );
+         }
+      }
+   }
+
+   // Multiplication with 6x6 blocks
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication (6x6 blocks)";
+
+      RMT ref;
+      initialize( ref, 96UL, 72UL, 500UL );
+
+      VT x;
+      initialize( x, 72UL );
+
+      const MT6 mat( ref );
+      const VT y( mat * x );
+
+      checkVector( y, VT( ref * x ) );
+   }
+
+   // Single precision multiplication
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication (single precision)";
+
+      FRMT ref;
+      initialize( ref, 64UL, 128UL, 800UL );
+
+      FVT x;
+      initialize( x, 128UL );
+
+      const FMT mat( ref );
+      const FVT y( mat * x );
+
+      checkVector( y, FVT( ref * x ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a BlockCompressedMatrix with row-major
+// and column-major dense matrices. All results are compared to the according products with a
+// CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatMatMult()
+{
+   // Multiplication with a row-major dense matrix
+   {
+      test_ = "BlockCompressedMatrix/row-major dense matrix multiplication";
+
+      for( size_t n=1UL; n<=17UL; n+=4UL )
+      {
+         RMT ref;
+         initialize( ref, 42UL, 30UL, 200UL );
+
+         DMT rhs;
+         initialize( rhs, 30UL, n, 30UL*n );
+
+         const MT mat( ref );
+         const DMT expected( ref * rhs );
+
+         DMT res( 42UL, n );
+
+         res = mat * rhs;
+         checkMatrix( res, expected );
+
+         res += mat * rhs;
+         checkMatrix( res, DMT( 2.0 * expected ) );
+
+         res -= mat * rhs;
+         checkMatrix( res, expected );
+      }
+   }
+
+   // Multiplication with a column-major dense matrix
+   {
+      test_ = "BlockCompressedMatrix/column-major dense matrix multiplication";
+
+      RMT ref;
+      initialize( ref, 36UL, 24UL, 150UL );
+
+      TDMT rhs;
+      initialize( rhs, 24UL, 7UL, 100UL );
+
+      const MT mat( ref );
+
+      DMT res( mat * rhs );
+      checkMatrix( res, DMT( ref * rhs ) );
+
+      TDMT tres( mat * rhs );
+      checkMatrix( tres, DMT( ref * rhs ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset() and clear() functions of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset() and clear() functions of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BlockCompressedMatrix::reset()";
+
+   RMT ref;
+   initialize( ref, 27UL, 15UL, 100UL );
+
+   MT mat( ref );
+
+   reset( mat );
+
+   checkMatrix( mat, RMT( 27UL, 15UL ) );
+   checkBlocks( mat, 0UL );
+
+   if( !isDefault( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: isDefault evaluation failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "BlockCompressedMatrix::clear()";
+
+   mat = ref;
+   clear( mat );
+
+   checkMatrix( mat, RMT() );
+   checkBlocks( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   RMT ref1, ref2;
+   initialize( ref1, 18UL, 9UL, 50UL );
+   initialize( ref2, 30UL, 42UL, 200UL );
+
+   MT mat1( ref1 ), mat2( ref2 );
+
+   swap( mat1, mat2 );
+
+   checkMatrix( mat1, ref2 );
+   checkMatrix( mat2, ref1 );
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
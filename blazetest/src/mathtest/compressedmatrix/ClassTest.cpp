@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/util/Complex.h>
@@ -85,12 +86,14 @@ ClassTest::ClassTest()
    testResize();
    testReserve();
    testTrim();
+   testAssemble();
    testTranspose();
    testSwap();
    testFind();
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -6807,6 +6810,76 @@ void ClassTest::testReserve()
       checkCapacity( mat,  2UL, 10UL );
    }
 
+   {
+      test_ = "Row-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      // Setting the capacities of all rows
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 1UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 2UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 3UL );
+      checkCapacity( mat, 0UL, 1UL );
+      checkCapacity( mat, 1UL, 0UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 0UL );
+
+      // Appending elements in arbitrary row order without finalization
+      mat.append( 2UL, 0UL, 3 );
+      mat.append( 0UL, 1UL, 1 );
+      mat.append( 2UL, 3UL, 4 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(2,0) != 3 || mat(0,1) != 1 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving the row capacities failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 3 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Increasing the capacity of the 1st row while preserving the current elements
+      nonzeros[1] = 2UL;
+
+      mat.reserve( nonzeros );
+      mat.append( 1UL, 3UL, 6 );
+
+      checkCapacity( mat, 5UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(2,0) != 3 || mat(0,1) != 1 || mat(2,3) != 4 || mat(1,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving the row capacities failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 6 )\n( 3 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -6879,6 +6952,76 @@ void ClassTest::testReserve()
       checkCapacity( mat,  1UL, 15UL );
       checkCapacity( mat,  2UL, 10UL );
    }
+
+   {
+      test_ = "Column-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+
+      // Setting the capacities of all columns
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 1UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 2UL;
+
+      mat.reserve( nonzeros );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkCapacity( mat, 0UL, 1UL );
+      checkCapacity( mat, 1UL, 0UL );
+      checkCapacity( mat, 2UL, 2UL );
+      checkNonZeros( mat, 0UL );
+
+      // Appending elements in arbitrary column order without finalization
+      mat.append( 0UL, 2UL, 3 );
+      mat.append( 1UL, 0UL, 1 );
+      mat.append( 3UL, 2UL, 4 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,2) != 3 || mat(1,0) != 1 || mat(3,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving the column capacities failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 3 )\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Increasing the capacity of the 1st column while preserving the current elements
+      nonzeros[1] = 2UL;
+
+      mat.reserve( nonzeros );
+      mat.append( 3UL, 1UL, 6 );
+
+      checkCapacity( mat, 5UL );
+      checkCapacity( mat, 1UL, 2UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,2) != 3 || mat(1,0) != 1 || mat(3,2) != 4 || mat(3,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving the column capacities failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 3 )\n( 1 0 0 )\n( 0 0 0 )\n( 0 6 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -7078,6 +7221,228 @@ void ClassTest::testTrim()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the triplet constructor and the \c assemble() member function of the
+//        CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the triplet constructor and the \c assemble() member function
+// of the CompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAssemble()
+{
+   const size_t rows   [] = { 2UL, 0UL, 2UL, 1UL, 2UL, 0UL };
+   const size_t columns[] = { 3UL, 1UL, 0UL, 2UL, 3UL, 1UL };
+   const int    values [] = { 1, 2, 3, 4, 5, 6 };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix triplet constructor (sum duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 6UL, rows, columns, values );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 8 || mat(1,2) != 4 || mat(2,0) != 3 || mat(2,3) != 6 ||
+          mat.begin(2UL)->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 8 0 0 )\n( 0 0 4 0 )\n( 3 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedMatrix::assemble() (overwrite duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(1,1) = 9;
+
+      mat.assemble( 6UL, rows, columns, values, blaze::overwriteDuplicates );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 6 || mat(1,2) != 4 || mat(2,0) != 3 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembling from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 6 0 0 )\n( 0 0 4 0 )\n( 3 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Trying to assemble an element outside the matrix
+      const size_t invalid[] = { 3UL };
+
+      try {
+         mat.assemble( 1UL, invalid, columns, values );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembling an invalid element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 6 0 0 )\n( 0 0 4 0 )\n( 3 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 4UL );
+   }
+
+   {
+      test_ = "Row-major CompressedMatrix::assemble() (large number of triplets)";
+
+      const size_t M( 301UL ), N( 257UL ), K( 120000UL );
+
+      std::vector<int> r( K ), c( K ), v( K );
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( M, N );
+
+      for( size_t k=0UL; k<K; ++k ) {
+         r[k] = blaze::rand<int>( 0, int(M)-1 );
+         c[k] = blaze::rand<int>( 0, int(N)-1 );
+         v[k] = blaze::rand<int>( 1, 9 );
+         ref(r[k],c[k]) += v[k];
+      }
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( M, N );
+      mat.assemble( K, &r[0], &c[0], &v[0] );
+
+      checkRows    ( mat, M );
+      checkColumns ( mat, N );
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembling from triplets failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix triplet constructor (sum duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL, 6UL, rows, columns, values );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat(0,1) != 8 || mat(1,2) != 4 || mat(2,0) != 3 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 8 0 0 )\n( 0 0 4 0 )\n( 3 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedMatrix::assemble() (overwrite duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(1,1) = 9;
+
+      mat.assemble( 6UL, rows, columns, values, blaze::overwriteDuplicates );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,1) != 6 || mat(1,2) != 4 || mat(2,0) != 3 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembling from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 6 0 0 )\n( 0 0 4 0 )\n( 3 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Trying to construct a matrix from an element outside the matrix
+      const size_t invalid[] = { 4UL };
+
+      try {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat2( 3UL, 4UL, 1UL, rows, invalid, values );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing from an invalid element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major CompressedMatrix::assemble() (large number of triplets)";
+
+      const size_t M( 257UL ), N( 301UL ), K( 120000UL );
+
+      std::vector<int> r( K ), c( K ), v( K );
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( M, N );
+
+      for( size_t k=0UL; k<K; ++k ) {
+         r[k] = blaze::rand<int>( 0, int(M)-1 );
+         c[k] = blaze::rand<int>( 0, int(N)-1 );
+         v[k] = blaze::rand<int>( 1, 9 );
+         ref(r[k],c[k]) = v[k];
+      }
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( M, N );
+      mat.assemble( K, &r[0], &c[0], &v[0], blaze::overwriteDuplicates );
+
+      checkRows    ( mat, M );
+      checkColumns ( mat, N );
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembling from triplets failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c transpose() member function of the CompressedMatrix class template.
 //
@@ -8540,6 +8905,190 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the index type of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of CompressedMatrix instances with a 32-bit index type. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   //=====================================================================================
+   // Element size tests
+   //=====================================================================================
+
+   {
+      test_ = "Size of the 32-bit index elements";
+
+      if( sizeof( blaze::ValueIndexPair<float,blaze::uint32_t> ) != 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element size\n"
+             << " Details:\n"
+             << "   Result:\n" << sizeof( blaze::ValueIndexPair<float,blaze::uint32_t> ) << "\n"
+             << "   Expected result:\n8\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix with 32-bit index type";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor,blaze::uint32_t>  MT;
+
+      MT mat( 3UL, 4UL );
+      mat(0,1) = 1;
+      mat(1,3) = 2;
+      mat(2,0) = 3;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat.begin(1UL)->index() != 3UL || mat(0,1) != 1 || mat(1,3) != 2 || mat(2,0) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 2 )\n( 3 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor,blaze::uint32_t> tmat( trans( mat ) );
+
+      checkRows    ( tmat, 4UL );
+      checkColumns ( tmat, 3UL );
+      checkNonZeros( tmat, 3UL );
+
+      if( tmat(1,0) != 1 || tmat(3,1) != 2 || tmat(0,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tmat << "\n"
+             << "   Expected result:\n( 0 0 3 )\n( 1 0 0 )\n( 0 0 0 )\n( 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat2( mat );
+
+      if( mat2 != mat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion to default index type failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( sizeof( size_t ) > sizeof( blaze::uint32_t ) )
+      {
+         const size_t n( static_cast<size_t>( blaze::uint32_t(-1) ) + 2UL );
+
+         try {
+            MT mat3( 2UL, n );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction with too many columns succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat3.rows() << "x" << mat3.columns() << " matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         try {
+            mat.resize( 2UL, n );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Resizing to too many columns succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat.rows() << "x" << mat.columns() << " matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix with 32-bit index type";
+
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor,blaze::uint32_t>  MT;
+
+      MT mat( 4UL, 3UL );
+      mat(1,0) = 1;
+      mat(3,1) = 2;
+      mat(0,2) = 3;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat.begin(1UL)->index() != 3UL || mat(1,0) != 1 || mat(3,1) != 2 || mat(0,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 3 )\n( 1 0 0 )\n( 0 0 0 )\n( 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( sizeof( size_t ) > sizeof( blaze::uint32_t ) )
+      {
+         const size_t m( static_cast<size_t>( blaze::uint32_t(-1) ) + 2UL );
+
+         try {
+            MT mat2( m, 2UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction with too many rows succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2.rows() << "x" << mat2.columns() << " matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         try {
+            mat.resize( m, 2UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Resizing to too many rows succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat.rows() << "x" << mat.columns() << " matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
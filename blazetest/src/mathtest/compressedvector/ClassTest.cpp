@@ -90,6 +90,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -2938,6 +2939,83 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the index type of the CompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of CompressedVector instances with a 32-bit index type. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "CompressedVector with 32-bit index type";
+
+   typedef blaze::CompressedVector<int,blaze::rowVector,blaze::uint32_t>  VT;
+
+   VT vec( 7UL );
+   vec[1] = 1;
+   vec[4] = 2;
+   vec[6] = 3;
+
+   checkSize    ( vec, 7UL );
+   checkNonZeros( vec, 3UL );
+
+   if( vec.begin()->index() != 1UL || vec[1] != 1 || vec[4] != 2 || vec[6] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting elements failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 0 1 0 0 2 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::CompressedVector<int,blaze::rowVector> vec2( vec );
+
+   if( vec2 != vec ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Conversion to default index type failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec2 << "\n"
+          << "   Expected result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( sizeof( size_t ) > sizeof( blaze::uint32_t ) )
+   {
+      const size_t n( static_cast<size_t>( blaze::uint32_t(-1) ) + 2UL );
+
+      try {
+         VT vec3( n );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with too many elements succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec3.size() << "-dimensional vector\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         vec.resize( n );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to too many elements succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec.size() << "-dimensional vector\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace compressedvector
 
 } // namespace mathtest
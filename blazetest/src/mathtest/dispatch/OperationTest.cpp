@@ -0,0 +1,595 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/dispatch/OperationTest.cpp
+//  \brief Source file for the runtime dispatch operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/dispatch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testInstructionSet();
+
+   testVectorKernels<float> ( 1E-4F );
+   testVectorKernels<double>( 1E-12 );
+
+   testMatVecKernels<float> ( 1E-3F );
+   testMatVecKernels<double>( 1E-10 );
+
+   testMatMatKernels<float> ( 1E-3F );
+   testMatMatKernels<double>( 1E-10 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the \c instructionSet() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the instruction set selected at program startup is valid and does
+// not change during the execution of the program. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testInstructionSet()
+{
+#if BLAZE_DISPATCH_MODE
+   test_ = "instructionSet()";
+
+   const blaze::InstructionSet is( blaze::instructionSet() );
+
+   if( is < blaze::sse2InstructionSet || is > blaze::avx512InstructionSet ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid instruction set selected\n"
+          << " Details:\n"
+          << "   Instruction set = " << is << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::instructionSet() != is ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Instruction set changed during the execution\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense vector kernels.
+//
+// \param accuracy The accepted absolute deviation from the reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched dense vector addition, subtraction, componentwise
+// multiplication, scaling, and inner product for vector sizes that are and are not a
+// multiple of the SIMD width. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Type of the vector elements
+void OperationTest::testVectorKernels( T accuracy )
+{
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   const size_t sizes[] = { 1000UL, 1003UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      VT a, b;
+      initRandom( a, n );
+      initRandom( b, n );
+
+      VT ref( n );
+
+      {
+         test_ = "Dense vector addition";
+
+         const VT c( a + b );
+         for( size_t i=0UL; i<n; ++i ) ref[i] = a[i] + b[i];
+         checkResult( c, ref, accuracy );
+      }
+
+      {
+         test_ = "Dense vector subtraction";
+
+         const VT c( a - b );
+         for( size_t i=0UL; i<n; ++i ) ref[i] = a[i] - b[i];
+         checkResult( c, ref, accuracy );
+      }
+
+      {
+         test_ = "Dense vector componentwise multiplication";
+
+         const VT c( a * b );
+         for( size_t i=0UL; i<n; ++i ) ref[i] = a[i] * b[i];
+         checkResult( c, ref, accuracy );
+      }
+
+      {
+         test_ = "Dense vector scaling";
+
+         const VT c( a * T(3) );
+         for( size_t i=0UL; i<n; ++i ) ref[i] = a[i] * T(3);
+         checkResult( c, ref, accuracy );
+      }
+
+      {
+         test_ = "Dense vector inner product";
+
+         const T result( trans( a ) * b );
+         T expected( 0 );
+         for( size_t i=0UL; i<n; ++i ) expected += a[i] * b[i];
+
+         if( std::fabs( result - expected ) > accuracy * T(n) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   Result   = " << result << "\n"
+                << "   Expected = " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix/dense vector multiplication kernels.
+//
+// \param accuracy The accepted absolute deviation from the reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched dense matrix/dense vector and dense vector/dense matrix
+// multiplications (including the addition and subtraction assignments) for row-major and
+// column-major matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Type of the matrix and vector elements
+void OperationTest::testMatVecKernels( T accuracy )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>        MT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>     OMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>    VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>       TVT;
+
+   const size_t m( 127UL );
+   const size_t n( 93UL );
+
+   MT A;
+   initRandom( A, m, n );
+   const OMT oA( A );
+
+   VT x, y0;
+   initRandom( x, n );
+   initRandom( y0, m );
+
+   TVT tx, ty0;
+   initRandom( tx, m );
+   initRandom( ty0, n );
+
+   VT ref( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      ref[i] = T(0);
+      for( size_t j=0UL; j<n; ++j )
+         ref[i] += A(i,j) * x[j];
+   }
+
+   TVT tref( n );
+   for( size_t j=0UL; j<n; ++j ) {
+      tref[j] = T(0);
+      for( size_t i=0UL; i<m; ++i )
+         tref[j] += tx[i] * A(i,j);
+   }
+
+   {
+      test_ = "Row-major dense matrix/dense vector multiplication";
+
+      VT y( A * x );
+      checkResult( y, ref, accuracy );
+
+      y = y0;
+      y += A * x;
+      checkResult( y, VT( y0 + ref ), accuracy );
+
+      y = y0;
+      y -= A * x;
+      checkResult( y, VT( y0 - ref ), accuracy );
+   }
+
+   {
+      test_ = "Column-major dense matrix/dense vector multiplication";
+
+      VT y( oA * x );
+      checkResult( y, ref, accuracy );
+
+      y = y0;
+      y += oA * x;
+      checkResult( y, VT( y0 + ref ), accuracy );
+
+      y = y0;
+      y -= oA * x;
+      checkResult( y, VT( y0 - ref ), accuracy );
+   }
+
+   {
+      test_ = "Dense vector/row-major dense matrix multiplication";
+
+      TVT y( tx * A );
+      checkResult( y, tref, accuracy );
+
+      y = ty0;
+      y += tx * A;
+      checkResult( y, TVT( ty0 + tref ), accuracy );
+
+      y = ty0;
+      y -= tx * A;
+      checkResult( y, TVT( ty0 - tref ), accuracy );
+   }
+
+   {
+      test_ = "Dense vector/column-major dense matrix multiplication";
+
+      TVT y( tx * oA );
+      checkResult( y, tref, accuracy );
+
+      y = ty0;
+      y += tx * oA;
+      checkResult( y, TVT( ty0 + tref ), accuracy );
+
+      y = ty0;
+      y -= tx * oA;
+      checkResult( y, TVT( ty0 - tref ), accuracy );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix/dense matrix multiplication kernel.
+//
+// \param accuracy The accepted absolute deviation from the reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched dense matrix/dense matrix multiplication (including the
+// addition and subtraction assignments) for all combinations of storage orders. The matrix
+// sizes are not a multiple of the register block of the packed kernel. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Type of the matrix elements
+void OperationTest::testMatMatKernels( T accuracy )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     MT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  OMT;
+
+   const size_t m( 151UL );
+   const size_t k( 173UL );
+   const size_t n( 131UL );
+
+   MT A, B, C0;
+   initRandom( A, m, k );
+   initRandom( B, k, n );
+   initRandom( C0, m, n );
+
+   const OMT oA( A );
+   const OMT oB( B );
+
+   MT ref( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         ref(i,j) = T(0);
+         for( size_t l=0UL; l<k; ++l )
+            ref(i,j) += A(i,l) * B(l,j);
+      }
+   }
+
+   const MT addRef( C0 + ref );
+   const MT subRef( C0 - ref );
+
+   {
+      test_ = "Row-major dense matrix/row-major dense matrix multiplication";
+
+      MT C( A * B );
+      checkResult( C, ref, accuracy );
+
+      C = C0;
+      C += A * B;
+      checkResult( C, addRef, accuracy );
+
+      C = C0;
+      C -= A * B;
+      checkResult( C, subRef, accuracy );
+   }
+
+   {
+      test_ = "Row-major dense matrix/column-major dense matrix multiplication";
+
+      MT C( A * oB );
+      checkResult( C, ref, accuracy );
+
+      C = C0;
+      C += A * oB;
+      checkResult( C, addRef, accuracy );
+
+      C = C0;
+      C -= A * oB;
+      checkResult( C, subRef, accuracy );
+   }
+
+   {
+      test_ = "Column-major dense matrix/row-major dense matrix multiplication";
+
+      OMT C( oA * B );
+      checkResult( C, ref, accuracy );
+
+      C = C0;
+      C += oA * B;
+      checkResult( C, addRef, accuracy );
+
+      C = C0;
+      C -= oA * B;
+      checkResult( C, subRef, accuracy );
+   }
+
+   {
+      test_ = "Column-major dense matrix/column-major dense matrix multiplication";
+
+      OMT C( oA * oB );
+      checkResult( C, ref, accuracy );
+
+      C = C0;
+      C += oA * oB;
+      checkResult( C, addRef, accuracy );
+
+      C = C0;
+      C -= oA * oB;
+      checkResult( C, subRef, accuracy );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a vector operation.
+//
+// \param result The result of the dispatched operation.
+// \param ref The result of the reference implementation.
+// \param accuracy The accepted absolute deviation from the reference result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T  // Type of the vector elements
+        , bool TF >   // Transpose flag
+void OperationTest::checkResult( const blaze::DynamicVector<T,TF>& result,
+                                 const blaze::DynamicVector<T,TF>& ref, T accuracy ) const
+{
+   if( result.size() != ref.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result size\n"
+          << " Details:\n"
+          << "   Result   = " << result.size() << "\n"
+          << "   Expected = " << ref.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.size(); ++i )
+   {
+      if( std::fabs( result[i] - ref[i] ) > accuracy ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   First deviation at index " << i << ": "
+             << result[i] << " instead of " << ref[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a matrix operation.
+//
+// \param result The result of the dispatched operation.
+// \param ref The result of the reference implementation.
+// \param accuracy The accepted absolute deviation from the reference result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T  // Type of the matrix elements
+        , bool SO1    // Storage order of the result matrix
+        , bool SO2 >  // Storage order of the reference matrix
+void OperationTest::checkResult( const blaze::DynamicMatrix<T,SO1>& result,
+                                 const blaze::DynamicMatrix<T,SO2>& ref, T accuracy ) const
+{
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result size\n"
+          << " Details:\n"
+          << "   Result   = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected = " << ref.rows() << "x" << ref.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         if( std::fabs( result(i,j) - ref(i,j) ) > accuracy ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   First deviation at (" << i << "," << j << "): "
+                << result(i,j) << " instead of " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given vector.
+//
+// \param v The vector to be initialized.
+// \param n The size of the vector.
+// \return void
+*/
+template< typename T  // Type of the vector elements
+        , bool TF >   // Transpose flag
+void OperationTest::initRandom( blaze::DynamicVector<T,TF>& v, size_t n ) const
+{
+   v.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      v[i] = blaze::rand<T>( T(-1), T(1) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix.
+//
+// \param A The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+*/
+template< typename T  // Type of the matrix elements
+        , bool SO >   // Storage order
+void OperationTest::initRandom( blaze::DynamicMatrix<T,SO>& A, size_t m, size_t n ) const
+{
+   A.resize( m, n, false );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = blaze::rand<T>( T(-1), T(1) );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime dispatch operation test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime dispatch operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,121 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatdmatmult/ChainTest.cpp
+//  \brief Source file for the dense matrix/dense matrix multiplication chain test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dmatdmatmult/ChainTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the chain test class.
+//
+// \exception std::runtime_error Operation error detected.
+//
+// The constructor runs the chain tests for all combinations of storage orders, both for
+// dimensions favoring the left-to-right and for dimensions favoring the right-to-left
+// evaluation of the chain.
+*/
+ChainTest::ChainTest()
+   : test_()
+{
+   const size_t dims[3][4] = { { 12UL,  2UL, 12UL,  2UL },
+                               {  2UL, 12UL,  2UL, 12UL },
+                               {  5UL,  5UL,  5UL,  5UL } };
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      const size_t m( dims[i][0] ), k( dims[i][1] ), n( dims[i][2] ), p( dims[i][3] );
+
+      testChain<false,false,false>( m, k, n, p );
+      testChain<false,false,true >( m, k, n, p );
+      testChain<false,true ,false>( m, k, n, p );
+      testChain<false,true ,true >( m, k, n, p );
+      testChain<true ,false,false>( m, k, n, p );
+      testChain<true ,false,true >( m, k, n, p );
+      testChain<true ,true ,false>( m, k, n, p );
+      testChain<true ,true ,true >( m, k, n, p );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running chain test..." << std::endl;
+
+   try
+   {
+      RUN_DMATDMATMULT_CHAIN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during chain test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -83,6 +83,8 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CLDa( 16UL ), CMDa( 16UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CLDa( 32UL ), CMDa( 32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CLDa( 64UL ), CMDa( 64UL, 32UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDa( 127UL ), CMDa( 127UL, 129UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDa( 128UL ), CMDa( 128UL, 128UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
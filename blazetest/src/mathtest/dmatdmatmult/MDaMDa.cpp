@@ -86,6 +86,8 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 32UL, 32UL ), CMDa(  32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 64UL, 32UL ), CMDa(  32UL, 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 64UL, 32UL ), CMDa(  32UL, 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 127UL, 67UL ), CMDa(  67UL, 129UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 128UL, 64UL ), CMDa(  64UL, 128UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -83,6 +83,8 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 32UL, 16UL ), CUDa( 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 32UL, 32UL ), CUDa( 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 32UL, 64UL ), CUDa( 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 129UL, 127UL ), CUDa( 127UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDa( 128UL, 128UL ), CUDa( 128UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -181,6 +181,25 @@ void ClassTest::testConstructors()
       checkCapacity( mat, 12UL );
    }
 
+   {
+      test_ = "Row-major DynamicMatrix size constructor (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+      const size_t n( 13UL );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat( m, n );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            mat(i,j) = 0.0;
+
+      checkElements( mat, 0.0 );
+   }
+
 
    //=====================================================================================
    // Row-major homogeneous initialization
@@ -242,6 +261,21 @@ void ClassTest::testConstructors()
       }
    }
 
+   {
+      test_ = "Row-major DynamicMatrix homogeneous initialization constructor (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+      const size_t n( 13UL );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat( m, n, 2.0 );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+      checkNonZeros( mat, m*n );
+      checkElements( mat, 2.0 );
+   }
+
 
    //=====================================================================================
    // Row-major array initialization
@@ -433,6 +467,25 @@ void ClassTest::testConstructors()
       checkCapacity( mat, 12UL );
    }
 
+   {
+      test_ = "Column-major DynamicMatrix size constructor (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( 13UL );
+      const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat( m, n );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            mat(i,j) = 0.0;
+
+      checkElements( mat, 0.0 );
+   }
+
 
    //=====================================================================================
    // Column-major homogeneous initialization
@@ -495,6 +548,21 @@ void ClassTest::testConstructors()
       }
    }
 
+   {
+      test_ = "Column-major DynamicMatrix homogeneous initialization constructor (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( 13UL );
+      const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat( m, n, 2.0 );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+      checkNonZeros( mat, m*n );
+      checkElements( mat, 2.0 );
+   }
+
 
    //=====================================================================================
    // Column-major array initialization
@@ -4593,6 +4661,34 @@ void ClassTest::testResize()
       checkNonZeros( mat, 0UL );
    }
 
+   {
+      test_ = "Row-major DynamicMatrix::resize() (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+      const size_t n( 13UL );
+
+      // Resizing to a large matrix
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat( 3UL, 4UL, 2.0 );
+      mat.resize( m, n, false );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            mat(i,j) = 2.0;
+
+      checkElements( mat, 2.0 );
+
+      // Shrinking the large matrix and preserving the elements
+      mat.resize( m, n-2UL, true );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n-2UL );
+      checkElements( mat, 2.0 );
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -4684,6 +4780,34 @@ void ClassTest::testResize()
       checkColumns ( mat, 0UL );
       checkNonZeros( mat, 0UL );
    }
+
+   {
+      test_ = "Column-major DynamicMatrix::resize() (> SMP_DMATASSIGN_THRESHOLD)";
+
+      const size_t m( 13UL );
+      const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD + 7UL );
+
+      // Resizing to a large matrix
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat( 3UL, 4UL, 2.0 );
+      mat.resize( m, n, false );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkCapacity( mat, m*n );
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            mat(i,j) = 2.0;
+
+      checkElements( mat, 2.0 );
+
+      // Shrinking the large matrix and preserving the elements
+      mat.resize( m-2UL, n, true );
+
+      checkRows    ( mat, m-2UL );
+      checkColumns ( mat, n );
+      checkElements( mat, 2.0 );
+   }
 }
 //*************************************************************************************************
 
@@ -191,6 +191,33 @@ void ClassTest::testConstructors()
       }
    }
 
+   {
+      test_ = "DynamicVector homogeneous initialization constructor (size > SMP_DVECASSIGN_THRESHOLD)";
+
+      const size_t n( blaze::SMP_DVECASSIGN_THRESHOLD + 13UL );
+
+      blaze::DynamicVector<double,blaze::rowVector> vec( n, 2.0 );
+
+      checkSize    ( vec, n );
+      checkCapacity( vec, n );
+      checkNonZeros( vec, n );
+
+      for( size_t i=0UL; i<vec.capacity(); ++i ) {
+         if( vec.data()[i] != ( ( i < n )?( 2.0 ):( 0.0 ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Size     : " << n << "\n"
+                << "   Capacity : " << vec.capacity() << "\n"
+                << "   Index    : " << i << "\n"
+                << "   Element  : " << vec.data()[i] << "\n"
+                << "   Expected : " << ( ( i < n )?( 2.0 ):( 0.0 ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
 
    //=====================================================================================
    // Array initialization
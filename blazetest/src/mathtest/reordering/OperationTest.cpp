@@ -0,0 +1,595 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/reordering/OperationTest.cpp
+//  \brief Source file for the sparse matrix reordering operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/reordering/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testReverseCuthillMcKee();
+   testNestedDissection();
+   testPermute();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the \c reverseCuthillMcKee() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reverseCuthillMcKee() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReverseCuthillMcKee()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reverseCuthillMcKee() of a shuffled grid";
+
+      MT A;
+      initGrid( A, 12UL, 10UL );
+      shuffle( A );
+
+      std::vector<size_t> perm;
+      blaze::reverseCuthillMcKee( A, perm );
+
+      checkPermutation( perm, A.rows() );
+
+      MT B;
+      blaze::permute( A, perm, B );
+
+      if( blaze::bandwidth( B ) > 20UL || B.nonZeros() != A.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Bandwidth of the shuffled matrix = " << blaze::bandwidth( A ) << "\n"
+             << "   Bandwidth of the reordered matrix = " << blaze::bandwidth( B ) << "\n"
+             << "   Expected bandwidth <= 20\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major reverseCuthillMcKee() of a disconnected matrix";
+
+      MT A( 7UL, 7UL );
+      A(0,4) = 1; A(4,0) = 1;
+      A(4,2) = 2; A(2,4) = 2;
+      A(1,5) = 3;
+      A(6,6) = 4;
+
+      std::vector<size_t> perm;
+      blaze::reverseCuthillMcKee( A, perm );
+
+      checkPermutation( perm, 7UL );
+
+      if( blaze::bandwidth( A ) != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computing the bandwidth failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::bandwidth( A ) << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major reverseCuthillMcKee() of a non-square matrix";
+
+      MT A( 3UL, 4UL );
+      std::vector<size_t> perm;
+
+      try {
+         blaze::reverseCuthillMcKee( A, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reverseCuthillMcKee() of a shuffled grid";
+
+      MT A;
+      initGrid( A, 9UL, 14UL );
+      shuffle( A );
+
+      const OMT tA( A );
+
+      std::vector<size_t> perm, tperm;
+      blaze::reverseCuthillMcKee( A, perm );
+      blaze::reverseCuthillMcKee( tA, tperm );
+
+      checkPermutation( tperm, tA.rows() );
+
+      if( tperm != perm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row-major and column-major orderings differ\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      OMT B;
+      blaze::permute( tA, perm, B );
+
+      if( blaze::bandwidth( B ) > 18UL || B.nonZeros() != A.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Bandwidth of the shuffled matrix = " << blaze::bandwidth( tA ) << "\n"
+             << "   Bandwidth of the reordered matrix = " << blaze::bandwidth( B ) << "\n"
+             << "   Expected bandwidth <= 18\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nestedDissection() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nestedDissection() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNestedDissection()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major nestedDissection() of a shuffled grid";
+
+      MT A;
+      initGrid( A, 40UL, 40UL );
+      shuffle( A );
+
+      std::vector<size_t> perm;
+      MT B, C;
+
+      blaze::reverseCuthillMcKee( A, perm );
+      blaze::permute( A, perm, B );
+
+      blaze::nestedDissection( A, perm, 8UL );
+      checkPermutation( perm, A.rows() );
+      blaze::permute( A, perm, C );
+
+      if( C.nonZeros() != A.nonZeros() || factorNonZeros( C ) >= factorNonZeros( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fill-in reduction failed\n"
+             << " Details:\n"
+             << "   Factor non-zeros (nested dissection)     = " << factorNonZeros( C ) << "\n"
+             << "   Factor non-zeros (reverse Cuthill-McKee) = " << factorNonZeros( B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major nestedDissection() of a disconnected matrix";
+
+      MT A( 9UL, 9UL );
+      A(0,8) = 1; A(8,0) = 1;
+      A(8,3) = 2; A(3,8) = 2;
+      A(3,5) = 3; A(5,3) = 3;
+      A(5,1) = 4; A(1,5) = 4;
+      A(2,7) = 5;
+
+      std::vector<size_t> perm;
+      blaze::nestedDissection( A, perm, 1UL );
+
+      checkPermutation( perm, 9UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major nestedDissection() of a shuffled grid";
+
+      MT A;
+      initGrid( A, 20UL, 20UL );
+      shuffle( A );
+
+      const OMT tA( A );
+
+      std::vector<size_t> perm, tperm;
+      blaze::nestedDissection( A, perm, 16UL );
+      blaze::nestedDissection( tA, tperm, 16UL );
+
+      checkPermutation( tperm, tA.rows() );
+
+      if( tperm != perm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row-major and column-major orderings differ\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c permute() and \c unpermute() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c permute() and \c unpermute() functions for sparse
+// matrices and dense vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testPermute()
+{
+   std::vector<size_t> perm( 4UL );
+   perm[0] = 2UL; perm[1] = 0UL; perm[2] = 3UL; perm[3] = 1UL;
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major permute()";
+
+      MT A( 4UL, 4UL );
+      A(0,0) = 1; A(0,3) = 2;
+      A(1,2) = 3;
+      A(2,0) = 4; A(2,1) = 5;
+      A(3,3) = 6;
+
+      blaze::permute( A, perm, A );
+
+      if( A.nonZeros() != 6UL ||
+          A(1,1) != 1 || A(1,2) != 2 || A(3,0) != 3 ||
+          A(0,1) != 4 || A(0,3) != 5 || A(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation of the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n( 0 4 0 5 )\n( 0 1 2 0 )\n( 0 0 6 0 )\n( 3 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::vector<size_t> invalid( perm );
+      invalid[3] = 2UL;
+
+      try {
+         blaze::permute( A, invalid, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with an invalid permutation succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major permute()";
+
+      OMT A( 4UL, 4UL ), B;
+      A(0,0) = 1; A(0,3) = 2;
+      A(1,2) = 3;
+      A(2,0) = 4; A(2,1) = 5;
+      A(3,3) = 6;
+
+      blaze::permute( A, perm, B );
+
+      if( B.nonZeros() != 6UL ||
+          B(1,1) != 1 || B(1,2) != 2 || B(3,0) != 3 ||
+          B(0,1) != 4 || B(0,3) != 5 || B(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation of the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n( 0 4 0 5 )\n( 0 1 2 0 )\n( 0 0 6 0 )\n( 3 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense vector tests
+   //=====================================================================================
+
+   {
+      test_ = "Dense vector permute() and unpermute()";
+
+      blaze::DynamicVector<int,blaze::columnVector> x( 4UL ), y( 4UL );
+      x[0] = 1; x[1] = 2; x[2] = 3; x[3] = 4;
+
+      blaze::permute( x, perm, y );
+
+      if( y[0] != 3 || y[1] != 1 || y[2] != 4 || y[3] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation of the vector failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 3 1 4 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::unpermute( y, perm, y );
+
+      if( y != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inverse permutation of the vector failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<int,blaze::columnVector> z( 3UL );
+
+      try {
+         blaze::permute( x, perm, z );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation into a vector of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether the given vector is a permutation of \f$ [0..n) \f$.
+//
+// \param perm The permutation to be checked.
+// \param n The expected number of elements.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkPermutation( const std::vector<size_t>& perm, size_t n ) const
+{
+   std::vector<bool> found( n, false );
+   bool valid( perm.size() == n );
+
+   for( size_t k=0UL; valid && k<perm.size(); ++k ) {
+      valid = ( perm[k] < n && !found[perm[k]] );
+      if( valid ) found[perm[k]] = true;
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation detected\n"
+          << " Details:\n"
+          << "   Size of the permutation = " << perm.size() << "\n"
+          << "   Expected size = " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given matrix as 5-point stencil matrix of a structured grid.
+//
+// \param A The matrix to be initialized.
+// \param nx The number of grid points in x-direction.
+// \param ny The number of grid points in y-direction.
+// \return void
+*/
+void OperationTest::initGrid( MT& A, size_t nx, size_t ny ) const
+{
+   const size_t n( nx*ny );
+
+   A.resize( n, n, false );
+   A.reset();
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t x( i % nx ), y( i / nx );
+      if( y > 0UL    ) A.append( i, i-nx, -1 );
+      if( x > 0UL    ) A.append( i, i-1UL, -1 );
+      A.append( i, i, 4 );
+      if( x+1UL < nx ) A.append( i, i+1UL, -1 );
+      if( y+1UL < ny ) A.append( i, i+nx, -1 );
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of non-zero elements of the Cholesky factor of the given matrix.
+//
+// \param A The given matrix with symmetric sparsity pattern.
+// \return The number of non-zero elements of the lower Cholesky factor.
+//
+// The non-zero elements of each row of the factor are determined by climbing the elimination
+// tree from the non-zero elements of the lower part of the according row of \a A.
+*/
+size_t OperationTest::factorNonZeros( const MT& A ) const
+{
+   const size_t n( A.rows() );
+
+   std::vector<size_t> parent( n, n ), mark( n, n );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      mark[i] = i;
+      ++nonzeros;
+
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         for( size_t j=element->index(); j<i && mark[j]!=i; j=parent[j] ) {
+            mark[j] = i;
+            ++nonzeros;
+            if( parent[j] == n ) parent[j] = i;
+         }
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random symmetric permutation of the given matrix.
+//
+// \param A The matrix to be shuffled.
+// \return void
+*/
+void OperationTest::shuffle( MT& A ) const
+{
+   std::vector<size_t> perm( A.rows() );
+
+   for( size_t i=0UL; i<perm.size(); ++i ) {
+      perm[i] = i;
+   }
+
+   for( size_t i=perm.size(); i>1UL; --i ) {
+      std::swap( perm[i-1UL], perm[blaze::rand<size_t>( 0UL, i-1UL )] );
+   }
+
+   blaze::permute( A, perm, A );
+}
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix reordering operation test..." << std::endl;
+
+   try
+   {
+      RUN_REORDERING_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix reordering operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
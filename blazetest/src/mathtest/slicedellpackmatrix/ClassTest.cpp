@@ -0,0 +1,634 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <blaze/math/Views.h>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testLookup();
+   testLayout();
+   testMatVecMult();
+   testTVecMatMult();
+   testReset();
+   testSwap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      MT mat;
+
+      checkMatrix( mat, RMT() );
+   }
+
+   // Size constructor
+   {
+      test_ = "SlicedEllpackMatrix size constructor";
+
+      MT mat( 13UL, 7UL );
+
+      checkMatrix( mat, RMT( 13UL, 7UL ) );
+   }
+
+   // Conversion constructor (CompressedMatrix)
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (CompressedMatrix)";
+
+      const size_t sigmas[] = { 1UL, 16UL, 128UL, MT::defaultSigma, 1000UL };
+
+      for( size_t s=0UL; s<sizeof(sigmas)/sizeof(size_t); ++s ) {
+         for( size_t m=0UL; m<=20UL; m+=5UL ) {
+            RMT ref;
+            initialize( ref, m, 17UL, m*4UL );
+
+            MT mat( ref, sigmas[s] );
+
+            checkMatrix( mat, ref );
+         }
+      }
+   }
+
+   // Conversion constructor (column-major CompressedMatrix)
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (column-major CompressedMatrix)";
+
+      RMT ref;
+      initialize( ref, 67UL, 127UL, 1000UL );
+
+      const RMT::OppositeType tmp( ref );
+      MT mat( tmp );
+
+      checkMatrix( mat, ref );
+   }
+
+   // Conversion constructor (DynamicMatrix)
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (DynamicMatrix)";
+
+      RMT ref;
+      initialize( ref, 31UL, 9UL, 100UL );
+
+      const blaze::DynamicMatrix<double> tmp( ref );
+      MT mat( tmp );
+
+      checkMatrix( mat, ref );
+   }
+
+   // Copy constructor
+   {
+      test_ = "SlicedEllpackMatrix copy constructor";
+
+      RMT ref;
+      initialize( ref, 67UL, 127UL, 2000UL );
+
+      MT mat1( ref, 64UL );
+      MT mat2( mat1 );
+
+      checkMatrix( mat2, ref );
+
+      if( mat2.sigma() != mat1.sigma() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sorting scope detected\n"
+             << " Details:\n"
+             << "   Sorting scope         : " << mat2.sigma() << "\n"
+             << "   Expected sorting scope: " << mat1.sigma() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   // Copy assignment
+   {
+      test_ = "SlicedEllpackMatrix copy assignment";
+
+      RMT ref;
+      initialize( ref, 40UL, 30UL, 300UL );
+
+      MT mat1( ref );
+      MT mat2( 3UL, 3UL );
+      mat2 = mat1;
+
+      checkMatrix( mat2, ref );
+   }
+
+   // Matrix assignment
+   {
+      test_ = "SlicedEllpackMatrix matrix assignment";
+
+      RMT ref1, ref2;
+      initialize( ref1, 40UL, 30UL, 300UL );
+      initialize( ref2, 40UL, 30UL, 300UL );
+
+      MT mat;
+      mat = ref1;
+      checkMatrix( mat, ref1 );
+
+      mat = ref1 + ref2;
+      checkMatrix( mat, RMT( ref1 + ref2 ) );
+   }
+
+   // Self assignment
+   {
+      test_ = "SlicedEllpackMatrix self assignment";
+
+      RMT ref;
+      initialize( ref, 21UL, 19UL, 100UL );
+
+      MT mat( ref );
+      const MT& alias( mat );
+      mat = alias;
+
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() functions and
+// of the row iterators of the SlicedEllpackMatrix class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "SlicedEllpackMatrix lookup functions";
+
+   RMT ref;
+   initialize( ref, 37UL, 23UL, 300UL );
+
+   const MT mat( ref, 16UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      // Iteration over the row
+      {
+         RMT::ConstIterator refIt( ref.begin(i) );
+         MT::ConstIterator it( mat.begin(i) );
+
+         for( ; it!=mat.end(i) && refIt!=ref.end(i); ++it, ++refIt ) {
+            if( it->index() != refIt->index() || it->value() != refIt->value() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid row element detected\n"
+                   << " Details:\n"
+                   << "   Row             : " << i << "\n"
+                   << "   Element         : (" << it->index() << "," << it->value() << ")\n"
+                   << "   Expected element: (" << refIt->index() << "," << refIt->value() << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( it != mat.end(i) || refIt != ref.end(i) ||
+             size_t( mat.end(i) - mat.begin(i) ) != ref.nonZeros(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of row elements detected\n"
+                << " Details:\n"
+                << "   Row                         : " << i << "\n"
+                << "   Number of elements          : " << ( mat.end(i) - mat.begin(i) ) << "\n"
+                << "   Expected number of elements : " << ref.nonZeros(i) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Lookup of all elements of the row
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const bool found( mat.find(i,j) != mat.end(i) );
+         const bool expectedFound( ref.find(i,j) != ref.end(i) );
+
+         const size_t lbound( mat.lowerBound(i,j) - mat.begin(i) );
+         const size_t ubound( mat.upperBound(i,j) - mat.begin(i) );
+         const size_t expectedLbound( ref.lowerBound(i,j) - ref.begin(i) );
+         const size_t expectedUbound( ref.upperBound(i,j) - ref.begin(i) );
+
+         if( found != expectedFound || lbound != expectedLbound || ubound != expectedUbound ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lookup result detected\n"
+                << " Details:\n"
+                << "   Element            : (" << i << "," << j << ")\n"
+                << "   Found              : " << found << " (expected " << expectedFound << ")\n"
+                << "   Lower bound offset : " << lbound << " (expected " << expectedLbound << ")\n"
+                << "   Upper bound offset : " << ubound << " (expected " << expectedUbound << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SELL-C-sigma storage layout of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the chunk structure of the SlicedEllpackMatrix class template: All rows
+// have to be assigned to exactly one chunk lane, the rows have to be sorted by decreasing length
+// within each sorting scope, the width of each chunk has to match its longest row, and the
+// capacity has to correspond to the sum of all chunk widths. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLayout()
+{
+   test_ = "SlicedEllpackMatrix storage layout";
+
+   const size_t C( MT::chunkSize );
+   const size_t sigmas[] = { 1UL, 4UL*C, MT::defaultSigma };
+
+   for( size_t s=0UL; s<sizeof(sigmas)/sizeof(size_t); ++s )
+   {
+      RMT ref;
+      initialize( ref, 203UL, 61UL, 2500UL );
+
+      const MT mat( ref, sigmas[s] );
+      const size_t sigma( mat.sigma() );
+
+      std::vector<bool> visited( ref.rows(), false );
+      size_t capacity( 0UL );
+      bool valid( sigma % C == 0UL && mat.chunks() == ( ref.rows() + C - 1UL ) / C );
+
+      for( size_t c=0UL; valid && c<mat.chunks(); ++c )
+      {
+         const size_t* rows( mat.chunkRows( c ) );
+         const size_t lanes( ( ref.rows() - c*C < C )?( ref.rows() - c*C ):( C ) );
+         size_t width( 0UL );
+
+         for( size_t l=0UL; valid && l<lanes; ++l )
+         {
+            const size_t slot( c*C + l );
+
+            if( rows[l] >= ref.rows() || visited[rows[l]] ) {
+               valid = false;
+               break;
+            }
+            visited[rows[l]] = true;
+
+            if( sigma > C && slot % sigma != 0UL &&
+                ref.nonZeros( rows[l] ) > ref.nonZeros( *( mat.chunkRows( (slot-1UL)/C ) + (slot-1UL)%C ) ) )
+               valid = false;
+
+            if( ref.nonZeros( rows[l] ) > width )
+               width = ref.nonZeros( rows[l] );
+         }
+
+         if( mat.chunkWidth( c ) != width )
+            valid = false;
+
+         capacity += C * width;
+      }
+
+      if( !valid || mat.capacity() != capacity ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunk structure detected\n"
+             << " Details:\n"
+             << "   Sorting scope     : " << sigma << "\n"
+             << "   Chunk size        : " << C << "\n"
+             << "   Number of chunks  : " << mat.chunks() << "\n"
+             << "   Capacity          : " << mat.capacity() << "\n"
+             << "   Expected capacity : " << capacity << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a sliced ELLPACK matrix with a dense
+// column vector, including the addition and subtraction assignment of the product. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   // Double precision matrix/vector multiplication
+   {
+      test_ = "SlicedEllpackMatrix/dense vector multiplication (double)";
+
+      const size_t sizes[][3] = { {   0UL,   0UL,    0UL }, {   7UL,  0UL,    0UL },
+                                  {   1UL,   1UL,    1UL }, {   5UL,  6UL,   10UL },
+                                  {  67UL, 127UL, 2000UL }, { 128UL, 64UL, 3000UL },
+                                  { 999UL, 731UL, 9000UL } };
+
+      for( size_t k=0UL; k<sizeof(sizes)/sizeof(sizes[0]); ++k )
+      {
+         RMT ref;
+         VT x, y;
+         initialize( ref, sizes[k][0], sizes[k][1], sizes[k][2] );
+         initialize( x, sizes[k][1] );
+         initialize( y, sizes[k][0] );
+
+         const MT mat( ref, 32UL );
+
+         VT res( mat * x );
+         checkVector( res, VT( ref * x ) );
+
+         res = y;
+         res += mat * x;
+         checkVector( res, VT( y + ref * x ) );
+
+         res = y;
+         res -= mat * x;
+         checkVector( res, VT( y - ref * x ) );
+
+         res = 2.0 * ( mat * x ) + y;
+         checkVector( res, VT( 2.0 * ( ref * x ) + y ) );
+
+         if( sizes[k][0] > 2UL ) {
+            res = subvector( mat * x, 1UL, sizes[k][0]-2UL );
+            checkVector( res, VT( subvector( ref * x, 1UL, sizes[k][0]-2UL ) ) );
+         }
+      }
+   }
+
+   // Single precision matrix/vector multiplication
+   {
+      test_ = "SlicedEllpackMatrix/dense vector multiplication (float)";
+
+      FRMT ref;
+      FVT x, y;
+      initialize( ref, 130UL, 257UL, 5000UL );
+      initialize( x, 257UL );
+      initialize( y, 130UL );
+
+      const FMT mat( ref );
+
+      FVT res( mat * x );
+      checkVector( res, FVT( ref * x ) );
+
+      res = y;
+      res += mat * x;
+      checkVector( res, FVT( y + ref * x ) );
+
+      res = y;
+      res -= mat * x;
+      checkVector( res, FVT( y - ref * x ) );
+   }
+
+   // Multiplication with empty rows and non-finite vector elements
+   {
+      test_ = "SlicedEllpackMatrix/dense vector multiplication (empty rows)";
+
+      RMT ref( 19UL, 5UL );
+      ref(3,1) = 2.0;
+      ref(7,4) = 1.0;
+
+      VT x( 5UL, 1.0 );
+      x[0] = std::numeric_limits<double>::infinity();
+
+      const MT mat( ref );
+
+      VT res( 19UL, 3.0 );
+      res = mat * x;
+      checkVector( res, VT( ref * x ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector/SlicedEllpackMatrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a transpose dense vector with a
+// sliced ELLPACK matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testTVecMatMult()
+{
+   test_ = "Dense vector/SlicedEllpackMatrix multiplication";
+
+   RMT ref;
+   TVT x, y;
+   initialize( ref, 67UL, 127UL, 2000UL );
+   initialize( x, 67UL );
+   initialize( y, 127UL );
+
+   const MT mat( ref );
+
+   TVT res( x * mat );
+   checkVector( res, TVT( x * ref ) );
+
+   res = y;
+   res += x * mat;
+   checkVector( res, TVT( y + x * ref ) );
+
+   res = y;
+   res -= x * mat;
+   checkVector( res, TVT( y - x * ref ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset() and clear() functions of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   // Resetting the matrix
+   {
+      test_ = "SlicedEllpackMatrix::reset()";
+
+      RMT ref;
+      initialize( ref, 21UL, 13UL, 80UL );
+
+      MT mat( ref );
+      reset( mat );
+
+      checkMatrix( mat, RMT( 21UL, 13UL ) );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Clearing the matrix
+   {
+      test_ = "SlicedEllpackMatrix::clear()";
+
+      RMT ref;
+      initialize( ref, 21UL, 13UL, 80UL );
+
+      MT mat( ref );
+      clear( mat );
+
+      checkMatrix( mat, RMT() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SlicedEllpackMatrix swap";
+
+   RMT ref1, ref2;
+   initialize( ref1, 17UL, 9UL, 50UL );
+   initialize( ref2, 31UL, 40UL, 200UL );
+
+   MT mat1( ref1 ), mat2( ref2 );
+
+   swap( mat1, mat2 );
+
+   checkMatrix( mat1, ref2 );
+   checkMatrix( mat2, ref1 );
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
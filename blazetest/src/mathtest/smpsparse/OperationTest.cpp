@@ -0,0 +1,812 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/smpsparse/OperationTest.cpp
+//  \brief Source file for the SMP sparse operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Workload.h>
+#include <blazetest/mathtest/smpsparse/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpsparse {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testThreads();
+   testPartition();
+   testRowMajorAssign();
+   testColumnMajorAssign();
+   testVectorAssign();
+   testRowMajorMatVecMult();
+   testColumnMajorMatVecMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the number of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the test is compiled with a thread-based parallelization and is
+// executed with more than one thread. In case the number of threads has not been set via the
+// \c BLAZE_NUM_THREADS environment variable, four threads are used. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testThreads()
+{
+   test_ = "Number of threads";
+
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE && !BLAZE_BOOST_THREADS_PARALLEL_MODE
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Thread-based parallelization not activated\n";
+   throw std::runtime_error( oss.str() );
+#endif
+
+   if( blaze::getNumThreads() < 2UL ) {
+      blaze::setNumThreads( 4UL );
+   }
+
+   if( blaze::getNumThreads() < 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Number of threads = " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nonzero-balanced partitioning of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the partitioning of the rows of a row-major and of the columns of a
+// column-major sparse matrix with skewed row (or column) lengths. Each part must not exceed
+// its share of the total work by more than the work of a single row (or column). In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPartition()
+{
+   const size_t n( 2000UL );
+
+   MT A;
+   initSkewed( A, n );
+
+   TMT T;
+   initSkewed( T, n );
+
+   const size_t numParts[] = { 1UL, 2UL, 3UL, 4UL, 7UL, 16UL };
+
+   for( size_t p=0UL; p<sizeof(numParts)/sizeof(size_t); ++p )
+   {
+      const size_t parts( numParts[p] );
+
+      for( size_t so=0UL; so<2UL; ++so )
+      {
+         test_ = ( so == 0UL )?( "Row-major sparse matrix partitioning" )
+                              :( "Column-major sparse matrix partitioning" );
+
+         std::vector<size_t> bounds;
+         if( so == 0UL ) blaze::smpPartition( A, parts, bounds );
+         else            blaze::smpPartition( T, parts, bounds );
+
+         const size_t total  ( ( ( so == 0UL )?( A.nonZeros() ):( T.nonZeros() ) ) + n );
+         const size_t maxWork( n + 1UL );  // The work of the dense first row (or column)
+
+         if( bounds.size() != parts+1UL || bounds[0] != 0UL || bounds[parts] != n ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid boundaries of the parts\n"
+                << " Details:\n"
+                << "   Number of parts  = " << parts << "\n"
+                << "   Number of bounds = " << bounds.size() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<parts; ++i )
+         {
+            if( bounds[i] > bounds[i+1UL] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Decreasing boundaries of the parts\n"
+                   << " Details:\n"
+                   << "   Number of parts = " << parts << "\n"
+                   << "   Part            = " << i << "\n"
+                   << "   Boundaries      = [" << bounds[i] << "," << bounds[i+1UL] << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            size_t work( 0UL );
+            for( size_t k=bounds[i]; k<bounds[i+1UL]; ++k ) {
+               work += ( ( so == 0UL )?( A.nonZeros( k ) ):( T.nonZeros( k ) ) ) + 1UL;
+            }
+
+            if( work*parts > total + maxWork*parts ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Unbalanced parts\n"
+                   << " Details:\n"
+                   << "   Number of parts = " << parts << "\n"
+                   << "   Part            = " << i << "\n"
+                   << "   Work of part    = " << work << "\n"
+                   << "   Total work      = " << total << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to a row-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of a
+// sparse matrix multiplication with skewed row lengths to a row-major compressed matrix and
+// the assignment of a dense matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testRowMajorAssign()
+{
+   const size_t n( 2000UL );
+
+   MT A, I;
+   initSkewed  ( A, n );
+   initIdentity( I, n );
+
+   DMT ref( n, n, 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         ref(i,element->index()) = element->value();
+   }
+
+   MT C;
+
+   {
+      test_ = "Row-major sparse matrix assignment";
+
+      C = A * I;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), A.nonZeros() );
+   }
+
+   {
+      test_ = "Row-major sparse matrix addition assignment";
+
+      C += A * I;
+      ref *= 2.0;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), A.nonZeros() );
+   }
+
+   {
+      test_ = "Row-major sparse matrix subtraction assignment";
+
+      C -= A * I;
+      ref /= 2.0;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), A.nonZeros() );
+   }
+
+   {
+      test_ = "Row-major dense matrix assignment";
+
+      MT D;
+      D = ref;
+      checkMatrix  ( D, ref );
+      checkNonZeros( D.nonZeros(), A.nonZeros() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to a column-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of a
+// sparse matrix multiplication with skewed column lengths to a column-major compressed matrix
+// and the assignment of a dense matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testColumnMajorAssign()
+{
+   const size_t n( 2000UL );
+
+   TMT T, I;
+   initSkewed  ( T, n );
+   initIdentity( I, n );
+
+   DMT ref( n, n, 0.0 );
+   for( size_t j=0UL; j<n; ++j ) {
+      for( TMT::ConstIterator element=T.begin(j); element!=T.end(j); ++element )
+         ref(element->index(),j) = element->value();
+   }
+
+   TMT C;
+
+   {
+      test_ = "Column-major sparse matrix assignment";
+
+      C = T * I;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), T.nonZeros() );
+   }
+
+   {
+      test_ = "Column-major sparse matrix addition assignment";
+
+      C += T * I;
+      ref *= 2.0;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), T.nonZeros() );
+   }
+
+   {
+      test_ = "Column-major sparse matrix subtraction assignment";
+
+      C -= T * I;
+      ref /= 2.0;
+      checkMatrix  ( C, ref );
+      checkNonZeros( C.nonZeros(), T.nonZeros() );
+   }
+
+   {
+      test_ = "Column-major dense matrix assignment";
+
+      TMT D;
+      D = ref;
+      checkMatrix  ( D, ref );
+      checkNonZeros( D.nonZeros(), T.nonZeros() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to a compressed vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of a
+// sparse matrix/sparse vector multiplication with skewed row lengths to a compressed vector.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testVectorAssign()
+{
+   const size_t n( 2000UL );
+
+   MT A;
+   initSkewed( A, n );
+
+   SVT s;
+   initSparse( s, n );
+
+   DVT ref( n, 0.0 );
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         ref[i] += element->value() * s[element->index()];
+      if( ref[i] != 0.0 ) ++nonzeros;
+   }
+
+   SVT v;
+
+   {
+      test_ = "Sparse vector assignment";
+
+      v = A * s;
+      checkVector  ( v, ref );
+      checkNonZeros( v.nonZeros(), nonzeros );
+   }
+
+   {
+      test_ = "Sparse vector addition assignment";
+
+      v += A * s;
+      ref *= 2.0;
+      checkVector  ( v, ref );
+      checkNonZeros( v.nonZeros(), nonzeros );
+   }
+
+   {
+      test_ = "Sparse vector subtraction assignment";
+
+      v -= A * s;
+      ref /= 2.0;
+      checkVector  ( v, ref );
+      checkNonZeros( v.nonZeros(), nonzeros );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row-major sparse matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the nonzero-balanced multiplication of a row-major sparse matrix with
+// skewed row lengths and a dense vector, including the addition and subtraction assignment.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testRowMajorMatVecMult()
+{
+   const size_t n( 2000UL );
+
+   MT A;
+   initSkewed( A, n );
+
+   DVT x;
+   initDense( x, n );
+
+   DVT ref( n, 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         ref[i] += element->value() * x[element->index()];
+   }
+
+   DVT y;
+
+   {
+      test_ = "Row-major sparse matrix/dense vector multiplication";
+
+      y = A * x;
+      checkVector( y, ref );
+   }
+
+   {
+      test_ = "Row-major sparse matrix/dense vector multiplication with addition assignment";
+
+      y += A * x;
+      ref *= 2.0;
+      checkVector( y, ref );
+   }
+
+   {
+      test_ = "Row-major sparse matrix/dense vector multiplication with subtraction assignment";
+
+      y -= A * x;
+      ref /= 2.0;
+      checkVector( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the column-major sparse matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the nonzero-balanced multiplication of a column-major sparse matrix with
+// skewed column lengths and a dense vector, including the addition and subtraction assignment.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testColumnMajorMatVecMult()
+{
+   const size_t n( 2000UL );
+
+   TMT T;
+   initSkewed( T, n );
+
+   DVT x;
+   initDense( x, n );
+
+   DVT ref( n, 0.0 );
+   for( size_t j=0UL; j<n; ++j ) {
+      for( TMT::ConstIterator element=T.begin(j); element!=T.end(j); ++element )
+         ref[element->index()] += element->value() * x[j];
+   }
+
+   DVT y;
+
+   {
+      test_ = "Column-major sparse matrix/dense vector multiplication";
+
+      y = T * x;
+      checkVector( y, ref );
+   }
+
+   {
+      test_ = "Column-major sparse matrix/dense vector multiplication with addition assignment";
+
+      y += T * x;
+      ref *= 2.0;
+      checkVector( y, ref );
+   }
+
+   {
+      test_ = "Column-major sparse matrix/dense vector multiplication with subtraction assignment";
+
+      y -= T * x;
+      ref /= 2.0;
+      checkVector( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result matrix.
+//
+// \param result The computed result matrix.
+// \param ref The reference result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result matrix element by element with the reference
+// result. Since all operands hold small integral values, the results have to match exactly.
+// In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the computed result matrix
+        , typename MT2 >  // Type of the reference result matrix
+void OperationTest::checkMatrix( const MT1& result, const MT2& ref ) const
+{
+   if( result.rows() != ref.rows() || result.columns() != ref.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix dimensions\n"
+          << " Details:\n"
+          << "   Result   = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected = " << ref.rows() << "x" << ref.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( result(i,j) != ref(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   Element  = (" << i << "," << j << ")\n"
+                << "   Result   = " << result(i,j) << "\n"
+                << "   Expected = " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result vector.
+//
+// \param result The computed result vector.
+// \param ref The reference result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result vector element by element with the reference
+// result. Since all operands hold small integral values, the results have to match exactly.
+// In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the computed result vector
+        , typename VT2 >  // Type of the reference result vector
+void OperationTest::checkVector( const VT1& result, const VT2& ref ) const
+{
+   if( result.size() != ref.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size\n"
+          << " Details:\n"
+          << "   Result   = " << result.size() << "\n"
+          << "   Expected = " << ref.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ref.size(); ++i ) {
+      if( result[i] != ref[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Index    = " << i << "\n"
+             << "   Result   = " << result[i] << "\n"
+             << "   Expected = " << ref[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the computed result.
+//
+// \param nonzeros The number of non-zero elements of the computed result.
+// \param expected The expected number of non-zero elements.
+// \return void
+// \exception std::runtime_error Invalid number of non-zero elements detected.
+//
+// This function detects lost or duplicated elements during the combination of the parts of
+// an SMP assignment. In case the number of non-zero elements differs from the expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkNonZeros( size_t nonzeros, size_t expected ) const
+{
+   if( nonzeros != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros          = " << nonzeros << "\n"
+          << "   Expected number of non-zeros = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a row-major sparse matrix with skewed row lengths.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \return void
+//
+// This function initializes the given \f$ n \times n \f$ matrix such that row \a i holds
+// every \f$ (i+1) \f$-th element. The number of non-zero elements per row therefore follows
+// a power law: the first row is dense, whereas most of the other rows contain only a few
+// elements.
+*/
+void OperationTest::initSkewed( MT& A, size_t n ) const
+{
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros += ( n + i ) / ( i + 1UL );
+   }
+
+   A.reset();
+   A.resize( n, n, false );
+   A.reserve( nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; j+=i+1UL ) {
+         A.append( i, j, static_cast<double>( 1UL + ( i + 2UL*j ) % 5UL ) );
+      }
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a column-major sparse matrix with skewed column lengths.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \return void
+//
+// This function initializes the given \f$ n \times n \f$ matrix such that column \a j holds
+// every \f$ (j+1) \f$-th element. The number of non-zero elements per column therefore
+// follows a power law: the first column is dense, whereas most of the other columns contain
+// only a few elements.
+*/
+void OperationTest::initSkewed( TMT& A, size_t n ) const
+{
+   size_t nonzeros( 0UL );
+   for( size_t j=0UL; j<n; ++j ) {
+      nonzeros += ( n + j ) / ( j + 1UL );
+   }
+
+   A.reset();
+   A.resize( n, n, false );
+   A.reserve( nonzeros );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<n; i+=j+1UL ) {
+         A.append( i, j, static_cast<double>( 1UL + ( j + 2UL*i ) % 5UL ) );
+      }
+      A.finalize( j );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a row-major identity matrix.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \return void
+*/
+void OperationTest::initIdentity( MT& A, size_t n ) const
+{
+   A.reset();
+   A.resize( n, n, false );
+   A.reserve( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A.append( i, i, 1.0 );
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a column-major identity matrix.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \return void
+*/
+void OperationTest::initIdentity( TMT& A, size_t n ) const
+{
+   A.reset();
+   A.resize( n, n, false );
+   A.reserve( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      A.append( j, j, 1.0 );
+      A.finalize( j );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \param n The size of the vector.
+// \return void
+*/
+void OperationTest::initDense( DVT& v, size_t n ) const
+{
+   v.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      v[i] = static_cast<double>( 1UL + i % 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a sparse vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \param n The size of the vector.
+// \return void
+//
+// This function initializes every third element of the given vector.
+*/
+void OperationTest::initSparse( SVT& v, size_t n ) const
+{
+   v.reset();
+   v.resize( n, false );
+   v.reserve( ( n + 2UL ) / 3UL );
+
+   for( size_t i=0UL; i<n; i+=3UL ) {
+      v.append( i, static_cast<double>( 1UL + i % 4UL ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smpsparse
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP sparse operation test..." << std::endl;
+
+   try
+   {
+      RUN_SMPSPARSE_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP sparse operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
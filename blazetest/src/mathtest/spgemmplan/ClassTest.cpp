@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/spgemmplan/ClassTest.cpp
+//  \brief Source file for the SpGEMMPlan class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/smp/SerialSection.h>
+#include <blazetest/mathtest/spgemmplan/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace spgemmplan {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SpGEMMPlan class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testMultiply();
+   testReuse();
+   testAliasing();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SpGEMMPlan constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SpGEMMPlan class and of the
+// analyze() function. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "SpGEMMPlan default constructor";
+
+      blaze::SpGEMMPlan plan;
+
+      checkPlan( plan, MT(), 0UL );
+   }
+
+   // Matrix constructor
+   {
+      test_ = "SpGEMMPlan matrix constructor";
+
+      for( size_t m=0UL; m<=40UL; m+=8UL ) {
+         for( size_t n=0UL; n<=40UL; n+=10UL ) {
+            for( size_t k=1UL; k<=40UL; k+=13UL )
+            {
+               MT A, B;
+               initialize( A, m, k, m*k/4UL );
+               initialize( B, k, n, k*n/4UL );
+
+               blaze::SpGEMMPlan plan( A, B );
+
+               checkPlan( plan, A * B, countProducts( A, B ) );
+            }
+         }
+      }
+   }
+
+   // Matrix constructor (mixed element types)
+   {
+      test_ = "SpGEMMPlan matrix constructor (mixed element types)";
+
+      MT A;
+      FMT B;
+      initialize( A, 30UL, 20UL, 80UL );
+      initialize( B, 20UL, 25UL, 60UL );
+
+      blaze::SpGEMMPlan plan( A, B );
+
+      checkPlan( plan, A * B, countProducts( A, B ) );
+   }
+
+   // Reanalysis
+   {
+      test_ = "SpGEMMPlan::analyze()";
+
+      MT A, B, C, D;
+      initialize( A, 25UL, 15UL, 60UL );
+      initialize( B, 15UL, 35UL, 70UL );
+      initialize( C, 10UL, 20UL, 30UL );
+      initialize( D, 20UL,  5UL, 30UL );
+
+      blaze::SpGEMMPlan plan( A, B );
+      plan.analyze( C, D );
+
+      checkPlan( plan, C * D, countProducts( C, D ) );
+
+      plan.clear();
+
+      checkPlan( plan, MT(), 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the plan-based sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiply() function for matrices of various sizes and
+// densities, such that the products run both serially and in parallel. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiply()
+{
+   // Multiplication of random matrices
+   {
+      test_ = "Plan-based multiplication of random matrices";
+
+      for( size_t m=0UL; m<=200UL; m+=50UL ) {
+         for( size_t n=1UL; n<=200UL; n+=66UL ) {
+            for( size_t k=1UL; k<=100UL; k+=33UL )
+            {
+               MT A, B, C;
+               initialize( A, m, k, m*k/8UL );
+               initialize( B, k, n, k*n/8UL );
+
+               const blaze::SpGEMMPlan plan( A, B );
+               multiply( C, plan, A, B );
+
+               checkMatrix( C, A * B );
+            }
+         }
+      }
+   }
+
+   // Multiplication of matrices with mixed element types
+   {
+      test_ = "Plan-based multiplication of matrices with mixed element types";
+
+      MT A, C;
+      FMT B;
+      initialize( A, 150UL, 60UL, 600UL );
+      initialize( B, 60UL, 90UL, 500UL );
+
+      const blaze::SpGEMMPlan plan( A, B );
+      multiply( C, plan, A, B );
+
+      checkMatrix( C, A * B );
+   }
+
+   // Serial multiplication
+   {
+      test_ = "Serial plan-based multiplication";
+
+      MT A, B, C;
+      initialize( A, 300UL, 200UL, 3000UL );
+      initialize( B, 200UL, 250UL, 2500UL );
+
+      const blaze::SpGEMMPlan plan( A, B );
+
+      BLAZE_SERIAL_SECTION {
+         multiply( C, plan, A, B );
+      }
+
+      checkMatrix( C, A * B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the repeated plan-based multiplication with changing values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the plan can be reused for matrices with the same sparsity pattern
+// but changing values and that the resulting matrix keeps its storage. Elements of the product
+// that cancel out to zero have to remain in the sparsity pattern. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReuse()
+{
+   test_ = "Repeated plan-based multiplication";
+
+   MT A, B, C;
+   initialize( A, 250UL, 120UL, 1500UL );
+   initialize( B, 120UL, 180UL, 1200UL );
+
+   const blaze::SpGEMMPlan plan( A, B );
+   multiply( C, plan, A, B );
+
+   const MT::ConstIterator storage( C.begin(0UL) );
+   const size_t capacity( C.capacity() );
+
+   for( size_t step=0UL; step<5UL; ++step )
+   {
+      randomize( A );
+      randomize( B );
+
+      multiply( C, plan, A, B );
+
+      checkMatrix( C, A * B );
+
+      if( C.begin(0UL) != storage || C.capacity() != capacity || C.nonZeros() != plan.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reallocation of the resulting matrix detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << C.capacity() << "\n"
+             << "   Expected capacity: " << capacity << "\n"
+             << "   Non-zeros        : " << C.nonZeros() << "\n"
+             << "   Expected non-zeros: " << plan.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the plan-based multiplication with aliased operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiply() function in case the resulting matrix is
+// also one of the operands. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAliasing()
+{
+   // Aliasing with the left-hand side operand
+   {
+      test_ = "Plan-based multiplication (A=A*B)";
+
+      MT A, B;
+      initialize( A, 40UL, 40UL, 200UL );
+      initialize( B, 40UL, 40UL, 200UL );
+
+      const MT result( A * B );
+
+      const blaze::SpGEMMPlan plan( A, B );
+      multiply( A, plan, A, B );
+
+      checkMatrix( A, result );
+   }
+
+   // Aliasing with the right-hand side operand
+   {
+      test_ = "Plan-based multiplication (B=A*B)";
+
+      MT A, B;
+      initialize( A, 40UL, 40UL, 200UL );
+      initialize( B, 40UL, 40UL, 200UL );
+
+      const MT result( A * B );
+
+      const blaze::SpGEMMPlan plan( A, B );
+      multiply( B, plan, A, B );
+
+      checkMatrix( B, result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the SpGEMMPlan class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the setup of a plan for matrices with non-matching sizes and the
+// use of a plan with matrices of a different sparsity pattern fail. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErrors()
+{
+   // Setup with non-matching sizes
+   {
+      test_ = "SpGEMMPlan setup with non-matching sizes";
+
+      MT A, B;
+      initialize( A, 10UL, 12UL, 30UL );
+      initialize( B, 11UL, 10UL, 30UL );
+
+      try {
+         blaze::SpGEMMPlan plan( A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of plan with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Multiplication with a different sparsity pattern
+   {
+      test_ = "Plan-based multiplication with a different sparsity pattern";
+
+      MT A, B, C;
+      initialize( A, 20UL, 15UL, 60UL );
+      initialize( B, 15UL, 20UL, 60UL );
+
+      const blaze::SpGEMMPlan plan( A, B );
+
+      size_t i( 0UL );
+      while( A.nonZeros(i) == 0UL ) ++i;
+      A.erase( i, A.begin(i) );
+
+      try {
+         multiply( C, plan, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with a different sparsity pattern succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given plan against the given reference product.
+//
+// \param plan The plan to be checked.
+// \param expected The expected product.
+// \param products The expected number of scalar products.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions, the number of non-zero elements per row, and the number
+// of scalar products of the given plan. Since the reference product may contain explicit zeros
+// only in case of cancellation, the test matrices are restricted to positive values. In case a
+// difference is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::checkPlan( const blaze::SpGEMMPlan& plan, const MT& expected, size_t products ) const
+{
+   bool equal( plan.rows() == expected.rows() && plan.columns() == expected.columns() &&
+               plan.nonZeros() == expected.nonZeros() && plan.products() == products );
+
+   for( size_t i=0UL; equal && i<plan.rows(); ++i ) {
+      if( plan.nonZeros(i) != expected.nonZeros(i) )
+         equal = false;
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid plan detected\n"
+          << " Details:\n"
+          << "   Rows     : " << plan.rows() << " (expected " << expected.rows() << ")\n"
+          << "   Columns  : " << plan.columns() << " (expected " << expected.columns() << ")\n"
+          << "   Non-zeros: " << plan.nonZeros() << " (expected " << expected.nonZeros() << ")\n"
+          << "   Products : " << plan.products() << " (expected " << products << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace spgemmplan
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SpGEMMPlan class test..." << std::endl;
+
+   try
+   {
+      RUN_SPGEMMPLAN_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SpGEMMPlan class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,666 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/staticmatrixbatch/ClassTest.cpp
+//  \brief Source file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/staticmatrixbatch/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StaticMatrixBatch class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testTranspose();
+   testMatVecMult();
+   testResize();
+   testSubbatch();
+   testSwap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the StaticMatrixBatch class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "StaticMatrixBatch default constructor";
+
+      MB batch;
+
+      checkSize( batch, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "StaticMatrixBatch size constructor";
+
+      MB batch( 13UL );
+
+      checkSize( batch, 13UL );
+   }
+
+   // Homogeneous initialization
+   {
+      test_ = "StaticMatrixBatch homogeneous initialization constructor";
+
+      MB batch( 13UL, 2.0 );
+
+      checkMembers( batch, MV( 13UL, MT( 2.0 ) ) );
+   }
+
+   // Copy constructor
+   {
+      test_ = "StaticMatrixBatch copy constructor";
+
+      MB batch1;
+      MV ref;
+      initialize( batch1, ref, 13UL );
+
+      MB batch2( batch1 );
+
+      checkMembers( batch2, ref );
+   }
+
+   // Conversion constructor
+   {
+      test_ = "StaticMatrixBatch conversion constructor";
+
+      MB batch1, batch2;
+      MV ref1, ref2;
+      initialize( batch1, ref1, 13UL );
+      initialize( batch2, ref2, 13UL );
+
+      MB batch3( batch1 + batch2 );
+
+      MV ref( 13UL );
+      for( size_t k=0UL; k<13UL; ++k )
+         ref[k] = ref1[k] + ref2[k];
+
+      checkMembers( batch3, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the StaticMatrixBatch class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   // Homogeneous assignment
+   {
+      test_ = "StaticMatrixBatch homogeneous assignment";
+
+      MB batch( 9UL );
+      batch = 3.0;
+
+      checkMembers( batch, MV( 9UL, MT( 3.0 ) ) );
+   }
+
+   // Copy assignment
+   {
+      test_ = "StaticMatrixBatch copy assignment";
+
+      MB batch1, batch2( 5UL, 1.0 );
+      MV ref;
+      initialize( batch1, ref, 21UL );
+
+      batch2 = batch1;
+
+      checkMembers( batch2, ref );
+   }
+
+   // Batch expression assignment
+   {
+      test_ = "StaticMatrixBatch batch expression assignment";
+
+      MB batch1, batch2, batch3( 3UL, 1.0 );
+      MV ref1, ref2;
+      initialize( batch1, ref1, 21UL );
+      initialize( batch2, ref2, 21UL );
+
+      batch3 = batch1 - batch2;
+
+      MV ref( 21UL );
+      for( size_t k=0UL; k<21UL; ++k )
+         ref[k] = ref1[k] - ref2[k];
+
+      checkMembers( batch3, ref );
+   }
+
+   // Aliased batch expression assignment
+   {
+      test_ = "StaticMatrixBatch aliased batch expression assignment";
+
+      MB batch1, batch2;
+      MV ref1, ref2;
+      initialize( batch1, ref1, 21UL );
+      initialize( batch2, ref2, 21UL );
+
+      batch1 = batch1 * batch2 + batch1;
+
+      MV ref( 21UL );
+      for( size_t k=0UL; k<21UL; ++k )
+         ref[k] = ref1[k] * ref2[k] + ref1[k];
+
+      checkMembers( batch1, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch addition assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operator of the StaticMatrixBatch
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   // Batch addition assignment
+   {
+      test_ = "StaticMatrixBatch batch addition assignment";
+
+      MB batch1, batch2;
+      MV ref1, ref2;
+      initialize( batch1, ref1, 17UL );
+      initialize( batch2, ref2, 17UL );
+
+      batch1 += batch2;
+
+      for( size_t k=0UL; k<17UL; ++k )
+         ref1[k] += ref2[k];
+
+      checkMembers( batch1, ref1 );
+   }
+
+   // Batch addition assignment with non-matching sizes
+   {
+      test_ = "StaticMatrixBatch batch addition assignment with non-matching sizes";
+
+      MB batch1( 17UL, 1.0 ), batch2( 16UL, 1.0 );
+
+      try {
+         batch1 += batch2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-matching batches succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch subtraction assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operator of the StaticMatrixBatch
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   // Batch subtraction assignment
+   {
+      test_ = "StaticMatrixBatch batch subtraction assignment";
+
+      MB batch1, batch2;
+      MV ref1, ref2;
+      initialize( batch1, ref1, 17UL );
+      initialize( batch2, ref2, 17UL );
+
+      batch1 -= batch2;
+
+      for( size_t k=0UL; k<17UL; ++k )
+         ref1[k] -= ref2[k];
+
+      checkMembers( batch1, ref1 );
+   }
+
+   // Batch subtraction assignment with non-matching sizes
+   {
+      test_ = "StaticMatrixBatch batch subtraction assignment with non-matching sizes";
+
+      MB batch1( 17UL, 1.0 ), batch2( 16UL, 1.0 );
+
+      try {
+         batch1 -= batch2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of non-matching batches succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch multiplication assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operator of the
+// StaticMatrixBatch class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   test_ = "StaticMatrixBatch batch multiplication assignment";
+
+   MB batch1, batch2;
+   MV ref1, ref2;
+   initialize( batch1, ref1, 19UL );
+   initialize( batch2, ref2, 19UL );
+
+   batch1 *= batch2;
+
+   for( size_t k=0UL; k<19UL; ++k )
+      ref1[k] *= ref2[k];
+
+   checkMembers( batch1, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all StaticMatrixBatch (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// StaticMatrixBatch class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   // Self-scaling (A*=s)
+   {
+      test_ = "StaticMatrixBatch self-scaling (A*=s)";
+
+      MB batch;
+      MV ref;
+      initialize( batch, ref, 11UL );
+
+      batch *= 2;
+
+      for( size_t k=0UL; k<11UL; ++k )
+         ref[k] *= 2.0;
+
+      checkMembers( batch, ref );
+   }
+
+   // Scaling (A=B*s and A=s*B)
+   {
+      test_ = "StaticMatrixBatch scaling (A=B*s and A=s*B)";
+
+      MB batch1, batch2;
+      MV ref1;
+      initialize( batch1, ref1, 11UL );
+
+      batch2 = batch1 * 3.0 + 0.5 * batch1;
+
+      MV ref( 11UL );
+      for( size_t k=0UL; k<11UL; ++k )
+         ref[k] = ref1[k] * 3.0 + 0.5 * ref1[k];
+
+      checkMembers( batch2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transposition of StaticMatrixBatch and StaticVectorBatch instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the member-wise transposition of batches. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   // Transposition of a batch of rectangular matrices
+   {
+      test_ = "StaticMatrixBatch transposition of rectangular matrices";
+
+      RMB batch1;
+      RMV ref1;
+      initialize( batch1, ref1, 15UL );
+
+      blaze::StaticMatrixBatch<double,3UL,2UL> batch2( trans( batch1 ) );
+
+      typedef blaze::StaticMatrix<double,3UL,2UL>  TRMT;
+
+      std::vector< TRMT, blaze::AlignedAllocator<TRMT> > ref( 15UL );
+      for( size_t k=0UL; k<15UL; ++k )
+         ref[k] = trans( ref1[k] );
+
+      checkMembers( batch2, ref );
+   }
+
+   // Transposition of a batch of column vectors
+   {
+      test_ = "StaticVectorBatch transposition of column vectors";
+
+      VB batch1;
+      VV ref1;
+      initialize( batch1, ref1, 15UL );
+
+      TVB batch2( trans( batch1 ) );
+
+      TVV ref( 15UL );
+      for( size_t k=0UL; k<15UL; ++k )
+         ref[k] = trans( ref1[k] );
+
+      checkMembers( batch2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the matrix/vector multiplications of StaticMatrixBatch and StaticVectorBatch.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the member-wise matrix/vector and vector/matrix
+// multiplications between batches. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   // Matrix/vector multiplication
+   {
+      test_ = "StaticMatrixBatch/StaticVectorBatch multiplication";
+
+      MB mat;
+      VB vec1, vec2;
+      MV ref1;
+      VV ref2, ref3;
+      initialize( mat , ref1, 23UL );
+      initialize( vec1, ref2, 23UL );
+      initialize( vec2, ref3, 23UL );
+
+      vec2 += mat * vec1;
+
+      for( size_t k=0UL; k<23UL; ++k )
+         ref3[k] += ref1[k] * ref2[k];
+
+      checkMembers( vec2, ref3 );
+   }
+
+   // Vector/matrix multiplication
+   {
+      test_ = "StaticVectorBatch/StaticMatrixBatch multiplication";
+
+      MB mat;
+      TVB vec1, vec2;
+      MV ref1;
+      TVV ref2;
+      initialize( mat , ref1, 23UL );
+      initialize( vec1, ref2, 23UL );
+
+      vec2 = vec1 * mat;
+
+      TVV ref( 23UL );
+      for( size_t k=0UL; k<23UL; ++k )
+         ref[k] = ref2[k] * ref1[k];
+
+      checkMembers( vec2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() and clear() member functions of StaticMatrixBatch.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() and clear() member functions of the
+// StaticMatrixBatch class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "StaticMatrixBatch::resize()";
+
+   MB batch;
+   MV ref;
+   initialize( batch, ref, 13UL );
+
+   // Increasing the size of the batch
+   batch.resize( 27UL );
+   ref.resize( 27UL, MT( 0.0 ) );
+
+   checkMembers( batch, ref );
+
+   // Decreasing the size of the batch
+   batch.resize( 5UL );
+   ref.resize( 5UL );
+
+   checkMembers( batch, ref );
+
+   // Increasing the size of the batch within the last block
+   batch.resize( 6UL );
+   ref.resize( 6UL, MT( 0.0 ) );
+
+   checkMembers( batch, ref );
+
+   // Clearing the batch
+   test_ = "StaticMatrixBatch::clear()";
+
+   clear( batch );
+
+   checkSize( batch, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the subbatch() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subbatch() function for StaticMatrixBatch instances.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubbatch()
+{
+   typedef blaze::IntrinsicTrait<double>  IT;
+
+   // Assignment to a subbatch
+   {
+      test_ = "StaticMatrixBatch subbatch assignment";
+
+      MB batch1, batch2, batch3;
+      MV ref1, ref2, ref3;
+      initialize( batch1, ref1, 31UL );
+      initialize( batch2, ref2, 31UL );
+      initialize( batch3, ref3, 31UL );
+
+      blaze::SubBatch<MB> sb( subbatch( batch3, IT::size, 31UL-IT::size ) );
+      sb = subbatch( batch1 * batch2, IT::size, 31UL-IT::size );
+
+      for( size_t k=IT::size; k<31UL; ++k )
+         ref3[k] = ref1[k] * ref2[k];
+
+      checkMembers( batch3, ref3 );
+   }
+
+   // Invalid subbatch specification
+   if( IT::size > 1UL )
+   {
+      test_ = "StaticMatrixBatch invalid subbatch specification";
+
+      MB batch( 31UL, 1.0 );
+
+      try {
+         subbatch( batch, 1UL, IT::size );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an unaligned subbatch succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the StaticMatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the StaticMatrixBatch class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "StaticMatrixBatch swap";
+
+   MB batch1, batch2;
+   MV ref1, ref2;
+   initialize( batch1, ref1, 7UL );
+   initialize( batch2, ref2, 12UL );
+
+   swap( batch1, batch2 );
+
+   checkMembers( batch1, ref2 );
+   checkMembers( batch2, ref1 );
+}
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running StaticMatrixBatch class test..." << std::endl;
+
+   try
+   {
+      RUN_STATICMATRIXBATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during StaticMatrixBatch class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
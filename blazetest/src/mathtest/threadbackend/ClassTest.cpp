@@ -0,0 +1,563 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/threadbackend/ClassTest.cpp
+//  \brief Source file for the thread backend test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <blazetest/mathtest/threadbackend/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace threadbackend {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread backend class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   Backend::resize( 4UL, true );
+
+   testWait();
+   testConcurrentCallers();
+   testException();
+   testNestedWait();
+   testTaskActivity();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the wait() function of the thread backend.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the wait() function returns as soon as all tasks of the calling
+// thread have been completed, even if a task that has been scheduled independently of the
+// calling thread is still running. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testWait()
+{
+   test_ = "Waiting for the tasks of the calling thread";
+
+   boost::atomic<size_t> started ( 0UL );
+   boost::atomic<size_t> finished( 0UL );
+   boost::atomic<bool>   release ( false );
+
+   Backend::scheduleDetached( boost::bind( &ClassTest::block, &started, &release, &finished ) );
+
+   while( started.load() == 0UL ) {
+      boost::this_thread::yield();
+   }
+
+   boost::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<64UL; ++i ) {
+      Backend::schedule( boost::bind( &ClassTest::increment, &count ) );
+   }
+
+   Backend::wait();
+
+   const size_t blocked( finished.load() );
+
+   release.store( true );
+
+   while( finished.load() == 0UL ) {
+      boost::this_thread::yield();
+   }
+
+   checkCount( count, 64UL );
+
+   if( blocked != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Independent task completed before its release\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of the thread backend by several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several threads that simultaneously schedule tasks and perform SMP
+// dense matrix/dense vector multiplications. Every thread checks that all of its tasks have
+// been completed after the wait() function returned and that its multiplications computed
+// the correct result. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testConcurrentCallers()
+{
+   test_ = "Concurrent callers";
+
+   const size_t n( 400UL );
+
+   MT A( n, n );
+   VT x( n ), ref( n, 0.0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = static_cast<double>( i % 5UL );
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = static_cast<double>( ( i + j ) % 7UL );
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         ref[i] += A(i,j) * x[j];
+      }
+   }
+
+   const size_t callers( 4UL );
+
+   std::vector<std::string> errors( callers );
+   boost::thread_group threads;
+
+   for( size_t i=0UL; i<callers; ++i ) {
+      threads.create_thread( Caller( A, x, ref, errors[i] ) );
+   }
+
+   threads.join_all();
+
+   for( size_t i=0UL; i<callers; ++i ) {
+      if( !errors[i].empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << errors[i] << "\n"
+             << " Details:\n"
+             << "   Calling thread = " << i << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the forwarding of exceptions thrown by scheduled tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a task that fails with an exception among several successful tasks.
+// The wait() function has to rethrow the exception after all tasks have been completed, and a
+// subsequent wait() must not rethrow the same exception again. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testException()
+{
+   test_ = "Exception forwarding";
+
+   boost::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<16UL; ++i ) {
+      if( i == 5UL )
+         Backend::schedule( boost::bind( &ClassTest::fail, &count ) );
+      else
+         Backend::schedule( boost::bind( &ClassTest::increment, &count ) );
+   }
+
+   std::string message;
+
+   try {
+      Backend::wait();
+   }
+   catch( std::runtime_error& ex ) {
+      message = ex.what();
+   }
+
+   if( message != "Task failure" ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exception of the failing task not rethrown\n"
+          << " Details:\n"
+          << "   Message          = \"" << message << "\"\n"
+          << "   Expected message = \"Task failure\"\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCount( count, 16UL );
+
+   for( size_t i=0UL; i<16UL; ++i ) {
+      Backend::schedule( boost::bind( &ClassTest::increment, &count ) );
+   }
+
+   try {
+      Backend::wait();
+   }
+   catch( std::exception& ex ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exception rethrown by a subsequent wait\n"
+          << " Details:\n"
+          << "   Message = \"" << ex.what() << "\"\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCount( count, 32UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of tasks that schedule further tasks and wait for them.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules several tasks that each schedule further tasks and wait for them.
+// In order to check that waiting tasks take part in the execution, the test is performed
+// with a single thread in the thread pool. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedWait()
+{
+   test_ = "Nested waits";
+
+   Backend::resize( 1UL, true );
+
+   boost::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      Backend::schedule( boost::bind( &ClassTest::fork, &count, 8UL ) );
+   }
+
+   Backend::wait();
+
+   checkCount( count, 64UL );
+
+   Backend::resize( 4UL, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the isTaskActive() function of the thread backend.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the isTaskActive() function only returns \a true for worker threads
+// while they execute a scheduled task. Neither the calling thread (also not while it executes
+// tasks of its own task group during the wait) nor a worker thread executing a detached task is
+// marked as busy. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTaskActivity()
+{
+   test_ = "Activity of the executing threads";
+
+   if( Backend::isTaskActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Calling thread marked as busy before scheduling any task\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   boost::atomic<size_t> errors  ( 0UL );
+   boost::atomic<size_t> finished( 0UL );
+
+   for( size_t i=0UL; i<64UL; ++i ) {
+      Backend::schedule( boost::bind( &ClassTest::checkActivity,
+                                      boost::this_thread::get_id(), &errors, &finished ) );
+   }
+
+   Backend::wait();
+
+   checkCount( finished, 64UL );
+
+   if( errors.load() != 0UL || Backend::isTaskActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid activity of the executing threads\n"
+          << " Details:\n"
+          << "   Number of invalid tasks = " << errors.load() << "\n"
+          << "   Calling thread busy     = " << std::boolalpha << Backend::isTaskActive() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   finished.store( 0UL );
+
+   Backend::scheduleDetached( boost::bind( &ClassTest::checkDetachedActivity, &errors, &finished ) );
+
+   while( finished.load() == 0UL ) {
+      boost::this_thread::yield();
+   }
+
+   if( errors.load() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Worker thread executing a detached task marked as busy\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Repeatedly schedules tasks and SMP assignments and checks their completion.
+//
+// \return void
+//
+// In case an error is detected, the error message is stored and the function returns.
+*/
+void ClassTest::Caller::operator()() const
+{
+   for( size_t iteration=0UL; iteration<20UL; ++iteration )
+   {
+      boost::atomic<size_t> count( 0UL );
+
+      for( size_t i=0UL; i<16UL; ++i ) {
+         Backend::schedule( boost::bind( &ClassTest::increment, &count ) );
+      }
+
+      Backend::wait();
+
+      if( count.load() != 16UL ) {
+         *error_ = "Tasks of the calling thread not completed";
+         return;
+      }
+
+      VT y;
+      y = (*A_) * (*x_);
+
+      if( y != *ref_ ) {
+         *error_ = "Invalid result of the matrix/vector multiplication";
+         return;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blocks until it is released.
+//
+// \param started The counter for the started tasks.
+// \param release The flag releasing the task.
+// \param finished The counter for the finished tasks.
+// \return void
+*/
+void ClassTest::block( boost::atomic<size_t>* started, const boost::atomic<bool>* release,
+                       boost::atomic<size_t>* finished )
+{
+   ++(*started);
+
+   while( !release->load() ) {
+      boost::this_thread::yield();
+   }
+
+   ++(*finished);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Increments the given task counter.
+//
+// \param count The task counter.
+// \return void
+*/
+void ClassTest::increment( boost::atomic<size_t>* count )
+{
+   ++(*count);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Increments the given task counter and fails with an exception.
+//
+// \param count The task counter.
+// \return void
+// \exception std::runtime_error Task failure.
+*/
+void ClassTest::fail( boost::atomic<size_t>* count )
+{
+   ++(*count);
+   throw std::runtime_error( "Task failure" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schedules the given number of tasks and waits for their completion.
+//
+// \param count The task counter incremented by the scheduled tasks.
+// \param n The number of tasks to be scheduled.
+// \return void
+*/
+void ClassTest::fork( boost::atomic<size_t>* count, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      Backend::schedule( boost::bind( &ClassTest::increment, count ) );
+   }
+
+   Backend::wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the activity flag of the thread executing a scheduled task.
+//
+// \param caller The thread that scheduled the task.
+// \param errors The counter for the tasks with an invalid activity flag.
+// \param finished The counter for the finished tasks.
+// \return void
+*/
+void ClassTest::checkActivity( boost::thread::id caller, boost::atomic<size_t>* errors,
+                               boost::atomic<size_t>* finished )
+{
+   const bool worker( boost::this_thread::get_id() != caller );
+
+   if( Backend::isTaskActive() != worker )
+      ++(*errors);
+
+   ++(*finished);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the activity flag of the thread executing a detached task.
+//
+// \param errors The counter for the tasks with an invalid activity flag.
+// \param finished The counter for the finished tasks.
+// \return void
+*/
+void ClassTest::checkDetachedActivity( boost::atomic<size_t>* errors, boost::atomic<size_t>* finished )
+{
+   if( Backend::isTaskActive() )
+      ++(*errors);
+
+   ++(*finished);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of executed tasks.
+//
+// \param count The task counter.
+// \param expected The expected number of executed tasks.
+// \return void
+// \exception std::runtime_error Invalid number of executed tasks.
+*/
+void ClassTest::checkCount( const boost::atomic<size_t>& count, size_t expected ) const
+{
+   if( count.load() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Number of executed tasks = " << count.load() << "\n"
+          << "   Expected number          = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadbackend
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread backend class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADBACKEND_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread backend class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
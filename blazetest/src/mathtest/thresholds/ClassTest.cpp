@@ -0,0 +1,586 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/thresholds/ClassTest.cpp
+//  \brief Source file for the runtime threshold test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/thresholds/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the runtime threshold class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_      ()                                   // Label of the currently performed test
+   , file_      ( "ClassTest.thresholds" )           // Name of the temporary tuning file
+   , thresholds_( blaze::thresholdValues(),          // The initial values of all runtime thresholds
+                  blaze::thresholdValues()+blaze::thresholdCount )
+{
+   testReadThresholds();
+   testSetThreshold();
+   testLoadThresholds();
+   testEvaluation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parsing of tuning files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the readThresholds() function in strict and lenient mode. It checks
+// that comments and empty lines are ignored and that unknown names, missing values, trailing
+// tokens, and BLAS thresholds of 0 are rejected in strict mode and skipped in lenient mode.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReadThresholds()
+{
+   test_ = "Reading comments and empty lines";
+
+   checkRead( "# Tuned thresholds\n\n   \nSMP_DVECASSIGN_THRESHOLD 100  # Comment\n"
+              "# DMATDVECMULT_THRESHOLD 5\n", true , true, "SMP_DVECASSIGN_THRESHOLD", 100UL );
+   checkRead( "# DMATDVECMULT_THRESHOLD 5\n", true, true, "DMATDVECMULT_THRESHOLD", 1UL );
+   checkRead( "\tSMP_DVECDVECADD_THRESHOLD\t200", true, true, "SMP_DVECDVECADD_THRESHOLD", 200UL );
+
+   test_ = "Reading unknown threshold names";
+
+   checkRead( "UNKNOWN_THRESHOLD 10\nSMP_DVECDVECADD_THRESHOLD 200\n", true , false,
+              "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "UNKNOWN_THRESHOLD 10\nSMP_DVECDVECADD_THRESHOLD 200\n", false, true,
+              "SMP_DVECDVECADD_THRESHOLD", 200UL );
+   checkRead( "smp_dvecdvecadd_threshold 200\n", false, true, "SMP_DVECDVECADD_THRESHOLD", 1UL );
+
+   test_ = "Reading missing and invalid values";
+
+   checkRead( "SMP_DVECDVECADD_THRESHOLD\n"    , true , false, "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECDVECADD_THRESHOLD\n"    , false, true , "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECDVECADD_THRESHOLD abc\n", true , false, "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECDVECADD_THRESHOLD abc\n", false, true , "SMP_DVECDVECADD_THRESHOLD", 1UL );
+
+   test_ = "Reading trailing tokens";
+
+   checkRead( "SMP_DVECDVECADD_THRESHOLD 200 300\n", true , false, "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECDVECADD_THRESHOLD 200 300\n", false, true , "SMP_DVECDVECADD_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECDVECADD_THRESHOLD 200 x\n"  , false, true , "SMP_DVECDVECADD_THRESHOLD", 1UL );
+
+   test_ = "Reading thresholds of 0";
+
+   checkRead( "DMATDVECMULT_THRESHOLD 0\n"  , true , false, "DMATDVECMULT_THRESHOLD"  , 1UL );
+   checkRead( "DMATDVECMULT_THRESHOLD 0\n"  , false, true , "DMATDVECMULT_THRESHOLD"  , 1UL );
+   checkRead( "TDMATTDMATMULT_THRESHOLD 0\n", true , false, "TDMATTDMATMULT_THRESHOLD", 1UL );
+   checkRead( "TDMATTDMATMULT_THRESHOLD 0\n", false, true , "TDMATTDMATMULT_THRESHOLD", 1UL );
+   checkRead( "SMP_DVECASSIGN_THRESHOLD 0\n", true , true , "SMP_DVECASSIGN_THRESHOLD", 0UL );
+   checkRead( "SMP_DVECASSIGN_THRESHOLD 0\n", false, true , "SMP_DVECASSIGN_THRESHOLD", 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the getThreshold() and setThreshold() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the getThreshold() and setThreshold() functions. It checks that valid
+// values are applied to both the named threshold and the according threshold constant and
+// that unknown names and BLAS thresholds of 0 are rejected without changing any threshold.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSetThreshold()
+{
+   test_ = "Setting valid thresholds";
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 12345UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 12345UL );
+
+   if( static_cast<size_t>( blaze::SMP_DVECASSIGN_THRESHOLD ) != 12345UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold constant not updated\n"
+          << " Details:\n"
+          << "   Value of the constant = " << static_cast<size_t>( blaze::SMP_DVECASSIGN_THRESHOLD ) << "\n"
+          << "   Expected value        = 12345\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+
+   blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+   checkThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+
+   test_ = "Setting an unknown threshold";
+
+   try {
+      blaze::setThreshold( "UNKNOWN_THRESHOLD", 10UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::getThreshold( "UNKNOWN_THRESHOLD" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Querying an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   test_ = "Setting a BLAS threshold to 0";
+
+   try {
+      blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a BLAS threshold to 0 succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+
+   restore();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the loadThresholds() function. It checks that a valid tuning file only
+// changes the contained thresholds and that an invalid or missing tuning file results in a
+// \a std::runtime_error exception without changing any threshold. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLoadThresholds()
+{
+   test_ = "Loading a valid tuning file";
+
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 777UL );
+
+   writeFile( "# Tuned thresholds\n"
+              "DMATDVECMULT_THRESHOLD    2250000\n"
+              "\n"
+              "SMP_DVECASSIGN_THRESHOLD  16000  # Comment\n" );
+   blaze::loadThresholds( file_ );
+
+   checkThreshold( "DMATDVECMULT_THRESHOLD"   , 2250000UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD" ,   16000UL );
+   checkThreshold( "SMP_DVECDVECADD_THRESHOLD",     777UL );
+
+   const char* const invalid[] = {
+      "SMP_DVECDVECADD_THRESHOLD 100\nUNKNOWN_THRESHOLD 10\n",
+      "SMP_DVECDVECADD_THRESHOLD 100\nSMP_DVECASSIGN_THRESHOLD 200 300\n",
+      "SMP_DVECDVECADD_THRESHOLD 100\nDMATDVECMULT_THRESHOLD 0\n"
+   };
+
+   for( size_t i=0UL; i<sizeof(invalid)/sizeof(invalid[0]); ++i )
+   {
+      test_ = "Loading an invalid tuning file";
+
+      writeFile( invalid[i] );
+
+      bool thrown( false );
+
+      try {
+         blaze::loadThresholds( file_ );
+      }
+      catch( std::runtime_error& ) {
+         thrown = true;
+      }
+
+      if( !thrown ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading an invalid tuning file succeeded\n"
+             << " Details:\n"
+             << "   Tuning file:\n" << invalid[i];
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkThreshold( "DMATDVECMULT_THRESHOLD"   , 2250000UL );
+      checkThreshold( "SMP_DVECASSIGN_THRESHOLD" ,   16000UL );
+      checkThreshold( "SMP_DVECDVECADD_THRESHOLD",     777UL );
+   }
+
+   std::remove( file_.c_str() );
+
+   test_ = "Loading a missing tuning file";
+
+   bool thrown( false );
+
+   try {
+      blaze::loadThresholds( file_ );
+   }
+   catch( std::runtime_error& ) {
+      thrown = true;
+   }
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a missing tuning file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   restore();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of operations with modified runtime thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function evaluates several dense vector and matrix operations once with all SMP
+// thresholds set to 0 (i.e. all operations are executed in parallel) and once with all SMP
+// thresholds set to a huge value (i.e. all operations are executed serially). In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEvaluation()
+{
+   const char* const* names( blaze::thresholdNames() );
+
+   test_ = "Parallel evaluation with runtime thresholds";
+
+   for( size_t i=8UL; i<blaze::thresholdCount; ++i ) {
+      blaze::setThreshold( names[i], 0UL );
+   }
+
+   evaluate();
+
+   test_ = "Serial evaluation with runtime thresholds";
+
+   for( size_t i=8UL; i<blaze::thresholdCount; ++i ) {
+      blaze::setThreshold( names[i], 1000000000UL );
+   }
+
+   evaluate();
+
+   restore();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a single readThresholds() call.
+//
+// \param input The content of the tuning file.
+// \param strict \a true for the strict mode, \a false for the lenient mode.
+// \param result The expected result of the readThresholds() function.
+// \param name The name of the threshold to be checked.
+// \param value The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads the given tuning file into a set of thresholds that are all initialized
+// to 1 and checks both the result of the readThresholds() function and, in case the expected
+// result is \a true, the value of the given threshold. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::checkRead( const std::string& input, bool strict, bool result,
+                           const std::string& name, size_t value )
+{
+   std::vector<size_t> values( blaze::thresholdCount, 1UL );
+   std::istringstream is( input );
+
+   const bool success( blaze::readThresholds( is, &values[0], strict ) );
+
+   if( success != result ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected result of the tuning file parser\n"
+          << " Details:\n"
+          << "   Mode:\n" << ( strict ? "     strict\n" : "     lenient\n" )
+          << "   Result:\n     " << std::boolalpha << success << "\n"
+          << "   Expected result:\n     " << result << "\n"
+          << "   Tuning file:\n" << input << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( result && values[blaze::thresholdIndex( name )] != value ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value\n"
+          << " Details:\n"
+          << "   Mode:\n" << ( strict ? "     strict\n" : "     lenient\n" )
+          << "   Threshold:\n     " << name << "\n"
+          << "   Value:\n     " << values[blaze::thresholdIndex( name )] << "\n"
+          << "   Expected value:\n     " << value << "\n"
+          << "   Tuning file:\n" << input << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given runtime threshold.
+//
+// \param name The name of the threshold to be checked.
+// \param value The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkThreshold( const std::string& name, size_t value ) const
+{
+   if( blaze::getThreshold( name ) != value ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value\n"
+          << " Details:\n"
+          << "   Threshold:\n     " << name << "\n"
+          << "   Value:\n     " << blaze::getThreshold( name ) << "\n"
+          << "   Expected value:\n     " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the temporary tuning file.
+//
+// \param content The content of the tuning file.
+// \return void
+// \exception std::runtime_error Tuning file could not be written.
+*/
+void ClassTest::writeFile( const std::string& content ) const
+{
+   std::ofstream os( file_.c_str() );
+   os << content;
+
+   if( !os ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Tuning file '" << file_ << "' could not be written\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluating several dense operations and comparing the results to a manual computation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::evaluate()
+{
+   const size_t n( 200UL );
+
+   VT a( n ), b( n ), c( n );
+   MT A( n, n ), B( n, n ), C( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = static_cast<double>( i % 7UL ) + 1.0;
+      b[i] = static_cast<double>( i % 5UL ) - 2.0;
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = static_cast<double>( ( i + j ) % 3UL );
+      }
+   }
+
+   c = a + b;
+   c += a;
+   B = A * 2.0;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( c[i] != 2.0*a[i] + b[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dense vector addition result\n"
+             << " Details:\n"
+             << "   Index          = " << i << "\n"
+             << "   Result         = " << c[i] << "\n"
+             << "   Expected value = " << 2.0*a[i] + b[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      for( size_t j=0UL; j<n; ++j ) {
+         if( B(i,j) != 2.0*A(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid dense matrix scaling result\n"
+                << " Details:\n"
+                << "   Index          = (" << i << "," << j << ")\n"
+                << "   Result         = " << B(i,j) << "\n"
+                << "   Expected value = " << 2.0*A(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   c = A * a;
+   C = A * B;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      double ref( 0.0 );
+      for( size_t k=0UL; k<n; ++k ) {
+         ref += A(i,k) * a[k];
+      }
+
+      if( c[i] != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dense matrix/dense vector multiplication result\n"
+             << " Details:\n"
+             << "   Index          = " << i << "\n"
+             << "   Result         = " << c[i] << "\n"
+             << "   Expected value = " << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t j=0UL; j<n; ++j )
+      {
+         double sum( 0.0 );
+         for( size_t k=0UL; k<n; ++k ) {
+            sum += A(i,k) * B(k,j);
+         }
+
+         if( C(i,j) != sum ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid dense matrix/dense matrix multiplication result\n"
+                << " Details:\n"
+                << "   Index          = (" << i << "," << j << ")\n"
+                << "   Result         = " << C(i,j) << "\n"
+                << "   Expected value = " << sum << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restoring the initial values of all runtime thresholds.
+//
+// \return void
+*/
+void ClassTest::restore() const
+{
+   const char* const* names( blaze::thresholdNames() );
+
+   for( size_t i=0UL; i<blaze::thresholdCount; ++i ) {
+      blaze::setThreshold( names[i], thresholds_[i] );
+   }
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime threshold class test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime threshold class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
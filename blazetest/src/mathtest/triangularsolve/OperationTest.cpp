@@ -0,0 +1,880 @@
+//=================================================================================================
+/*!
+//  \file blazetest/src/mathtest/triangularsolve/OperationTest.cpp
+//  \brief Source file for the sparse triangular solve operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/triangularsolve/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace triangularsolve {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testForwardSubstitution();
+   testBackSubstitution();
+   testAdaptors();
+   testLevelSchedule();
+   testScheduledSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the \c forwardSubstitution() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c forwardSubstitution() function for row-major and
+// column-major matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testForwardSubstitution()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major forwardSubstitution()";
+
+      MT A;
+      initExample( A );
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 2.0; b[1] = 9.0; b[2] = 21.0; b[3] = 21.0;
+
+      blaze::forwardSubstitution( A, x, b );
+
+      if( x[0] != 1.0 || x[1] != 2.0 || x[2] != 3.0 || x[3] != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Forward substitution failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 1 2 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major in-place forwardSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( b );
+      blaze::forwardSubstitution( A, x, x );
+
+      checkSolution( A, true, x, b );
+   }
+
+   {
+      test_ = "Row-major forwardSubstitution() with missing diagonal element";
+
+      MT A;
+      initExample( A );
+      A.erase( 2UL, 2UL );
+
+      VT b( 4UL, 1.0 ), x( 4UL );
+
+      try {
+         blaze::forwardSubstitution( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Forward substitution with a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major forwardSubstitution() with non-matching vector size";
+
+      MT A;
+      initExample( A );
+
+      VT b( 5UL, 1.0 ), x( 4UL );
+
+      try {
+         blaze::forwardSubstitution( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Forward substitution with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major forwardSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      const OMT tA( A );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( 200UL );
+      blaze::forwardSubstitution( tA, x, b );
+
+      checkSolution( A, true, x, b );
+   }
+
+   {
+      test_ = "Column-major in-place forwardSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      const OMT tA( A );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( b );
+      blaze::forwardSubstitution( tA, x, x );
+
+      checkSolution( A, true, x, b );
+   }
+
+   {
+      test_ = "Column-major forwardSubstitution() with missing diagonal element";
+
+      MT A;
+      initExample( A );
+      A.erase( 3UL, 3UL );
+
+      const OMT tA( A );
+
+      VT b( 4UL, 1.0 ), x( 4UL );
+
+      try {
+         blaze::forwardSubstitution( tA, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Forward substitution with a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c backSubstitution() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c backSubstitution() function for row-major and
+// column-major matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testBackSubstitution()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major backSubstitution()";
+
+      MT A;
+      initExample( A );
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 16.0; b[1] = 16.0; b[2] = 19.0; b[3] = 16.0;
+
+      blaze::backSubstitution( A, x, b );
+
+      if( x[0] != 1.0 || x[1] != 2.0 || x[2] != 3.0 || x[3] != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Back substitution failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 1 2 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major in-place backSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( b );
+      blaze::backSubstitution( A, x, x );
+
+      checkSolution( A, false, x, b );
+   }
+
+   {
+      test_ = "Row-major backSubstitution() with missing diagonal element";
+
+      MT A;
+      initExample( A );
+      A.erase( 0UL, 0UL );
+
+      VT b( 4UL, 1.0 ), x( 4UL );
+
+      try {
+         blaze::backSubstitution( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Back substitution with a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major backSubstitution() of a non-square matrix";
+
+      MT A( 3UL, 4UL );
+      VT b( 3UL, 1.0 ), x( 3UL );
+
+      try {
+         blaze::backSubstitution( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Back substitution with a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major backSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      const OMT tA( A );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( 200UL );
+      blaze::backSubstitution( tA, x, b );
+
+      checkSolution( A, false, x, b );
+   }
+
+   {
+      test_ = "Column-major in-place backSubstitution()";
+
+      MT A;
+      initRandom( A, 200UL, 50UL );
+
+      const OMT tA( A );
+
+      VT b;
+      initRandom( b, 200UL );
+
+      VT x( b );
+      blaze::backSubstitution( tA, x, x );
+
+      checkSolution( A, false, x, b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() functions for triangular adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() functions for sparse LowerMatrix,
+// UniLowerMatrix, UpperMatrix, and UniUpperMatrix adaptors. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAdaptors()
+{
+   {
+      test_ = "LowerMatrix solve()";
+
+      blaze::LowerMatrix<MT> L( 4UL );
+      L(0,0) = 2.0;
+      L(1,0) = 1.0; L(1,1) = 4.0;
+      L(2,1) = 3.0; L(2,2) = 5.0;
+      L(3,0) = 2.0; L(3,2) = 1.0; L(3,3) = 4.0;
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 2.0; b[1] = 9.0; b[2] = 21.0; b[3] = 21.0;
+
+      solve( L, x, b );
+
+      checkSolution( MT( L ), true, x, b );
+   }
+
+   {
+      test_ = "UniLowerMatrix solve()";
+
+      blaze::UniLowerMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > L( 4UL );
+      L(1,0) = 1.0;
+      L(2,1) = 3.0;
+      L(3,0) = 2.0; L(3,2) = 1.0;
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 1.0; b[1] = 3.0; b[2] = 9.0; b[3] = 9.0;
+
+      solve( L, x, b );
+
+      if( x[0] != 1.0 || x[1] != 2.0 || x[2] != 3.0 || x[3] != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Forward substitution failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 1 2 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "UpperMatrix solve()";
+
+      blaze::UpperMatrix<MT> U( 4UL );
+      U(0,0) = 2.0; U(0,1) = 1.0; U(0,3) = 3.0;
+      U(1,1) = 4.0; U(1,3) = 2.0;
+      U(2,2) = 5.0; U(2,3) = 1.0;
+      U(3,3) = 4.0;
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 16.0; b[1] = 16.0; b[2] = 19.0; b[3] = 16.0;
+
+      solve( U, x, b );
+
+      checkSolution( MT( U ), false, x, b );
+   }
+
+   {
+      test_ = "UniUpperMatrix solve()";
+
+      blaze::UniUpperMatrix<MT> U( 4UL );
+      U(0,1) = 1.0; U(0,3) = 3.0;
+      U(1,3) = 2.0;
+      U(2,3) = 1.0;
+
+      VT b( 4UL ), x( 4UL );
+      b[0] = 15.0; b[1] = 10.0; b[2] = 7.0; b[3] = 4.0;
+
+      solve( U, x, b );
+
+      if( x[0] != 1.0 || x[1] != 2.0 || x[2] != 3.0 || x[3] != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Back substitution failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 1 2 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LevelSchedule class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the level-set analysis of the LevelSchedule class. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLevelSchedule()
+{
+   {
+      test_ = "LevelSchedule of a bidiagonal matrix";
+
+      MT A( 5UL, 5UL );
+      for( size_t i=0UL; i<5UL; ++i ) {
+         A(i,i) = 2.0;
+         if( i > 0UL ) A(i,i-1UL) = 1.0;
+      }
+
+      const blaze::LevelSchedule lower( A, true );
+      const blaze::LevelSchedule upper( A, false );
+      const blaze::LevelSchedule tlower( OMT( A ), true );
+
+      if( lower.levels() != 5UL || lower.rows( 3UL ) != 1UL || *lower.begin( 3UL ) != 3UL ||
+          tlower.levels() != 5UL || *tlower.begin( 4UL ) != 4UL ||
+          upper.levels() != 1UL || upper.rows( 0UL ) != 5UL || !lower.isLower() ||
+          upper.isLower() || lower.rows() != 5UL || lower.nonZeros() != 9UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level-set analysis failed\n"
+             << " Details:\n"
+             << "   Levels of the lower part = " << lower.levels() << " (expected 5)\n"
+             << "   Levels of the upper part = " << upper.levels() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "LevelSchedule of a random matrix";
+
+      MT A;
+      initRandom( A, 1000UL, 250UL );
+
+      blaze::LevelSchedule schedule( A, true );
+
+      std::vector<size_t> level( A.rows(), A.rows() );
+      size_t rows( 0UL );
+
+      for( size_t l=0UL; l<schedule.levels(); ++l ) {
+         typedef blaze::LevelSchedule::ConstIterator  ConstIterator;
+         for( ConstIterator it=schedule.begin(l); it!=schedule.end(l); ++it ) {
+            level[*it] = l;
+            ++rows;
+         }
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            if( element->index() < i && level[element->index()] >= level[i] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid level detected\n"
+                   << " Details:\n"
+                   << "   Row " << i << " (level " << level[i] << ") depends on row "
+                   << element->index() << " (level " << level[element->index()] << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( rows != A.rows() || schedule.levels() < 2UL || schedule.levels() > 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level-set analysis failed\n"
+             << " Details:\n"
+             << "   Number of scheduled rows = " << rows << " (expected " << A.rows() << ")\n"
+             << "   Number of levels = " << schedule.levels() << " (expected 2 to 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      schedule.clear();
+
+      if( schedule.rows() != 0UL || schedule.levels() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Clearing the level schedule failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "LevelSchedule of a matrix with missing diagonal element";
+
+      MT A;
+      initExample( A );
+      A.erase( 1UL, 1UL );
+
+      MT I( 2UL, 2UL );
+      I(0,0) = 1.0;
+      I(1,1) = 1.0;
+
+      blaze::LevelSchedule schedule( I, true );
+
+      try {
+         schedule.analyze( A, true );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( schedule.rows() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed analysis modified the level schedule\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the level-scheduled \c solve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the level-scheduled \c solve() function. The matrices are
+// large enough to be solved in parallel in case a parallelization technique is enabled. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testScheduledSolve()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major level-scheduled lower triangular solve()";
+
+      MT A;
+      initRandom( A, 20000UL, 5000UL );
+
+      VT b;
+      initRandom( b, 20000UL );
+
+      const blaze::LevelSchedule schedule( A, true );
+
+      VT x( 20000UL ), y( 20000UL );
+      blaze::solve( A, schedule, x, b );
+      blaze::forwardSubstitution( A, y, b );
+
+      if( x != y ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level-scheduled solve failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolution( A, true, x, b );
+   }
+
+   {
+      test_ = "Row-major level-scheduled in-place upper triangular solve()";
+
+      MT A;
+      initRandom( A, 20000UL, 5000UL );
+
+      VT b;
+      initRandom( b, 20000UL );
+
+      const blaze::LevelSchedule schedule( A, false );
+
+      VT x( b ), y( 20000UL );
+      blaze::solve( A, schedule, x, x );
+      blaze::backSubstitution( A, y, b );
+
+      if( x != y ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level-scheduled solve failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolution( A, false, x, b );
+   }
+
+   {
+      test_ = "Row-major level-scheduled solve() with non-matching matrix";
+
+      MT A;
+      initRandom( A, 100UL, 25UL );
+
+      const blaze::LevelSchedule schedule( A, true );
+
+      A(0,99) = 1.0;
+
+      VT b( 100UL, 1.0 ), x( 100UL );
+
+      try {
+         blaze::solve( A, schedule, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with a non-matching matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major level-scheduled lower triangular solve()";
+
+      MT A;
+      initRandom( A, 5000UL, 1000UL );
+
+      const OMT tA( A );
+
+      VT b;
+      initRandom( b, 5000UL );
+
+      const blaze::LevelSchedule schedule( tA, true );
+
+      VT x( 5000UL );
+      blaze::solve( tA, schedule, x, b );
+
+      checkSolution( A, true, x, b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a triangular system.
+//
+// \param A The row-major system matrix.
+// \param lower \a true for the lower, \a false for the upper triangular part of \a A.
+// \param x The computed solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::runtime_error Invalid solution detected.
+*/
+void OperationTest::checkSolution( const MT& A, bool lower, const VT& x, const VT& b ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      double residual( b[i] );
+
+      for( MT::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         if( element->index() == i || ( element->index() < i ) == lower )
+            residual -= element->value() * x[element->index()];
+      }
+
+      if( std::fabs( residual ) > 1E-10 * ( 1.0 + std::fabs( b[i] ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution detected\n"
+             << " Details:\n"
+             << "   Residual of row " << i << " = " << residual << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given matrix as 4x4 example matrix.
+//
+// \param A The matrix to be initialized.
+// \return void
+//
+// The lower triangular part of the example matrix maps the vector ( 1 2 3 4 ) to ( 2 9 21 21 ),
+// the upper triangular part maps it to ( 16 16 19 16 ).
+*/
+void OperationTest::initExample( MT& A ) const
+{
+   A.resize( 4UL, 4UL, false );
+   A.reset();
+
+   A(0,0) = 2.0; A(0,1) = 1.0; A(0,3) = 3.0;
+   A(1,0) = 1.0; A(1,1) = 4.0; A(1,3) = 2.0;
+   A(2,1) = 3.0; A(2,2) = 5.0; A(2,3) = 1.0;
+   A(3,0) = 2.0; A(3,2) = 1.0; A(3,3) = 4.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix.
+//
+// \param A The matrix to be initialized.
+// \param n The number of rows and columns of the matrix.
+// \param blocksize The number of rows per block.
+// \return void
+//
+// This function initializes the given matrix as diagonally dominant random matrix. Each row
+// contains up to three non-zero elements in the columns of the preceding blocks and up to three
+// non-zero elements in the columns of the subsequent blocks. Therefore both triangular parts of
+// the matrix consist of approximately \f$ n/blocksize \f$ levels.
+*/
+void OperationTest::initRandom( MT& A, size_t n, size_t blocksize ) const
+{
+   A.resize( n, n, false );
+   A.reset();
+   A.reserve( 7UL*n );
+
+   std::vector<size_t> columns;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t first( ( i / blocksize ) * blocksize );
+      const size_t last ( std::min( first + blocksize, n ) );
+
+      columns.clear();
+      columns.push_back( i );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         if( first > 0UL ) columns.push_back( blaze::rand<size_t>( 0UL, first-1UL ) );
+         if( last  < n   ) columns.push_back( blaze::rand<size_t>( last, n-1UL ) );
+      }
+
+      std::sort( columns.begin(), columns.end() );
+      columns.erase( std::unique( columns.begin(), columns.end() ), columns.end() );
+
+      for( size_t k=0UL; k<columns.size(); ++k ) {
+         if( columns[k] == i )
+            A.append( i, i, blaze::rand<double>( 4.0, 5.0 ) );
+         else
+            A.append( i, columns[k], blaze::rand<double>( -1.0, 1.0 ) );
+      }
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given vector.
+//
+// \param b The vector to be initialized.
+// \param n The size of the vector.
+// \return void
+*/
+void OperationTest::initRandom( VT& b, size_t n ) const
+{
+   b.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      b[i] = blaze::rand<double>( -1.0, 1.0 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace triangularsolve
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse triangular solve operation test..." << std::endl;
+
+   try
+   {
+      RUN_TRIANGULARSOLVE_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse triangular solve operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,623 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workstealing/ClassTest.cpp
+//  \brief Source file for the work-stealing deque and pool test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <blazetest/utiltest/workstealing/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealing {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the work-stealing class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDequePushPop();
+   testDequeSteal();
+   testDequeConcurrentSteal();
+   testPoolSchedule();
+   testPoolForkJoin();
+   testPoolResize();
+   testPoolShutdown();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the push() and pop() functions of the WorkStealingDeque class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pushes more tasks than fit into the initial buffer of the deque, such that the
+// deque has to grow several times, and pops them again. The tasks have to be returned in LIFO
+// order. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDequePushPop()
+{
+   test_ = "WorkStealingDeque push() and pop()";
+
+   const size_t N( 1000UL );
+
+   std::vector<size_t> ids, expected;
+
+   {
+      Deque deque;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         deque.push( new Task( boost::bind( &ClassTest::record, &ids, i ) ) );
+      }
+
+      if( deque.size() != N || deque.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid deque size\n"
+             << " Details:\n"
+             << "   Size          = " << deque.size() << "\n"
+             << "   Expected size = " << N << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      while( Task* task = deque.pop() ) {
+         (*task)();
+         delete task;
+      }
+
+      if( deque.size() != 0UL || !deque.isEmpty() || deque.pop() != NULL || deque.steal() != NULL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deque not empty after popping all tasks\n"
+             << " Details:\n"
+             << "   Size = " << deque.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=N; i>0UL; --i ) {
+      expected.push_back( i-1UL );
+   }
+
+   checkOrder( ids, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the steal() function of the WorkStealingDeque class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the interplay of the owner and a thief in a single thread: stolen tasks
+// are returned in FIFO order, popped tasks in LIFO order. Additionally, the destructor of the
+// deque has to destroy the remaining tasks. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDequeSteal()
+{
+   test_ = "WorkStealingDeque steal()";
+
+   std::vector<size_t> ids, expected;
+
+   {
+      Deque deque;
+
+      for( size_t i=0UL; i<200UL; ++i ) {
+         deque.push( new Task( boost::bind( &ClassTest::record, &ids, i ) ) );
+      }
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         Task* task( ( i % 2UL == 0UL )?( deque.steal() ):( deque.pop() ) );
+         if( task == NULL ) break;
+         (*task)();
+         delete task;
+      }
+
+      if( deque.size() != 100UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid deque size\n"
+             << " Details:\n"
+             << "   Size          = " << deque.size() << "\n"
+             << "   Expected size = 100\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=0UL; i<50UL; ++i ) {
+      expected.push_back( i );
+      expected.push_back( 199UL-i );
+   }
+
+   checkOrder( ids, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent steal() function of the WorkStealingDeque class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pushes and pops a large number of tasks while several thieves concurrently
+// steal from the deque. Each task has to be obtained by exactly one thread. In case a task is
+// lost or obtained more than once, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDequeConcurrentSteal()
+{
+   test_ = "WorkStealingDeque concurrent steal()";
+
+   const size_t rounds ( 200UL );
+   const size_t pushes ( 500UL );
+   const size_t pops   ( 200UL );
+   const size_t thieves( 3UL );
+
+   std::vector<Task*> tasks;
+   tasks.reserve( rounds*pushes );
+   for( size_t i=0UL; i<rounds*pushes; ++i ) {
+      tasks.push_back( new Task() );
+   }
+
+   std::vector<Task*> obtained;
+   std::vector< std::vector<Task*> > stolen( thieves );
+
+   {
+      Deque deque;
+      boost::atomic<bool> done( false );
+
+      std::vector<boost::thread*> threads;
+      for( size_t t=0UL; t<thieves; ++t ) {
+         threads.push_back( new boost::thread( Thief( deque, done, stolen[t] ) ) );
+      }
+
+      size_t next( 0UL );
+
+      for( size_t r=0UL; r<rounds; ++r )
+      {
+         for( size_t i=0UL; i<pushes; ++i ) {
+            deque.push( tasks[next++] );
+         }
+
+         for( size_t i=0UL; i<pops; ++i ) {
+            Task* task( deque.pop() );
+            if( task != NULL ) obtained.push_back( task );
+         }
+      }
+
+      while( !deque.isEmpty() ) {
+         Task* task( deque.pop() );
+         if( task != NULL ) obtained.push_back( task );
+      }
+
+      done.store( true );
+
+      for( size_t t=0UL; t<thieves; ++t ) {
+         threads[t]->join();
+         delete threads[t];
+      }
+   }
+
+   for( size_t t=0UL; t<thieves; ++t ) {
+      obtained.insert( obtained.end(), stolen[t].begin(), stolen[t].end() );
+   }
+
+   std::sort( obtained.begin(), obtained.end() );
+   std::sort( tasks.begin(), tasks.end() );
+
+   const bool identical( obtained == tasks );
+
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      delete tasks[i];
+   }
+
+   if( !identical ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lost or duplicated tasks detected\n"
+          << " Details:\n"
+          << "   Number of obtained tasks = " << obtained.size() << "\n"
+          << "   Number of pushed tasks   = " << tasks.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the schedule() and wait() functions of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of tasks and waits for their completion. Each task
+// has to be executed exactly once. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testPoolSchedule()
+{
+   test_ = "WorkStealingPool schedule() and wait()";
+
+   const size_t N( 100000UL );
+
+   std::vector<size_t> counts( N, 0UL );
+   boost::atomic<size_t> total( 0UL );
+
+   Pool pool( 4UL );
+
+   if( pool.size() != 4UL || !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid initial state of the pool\n"
+          << " Details:\n"
+          << "   Size = " << pool.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.schedule( &ClassTest::increment, &counts, &total, i );
+   }
+
+   pool.wait();
+
+   if( !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Pending tasks after wait()\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCounts( counts, total );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of back-to-back fork/join steps of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs many short fork/join steps with one task per worker thread, as they
+// are used by the SMP assignments. After each wait() all tasks of the step have to be complete.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPoolForkJoin()
+{
+   test_ = "WorkStealingPool fork/join steps";
+
+   const size_t steps  ( 2000UL );
+   const size_t threads( 4UL );
+
+   std::vector<size_t> counts( steps*threads, 0UL );
+   boost::atomic<size_t> total( 0UL );
+
+   Pool pool( threads );
+
+   for( size_t s=0UL; s<steps; ++s )
+   {
+      for( size_t i=0UL; i<threads; ++i ) {
+         pool.schedule( &ClassTest::increment, &counts, &total, s*threads+i );
+      }
+
+      pool.wait();
+
+      if( total.load() != (s+1UL)*threads ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incomplete fork/join step\n"
+             << " Details:\n"
+             << "   Step                     = " << s << "\n"
+             << "   Number of executed tasks = " << total.load() << "\n"
+             << "   Expected number          = " << (s+1UL)*threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkCounts( counts, total );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function changes the number of worker threads while tasks are pending. All tasks have
+// to be executed exactly once and an invalid number of threads has to be rejected. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPoolResize()
+{
+   test_ = "WorkStealingPool resize()";
+
+   const size_t N( 10000UL );
+   const size_t sizes[] = { 5UL, 1UL, 3UL, 3UL, 8UL };
+
+   std::vector<size_t> counts( N*5UL, 0UL );
+   boost::atomic<size_t> total( 0UL );
+
+   Pool pool( 2UL );
+
+   for( size_t r=0UL; r<5UL; ++r )
+   {
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( &ClassTest::increment, &counts, &total, r*N+i );
+      }
+
+      pool.resize( sizes[r] );
+
+      if( pool.size() != sizes[r] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid pool size\n"
+             << " Details:\n"
+             << "   Size          = " << pool.size() << "\n"
+             << "   Expected size = " << sizes[r] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   pool.wait();
+
+   checkCounts( counts, total );
+
+   try {
+      pool.resize( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing to zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      Pool invalid( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction with zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the shutdown of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function destroys a pool with pending tasks without calling wait(). The destructor has
+// to execute all pending tasks exactly once before the worker threads terminate. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPoolShutdown()
+{
+   test_ = "WorkStealingPool shutdown";
+
+   const size_t N( 50000UL );
+
+   std::vector<size_t> counts( N, 0UL );
+   boost::atomic<size_t> total( 0UL );
+
+   {
+      Pool pool( 3UL );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( &ClassTest::increment, &counts, &total, i );
+      }
+   }
+
+   checkCounts( counts, total );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Recording the ID of an executed task.
+//
+// \param ids The IDs of the executed tasks.
+// \param id The ID of the executed task.
+// \return void
+*/
+void ClassTest::record( std::vector<size_t>* ids, size_t id )
+{
+   ids->push_back( id );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counting the execution of a task.
+//
+// \param counts The number of executions of each task.
+// \param total The total number of executed tasks.
+// \param id The ID of the executed task.
+// \return void
+*/
+void ClassTest::increment( std::vector<size_t>* counts, boost::atomic<size_t>* total, size_t id )
+{
+   ++(*counts)[id];
+   ++(*total);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the order of the executed tasks.
+//
+// \param ids The IDs of the executed tasks.
+// \param expected The expected IDs.
+// \return void
+// \exception std::runtime_error Invalid order detected.
+*/
+void ClassTest::checkOrder( const std::vector<size_t>& ids, const std::vector<size_t>& expected ) const
+{
+   if( ids.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Number of executed tasks = " << ids.size() << "\n"
+          << "   Expected number          = " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      if( ids[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid order of the executed tasks\n"
+             << " Details:\n"
+             << "   Position    = " << i << "\n"
+             << "   Task        = " << ids[i] << "\n"
+             << "   Expected ID = " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that each task has been executed exactly once.
+//
+// \param counts The number of executions of each task.
+// \param total The total number of executed tasks.
+// \return void
+// \exception std::runtime_error Lost or duplicated task detected.
+*/
+void ClassTest::checkCounts( const std::vector<size_t>& counts, const boost::atomic<size_t>& total ) const
+{
+   if( total.load() != counts.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Number of executed tasks = " << total.load() << "\n"
+          << "   Expected number          = " << counts.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<counts.size(); ++i ) {
+      if( counts[i] != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Task not executed exactly once\n"
+             << " Details:\n"
+             << "   Task                 = " << i << "\n"
+             << "   Number of executions = " << counts[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace workstealing
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running work-stealing class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSTEALING_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during work-stealing class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,157 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/dispatch/AVX512.cpp
+//  \brief Source file for the AVX-512 kernels of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_DISPATCH_MODE
+
+#include <immintrin.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+#include "KernelTable.h"
+
+
+//*************************************************************************************************
+// Instruction set configuration
+//*************************************************************************************************
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx512 {
+
+//=================================================================================================
+//
+//  INTRINSIC OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Intrinsic operations of the AVX-512 instruction set.
+*/
+template< typename T >
+struct Vec;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic operations for float values.
+*/
+template<>
+struct Vec<float>
+{
+   typedef __m512  Type;
+
+   enum { size = 16UL };
+
+   static inline Type load ( const float* p ) { return _mm512_loadu_ps( p ); }
+   static inline void store( float* p, Type a ) { _mm512_storeu_ps( p, a ); }
+   static inline Type set  ( float v ) { return _mm512_set1_ps( v ); }
+   static inline Type setzero() { return _mm512_setzero_ps(); }
+   static inline Type add  ( Type a, Type b ) { return _mm512_add_ps( a, b ); }
+   static inline Type sub  ( Type a, Type b ) { return _mm512_sub_ps( a, b ); }
+   static inline Type mul  ( Type a, Type b ) { return _mm512_mul_ps( a, b ); }
+   static inline Type fmadd( Type a, Type b, Type c ) { return _mm512_fmadd_ps( a, b, c ); }
+
+   static inline float sum( Type a ) {
+      const __m256d h( _mm512_extractf64x4_pd( _mm512_castps_pd( a ), 1 ) );
+      const __m256 b( _mm256_add_ps( _mm512_castps512_ps256( a ), _mm256_castpd_ps( h ) ) );
+      const __m128 c( _mm_add_ps( _mm256_castps256_ps128( b ), _mm256_extractf128_ps( b, 1 ) ) );
+      const __m128 d( _mm_add_ps( c, _mm_movehl_ps( c, c ) ) );
+      return _mm_cvtss_f32( _mm_add_ss( d, _mm_shuffle_ps( d, d, 1 ) ) );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic operations for double values.
+*/
+template<>
+struct Vec<double>
+{
+   typedef __m512d  Type;
+
+   enum { size = 8UL };
+
+   static inline Type load ( const double* p ) { return _mm512_loadu_pd( p ); }
+   static inline void store( double* p, Type a ) { _mm512_storeu_pd( p, a ); }
+   static inline Type set  ( double v ) { return _mm512_set1_pd( v ); }
+   static inline Type setzero() { return _mm512_setzero_pd(); }
+   static inline Type add  ( Type a, Type b ) { return _mm512_add_pd( a, b ); }
+   static inline Type sub  ( Type a, Type b ) { return _mm512_sub_pd( a, b ); }
+   static inline Type mul  ( Type a, Type b ) { return _mm512_mul_pd( a, b ); }
+   static inline Type fmadd( Type a, Type b, Type c ) { return _mm512_fmadd_pd( a, b, c ); }
+
+   static inline double sum( Type a ) {
+      const __m256d b( _mm256_add_pd( _mm512_castpd512_pd256( a ), _mm512_extractf64x4_pd( a, 1 ) ) );
+      const __m128d c( _mm_add_pd( _mm256_castpd256_pd128( b ), _mm256_extractf128_pd( b, 1 ) ) );
+      return _mm_cvtsd_f64( _mm_add_sd( c, _mm_unpackhi_pd( c, c ) ) );
+   }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+#include "Kernels.h"
+
+} // namespace avx512
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#pragma GCC pop_options
+
+#endif
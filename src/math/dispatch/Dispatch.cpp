@@ -0,0 +1,303 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/dispatch/Dispatch.cpp
+//  \brief Source file for the runtime dispatch of the dense kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/Kernels.h>
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_DISPATCH_MODE
+
+#include "KernelTable.h"
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SET DETECTION
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*!\brief Detection of the most powerful instruction set supported by the executing CPU.
+//
+// \return The most powerful supported instruction set.
+//
+// The detection is based on the CPUID information, which also takes the operating system
+// support for the extended register states into account.
+*/
+InstructionSet detectInstructionSet()
+{
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return avx512InstructionSet;
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return avx2InstructionSet;
+   else if( __builtin_cpu_supports( "avx" ) )
+      return avxInstructionSet;
+   else
+      return sse2InstructionSet;
+}
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set of the runtime dispatched kernels.
+// \ingroup math
+//
+// \return The instruction set selected for the executing CPU.
+//
+// This function returns the instruction set of the kernels selected at program startup.
+*/
+InstructionSet instructionSet()
+{
+   static const InstructionSet is( detectInstructionSet() );
+   return is;
+}
+//*************************************************************************************************
+
+
+
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*!\brief Returns the kernel table of the instruction set selected for the executing CPU.
+//
+// \return Reference to the selected kernel table.
+*/
+const KernelTable& activeKernels()
+{
+   static const KernelTable& table( instructionSet() == avx512InstructionSet ? avx512::kernels :
+                                    instructionSet() == avx2InstructionSet   ? avx2::kernels   :
+                                    instructionSet() == avxInstructionSet    ? avx::kernels    :
+                                                                               sse2::kernels );
+   return table;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selection of the kernels at program startup.
+*/
+const KernelTable& startupKernels( activeKernels() );
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched matrix multiplication for single precision operands.
+*/
+void gemm( size_t m, size_t n, size_t k, float alpha,
+           const float* A, size_t ars, size_t acs, const float* B, size_t brs, size_t bcs,
+           float beta, float* C, size_t crs, size_t ccs )
+{
+   activeKernels().sgemm( m, n, k, alpha, A, ars, acs, B, brs, bcs, beta, C, crs, ccs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched matrix multiplication for double precision operands.
+*/
+void gemm( size_t m, size_t n, size_t k, double alpha,
+           const double* A, size_t ars, size_t acs, const double* B, size_t brs, size_t bcs,
+           double beta, double* C, size_t crs, size_t ccs )
+{
+   activeKernels().dgemm( m, n, k, alpha, A, ars, acs, B, brs, bcs, beta, C, crs, ccs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched matrix/vector multiplication for single precision operands.
+*/
+void gemv( size_t m, size_t n, float alpha, const float* A, size_t ars, size_t acs,
+           const float* x, float beta, float* y )
+{
+   activeKernels().sgemv( m, n, alpha, A, ars, acs, x, beta, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched matrix/vector multiplication for double precision operands.
+*/
+void gemv( size_t m, size_t n, double alpha, const double* A, size_t ars, size_t acs,
+           const double* x, double beta, double* y )
+{
+   activeKernels().dgemv( m, n, alpha, A, ars, acs, x, beta, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched inner product for single precision operands.
+*/
+float dot( size_t n, const float* x, const float* y )
+{
+   return activeKernels().sdot( n, x, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched inner product for double precision operands.
+*/
+double dot( size_t n, const double* x, const double* y )
+{
+   return activeKernels().ddot( n, x, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector addition for single precision operands.
+*/
+void add( size_t n, const float* x, const float* y, float* z )
+{
+   activeKernels().sadd( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector addition for double precision operands.
+*/
+void add( size_t n, const double* x, const double* y, double* z )
+{
+   activeKernels().dadd( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector subtraction for single precision operands.
+*/
+void sub( size_t n, const float* x, const float* y, float* z )
+{
+   activeKernels().ssub( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector subtraction for double precision operands.
+*/
+void sub( size_t n, const double* x, const double* y, double* z )
+{
+   activeKernels().dsub( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched componentwise vector multiplication for single precision operands.
+*/
+void mult( size_t n, const float* x, const float* y, float* z )
+{
+   activeKernels().smult( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched componentwise vector multiplication for double precision operands.
+*/
+void mult( size_t n, const double* x, const double* y, double* z )
+{
+   activeKernels().dmult( n, x, y, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector scaling for single precision operands.
+*/
+void scale( size_t n, float s, const float* x, float* z )
+{
+   activeKernels().sscale( n, s, x, z );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched vector scaling for double precision operands.
+*/
+void scale( size_t n, double s, const double* x, double* z )
+{
+   activeKernels().dscale( n, s, x, z );
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
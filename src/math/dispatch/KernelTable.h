@@ -0,0 +1,111 @@
+//=================================================================================================
+/*!
+//  \file src/math/dispatch/KernelTable.h
+//  \brief Header file for the kernel tables of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _SRC_MATH_DISPATCH_KERNELTABLE_H_
+#define _SRC_MATH_DISPATCH_KERNELTABLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Table of the kernels compiled for a specific instruction set.
+// \ingroup math
+//
+// Each instruction set specific source file of the runtime dispatch provides one instance of
+// the KernelTable. The table of the most powerful instruction set supported by the executing
+// CPU is selected once at program startup.
+*/
+struct KernelTable
+{
+   void (*sgemm)( size_t, size_t, size_t, float, const float*, size_t, size_t,
+                  const float*, size_t, size_t, float, float*, size_t, size_t );
+   void (*dgemm)( size_t, size_t, size_t, double, const double*, size_t, size_t,
+                  const double*, size_t, size_t, double, double*, size_t, size_t );
+
+   void (*sgemv)( size_t, size_t, float, const float*, size_t, size_t, const float*, float, float* );
+   void (*dgemv)( size_t, size_t, double, const double*, size_t, size_t, const double*, double, double* );
+
+   float  (*sdot)( size_t, const float* , const float*  );
+   double (*ddot)( size_t, const double*, const double* );
+
+   void (*sadd)( size_t, const float* , const float* , float*  );
+   void (*dadd)( size_t, const double*, const double*, double* );
+
+   void (*ssub)( size_t, const float* , const float* , float*  );
+   void (*dsub)( size_t, const double*, const double*, double* );
+
+   void (*smult)( size_t, const float* , const float* , float*  );
+   void (*dmult)( size_t, const double*, const double*, double* );
+
+   void (*sscale)( size_t, float , const float* , float*  );
+   void (*dscale)( size_t, double, const double*, double* );
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+namespace sse2   { extern const KernelTable kernels; }  //!< The SSE2 kernels.
+namespace avx    { extern const KernelTable kernels; }  //!< The AVX kernels.
+namespace avx2   { extern const KernelTable kernels; }  //!< The AVX2/FMA kernels.
+namespace avx512 { extern const KernelTable kernels; }  //!< The AVX-512 kernels.
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
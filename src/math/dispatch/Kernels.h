@@ -0,0 +1,613 @@
+//=================================================================================================
+/*!
+//  \file src/math/dispatch/Kernels.h
+//  \brief Header file for the instruction set independent implementation of the dispatched kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//
+// Note that this file is deliberately not protected by an include guard: it is included once by
+// each instruction set specific source file of the runtime dispatch, inside the namespace of the
+// according instruction set and after the definition of the Vec class template, which wraps the
+// intrinsic vector type and the intrinsic operations of the instruction set for \c float and
+// \c double values.
+
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocking parameters of the packed matrix multiplication kernel.
+//
+// The register block of the micro-kernel consists of \a mr rows and \a nr columns (i.e. two
+// intrinsic vectors). The blocks are chosen analogously to the blaze::MMMBlocking parameters
+// of the compile time kernel.
+*/
+template< typename T >  // Type of the matrix elements
+struct Blocking
+{
+ private:
+   //**********************************************************************************************
+   static const size_t kmax = 16384UL / ( size_t( Vec<T>::size ) * 2UL * sizeof(T) );
+   static const size_t kval = ( kmax < 64UL )?( 64UL ):( ( kmax > 512UL )?( 512UL ):( kmax ) );
+   static const size_t mmax = ( cacheSize / 8UL ) / kval / sizeof(T);
+   static const size_t nmax = ( cacheSize / 2UL ) / kval / sizeof(T);
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   static const size_t mr = 6UL;
+   static const size_t nr = size_t( Vec<T>::size ) * 2UL;
+   static const size_t kc = kval;
+   static const size_t mc = ( mmax < mr )?( mr ):( mmax - mmax % mr );
+   static const size_t nc = ( nmax < nr )?( nr ):( nmax - nmax % nr );
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Inner product of two contiguous vectors (\f$ s=\vec{x}^T*\vec{y} \f$).
+*/
+template< typename T >
+T dot( size_t n, const T* x, const T* y )
+{
+   typedef Vec<T>             V;
+   typedef typename V::Type  VT;
+
+   const size_t S( V::size );
+   const size_t end( n - n % ( 4UL*S ) );
+
+   VT xmm1( V::setzero() ), xmm2( V::setzero() ), xmm3( V::setzero() ), xmm4( V::setzero() );
+
+   for( size_t i=0UL; i<end; i+=4UL*S ) {
+      xmm1 = V::fmadd( V::load( x+i     ), V::load( y+i     ), xmm1 );
+      xmm2 = V::fmadd( V::load( x+i+S   ), V::load( y+i+S   ), xmm2 );
+      xmm3 = V::fmadd( V::load( x+i+2*S ), V::load( y+i+2*S ), xmm3 );
+      xmm4 = V::fmadd( V::load( x+i+3*S ), V::load( y+i+3*S ), xmm4 );
+   }
+
+   T sp( V::sum( V::add( V::add( xmm1, xmm2 ), V::add( xmm3, xmm4 ) ) ) );
+
+   for( size_t i=end; i<n; ++i )
+      sp += x[i] * y[i];
+
+   return sp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of two contiguous vectors (\f$ \vec{z}=\vec{x}+\vec{y} \f$).
+*/
+template< typename T >
+void add( size_t n, const T* x, const T* y, T* z )
+{
+   typedef Vec<T>  V;
+
+   const size_t S( V::size );
+   const size_t end( n - n % S );
+
+   for( size_t i=0UL; i<end; i+=S )
+      V::store( z+i, V::add( V::load( x+i ), V::load( y+i ) ) );
+   for( size_t i=end; i<n; ++i )
+      z[i] = x[i] + y[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of two contiguous vectors (\f$ \vec{z}=\vec{x}-\vec{y} \f$).
+*/
+template< typename T >
+void sub( size_t n, const T* x, const T* y, T* z )
+{
+   typedef Vec<T>  V;
+
+   const size_t S( V::size );
+   const size_t end( n - n % S );
+
+   for( size_t i=0UL; i<end; i+=S )
+      V::store( z+i, V::sub( V::load( x+i ), V::load( y+i ) ) );
+   for( size_t i=end; i<n; ++i )
+      z[i] = x[i] - y[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise multiplication of two contiguous vectors (\f$ \vec{z}=\vec{x}*\vec{y} \f$).
+*/
+template< typename T >
+void mult( size_t n, const T* x, const T* y, T* z )
+{
+   typedef Vec<T>  V;
+
+   const size_t S( V::size );
+   const size_t end( n - n % S );
+
+   for( size_t i=0UL; i<end; i+=S )
+      V::store( z+i, V::mul( V::load( x+i ), V::load( y+i ) ) );
+   for( size_t i=end; i<n; ++i )
+      z[i] = x[i] * y[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of a contiguous vector (\f$ \vec{z}=s*\vec{x} \f$).
+*/
+template< typename T >
+void scale( size_t n, T s, const T* x, T* z )
+{
+   typedef Vec<T>             V;
+   typedef typename V::Type  VT;
+
+   const size_t S( V::size );
+   const size_t end( n - n % S );
+   const VT factor( V::set( s ) );
+
+   for( size_t i=0UL; i<end; i+=S )
+      V::store( z+i, V::mul( V::load( x+i ), factor ) );
+   for( size_t i=end; i<n; ++i )
+      z[i] = x[i] * s;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+//
+// In case the rows of \a A are contiguous, four rows are processed simultaneously by inner
+// products. In case the columns of \a A are contiguous, \a y is updated by the linear
+// combination of four columns at a time. In case \a beta is zero, \a y is not read.
+*/
+template< typename T >
+void gemv( size_t m, size_t n, T alpha, const T* A, size_t ars, size_t acs,
+           const T* x, T beta, T* y )
+{
+   typedef Vec<T>             V;
+   typedef typename V::Type  VT;
+
+   const size_t S( V::size );
+   const size_t jend( n - n % S );
+
+   if( acs == 1UL )
+   {
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= m; i+=4UL )
+      {
+         const T* a1( A + (i    )*ars );
+         const T* a2( A + (i+1UL)*ars );
+         const T* a3( A + (i+2UL)*ars );
+         const T* a4( A + (i+3UL)*ars );
+
+         VT xmm1( V::setzero() ), xmm2( V::setzero() ), xmm3( V::setzero() ), xmm4( V::setzero() );
+
+         for( size_t j=0UL; j<jend; j+=S ) {
+            const VT x1( V::load( x+j ) );
+            xmm1 = V::fmadd( V::load( a1+j ), x1, xmm1 );
+            xmm2 = V::fmadd( V::load( a2+j ), x1, xmm2 );
+            xmm3 = V::fmadd( V::load( a3+j ), x1, xmm3 );
+            xmm4 = V::fmadd( V::load( a4+j ), x1, xmm4 );
+         }
+
+         T s1( V::sum( xmm1 ) ), s2( V::sum( xmm2 ) ), s3( V::sum( xmm3 ) ), s4( V::sum( xmm4 ) );
+
+         for( size_t j=jend; j<n; ++j ) {
+            s1 += a1[j] * x[j];
+            s2 += a2[j] * x[j];
+            s3 += a3[j] * x[j];
+            s4 += a4[j] * x[j];
+         }
+
+         if( beta == T(0) ) {
+            y[i    ] = alpha * s1;
+            y[i+1UL] = alpha * s2;
+            y[i+2UL] = alpha * s3;
+            y[i+3UL] = alpha * s4;
+         }
+         else {
+            y[i    ] = beta * y[i    ] + alpha * s1;
+            y[i+1UL] = beta * y[i+1UL] + alpha * s2;
+            y[i+2UL] = beta * y[i+2UL] + alpha * s3;
+            y[i+3UL] = beta * y[i+3UL] + alpha * s4;
+         }
+      }
+
+      for( ; i<m; ++i ) {
+         const T s( dot( n, A+i*ars, x ) );
+         y[i] = ( beta == T(0) )?( alpha * s ):( beta * y[i] + alpha * s );
+      }
+   }
+   else
+   {
+      if( beta == T(0) ) {
+         for( size_t i=0UL; i<m; ++i )
+            y[i] = T(0);
+      }
+      else if( beta != T(1) ) {
+         scale( m, beta, y, y );
+      }
+
+      if( ars != 1UL ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            const T factor( alpha * x[j] );
+            for( size_t i=0UL; i<m; ++i )
+               y[i] += A[i*ars+j*acs] * factor;
+         }
+         return;
+      }
+
+      const size_t iend( m - m % S );
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= n; j+=4UL )
+      {
+         const T* a1( A + (j    )*acs );
+         const T* a2( A + (j+1UL)*acs );
+         const T* a3( A + (j+2UL)*acs );
+         const T* a4( A + (j+3UL)*acs );
+
+         const T f1( alpha * x[j    ] );
+         const T f2( alpha * x[j+1UL] );
+         const T f3( alpha * x[j+2UL] );
+         const T f4( alpha * x[j+3UL] );
+
+         const VT x1( V::set( f1 ) ), x2( V::set( f2 ) ), x3( V::set( f3 ) ), x4( V::set( f4 ) );
+
+         for( size_t i=0UL; i<iend; i+=S ) {
+            VT xmm( V::load( y+i ) );
+            xmm = V::fmadd( V::load( a1+i ), x1, xmm );
+            xmm = V::fmadd( V::load( a2+i ), x2, xmm );
+            xmm = V::fmadd( V::load( a3+i ), x3, xmm );
+            xmm = V::fmadd( V::load( a4+i ), x4, xmm );
+            V::store( y+i, xmm );
+         }
+         for( size_t i=iend; i<m; ++i ) {
+            y[i] += a1[i] * f1 + a2[i] * f2 + a3[i] * f3 + a4[i] * f4;
+         }
+      }
+
+      for( ; j<n; ++j )
+      {
+         const T* a1( A + j*acs );
+         const T f1( alpha * x[j] );
+         const VT x1( V::set( f1 ) );
+
+         for( size_t i=0UL; i<iend; i+=S ) {
+            V::store( y+i, V::fmadd( V::load( a1+i ), x1, V::load( y+i ) ) );
+         }
+         for( size_t i=iend; i<m; ++i ) {
+            y[i] += a1[i] * f1;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packing of a block of the left-hand side operand into panels of \a mr rows.
+*/
+template< typename T >
+void packLeft( T* dst, const T* A, size_t ars, size_t acs,
+               size_t ibegin, size_t iend, size_t kbegin, size_t kend )
+{
+   const size_t mr( Blocking<T>::mr );
+   const size_t kn( kend - kbegin );
+
+   for( size_t i=ibegin; i<iend; i+=mr )
+   {
+      const size_t m( ( mr < iend-i )?( mr ):( iend-i ) );
+
+      if( acs == 1UL ) {
+         for( size_t r=0UL; r<m; ++r ) {
+            const T* a( A + (i+r)*ars + kbegin );
+            for( size_t k=0UL; k<kn; ++k )
+               dst[k*mr+r] = a[k];
+         }
+      }
+      else {
+         for( size_t k=0UL; k<kn; ++k ) {
+            const T* a( A + i*ars + (kbegin+k)*acs );
+            for( size_t r=0UL; r<m; ++r )
+               dst[k*mr+r] = a[r*ars];
+         }
+      }
+
+      for( size_t r=m; r<mr; ++r ) {
+         for( size_t k=0UL; k<kn; ++k )
+            dst[k*mr+r] = T(0);
+      }
+
+      dst += mr*kn;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packing of a block of the right-hand side operand into panels of \a nr columns.
+*/
+template< typename T >
+void packRight( T* dst, const T* B, size_t brs, size_t bcs,
+                size_t kbegin, size_t kend, size_t jbegin, size_t jend )
+{
+   const size_t nr( Blocking<T>::nr );
+   const size_t kn( kend - kbegin );
+
+   for( size_t j=jbegin; j<jend; j+=nr )
+   {
+      const size_t n( ( nr < jend-j )?( nr ):( jend-j ) );
+
+      if( bcs == 1UL ) {
+         for( size_t k=0UL; k<kn; ++k ) {
+            const T* b( B + (kbegin+k)*brs + j );
+            for( size_t c=0UL; c<n; ++c )
+               dst[k*nr+c] = b[c];
+         }
+      }
+      else {
+         for( size_t c=0UL; c<n; ++c ) {
+            const T* b( B + kbegin*brs + (j+c)*bcs );
+            for( size_t k=0UL; k<kn; ++k )
+               dst[k*nr+c] = b[k*brs];
+         }
+      }
+
+      for( size_t k=0UL; k<kn; ++k ) {
+         for( size_t c=n; c<nr; ++c )
+            dst[k*nr+c] = T(0);
+      }
+
+      dst += nr*kn;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Update of a row of a complete tile of the target matrix.
+*/
+template< typename T >
+inline void updateRow( T* c, typename Vec<T>::Type xmm1, typename Vec<T>::Type xmm2,
+                       typename Vec<T>::Type alpha, typename Vec<T>::Type beta, bool overwrite )
+{
+   typedef Vec<T>  V;
+
+   if( overwrite ) {
+      V::store( c        , V::mul( alpha, xmm1 ) );
+      V::store( c+V::size, V::mul( alpha, xmm2 ) );
+   }
+   else {
+      V::store( c        , V::fmadd( alpha, xmm1, V::mul( beta, V::load( c         ) ) ) );
+      V::store( c+V::size, V::fmadd( alpha, xmm2, V::mul( beta, V::load( c+V::size ) ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Register-blocked micro-kernel of the packed matrix multiplication.
+//
+// This function computes the \a mr x \a nr tile \f$ C=\alpha*A*B+\beta*C \f$ from the two
+// given packed panels. Complete tiles with contiguous rows are updated via intrinsic loads
+// and stores, all other tiles are updated element-wise.
+*/
+template< typename T >
+void microKernel( size_t kn, const T* a, const T* b, T* C, size_t crs, size_t ccs,
+                  size_t m, size_t n, T alpha, T beta )
+{
+   typedef Vec<T>             V;
+   typedef typename V::Type  VT;
+
+   const size_t S ( V::size );
+   const size_t mr( Blocking<T>::mr );
+   const size_t nr( Blocking<T>::nr );
+
+   VT xmm1 ( V::setzero() ), xmm2 ( V::setzero() ), xmm3 ( V::setzero() ), xmm4 ( V::setzero() );
+   VT xmm5 ( V::setzero() ), xmm6 ( V::setzero() ), xmm7 ( V::setzero() ), xmm8 ( V::setzero() );
+   VT xmm9 ( V::setzero() ), xmm10( V::setzero() ), xmm11( V::setzero() ), xmm12( V::setzero() );
+
+   for( size_t k=0UL; k<kn; ++k ) {
+      const VT b1( V::load( b   ) );
+      const VT b2( V::load( b+S ) );
+      VT a1;
+      a1 = V::set( a[0] ); xmm1  = V::fmadd( a1, b1, xmm1  ); xmm2  = V::fmadd( a1, b2, xmm2  );
+      a1 = V::set( a[1] ); xmm3  = V::fmadd( a1, b1, xmm3  ); xmm4  = V::fmadd( a1, b2, xmm4  );
+      a1 = V::set( a[2] ); xmm5  = V::fmadd( a1, b1, xmm5  ); xmm6  = V::fmadd( a1, b2, xmm6  );
+      a1 = V::set( a[3] ); xmm7  = V::fmadd( a1, b1, xmm7  ); xmm8  = V::fmadd( a1, b2, xmm8  );
+      a1 = V::set( a[4] ); xmm9  = V::fmadd( a1, b1, xmm9  ); xmm10 = V::fmadd( a1, b2, xmm10 );
+      a1 = V::set( a[5] ); xmm11 = V::fmadd( a1, b1, xmm11 ); xmm12 = V::fmadd( a1, b2, xmm12 );
+      a += mr;
+      b += nr;
+   }
+
+   const bool overwrite( beta == T(0) );
+
+   if( m == mr && n == nr && ccs == 1UL )
+   {
+      const VT factor1( V::set( alpha ) );
+      const VT factor2( V::set( beta  ) );
+
+      updateRow<T>( C        , xmm1 , xmm2 , factor1, factor2, overwrite );
+      updateRow<T>( C+crs    , xmm3 , xmm4 , factor1, factor2, overwrite );
+      updateRow<T>( C+crs*2UL, xmm5 , xmm6 , factor1, factor2, overwrite );
+      updateRow<T>( C+crs*3UL, xmm7 , xmm8 , factor1, factor2, overwrite );
+      updateRow<T>( C+crs*4UL, xmm9 , xmm10, factor1, factor2, overwrite );
+      updateRow<T>( C+crs*5UL, xmm11, xmm12, factor1, factor2, overwrite );
+   }
+   else
+   {
+      T tile[Blocking<T>::mr*Blocking<T>::nr];
+
+      V::store( tile        , xmm1  ); V::store( tile+S        , xmm2  );
+      V::store( tile+nr     , xmm3  ); V::store( tile+nr+S     , xmm4  );
+      V::store( tile+nr*2UL , xmm5  ); V::store( tile+nr*2UL+S , xmm6  );
+      V::store( tile+nr*3UL , xmm7  ); V::store( tile+nr*3UL+S , xmm8  );
+      V::store( tile+nr*4UL , xmm9  ); V::store( tile+nr*4UL+S , xmm10 );
+      V::store( tile+nr*5UL , xmm11 ); V::store( tile+nr*5UL+S , xmm12 );
+
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c ) {
+            T& element( C[r*crs+c*ccs] );
+            element = ( overwrite )?( alpha * tile[r*nr+c] )
+                                   :( beta * element + alpha * tile[r*nr+c] );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cache-blocked, packed matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+//
+// The vectorization runs along the rows of \a C. In case the columns of \a C are contiguous,
+// the transpose product \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ is computed instead. In case
+// \a beta is zero, the initial values of \a C are not accessed.
+*/
+template< typename T >
+void gemm( size_t m, size_t n, size_t k, T alpha,
+           const T* A, size_t ars, size_t acs, const T* B, size_t brs, size_t bcs,
+           T beta, T* C, size_t crs, size_t ccs )
+{
+   if( ccs != 1UL && crs == 1UL ) {
+      gemm( n, m, k, alpha, B, bcs, brs, A, acs, ars, beta, C, ccs, crs );
+      return;
+   }
+
+   if( m == 0UL || n == 0UL ) {
+      return;
+   }
+
+   if( k == 0UL ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            T& element( C[i*crs+j*ccs] );
+            element = ( beta == T(0) )?( T(0) ):( beta * element );
+         }
+      }
+      return;
+   }
+
+   const size_t mr( Blocking<T>::mr );
+   const size_t nr( Blocking<T>::nr );
+   const size_t mc( ( Blocking<T>::mc < m - m % mr + mr )?( Blocking<T>::mc ):( m - m % mr + mr ) );
+   const size_t nc( ( Blocking<T>::nc < n - n % nr + nr )?( Blocking<T>::nc ):( n - n % nr + nr ) );
+   const size_t kc( ( Blocking<T>::kc < k )?( Blocking<T>::kc ):( k ) );
+
+   UniqueArray<T,Deallocate> apack( allocate<T>( mc*kc ) );
+   UniqueArray<T,Deallocate> bpack( allocate<T>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<n; jj+=nc )
+   {
+      const size_t jend( ( jj+nc < n )?( jj+nc ):( n ) );
+
+      for( size_t kk=0UL; kk<k; kk+=kc )
+      {
+         const size_t kend( ( kk+kc < k )?( kk+kc ):( k ) );
+         const size_t kn( kend - kk );
+         const T factor( ( kk == 0UL )?( beta ):( T(1) ) );
+
+         packRight( bpack.get(), B, brs, bcs, kk, kend, jj, jend );
+
+         for( size_t ii=0UL; ii<m; ii+=mc )
+         {
+            const size_t iend( ( ii+mc < m )?( ii+mc ):( m ) );
+
+            packLeft( apack.get(), A, ars, acs, ii, iend, kk, kend );
+
+            for( size_t j=jj; j<jend; j+=nr ) {
+               const T* const b( bpack.get() + ( j - jj ) * kn );
+               for( size_t i=ii; i<iend; i+=mr ) {
+                  const T* const a( apack.get() + ( i - ii ) * kn );
+                  microKernel( kn, a, b, C+i*crs+j*ccs, crs, ccs,
+                               ( mr < iend-i )?( mr ):( iend-i ),
+                               ( nr < jend-j )?( nr ):( jend-j ), alpha, factor );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The kernel table of the instruction set.
+*/
+const KernelTable kernels = {
+   &gemm<float> , &gemm<double> ,
+   &gemv<float> , &gemv<double> ,
+   &dot<float>  , &dot<double>  ,
+   &add<float>  , &add<double>  ,
+   &sub<float>  , &sub<double>  ,
+   &mult<float> , &mult<double> ,
+   &scale<float>, &scale<double>
+};
+//*************************************************************************************************